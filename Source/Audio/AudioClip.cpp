@@ -8,7 +8,7 @@
 
 #include "Importer/WavAudioDecoder.h"
 #include "Importer/VorbisAudioDecoder.h"
-#include "IO/File.h"
+#include "IO/MemoryMappedFile.h"
 
 #include "AudioClip.h"
 
@@ -109,18 +109,19 @@ AudioClip& AudioClip::operator=(AudioClip&& rhs) noexcept
     return *this;
 }
 
-std::shared_ptr<AudioClip> AudioClip::Create(const char8_t* filePath)
+Ref<AudioClip> AudioClip::Create(const char8_t* filePath)
 {
-    auto fileData = File::ReadAllBytes(filePath, ReturnVectorTag{});
-    if (fileData.has_value() == false)
+    // The decoder reads the file from the beginning to the end once, so it's decoded straight out of the page cache.
+    const auto mappedFile = MemoryMappedFile::Open(filePath, MemoryAdvice::Sequential | MemoryAdvice::WillNeed);
+    if (mappedFile.has_value() == false)
     {
         return {};
     }
 
-    return Create(*fileData);
+    return Create(mappedFile->GetView());
 }
 
-std::shared_ptr<AudioClip> AudioClip::Create(const std::span<const std::byte>& fileData)
+Ref<AudioClip> AudioClip::Create(const std::span<const std::byte>& fileData)
 {
     AudioFormat audioFormat = AudioFormat::Unknown;
     if (WavAudioDecoder::IsWav(fileData))
@@ -139,7 +140,7 @@ std::shared_ptr<AudioClip> AudioClip::Create(const std::span<const std::byte>& f
     return Create(fileData, audioFormat);
 }
 
-std::shared_ptr<AudioClip> AudioClip::Create(const std::span<const std::byte>& fileData, AudioFormat audioFormat)
+Ref<AudioClip> AudioClip::Create(const std::span<const std::byte>& fileData, AudioFormat audioFormat)
 {
     std::shared_ptr<std::byte> audioData;
     int32_t audioDataBytes = 0;
@@ -180,7 +181,7 @@ std::shared_ptr<AudioClip> AudioClip::Create(const std::span<const std::byte>& f
         }
     }
 
-    return std::make_shared<AudioClip>(std::move(audioData), audioDataBytes, bitsPerSample, channels, samplingRate);
+    return MakeRef<AudioClip>(std::move(audioData), audioDataBytes, bitsPerSample, channels, samplingRate);
 }
 
 int32_t AudioClip::GetBitsPerSample() const noexcept
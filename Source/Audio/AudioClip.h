@@ -3,6 +3,8 @@
 #include <span>
 #include <memory>
 
+#include "Core/RefCounted.h"
+
 typedef unsigned int ALuint;
 
 namespace tg
@@ -19,7 +21,8 @@ enum class AudioFormat
     Opus,
 };
 
-class AudioClip final
+class AudioClip final :
+    public RefCounted<AudioClip>
 {
     friend class AudioSource;
 
@@ -40,9 +43,9 @@ public:
 
 /**@section Method */
 public:
-    static std::shared_ptr<AudioClip> Create(const char8_t* path);
-    static std::shared_ptr<AudioClip> Create(const std::span<const std::byte>& audioData);
-    static std::shared_ptr<AudioClip> Create(const std::span<const std::byte>& audioData, AudioFormat audioFormat);
+    static Ref<AudioClip> Create(const char8_t* path);
+    static Ref<AudioClip> Create(const std::span<const std::byte>& audioData);
+    static Ref<AudioClip> Create(const std::span<const std::byte>& audioData, AudioFormat audioFormat);
     [[nodiscard]] int32_t GetBitsPerSample() const noexcept;
     [[nodiscard]] int32_t GetChannels() const noexcept;
     [[nodiscard]] int32_t GetSamplingRate() const noexcept;
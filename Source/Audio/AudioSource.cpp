@@ -83,13 +83,13 @@ void AudioSource::UnPause()
     TGON_AL_ERROR_CHECK(alSourcePlay(m_alSource))
 }
 
-void AudioSource::SetClip(const std::shared_ptr<AudioClip>& audioBuffer)
+void AudioSource::SetClip(const Ref<AudioClip>& audioBuffer)
 {
     TGON_AL_ERROR_CHECK(alSourcei(m_alSource, AL_BUFFER, audioBuffer->GetNativeBuffer()));
     m_audioClip = audioBuffer;
 }
 
-void AudioSource::SetClip(std::shared_ptr<AudioClip>&& audioBuffer)
+void AudioSource::SetClip(Ref<AudioClip>&& audioBuffer)
 {
     TGON_AL_ERROR_CHECK(alSourcei(m_alSource, AL_BUFFER, audioBuffer->GetNativeBuffer()));
     m_audioClip = std::move(audioBuffer);
@@ -164,14 +164,14 @@ float AudioSource::GetPitch() const
     return pitch;
 }
 
-std::shared_ptr<AudioClip> AudioSource::GetClip() noexcept
+AudioClip* AudioSource::GetClip() noexcept
 {
-    return std::shared_ptr<AudioClip>();
+    return m_audioClip.Get();
 }
 
-std::shared_ptr<const AudioClip> AudioSource::GetClip() const noexcept
+const AudioClip* AudioSource::GetClip() const noexcept
 {
-    return std::shared_ptr<const AudioClip>();
+    return m_audioClip.Get();
 }
 
 void AudioSource::SetLoop(bool isLoop)
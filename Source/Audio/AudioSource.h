@@ -3,6 +3,8 @@
 #include <optional>
 #include <memory>
 
+#include "Core/RefCounted.h"
+
 typedef unsigned int ALuint;
 
 namespace tg
@@ -34,8 +36,8 @@ public:
     void Stop();
     void Pause();
     void UnPause();
-    void SetClip(const std::shared_ptr<AudioClip>& audioBuffer);
-    void SetClip(std::shared_ptr<AudioClip>&& audioBuffer);
+    void SetClip(const Ref<AudioClip>& audioBuffer);
+    void SetClip(Ref<AudioClip>&& audioBuffer);
     void SetVolume(float volume);
     void SetPosition(float x, float y, float z);
     void SetVelocity(float x, float y, float z);
@@ -48,15 +50,15 @@ public:
     [[nodiscard]] float GetProgressInSeconds() const;
     [[nodiscard]] float GetTotalProgressInSeconds() const;
     [[nodiscard]] float GetPitch() const;
-    [[nodiscard]] std::shared_ptr<AudioClip> GetClip() noexcept;
-    [[nodiscard]] std::shared_ptr<const AudioClip> GetClip() const noexcept;
+    [[nodiscard]] AudioClip* GetClip() noexcept;
+    [[nodiscard]] const AudioClip* GetClip() const noexcept;
     [[nodiscard]] bool IsLoop() const;
     [[nodiscard]] bool IsPlaying() const;
 
 /**@section Variable */
 private:
     ALuint m_alSource;
-    std::shared_ptr<AudioClip> m_audioClip;
+    Ref<AudioClip> m_audioClip;
 };
 
 }
@@ -0,0 +1,163 @@
+#include "PrecompiledHeader.h"
+
+#if TGON_SIMD_SSE2
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
+#include "CpuFeature.h"
+
+namespace tg
+{
+namespace
+{
+
+struct CpuFeatureFlags
+{
+    bool hasSse2;
+    bool hasSse41;
+    bool hasAvx2;
+    bool hasFma;
+    bool hasF16c;
+    bool hasNeon;
+};
+
+CpuFeatureFlags DetectCpuFeatureFlags() noexcept
+{
+    CpuFeatureFlags flags{};
+
+#if TGON_SIMD_SSE2
+#   if defined(_MSC_VER)
+    int32_t registers[4];
+    __cpuid(registers, 0);
+    const auto maxLeaf = registers[0];
+
+    __cpuid(registers, 1);
+    const auto leaf1Ecx = static_cast<uint32_t>(registers[2]);
+    const auto leaf1Edx = static_cast<uint32_t>(registers[3]);
+
+    uint32_t leaf7Ebx = 0;
+    if (maxLeaf >= 7)
+    {
+        __cpuidex(registers, 7, 0);
+        leaf7Ebx = static_cast<uint32_t>(registers[1]);
+    }
+#   else
+    uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
+    const auto maxLeaf = __get_cpuid_max(0, nullptr);
+
+    __get_cpuid(1, &eax, &ebx, &ecx, &edx);
+    const auto leaf1Ecx = ecx;
+    const auto leaf1Edx = edx;
+
+    uint32_t leaf7Ebx = 0;
+    if (maxLeaf >= 7)
+    {
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        leaf7Ebx = ebx;
+    }
+#   endif
+
+    flags.hasSse2 = (leaf1Edx & (1u << 26)) != 0;
+    flags.hasSse41 = (leaf1Ecx & (1u << 19)) != 0;
+
+    // The AVX registers can be used only if the OS saves them on context switches, which is reported through XCR0.
+    const auto hasOsxsave = (leaf1Ecx & (1u << 27)) != 0;
+    const auto hasAvx = (leaf1Ecx & (1u << 28)) != 0;
+    bool isAvxStateEnabled = false;
+    if (hasOsxsave && hasAvx)
+    {
+#   if defined(_MSC_VER)
+        const auto xcr0 = _xgetbv(0);
+#   else
+        uint32_t xcr0Low = 0, xcr0High = 0;
+        __asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+        const auto xcr0 = (static_cast<uint64_t>(xcr0High) << 32) | xcr0Low;
+#   endif
+        isAvxStateEnabled = (xcr0 & 0x6) == 0x6;
+    }
+
+    flags.hasAvx2 = isAvxStateEnabled && (leaf7Ebx & (1u << 5)) != 0;
+    flags.hasFma = isAvxStateEnabled && (leaf1Ecx & (1u << 12)) != 0;
+    flags.hasF16c = isAvxStateEnabled && (leaf1Ecx & (1u << 29)) != 0;
+#elif TGON_SIMD_NEON
+    flags.hasNeon = true;
+#endif
+
+    return flags;
+}
+
+const CpuFeatureFlags& GetCpuFeatureFlags() noexcept
+{
+    static const CpuFeatureFlags flags = DetectCpuFeatureFlags();
+    return flags;
+}
+
+}
+
+bool CpuFeature::HasSse2() noexcept
+{
+    return GetCpuFeatureFlags().hasSse2;
+}
+
+bool CpuFeature::HasSse41() noexcept
+{
+    return GetCpuFeatureFlags().hasSse41;
+}
+
+bool CpuFeature::HasAvx2() noexcept
+{
+    return GetCpuFeatureFlags().hasAvx2;
+}
+
+bool CpuFeature::HasFma() noexcept
+{
+    return GetCpuFeatureFlags().hasFma;
+}
+
+bool CpuFeature::HasF16c() noexcept
+{
+    return GetCpuFeatureFlags().hasF16c;
+}
+
+bool CpuFeature::HasNeon() noexcept
+{
+    return GetCpuFeatureFlags().hasNeon;
+}
+
+bool CpuFeature::IsSupported(SimdLevel level) noexcept
+{
+    switch (level)
+    {
+    case SimdLevel::Scalar:
+        return true;
+    case SimdLevel::Sse2:
+        return HasSse2();
+    case SimdLevel::Sse41:
+        return HasSse41();
+    case SimdLevel::Avx2:
+        return HasAvx2() && HasFma() && HasF16c();
+    case SimdLevel::Neon:
+        return HasNeon();
+    }
+
+    return false;
+}
+
+SimdLevel CpuFeature::GetSimdLevel() noexcept
+{
+    for (auto level : {SimdLevel::Avx2, SimdLevel::Sse41, SimdLevel::Sse2, SimdLevel::Neon})
+    {
+        if (IsSupported(level))
+        {
+            return level;
+        }
+    }
+
+    return SimdLevel::Scalar;
+}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+namespace tg
+{
+
+enum class SimdLevel
+{
+    Scalar,
+    Sse2,
+    Sse41,
+    Avx2,
+    Neon,
+};
+
+/**
+ * @brief   Queries the instruction sets which are supported by the running processor.
+ * @remark  The result is detected once and cached, so the queries are cheap enough to be called on hot paths.
+ */
+class CpuFeature final
+{
+/**@section Constructor */
+public:
+    CpuFeature() = delete;
+
+/**@section Method */
+public:
+    [[nodiscard]] static bool HasSse2() noexcept;
+    [[nodiscard]] static bool HasSse41() noexcept;
+    [[nodiscard]] static bool HasAvx2() noexcept;
+    [[nodiscard]] static bool HasFma() noexcept;
+    [[nodiscard]] static bool HasF16c() noexcept;
+    [[nodiscard]] static bool HasNeon() noexcept;
+
+    /**
+     * @brief   Checks whether the processor can run the code which is built for the specified level.
+     * @param level     The SIMD level.
+     */
+    [[nodiscard]] static bool IsSupported(SimdLevel level) noexcept;
+
+    /**
+     * @brief   Gets the highest SIMD level which is supported by the processor.
+     * @remark  Avx2 also requires FMA and F16C, because the AVX2 code paths are always built with them.
+     */
+    [[nodiscard]] static SimdLevel GetSimdLevel() noexcept;
+};
+
+}
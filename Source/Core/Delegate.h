@@ -3,6 +3,7 @@
 #include <array>
 #include <type_traits>
 
+#include "PoolAllocator.h"
 #include "TypeTraits.h"
 
 namespace tg
@@ -203,7 +204,7 @@ Delegate<_Return(_Types...)>::Delegate(_Function function) :
     using FunctionType = std::decay_t<_Function>;
     if constexpr (Delegate::template IsLargeFunction<FunctionType>())
     {
-        m_functor = static_cast<Functor*>(operator new(sizeof(FunctorImpl<FunctionType>)));
+        m_functor = static_cast<Functor*>(SmallObjectAllocator::Allocate(sizeof(FunctorImpl<FunctionType>)));
     }
     else
     {
@@ -221,7 +222,7 @@ Delegate<_Return(_Types...)>::Delegate(_Function function, void* receiver) :
     using FunctionType = std::decay_t<_Function>;
     if constexpr (Delegate::template IsLargeFunction<FunctionType>())
     {
-        m_functor = static_cast<Functor*>(operator new(sizeof(FunctorImpl<FunctionType>)));
+        m_functor = static_cast<Functor*>(SmallObjectAllocator::Allocate(sizeof(FunctorImpl<FunctionType>)));
     }
     else
     {
@@ -306,7 +307,7 @@ void Delegate<_Return(_Types...)>::Copy(const Delegate& rhs)
         return;
     }
 
-    m_functor = static_cast<Functor*>(rhs.IsDynamicAllocated() ? operator new(rhs.m_functor->GetSize()) : &m_storage[0]);
+    m_functor = static_cast<Functor*>(rhs.IsDynamicAllocated() ? SmallObjectAllocator::Allocate(rhs.m_functor->GetSize()) : &m_storage[0]);
 
     rhs.m_functor->CopyTo(m_functor);
 }
@@ -343,11 +344,12 @@ void Delegate<_Return(_Types...)>::Destroy()
         return;
     }
 
+    const auto functorSize = m_functor->GetSize();
     m_functor->Destroy();
 
     if (this->IsDynamicAllocated())
     {
-        operator delete(m_functor);
+        SmallObjectAllocator::Deallocate(m_functor, functorSize);
     }
 
     m_storage = {};
@@ -16,17 +16,14 @@ _CastTo DynamicCast(_CastFrom&& ptr) noexcept
 template <typename _CastTo, typename _CastFrom, std::enable_if_t<!std::is_convertible_v<_CastFrom, _CastTo>>* = nullptr>
 _CastTo DynamicCast(_CastFrom&& ptr) noexcept
 {
-    const Rtti* rtti = ptr->GetRTTI();
-    while (rtti != nullptr)
+    if (ptr == nullptr)
     {
-        if (rtti == GetRtti<_CastTo>())
-        {
-            return reinterpret_cast<_CastTo>(std::forward<_CastFrom>(ptr));
-        }
-        else
-        {
-            rtti = rtti->GetSuperRtti();
-        }
+        return nullptr;
+    }
+
+    if (ptr->GetRtti()->IsA(GetRtti<_CastTo>()))
+    {
+        return static_cast<_CastTo>(std::forward<_CastFrom>(ptr));
     }
     
     return nullptr;
@@ -0,0 +1,70 @@
+#include "PrecompiledHeader.h"
+
+#include "EventBus.h"
+
+namespace tg
+{
+
+EventBus::~EventBus()
+{
+    auto* postedEvent = m_postedEvents.exchange(nullptr, std::memory_order_acquire);
+    while (postedEvent != nullptr)
+    {
+        std::exchange(postedEvent, postedEvent->next)->Destroy();
+    }
+}
+
+bool EventBus::Unsubscribe(const EventHandle& handle)
+{
+    if (handle.eventTypeIndex >= m_channels.size() || m_channels[handle.eventTypeIndex] == nullptr)
+    {
+        return false;
+    }
+
+    return m_channels[handle.eventTypeIndex]->Unsubscribe(handle);
+}
+
+void EventBus::DispatchQueuedEvents()
+{
+    // The handler can't dispatch the queued events again, because the list of the types is being iterated.
+    if (m_isDispatching)
+    {
+        return;
+    }
+
+    this->EnqueuePostedEvents();
+
+    m_isDispatching = true;
+    std::swap(m_queuedEventTypeIndices, m_dispatchingEventTypeIndices);
+    for (auto eventTypeIndex : m_dispatchingEventTypeIndices)
+    {
+        m_channels[eventTypeIndex]->DispatchQueuedEvents();
+    }
+    m_dispatchingEventTypeIndices.clear();
+    m_isDispatching = false;
+}
+
+void EventBus::EnqueuePostedEvents()
+{
+    auto* postedEvent = m_postedEvents.exchange(nullptr, std::memory_order_acquire);
+
+    // The list is pushed at the front, so it's reversed to enqueue the events in the order in which they were posted.
+    PostedEvent* reversedPostedEvent = nullptr;
+    while (postedEvent != nullptr)
+    {
+        auto* nextPostedEvent = postedEvent->next;
+        postedEvent->next = reversedPostedEvent;
+        reversedPostedEvent = postedEvent;
+        postedEvent = nextPostedEvent;
+    }
+
+    while (reversedPostedEvent != nullptr)
+    {
+        auto* nextPostedEvent = reversedPostedEvent->next;
+        reversedPostedEvent->Enqueue(*this);
+        reversedPostedEvent->Destroy();
+        reversedPostedEvent = nextPostedEvent;
+    }
+}
+
+}
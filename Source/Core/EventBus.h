@@ -0,0 +1,430 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "InplaceDelegate.h"
+#include "NonCopyable.h"
+#include "ObjectPool.h"
+#include "PoolAllocator.h"
+#include "TypeId.h"
+
+namespace tg
+{
+
+class EventBus;
+
+/**
+ * @brief   The handle of a subscription, which unsubscribes the handler in O(1).
+ */
+struct EventHandle
+{
+/**@section Operator */
+public:
+    constexpr bool operator==(const EventHandle& rhs) const noexcept = default;
+
+/**@section Method */
+public:
+    [[nodiscard]] constexpr bool IsNull() const noexcept;
+
+/**@section Variable */
+public:
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+    uint32_t eventTypeIndex = InvalidIndex;
+    uint32_t index = InvalidIndex;
+    uint32_t generation = 0;
+};
+
+namespace detail
+{
+
+class EventChannelBase
+{
+/**@section Destructor */
+public:
+    virtual ~EventChannelBase() = default;
+
+/**@section Method */
+public:
+    virtual bool Unsubscribe(const EventHandle& handle) = 0;
+    virtual void DispatchQueuedEvents() = 0;
+};
+
+}
+
+/**
+ * @brief   The handlers of a single event type.
+ * @remark  The handlers can subscribe or unsubscribe while the event is being published. The handlers which are
+ *          subscribed during the publish are called from the next one, and the unsubscribed handlers are never called
+ *          again, but they are destroyed after the publish because one of them could be running.
+ *          The order of the calls is not the order of the subscriptions, because the freed slots are reused.
+ */
+template <typename _Event>
+class EventChannel final :
+    public detail::EventChannelBase
+{
+/**@section Type */
+public:
+    using EventType = _Event;
+    using Handler = InplaceDelegate<void(const _Event&)>;
+
+private:
+    struct Subscriber
+    {
+        Handler handler;
+        uint32_t subscribedPublishCount;
+        bool isRemoved;
+    };
+
+/**@section Constructor */
+public:
+    EventChannel() = default;
+    EventChannel(EventChannel&& rhs) noexcept = default;
+
+/**@section Operator */
+public:
+    EventChannel& operator=(EventChannel&& rhs) noexcept = default;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Adds the handler of the event.
+     * @param handler   The handler which is called with the published event.
+     * @return  The handle to unsubscribe the handler.
+     */
+    EventHandle Subscribe(Handler handler);
+
+    /**
+     * @brief   Removes the handler of the event.
+     * @param handle    The handle which was returned by Subscribe.
+     * @return  True if the handler was removed, false if it was already removed.
+     */
+    bool Unsubscribe(const EventHandle& handle) override;
+
+    /**
+     * @brief   Calls every handler with the event immediately.
+     */
+    void Publish(const _Event& event);
+
+    /**
+     * @brief   Stores the event until DispatchQueuedEvents is called.
+     */
+    void Enqueue(_Event event);
+
+    /**
+     * @brief   Publishes the queued events in the order in which they were queued.
+     * @remark  The events which are queued by the handlers are published on the next call.
+     */
+    void DispatchQueuedEvents() override;
+
+    [[nodiscard]] bool IsSubscribed(const EventHandle& handle) const noexcept;
+    [[nodiscard]] size_t GetSubscriberCount() const noexcept;
+    [[nodiscard]] size_t GetQueuedEventCount() const noexcept;
+
+private:
+    [[nodiscard]] static PoolHandle<Subscriber> ToPoolHandle(const EventHandle& handle) noexcept;
+
+/**@section Variable */
+private:
+    ObjectPool<Subscriber, 32> m_subscribers;
+    std::vector<PoolHandle<Subscriber>> m_removedSubscribers;
+    std::vector<_Event> m_queuedEvents;
+    std::vector<_Event> m_dispatchingEvents;
+    uint32_t m_publishCount = 0;
+    int32_t m_publishDepth = 0;
+};
+
+/**
+ * @brief   Delivers the events to the handlers which are subscribed by the event type.
+ * @remark  The events can be published immediately, or queued and dispatched together once per frame, grouped by the
+ *          event type. The other threads can post the events without a lock, and they are queued on the thread which
+ *          dispatches the queued events.
+ *          Except for Post, the methods must be called on the thread which owns the bus.
+ */
+class EventBus final :
+    private NonCopyable
+{
+/**@section Struct */
+private:
+    struct PostedEvent
+    {
+        virtual ~PostedEvent() = default;
+
+        virtual void Enqueue(EventBus& eventBus) = 0;
+        virtual void Destroy() noexcept = 0;
+
+        PostedEvent* next = nullptr;
+    };
+
+    template <typename _Event>
+    struct PostedEventImpl final :
+        PostedEvent
+    {
+        explicit PostedEventImpl(_Event event) noexcept(std::is_nothrow_move_constructible_v<_Event>);
+
+        void Enqueue(EventBus& eventBus) override;
+        void Destroy() noexcept override;
+
+        _Event event;
+    };
+
+/**@section Constructor */
+public:
+    EventBus() = default;
+
+/**@section Destructor */
+public:
+    ~EventBus();
+
+/**@section Method */
+public:
+    /**
+     * @brief   Adds the handler of the specified event type.
+     * @param handler   The handler which is called with the published event.
+     * @return  The handle to unsubscribe the handler.
+     */
+    template <typename _Event>
+    EventHandle Subscribe(typename EventChannel<_Event>::Handler handler);
+
+    /**
+     * @brief   Removes the handler.
+     * @param handle    The handle which was returned by Subscribe.
+     * @return  True if the handler was removed, false if it was already removed.
+     */
+    bool Unsubscribe(const EventHandle& handle);
+
+    /**
+     * @brief   Calls every handler of the event type immediately.
+     */
+    template <typename _Event>
+    void Publish(const _Event& event);
+
+    /**
+     * @brief   Stores the event until DispatchQueuedEvents is called.
+     */
+    template <typename _Event>
+    void Enqueue(_Event event);
+
+    /**
+     * @brief   Stores the event from any thread until DispatchQueuedEvents is called.
+     * @remark  The event is pushed into a lock-free list, and moved into the queue on the thread which dispatches.
+     */
+    template <typename _Event>
+    void Post(_Event event);
+
+    /**
+     * @brief   Publishes the queued and posted events, grouped by the event type.
+     * @remark  The types are dispatched in the order in which their first event was queued, and the events of a type
+     *          are dispatched in the order in which they were queued.
+     */
+    void DispatchQueuedEvents();
+
+    template <typename _Event>
+    [[nodiscard]] EventChannel<_Event>& GetChannel();
+
+private:
+    void EnqueuePostedEvents();
+
+/**@section Variable */
+private:
+    // Indexed by TypeId<EventBus>.
+    std::vector<std::unique_ptr<detail::EventChannelBase>> m_channels;
+    std::vector<uint32_t> m_queuedEventTypeIndices;
+    std::vector<uint32_t> m_dispatchingEventTypeIndices;
+    std::atomic<PostedEvent*> m_postedEvents = nullptr;
+    bool m_isDispatching = false;
+};
+
+constexpr bool EventHandle::IsNull() const noexcept
+{
+    return index == InvalidIndex;
+}
+
+template <typename _Event>
+EventHandle EventChannel<_Event>::Subscribe(Handler handler)
+{
+    // Tag the subscriber with the current publish, so that it isn't called if the publish is still running.
+    const auto poolHandle = m_subscribers.Create(Subscriber{std::move(handler), m_publishCount, false});
+    return EventHandle{TypeId<EventBus>::Get<_Event>(), poolHandle.index, poolHandle.generation};
+}
+
+template <typename _Event>
+bool EventChannel<_Event>::Unsubscribe(const EventHandle& handle)
+{
+    if (handle.eventTypeIndex != TypeId<EventBus>::Get<_Event>())
+    {
+        return false;
+    }
+
+    const auto poolHandle = ToPoolHandle(handle);
+    auto* subscriber = m_subscribers.Get(poolHandle);
+    if (subscriber == nullptr || subscriber->isRemoved)
+    {
+        return false;
+    }
+
+    if (m_publishDepth > 0)
+    {
+        subscriber->isRemoved = true;
+        m_removedSubscribers.push_back(poolHandle);
+        return true;
+    }
+
+    return m_subscribers.Destroy(poolHandle);
+}
+
+template <typename _Event>
+void EventChannel<_Event>::Publish(const _Event& event)
+{
+    if (m_publishDepth++ == 0)
+    {
+        ++m_publishCount;
+    }
+
+    const auto publishCount = m_publishCount;
+    m_subscribers.ForEach(0, m_subscribers.GetCapacity(), [&](Subscriber& subscriber)
+    {
+        if (subscriber.isRemoved == false && subscriber.subscribedPublishCount != publishCount)
+        {
+            subscriber.handler(event);
+        }
+    });
+
+    if (--m_publishDepth == 0)
+    {
+        for (const auto& poolHandle : m_removedSubscribers)
+        {
+            m_subscribers.Destroy(poolHandle);
+        }
+        m_removedSubscribers.clear();
+    }
+}
+
+template <typename _Event>
+void EventChannel<_Event>::Enqueue(_Event event)
+{
+    m_queuedEvents.push_back(std::move(event));
+}
+
+template <typename _Event>
+void EventChannel<_Event>::DispatchQueuedEvents()
+{
+    // The handler can't dispatch the events of its own channel again.
+    if (m_dispatchingEvents.empty() == false)
+    {
+        return;
+    }
+
+    // Both buffers keep their capacity, so queueing the events doesn't allocate after the first frames.
+    std::swap(m_queuedEvents, m_dispatchingEvents);
+    for (const auto& event : m_dispatchingEvents)
+    {
+        this->Publish(event);
+    }
+    m_dispatchingEvents.clear();
+}
+
+template <typename _Event>
+bool EventChannel<_Event>::IsSubscribed(const EventHandle& handle) const noexcept
+{
+    const auto* subscriber = m_subscribers.Get(ToPoolHandle(handle));
+    return handle.eventTypeIndex == TypeId<EventBus>::Get<_Event>() && subscriber != nullptr && subscriber->isRemoved == false;
+}
+
+template <typename _Event>
+size_t EventChannel<_Event>::GetSubscriberCount() const noexcept
+{
+    return m_subscribers.GetSize() - m_removedSubscribers.size();
+}
+
+template <typename _Event>
+size_t EventChannel<_Event>::GetQueuedEventCount() const noexcept
+{
+    return m_queuedEvents.size();
+}
+
+template <typename _Event>
+PoolHandle<typename EventChannel<_Event>::Subscriber> EventChannel<_Event>::ToPoolHandle(const EventHandle& handle) noexcept
+{
+    return PoolHandle<Subscriber>{handle.index, handle.generation};
+}
+
+template <typename _Event>
+EventBus::PostedEventImpl<_Event>::PostedEventImpl(_Event event) noexcept(std::is_nothrow_move_constructible_v<_Event>) :
+    event(std::move(event))
+{
+}
+
+template <typename _Event>
+void EventBus::PostedEventImpl<_Event>::Enqueue(EventBus& eventBus)
+{
+    eventBus.Enqueue(std::move(event));
+}
+
+template <typename _Event>
+void EventBus::PostedEventImpl<_Event>::Destroy() noexcept
+{
+    this->~PostedEventImpl();
+    PoolMemoryResource::GetInstance()->deallocate(this, sizeof(PostedEventImpl), alignof(PostedEventImpl));
+}
+
+template <typename _Event>
+EventHandle EventBus::Subscribe(typename EventChannel<_Event>::Handler handler)
+{
+    return this->GetChannel<_Event>().Subscribe(std::move(handler));
+}
+
+template <typename _Event>
+void EventBus::Publish(const _Event& event)
+{
+    this->GetChannel<_Event>().Publish(event);
+}
+
+template <typename _Event>
+void EventBus::Enqueue(_Event event)
+{
+    auto& channel = this->GetChannel<_Event>();
+    if (channel.GetQueuedEventCount() == 0)
+    {
+        m_queuedEventTypeIndices.push_back(TypeId<EventBus>::Get<_Event>());
+    }
+
+    channel.Enqueue(std::move(event));
+}
+
+template <typename _Event>
+void EventBus::Post(_Event event)
+{
+    // The pool allocator keeps a cache per thread, so the posting threads don't contend for the memory either.
+    auto* postedEvent = new (PoolMemoryResource::GetInstance()->allocate(sizeof(PostedEventImpl<_Event>), alignof(PostedEventImpl<_Event>))) PostedEventImpl<_Event>(std::move(event));
+
+    // The release publishes the event to the thread which takes the list.
+    postedEvent->next = m_postedEvents.load(std::memory_order_relaxed);
+    while (m_postedEvents.compare_exchange_weak(postedEvent->next, postedEvent, std::memory_order_release, std::memory_order_relaxed) == false)
+    {
+    }
+}
+
+template <typename _Event>
+EventChannel<_Event>& EventBus::GetChannel()
+{
+    const auto eventTypeIndex = TypeId<EventBus>::Get<_Event>();
+    if (eventTypeIndex >= m_channels.size())
+    {
+        m_channels.resize(eventTypeIndex + 1);
+    }
+
+    auto& channel = m_channels[eventTypeIndex];
+    if (channel == nullptr)
+    {
+        channel = std::make_unique<EventChannel<_Event>>();
+    }
+
+    return static_cast<EventChannel<_Event>&>(*channel);
+}
+
+}
@@ -0,0 +1,995 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if TGON_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace tg
+{
+namespace detail
+{
+
+/**
+ * @brief   The bits of the slots which matched in a group.
+ */
+template <size_t _Shift>
+class FlatHashBitMask
+{
+/**@section Constructor */
+public:
+    constexpr explicit FlatHashBitMask(uint64_t mask) noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] constexpr bool HasAny() const noexcept;
+
+    /**
+     * @brief   Gets the offset of the first matched slot in the group.
+     */
+    [[nodiscard]] constexpr size_t GetLowest() const noexcept;
+    constexpr void ClearLowest() noexcept;
+
+/**@section Variable */
+private:
+    uint64_t m_mask;
+};
+
+/**
+ * @brief   The control bytes of the consecutive slots which are compared at once.
+ * @remark  A control byte is Empty, Deleted, or the low 7 bits of the hash of a full slot. SSE2 compares 16 bytes with
+ *          a single instruction, and the other builds compare 8 bytes within a 64-bit integer.
+ */
+struct FlatHashGroup
+{
+/**@section Type */
+public:
+#if TGON_SIMD_SSE2
+    using BitMask = FlatHashBitMask<0>;
+#else
+    using BitMask = FlatHashBitMask<3>;
+#endif
+
+/**@section Constructor */
+public:
+    explicit FlatHashGroup(const int8_t* controls) noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] BitMask Match(int8_t h2) const noexcept;
+    [[nodiscard]] BitMask MatchEmpty() const noexcept;
+    [[nodiscard]] BitMask MatchEmptyOrDeleted() const noexcept;
+
+/**@section Variable */
+public:
+    static constexpr int8_t Empty = -128;
+    static constexpr int8_t Deleted = -2;
+#if TGON_SIMD_SSE2
+    static constexpr size_t Width = 16;
+#else
+    static constexpr size_t Width = 8;
+#endif
+
+private:
+#if TGON_SIMD_SSE2
+    __m128i m_controls;
+#else
+    uint64_t m_controls;
+#endif
+};
+
+template <typename _Key, typename _Value>
+struct FlatHashMapPolicy
+{
+    using KeyType = _Key;
+    using ValueType = std::pair<const _Key, _Value>;
+
+    static constexpr bool IsKeyOnly = false;
+    [[nodiscard]] static const _Key& GetKey(const ValueType& value) noexcept { return value.first; }
+};
+
+template <typename _Key>
+struct FlatHashSetPolicy
+{
+    using KeyType = _Key;
+    using ValueType = _Key;
+
+    static constexpr bool IsKeyOnly = true;
+    [[nodiscard]] static const _Key& GetKey(const ValueType& value) noexcept { return value; }
+};
+
+/**
+ * @brief   The open addressing hash table which keeps the values in a flat array.
+ * @remark  Each slot has a control byte in a separate array, so a probe compares a whole group of slots with a few
+ *          instructions, and only touches the slots whose 7-bit hash matched. The groups are probed quadratically, and
+ *          the table grows when 7/8 of the slots are used. The first group of the control bytes is repeated after the
+ *          last one, so that a group can be loaded from any slot without wrapping around.
+ *          The values are moved when the table grows, so the references to them are invalidated by the insertion.
+ */
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+class FlatHashTable
+{
+/**@section Type */
+public:
+    using KeyType = typename _Policy::KeyType;
+    using ValueType = typename _Policy::ValueType;
+    using AllocatorType = _Allocator;
+
+    template <bool _IsConst>
+    class BasicIterator
+    {
+    /**@section Type */
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::remove_const_t<ValueType>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<_IsConst || _Policy::IsKeyOnly, const ValueType&, ValueType&>;
+        using pointer = std::conditional_t<_IsConst || _Policy::IsKeyOnly, const ValueType*, ValueType*>;
+
+    /**@section Constructor */
+    public:
+        constexpr BasicIterator() noexcept = default;
+        BasicIterator(const int8_t* control, const int8_t* controlEnd, pointer slot) noexcept;
+        template <bool _IsOtherConst> requires (_IsConst && _IsOtherConst == false)
+        BasicIterator(const BasicIterator<_IsOtherConst>& rhs) noexcept;
+
+    /**@section Operator */
+    public:
+        [[nodiscard]] reference operator*() const noexcept;
+        [[nodiscard]] pointer operator->() const noexcept;
+        BasicIterator& operator++() noexcept;
+        BasicIterator operator++(int) noexcept;
+        [[nodiscard]] bool operator==(const BasicIterator& rhs) const noexcept;
+
+    private:
+        void SkipEmptySlots() noexcept;
+
+    /**@section Variable */
+    private:
+        friend class FlatHashTable;
+        template <bool>
+        friend class BasicIterator;
+
+        const int8_t* m_control = nullptr;
+        const int8_t* m_controlEnd = nullptr;
+        pointer m_slot = nullptr;
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+private:
+    using Group = FlatHashGroup;
+    using SlotAllocator = typename std::allocator_traits<_Allocator>::template rebind_alloc<ValueType>;
+    using SlotAllocatorTraits = std::allocator_traits<SlotAllocator>;
+    using ControlAllocator = typename std::allocator_traits<_Allocator>::template rebind_alloc<int8_t>;
+
+/**@section Constructor */
+public:
+    FlatHashTable() = default;
+    explicit FlatHashTable(const _Allocator& allocator) noexcept;
+    FlatHashTable(const FlatHashTable& rhs);
+    FlatHashTable(FlatHashTable&& rhs) noexcept;
+
+/**@section Destructor */
+public:
+    ~FlatHashTable();
+
+/**@section Operator */
+public:
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+    FlatHashTable& operator=(FlatHashTable&& rhs) noexcept(SlotAllocatorTraits::propagate_on_container_move_assignment::value || SlotAllocatorTraits::is_always_equal::value);
+
+/**@section Method */
+public:
+    /**
+     * @brief   Finds the value of the specified key.
+     * @param key   The key to find.
+     * @return  The iterator of the value, or end() if it doesn't exist.
+     */
+    [[nodiscard]] Iterator Find(const KeyType& key);
+    [[nodiscard]] ConstIterator Find(const KeyType& key) const;
+    [[nodiscard]] bool Contains(const KeyType& key) const;
+
+    /**
+     * @brief   Removes the value of the specified key.
+     * @return  True if the value was removed, false if it doesn't exist.
+     */
+    bool Erase(const KeyType& key);
+    void Erase(ConstIterator it);
+
+    /**
+     * @brief   Removes all of the values. The slots are kept for reuse.
+     */
+    void Clear() noexcept;
+
+    /**
+     * @brief   Allocates the slots in advance so that the specified number of values can be inserted without growing.
+     * @param size  The number of values.
+     */
+    void Reserve(size_t size);
+
+    [[nodiscard]] size_t GetSize() const noexcept;
+    [[nodiscard]] size_t GetCapacity() const noexcept;
+    [[nodiscard]] bool IsEmpty() const noexcept;
+    [[nodiscard]] _Allocator GetAllocator() const noexcept;
+    [[nodiscard]] Iterator begin() noexcept;
+    [[nodiscard]] ConstIterator begin() const noexcept;
+    [[nodiscard]] Iterator end() noexcept;
+    [[nodiscard]] ConstIterator end() const noexcept;
+
+protected:
+    /**
+     * @brief   Constructs a new value from the arguments if the key doesn't exist.
+     * @return  The iterator of the value with the key, and whether it was inserted.
+     */
+    template <typename... _Types>
+    std::pair<Iterator, bool> TryEmplaceWithKey(const KeyType& key, _Types&&... args);
+
+private:
+    [[nodiscard]] static uint64_t Mix(size_t hash) noexcept;
+    [[nodiscard]] static size_t GetMaxSize(size_t capacity) noexcept;
+    [[nodiscard]] size_t FindIndex(const KeyType& key, uint64_t hash) const;
+    [[nodiscard]] size_t FindInsertIndex(uint64_t hash) const noexcept;
+    [[nodiscard]] Iterator MakeIterator(size_t index) noexcept;
+    [[nodiscard]] ConstIterator MakeIterator(size_t index) const noexcept;
+    void SetControl(size_t index, int8_t control) noexcept;
+    void EraseAt(size_t index) noexcept;
+    void Rehash(size_t capacity);
+    void Destroy() noexcept;
+
+/**@section Variable */
+private:
+    static constexpr size_t NotFound = SIZE_MAX;
+
+    int8_t* m_controls = nullptr;
+    ValueType* m_slots = nullptr;
+    size_t m_capacity = 0;
+    size_t m_size = 0;
+    size_t m_growthLeft = 0;
+    [[no_unique_address]] _Hash m_hash;
+    [[no_unique_address]] _KeyEqual m_keyEqual;
+    [[no_unique_address]] SlotAllocator m_allocator;
+};
+
+}
+
+/**
+ * @brief   The hash map which stores the key-value pairs in a flat array instead of the nodes.
+ * @remark  It's much faster than std::unordered_map for the small keys, but the insertion invalidates the references to
+ *          the values. Use the iterators or look the value up again after inserting.
+ */
+template <typename _Key, typename _Value, typename _Hash = std::hash<_Key>, typename _KeyEqual = std::equal_to<_Key>, typename _Allocator = std::allocator<std::pair<const _Key, _Value>>>
+class FlatHashMap final :
+    public detail::FlatHashTable<detail::FlatHashMapPolicy<_Key, _Value>, _Hash, _KeyEqual, _Allocator>
+{
+/**@section Type */
+private:
+    using Super = detail::FlatHashTable<detail::FlatHashMapPolicy<_Key, _Value>, _Hash, _KeyEqual, _Allocator>;
+
+public:
+    using MappedType = _Value;
+    using typename Super::Iterator;
+
+/**@section Constructor */
+public:
+    using Super::Super;
+    FlatHashMap() = default;
+
+/**@section Operator */
+public:
+    _Value& operator[](const _Key& key);
+    _Value& operator[](_Key&& key);
+
+/**@section Method */
+public:
+    /**
+     * @brief   Constructs a new value from the arguments if the key doesn't exist.
+     * @param key   The key of the value.
+     * @param args  Arguments for construct the value.
+     * @return  The iterator of the value with the key, and whether it was inserted.
+     */
+    template <typename... _Types>
+    std::pair<Iterator, bool> TryEmplace(const _Key& key, _Types&&... args);
+
+    template <typename... _Types>
+    std::pair<Iterator, bool> TryEmplace(_Key&& key, _Types&&... args);
+
+    /**
+     * @brief   Inserts the pair if its key doesn't exist.
+     * @return  The iterator of the value with the key, and whether it was inserted.
+     */
+    std::pair<Iterator, bool> Insert(const std::pair<const _Key, _Value>& value);
+    std::pair<Iterator, bool> Insert(std::pair<const _Key, _Value>&& value);
+
+    /**
+     * @brief   Inserts the value, or assigns it to the existing value of the key.
+     * @return  The iterator of the value with the key, and whether it was inserted.
+     */
+    template <typename _Type>
+    std::pair<Iterator, bool> InsertOrAssign(const _Key& key, _Type&& value);
+};
+
+/**
+ * @brief   The hash set which stores the keys in a flat array instead of the nodes.
+ */
+template <typename _Key, typename _Hash = std::hash<_Key>, typename _KeyEqual = std::equal_to<_Key>, typename _Allocator = std::allocator<_Key>>
+class FlatHashSet final :
+    public detail::FlatHashTable<detail::FlatHashSetPolicy<_Key>, _Hash, _KeyEqual, _Allocator>
+{
+/**@section Type */
+private:
+    using Super = detail::FlatHashTable<detail::FlatHashSetPolicy<_Key>, _Hash, _KeyEqual, _Allocator>;
+
+public:
+    using typename Super::Iterator;
+
+/**@section Constructor */
+public:
+    using Super::Super;
+    FlatHashSet() = default;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Inserts the key if it doesn't exist.
+     * @return  The iterator of the key, and whether it was inserted.
+     */
+    std::pair<Iterator, bool> Insert(const _Key& key);
+    std::pair<Iterator, bool> Insert(_Key&& key);
+};
+
+namespace pmr
+{
+
+template <typename _Key, typename _Value, typename _Hash = std::hash<_Key>, typename _KeyEqual = std::equal_to<_Key>>
+using FlatHashMap = tg::FlatHashMap<_Key, _Value, _Hash, _KeyEqual, std::pmr::polymorphic_allocator<std::pair<const _Key, _Value>>>;
+
+template <typename _Key, typename _Hash = std::hash<_Key>, typename _KeyEqual = std::equal_to<_Key>>
+using FlatHashSet = tg::FlatHashSet<_Key, _Hash, _KeyEqual, std::pmr::polymorphic_allocator<_Key>>;
+
+}
+
+namespace detail
+{
+
+template <size_t _Shift>
+constexpr FlatHashBitMask<_Shift>::FlatHashBitMask(uint64_t mask) noexcept :
+    m_mask(mask)
+{
+}
+
+template <size_t _Shift>
+constexpr bool FlatHashBitMask<_Shift>::HasAny() const noexcept
+{
+    return m_mask != 0;
+}
+
+template <size_t _Shift>
+constexpr size_t FlatHashBitMask<_Shift>::GetLowest() const noexcept
+{
+    return static_cast<size_t>(std::countr_zero(m_mask)) >> _Shift;
+}
+
+template <size_t _Shift>
+constexpr void FlatHashBitMask<_Shift>::ClearLowest() noexcept
+{
+    m_mask &= m_mask - 1;
+}
+
+#if TGON_SIMD_SSE2
+inline FlatHashGroup::FlatHashGroup(const int8_t* controls) noexcept :
+    m_controls(_mm_loadu_si128(reinterpret_cast<const __m128i*>(controls)))
+{
+}
+
+inline FlatHashGroup::BitMask FlatHashGroup::Match(int8_t h2) const noexcept
+{
+    return BitMask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_controls))));
+}
+
+inline FlatHashGroup::BitMask FlatHashGroup::MatchEmpty() const noexcept
+{
+    return this->Match(Empty);
+}
+
+inline FlatHashGroup::BitMask FlatHashGroup::MatchEmptyOrDeleted() const noexcept
+{
+    // Empty and Deleted are the only control bytes which are less than -1.
+    return BitMask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), m_controls))));
+}
+#else
+inline FlatHashGroup::FlatHashGroup(const int8_t* controls) noexcept
+{
+    static_assert(std::endian::native == std::endian::little, "The slot offsets are counted from the lowest byte.");
+    std::memcpy(&m_controls, controls, Width);
+}
+
+inline FlatHashGroup::BitMask FlatHashGroup::Match(int8_t h2) const noexcept
+{
+    // The bytes which became zero by the XOR are found by the borrow of the subtraction. It can also report a byte above
+    // a matched one, but the keys are compared anyway.
+    constexpr uint64_t lsbs = 0x0101010101010101;
+    constexpr uint64_t msbs = 0x8080808080808080;
+    const auto x = m_controls ^ (lsbs * static_cast<uint8_t>(h2));
+    return BitMask((x - lsbs) & ~x & msbs);
+}
+
+inline FlatHashGroup::BitMask FlatHashGroup::MatchEmpty() const noexcept
+{
+    // Empty is the only control byte whose highest bit is set and second lowest bit is cleared.
+    constexpr uint64_t msbs = 0x8080808080808080;
+    return BitMask(m_controls & ~(m_controls << 6) & msbs);
+}
+
+inline FlatHashGroup::BitMask FlatHashGroup::MatchEmptyOrDeleted() const noexcept
+{
+    constexpr uint64_t msbs = 0x8080808080808080;
+    return BitMask(m_controls & ~(m_controls << 7) & msbs);
+}
+#endif
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+template <bool _IsConst>
+FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::BasicIterator<_IsConst>::BasicIterator(const int8_t* control, const int8_t* controlEnd, pointer slot) noexcept :
+    m_control(control),
+    m_controlEnd(controlEnd),
+    m_slot(slot)
+{
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+template <bool _IsConst>
+template <bool _IsOtherConst> requires (_IsConst && _IsOtherConst == false)
+FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::BasicIterator<_IsConst>::BasicIterator(const BasicIterator<_IsOtherConst>& rhs) noexcept :
+    m_control(rhs.m_control),
+    m_controlEnd(rhs.m_controlEnd),
+    m_slot(rhs.m_slot)
+{
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+template <bool _IsConst>
+typename FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::template BasicIterator<_IsConst>::reference FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::BasicIterator<_IsConst>::operator*() const noexcept
+{
+    return *m_slot;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+template <bool _IsConst>
+typename FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::template BasicIterator<_IsConst>::pointer FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::BasicIterator<_IsConst>::operator->() const noexcept
+{
+    return m_slot;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+template <bool _IsConst>
+typename FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::template BasicIterator<_IsConst>& FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::BasicIterator<_IsConst>::operator++() noexcept
+{
+    ++m_control;
+    ++m_slot;
+    this->SkipEmptySlots();
+
+    return *this;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+template <bool _IsConst>
+typename FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::template BasicIterator<_IsConst> FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::BasicIterator<_IsConst>::operator++(int) noexcept
+{
+    auto prevIt = *this;
+    ++*this;
+
+    return prevIt;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+template <bool _IsConst>
+bool FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::BasicIterator<_IsConst>::operator==(const BasicIterator& rhs) const noexcept
+{
+    return m_control == rhs.m_control;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+template <bool _IsConst>
+void FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::BasicIterator<_IsConst>::SkipEmptySlots() noexcept
+{
+    while (m_control != m_controlEnd && *m_control < 0)
+    {
+        ++m_control;
+        ++m_slot;
+    }
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::FlatHashTable(const _Allocator& allocator) noexcept :
+    m_allocator(allocator)
+{
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::FlatHashTable(const FlatHashTable& rhs) :
+    m_hash(rhs.m_hash),
+    m_keyEqual(rhs.m_keyEqual),
+    m_allocator(SlotAllocatorTraits::select_on_container_copy_construction(rhs.m_allocator))
+{
+    this->Reserve(rhs.m_size);
+    for (const auto& value : rhs)
+    {
+        this->TryEmplaceWithKey(_Policy::GetKey(value), value);
+    }
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::FlatHashTable(FlatHashTable&& rhs) noexcept :
+    m_controls(std::exchange(rhs.m_controls, nullptr)),
+    m_slots(std::exchange(rhs.m_slots, nullptr)),
+    m_capacity(std::exchange(rhs.m_capacity, 0)),
+    m_size(std::exchange(rhs.m_size, 0)),
+    m_growthLeft(std::exchange(rhs.m_growthLeft, 0)),
+    m_hash(std::move(rhs.m_hash)),
+    m_keyEqual(std::move(rhs.m_keyEqual)),
+    m_allocator(std::move(rhs.m_allocator))
+{
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::~FlatHashTable()
+{
+    this->Destroy();
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>& FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::operator=(const FlatHashTable& rhs)
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    this->Clear();
+    this->Reserve(rhs.m_size);
+    for (const auto& value : rhs)
+    {
+        this->TryEmplaceWithKey(_Policy::GetKey(value), value);
+    }
+
+    return *this;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>& FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::operator=(FlatHashTable&& rhs) noexcept(SlotAllocatorTraits::propagate_on_container_move_assignment::value || SlotAllocatorTraits::is_always_equal::value)
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    // The memory of another resource can't be freed by this allocator, so the values are moved one by one.
+    if constexpr (SlotAllocatorTraits::propagate_on_container_move_assignment::value == false && SlotAllocatorTraits::is_always_equal::value == false)
+    {
+        if (m_allocator != rhs.m_allocator)
+        {
+            this->Clear();
+            this->Reserve(rhs.m_size);
+            for (auto& value : rhs)
+            {
+                this->TryEmplaceWithKey(_Policy::GetKey(value), std::move(value));
+            }
+            rhs.Clear();
+
+            return *this;
+        }
+    }
+
+    this->Destroy();
+
+    m_controls = std::exchange(rhs.m_controls, nullptr);
+    m_slots = std::exchange(rhs.m_slots, nullptr);
+    m_capacity = std::exchange(rhs.m_capacity, 0);
+    m_size = std::exchange(rhs.m_size, 0);
+    m_growthLeft = std::exchange(rhs.m_growthLeft, 0);
+    m_hash = std::move(rhs.m_hash);
+    m_keyEqual = std::move(rhs.m_keyEqual);
+    if constexpr (SlotAllocatorTraits::propagate_on_container_move_assignment::value)
+    {
+        m_allocator = std::move(rhs.m_allocator);
+    }
+
+    return *this;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+typename FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Iterator FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Find(const KeyType& key)
+{
+    const auto index = this->FindIndex(key, Mix(m_hash(key)));
+    return index == NotFound ? this->end() : this->MakeIterator(index);
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+typename FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::ConstIterator FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Find(const KeyType& key) const
+{
+    const auto index = this->FindIndex(key, Mix(m_hash(key)));
+    return index == NotFound ? this->end() : this->MakeIterator(index);
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+bool FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Contains(const KeyType& key) const
+{
+    return this->FindIndex(key, Mix(m_hash(key))) != NotFound;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+bool FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Erase(const KeyType& key)
+{
+    const auto index = this->FindIndex(key, Mix(m_hash(key)));
+    if (index == NotFound)
+    {
+        return false;
+    }
+
+    this->EraseAt(index);
+    return true;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+void FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Erase(ConstIterator it)
+{
+    this->EraseAt(static_cast<size_t>(it.m_control - m_controls));
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+void FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Clear() noexcept
+{
+    if (m_capacity == 0)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < m_capacity; ++i)
+    {
+        if (m_controls[i] >= 0)
+        {
+            SlotAllocatorTraits::destroy(m_allocator, &m_slots[i]);
+        }
+    }
+
+    std::memset(m_controls, Group::Empty, m_capacity + Group::Width);
+    m_size = 0;
+    m_growthLeft = GetMaxSize(m_capacity);
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+void FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Reserve(size_t size)
+{
+    if (size <= m_size + m_growthLeft)
+    {
+        return;
+    }
+
+    auto capacity = std::max(m_capacity, Group::Width);
+    while (GetMaxSize(capacity) < size)
+    {
+        capacity *= 2;
+    }
+
+    this->Rehash(capacity);
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+size_t FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::GetSize() const noexcept
+{
+    return m_size;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+size_t FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::GetCapacity() const noexcept
+{
+    return m_capacity;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+bool FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::IsEmpty() const noexcept
+{
+    return m_size == 0;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+_Allocator FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::GetAllocator() const noexcept
+{
+    return _Allocator(m_allocator);
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+typename FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Iterator FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::begin() noexcept
+{
+    auto it = Iterator(m_controls, m_controls + m_capacity, m_slots);
+    it.SkipEmptySlots();
+
+    return it;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+typename FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::ConstIterator FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::begin() const noexcept
+{
+    return const_cast<FlatHashTable*>(this)->begin();
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+typename FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Iterator FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::end() noexcept
+{
+    return Iterator(m_controls + m_capacity, m_controls + m_capacity, m_slots + m_capacity);
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+typename FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::ConstIterator FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::end() const noexcept
+{
+    return const_cast<FlatHashTable*>(this)->end();
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+template <typename... _Types>
+std::pair<typename FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Iterator, bool> FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::TryEmplaceWithKey(const KeyType& key, _Types&&... args)
+{
+    const auto hash = Mix(m_hash(key));
+    if (const auto index = this->FindIndex(key, hash); index != NotFound)
+    {
+        return {this->MakeIterator(index), false};
+    }
+
+    if (m_growthLeft == 0)
+    {
+        // Rehashing in place is enough if the most of the used slots are the tombstones of the erased values.
+        this->Rehash((m_capacity != 0 && m_size < GetMaxSize(m_capacity) / 2) ? m_capacity : std::max(m_capacity * 2, Group::Width));
+    }
+
+    const auto index = this->FindInsertIndex(hash);
+    SlotAllocatorTraits::construct(m_allocator, &m_slots[index], std::forward<_Types>(args)...);
+
+    // The tombstone was already taken out of the growth.
+    if (m_controls[index] == Group::Empty)
+    {
+        --m_growthLeft;
+    }
+    this->SetControl(index, static_cast<int8_t>(hash & 0x7F));
+    ++m_size;
+
+    return {this->MakeIterator(index), true};
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+uint64_t FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Mix(size_t hash) noexcept
+{
+    // std::hash of the integers is the identity, so the bits are spread before the low bits are used as the 7-bit hash.
+    const auto mixed = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15;
+    return mixed ^ (mixed >> 32);
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+size_t FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::GetMaxSize(size_t capacity) noexcept
+{
+    return capacity - capacity / 8;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+size_t FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::FindIndex(const KeyType& key, uint64_t hash) const
+{
+    if (m_capacity == 0)
+    {
+        return NotFound;
+    }
+
+    const auto h2 = static_cast<int8_t>(hash & 0x7F);
+    const auto mask = m_capacity - 1;
+    auto groupIndex = static_cast<size_t>(hash >> 7) & mask;
+    for (size_t probeDistance = Group::Width; ; probeDistance += Group::Width)
+    {
+        const Group group(&m_controls[groupIndex]);
+        for (auto match = group.Match(h2); match.HasAny(); match.ClearLowest())
+        {
+            const auto index = (groupIndex + match.GetLowest()) & mask;
+            if (m_keyEqual(_Policy::GetKey(m_slots[index]), key))
+            {
+                return index;
+            }
+        }
+
+        // The key would have been put into this empty slot if it had been inserted.
+        if (group.MatchEmpty().HasAny())
+        {
+            return NotFound;
+        }
+
+        groupIndex = (groupIndex + probeDistance) & mask;
+    }
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+size_t FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::FindInsertIndex(uint64_t hash) const noexcept
+{
+    const auto mask = m_capacity - 1;
+    auto groupIndex = static_cast<size_t>(hash >> 7) & mask;
+    for (size_t probeDistance = Group::Width; ; probeDistance += Group::Width)
+    {
+        const auto match = Group(&m_controls[groupIndex]).MatchEmptyOrDeleted();
+        if (match.HasAny())
+        {
+            return (groupIndex + match.GetLowest()) & mask;
+        }
+
+        groupIndex = (groupIndex + probeDistance) & mask;
+    }
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+typename FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Iterator FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::MakeIterator(size_t index) noexcept
+{
+    return Iterator(&m_controls[index], m_controls + m_capacity, &m_slots[index]);
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+typename FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::ConstIterator FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::MakeIterator(size_t index) const noexcept
+{
+    return const_cast<FlatHashTable*>(this)->MakeIterator(index);
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+void FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::SetControl(size_t index, int8_t control) noexcept
+{
+    m_controls[index] = control;
+    if (index < Group::Width)
+    {
+        m_controls[m_capacity + index] = control;
+    }
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+void FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::EraseAt(size_t index) noexcept
+{
+    SlotAllocatorTraits::destroy(m_allocator, &m_slots[index]);
+
+    // The slot stays as a tombstone, so that the probes of the other keys don't stop at it.
+    this->SetControl(index, Group::Deleted);
+    --m_size;
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+void FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Rehash(size_t capacity)
+{
+    ControlAllocator controlAllocator(m_allocator);
+    auto* controls = std::allocator_traits<ControlAllocator>::allocate(controlAllocator, capacity + Group::Width);
+    std::memset(controls, Group::Empty, capacity + Group::Width);
+
+    ValueType* slots;
+    try
+    {
+        slots = SlotAllocatorTraits::allocate(m_allocator, capacity);
+    }
+    catch (...)
+    {
+        std::allocator_traits<ControlAllocator>::deallocate(controlAllocator, controls, capacity + Group::Width);
+        throw;
+    }
+
+    auto* prevControls = std::exchange(m_controls, controls);
+    auto* prevSlots = std::exchange(m_slots, slots);
+    const auto prevCapacity = std::exchange(m_capacity, capacity);
+    for (size_t i = 0; i < prevCapacity; ++i)
+    {
+        if (prevControls[i] < 0)
+        {
+            continue;
+        }
+
+        const auto hash = Mix(m_hash(_Policy::GetKey(prevSlots[i])));
+        const auto index = this->FindInsertIndex(hash);
+        SlotAllocatorTraits::construct(m_allocator, &m_slots[index], std::move_if_noexcept(prevSlots[i]));
+        SlotAllocatorTraits::destroy(m_allocator, &prevSlots[i]);
+        this->SetControl(index, static_cast<int8_t>(hash & 0x7F));
+    }
+    m_growthLeft = GetMaxSize(m_capacity) - m_size;
+
+    if (prevCapacity != 0)
+    {
+        std::allocator_traits<ControlAllocator>::deallocate(controlAllocator, prevControls, prevCapacity + Group::Width);
+        SlotAllocatorTraits::deallocate(m_allocator, prevSlots, prevCapacity);
+    }
+}
+
+template <typename _Policy, typename _Hash, typename _KeyEqual, typename _Allocator>
+void FlatHashTable<_Policy, _Hash, _KeyEqual, _Allocator>::Destroy() noexcept
+{
+    if (m_capacity == 0)
+    {
+        return;
+    }
+
+    this->Clear();
+
+    ControlAllocator controlAllocator(m_allocator);
+    std::allocator_traits<ControlAllocator>::deallocate(controlAllocator, m_controls, m_capacity + Group::Width);
+    SlotAllocatorTraits::deallocate(m_allocator, m_slots, m_capacity);
+
+    m_controls = nullptr;
+    m_slots = nullptr;
+    m_capacity = 0;
+    m_growthLeft = 0;
+}
+
+}
+
+template <typename _Key, typename _Value, typename _Hash, typename _KeyEqual, typename _Allocator>
+_Value& FlatHashMap<_Key, _Value, _Hash, _KeyEqual, _Allocator>::operator[](const _Key& key)
+{
+    return this->TryEmplace(key).first->second;
+}
+
+template <typename _Key, typename _Value, typename _Hash, typename _KeyEqual, typename _Allocator>
+_Value& FlatHashMap<_Key, _Value, _Hash, _KeyEqual, _Allocator>::operator[](_Key&& key)
+{
+    return this->TryEmplace(std::move(key)).first->second;
+}
+
+template <typename _Key, typename _Value, typename _Hash, typename _KeyEqual, typename _Allocator>
+template <typename... _Types>
+std::pair<typename FlatHashMap<_Key, _Value, _Hash, _KeyEqual, _Allocator>::Iterator, bool> FlatHashMap<_Key, _Value, _Hash, _KeyEqual, _Allocator>::TryEmplace(const _Key& key, _Types&&... args)
+{
+    return this->TryEmplaceWithKey(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<_Types>(args)...));
+}
+
+template <typename _Key, typename _Value, typename _Hash, typename _KeyEqual, typename _Allocator>
+template <typename... _Types>
+std::pair<typename FlatHashMap<_Key, _Value, _Hash, _KeyEqual, _Allocator>::Iterator, bool> FlatHashMap<_Key, _Value, _Hash, _KeyEqual, _Allocator>::TryEmplace(_Key&& key, _Types&&... args)
+{
+    // The key is only moved after the lookup failed.
+    return this->TryEmplaceWithKey(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<_Types>(args)...));
+}
+
+template <typename _Key, typename _Value, typename _Hash, typename _KeyEqual, typename _Allocator>
+std::pair<typename FlatHashMap<_Key, _Value, _Hash, _KeyEqual, _Allocator>::Iterator, bool> FlatHashMap<_Key, _Value, _Hash, _KeyEqual, _Allocator>::Insert(const std::pair<const _Key, _Value>& value)
+{
+    return this->TryEmplaceWithKey(value.first, value);
+}
+
+template <typename _Key, typename _Value, typename _Hash, typename _KeyEqual, typename _Allocator>
+std::pair<typename FlatHashMap<_Key, _Value, _Hash, _KeyEqual, _Allocator>::Iterator, bool> FlatHashMap<_Key, _Value, _Hash, _KeyEqual, _Allocator>::Insert(std::pair<const _Key, _Value>&& value)
+{
+    return this->TryEmplaceWithKey(value.first, std::move(value));
+}
+
+template <typename _Key, typename _Value, typename _Hash, typename _KeyEqual, typename _Allocator>
+template <typename _Type>
+std::pair<typename FlatHashMap<_Key, _Value, _Hash, _KeyEqual, _Allocator>::Iterator, bool> FlatHashMap<_Key, _Value, _Hash, _KeyEqual, _Allocator>::InsertOrAssign(const _Key& key, _Type&& value)
+{
+    auto result = this->TryEmplace(key, std::forward<_Type>(value));
+    if (result.second == false)
+    {
+        result.first->second = std::forward<_Type>(value);
+    }
+
+    return result;
+}
+
+template <typename _Key, typename _Hash, typename _KeyEqual, typename _Allocator>
+std::pair<typename FlatHashSet<_Key, _Hash, _KeyEqual, _Allocator>::Iterator, bool> FlatHashSet<_Key, _Hash, _KeyEqual, _Allocator>::Insert(const _Key& key)
+{
+    return this->TryEmplaceWithKey(key, key);
+}
+
+template <typename _Key, typename _Hash, typename _KeyEqual, typename _Allocator>
+std::pair<typename FlatHashSet<_Key, _Hash, _KeyEqual, _Allocator>::Iterator, bool> FlatHashSet<_Key, _Hash, _KeyEqual, _Allocator>::Insert(_Key&& key)
+{
+    return this->TryEmplaceWithKey(key, std::move(key));
+}
+
+}
@@ -0,0 +1,55 @@
+#include "PrecompiledHeader.h"
+
+#include "FrameAllocator.h"
+
+namespace tg
+{
+
+FrameAllocator::FrameAllocator(size_t capacity, size_t sharedCapacity)
+{
+    for (size_t i = 0; i < m_allocators.size(); ++i)
+    {
+        m_allocators[i].Reserve(capacity);
+        m_sharedAllocators[i].Reserve(sharedCapacity);
+    }
+}
+
+void* FrameAllocator::AllocateShared(size_t size, size_t alignment)
+{
+    std::lock_guard lock(m_sharedMutex);
+    return m_sharedAllocators[m_currentIndex].Allocate(size, alignment);
+}
+
+void FrameAllocator::SwapBuffers()
+{
+    m_currentIndex ^= 1;
+    m_allocators[m_currentIndex].Reset();
+    m_sharedAllocators[m_currentIndex].Reset();
+}
+
+ScratchScope::ScratchScope() :
+    m_allocator(GetThreadAllocator()),
+    m_marker(m_allocator.GetMarker())
+{
+}
+
+ScratchScope::~ScratchScope()
+{
+    // The outermost scope resets the allocator, so the overflow of the thread is folded into its buffer.
+    if (m_marker.offset == 0 && m_marker.overflowBlock == nullptr)
+    {
+        m_allocator.Reset();
+    }
+    else
+    {
+        m_allocator.Rewind(m_marker);
+    }
+}
+
+LinearAllocator& ScratchScope::GetThreadAllocator()
+{
+    thread_local LinearAllocator allocator(DefaultCapacity);
+    return allocator;
+}
+
+}
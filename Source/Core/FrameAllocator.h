@@ -0,0 +1,172 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+
+#include "LinearAllocator.h"
+
+namespace tg
+{
+
+/**
+ * @brief   Allocates the temporary memory of a frame.
+ * @remark  The allocator is double-buffered, so the memory which was allocated in a frame stays valid through the next
+ *          frame, e.g. for the data which is consumed by the renderer one frame later. Allocate must only be called by the
+ *          thread which swaps the buffers. The other threads can take the frame memory from AllocateShared, or use
+ *          ScratchScope for the memory which doesn't leave the task.
+ */
+class FrameAllocator final :
+    private NonCopyable
+{
+/**@section Constructor */
+public:
+    explicit FrameAllocator(size_t capacity = DefaultCapacity, size_t sharedCapacity = DefaultSharedCapacity);
+
+/**@section Method */
+public:
+    /**
+     * @brief   Allocates the uninitialized memory from the buffer of the current frame.
+     * @param size          The size of the memory in bytes.
+     * @param alignment     The alignment of the memory. It must be a power of two.
+     * @return  The allocated memory.
+     */
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief   Allocates the uninitialized memory for the array of the specified type.
+     * @param count     The number of elements.
+     * @return  The allocated array.
+     */
+    template <typename _Type>
+    [[nodiscard]] _Type* Allocate(size_t count);
+
+    /**
+     * @brief   Allocates the uninitialized memory from the shared buffer of the current frame. It can be called from any thread.
+     * @param size          The size of the memory in bytes.
+     * @param alignment     The alignment of the memory. It must be a power of two.
+     * @return  The allocated memory.
+     * @remark  It takes a lock, so it's meant for the blocks which are sub-allocated by the caller, such as the pages of
+     *          EntityCommandBuffer.
+     */
+    [[nodiscard]] void* AllocateShared(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief   Ends the current frame. The buffers of the previous frame are reset and become the current buffers.
+     * @remark  No thread may allocate from the allocator while the buffers are swapped.
+     */
+    void SwapBuffers();
+
+    [[nodiscard]] LinearAllocator& GetCurrent() noexcept;
+    [[nodiscard]] const LinearAllocator& GetCurrent() const noexcept;
+    [[nodiscard]] LinearAllocator& GetPrevious() noexcept;
+    [[nodiscard]] const LinearAllocator& GetPrevious() const noexcept;
+
+    /**
+     * @brief   Gets the shared buffer of the current frame. It must not be used while the other threads can allocate from it.
+     * @return  The shared buffer of the current frame.
+     */
+    [[nodiscard]] const LinearAllocator& GetCurrentShared() const noexcept;
+
+/**@section Variable */
+public:
+    static constexpr size_t DefaultCapacity = 2 * 1024 * 1024;
+    static constexpr size_t DefaultSharedCapacity = 256 * 1024;
+
+private:
+    std::array<LinearAllocator, 2> m_allocators;
+    std::array<LinearAllocator, 2> m_sharedAllocators;
+    std::mutex m_sharedMutex;
+    size_t m_currentIndex = 0;
+};
+
+/**
+ * @brief   Borrows the scratch memory of the calling thread, and gives it back on destruction.
+ * @remark  Every thread owns a LinearAllocator which is created on the first use. The scopes can be nested, but the memory
+ *          must not leave the scope or the thread.
+ */
+class ScratchScope final :
+    private NonCopyable
+{
+/**@section Constructor */
+public:
+    ScratchScope();
+
+/**@section Destructor */
+public:
+    ~ScratchScope();
+
+/**@section Method */
+public:
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    template <typename _Type>
+    [[nodiscard]] _Type* Allocate(size_t count);
+    [[nodiscard]] LinearAllocator& GetAllocator() noexcept;
+
+    /**
+     * @brief   Gets the scratch allocator of the calling thread.
+     * @return  The scratch allocator.
+     */
+    [[nodiscard]] static LinearAllocator& GetThreadAllocator();
+
+/**@section Variable */
+public:
+    static constexpr size_t DefaultCapacity = 256 * 1024;
+
+private:
+    LinearAllocator& m_allocator;
+    LinearAllocator::Marker m_marker;
+};
+
+inline void* FrameAllocator::Allocate(size_t size, size_t alignment)
+{
+    return m_allocators[m_currentIndex].Allocate(size, alignment);
+}
+
+template <typename _Type>
+_Type* FrameAllocator::Allocate(size_t count)
+{
+    return m_allocators[m_currentIndex].template Allocate<_Type>(count);
+}
+
+inline LinearAllocator& FrameAllocator::GetCurrent() noexcept
+{
+    return m_allocators[m_currentIndex];
+}
+
+inline const LinearAllocator& FrameAllocator::GetCurrent() const noexcept
+{
+    return m_allocators[m_currentIndex];
+}
+
+inline LinearAllocator& FrameAllocator::GetPrevious() noexcept
+{
+    return m_allocators[m_currentIndex ^ 1];
+}
+
+inline const LinearAllocator& FrameAllocator::GetPrevious() const noexcept
+{
+    return m_allocators[m_currentIndex ^ 1];
+}
+
+inline const LinearAllocator& FrameAllocator::GetCurrentShared() const noexcept
+{
+    return m_sharedAllocators[m_currentIndex];
+}
+
+inline void* ScratchScope::Allocate(size_t size, size_t alignment)
+{
+    return m_allocator.Allocate(size, alignment);
+}
+
+template <typename _Type>
+_Type* ScratchScope::Allocate(size_t count)
+{
+    return m_allocator.template Allocate<_Type>(count);
+}
+
+inline LinearAllocator& ScratchScope::GetAllocator() noexcept
+{
+    return m_allocator;
+}
+
+}
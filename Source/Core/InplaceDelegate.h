@@ -0,0 +1,249 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "TypeTraits.h"
+
+namespace tg
+{
+
+/**
+ * @brief   The move-only delegate which always stores the callable in itself.
+ * @remark  Unlike Delegate, it never allocates, and invokes the callable through a plain function pointer instead of a
+ *          virtual function. The callables which don't fit in the capacity are rejected at compile time, so the capacity
+ *          must be raised for them.
+ */
+template <typename, size_t _Capacity = 48>
+class InplaceDelegate;
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+class InplaceDelegate<_Return(_Types...), _Capacity> final
+{
+/**@section Type */
+public:
+    using ReturnType = _Return;
+
+private:
+    using Invoker = _Return(*)(const void* storage, _Types... args);
+
+    /**
+     * @brief   Moves the callable in src to dest and destroys the one in src, or only destroys src if dest is nullptr.
+     */
+    using Relocator = void(*)(void* dest, void* src) noexcept;
+
+/**@section Constructor */
+public:
+    constexpr InplaceDelegate() noexcept = default;
+    constexpr InplaceDelegate(std::nullptr_t) noexcept;
+    InplaceDelegate(const InplaceDelegate& rhs) = delete;
+    InplaceDelegate(InplaceDelegate&& rhs) noexcept;
+    template <typename _Function> requires (std::is_same_v<std::decay_t<_Function>, InplaceDelegate<_Return(_Types...), _Capacity>> == false)
+    InplaceDelegate(_Function&& function) noexcept(std::is_nothrow_constructible_v<std::decay_t<_Function>, _Function&&>);
+    template <typename _Function>
+    InplaceDelegate(_Function function, void* receiver) noexcept;
+
+/**@section Destructor */
+public:
+    ~InplaceDelegate();
+
+/**@section Operator */
+public:
+    template <typename... _Args2>
+    _Return operator()(_Args2&&... args) const;
+    InplaceDelegate& operator=(const InplaceDelegate& rhs) = delete;
+    InplaceDelegate& operator=(InplaceDelegate&& rhs) noexcept;
+    InplaceDelegate& operator=(std::nullptr_t) noexcept;
+    constexpr bool operator==(std::nullptr_t rhs) const noexcept;
+    constexpr bool operator!=(std::nullptr_t rhs) const noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] static constexpr size_t GetCapacity() noexcept;
+
+private:
+    template <typename _Function>
+    void Construct(_Function&& function);
+    void Move(InplaceDelegate&& rhs) noexcept;
+    void Reset() noexcept;
+    template <typename _Function>
+    static _Return Invoke(const void* storage, _Types... args);
+    template <typename _Function>
+    static void Relocate(void* dest, void* src) noexcept;
+
+/**@section Variable */
+private:
+    Invoker m_invoker{};
+
+    /**
+     * @brief   It's nullptr for the trivially copyable callables, which are moved by copying the storage.
+     */
+    Relocator m_relocator{};
+    alignas(std::max_align_t) std::byte m_storage[_Capacity];
+};
+
+template <typename _Function>
+InplaceDelegate(_Function function) -> InplaceDelegate<typename FunctionTraits<std::remove_cvref_t<_Function>>::FunctionType>;
+
+template <typename _Function>
+InplaceDelegate(_Function function, void* receiver) -> InplaceDelegate<typename FunctionTraits<std::remove_cvref_t<_Function>>::FunctionType>;
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+constexpr InplaceDelegate<_Return(_Types...), _Capacity>::InplaceDelegate(std::nullptr_t) noexcept :
+    InplaceDelegate()
+{
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+InplaceDelegate<_Return(_Types...), _Capacity>::InplaceDelegate(InplaceDelegate&& rhs) noexcept
+{
+    this->Move(std::move(rhs));
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+template <typename _Function> requires (std::is_same_v<std::decay_t<_Function>, InplaceDelegate<_Return(_Types...), _Capacity>> == false)
+InplaceDelegate<_Return(_Types...), _Capacity>::InplaceDelegate(_Function&& function) noexcept(std::is_nothrow_constructible_v<std::decay_t<_Function>, _Function&&>)
+{
+    this->Construct(std::forward<_Function>(function));
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+template <typename _Function>
+InplaceDelegate<_Return(_Types...), _Capacity>::InplaceDelegate(_Function function, void* receiver) noexcept
+{
+    using ClassType = typename FunctionTraits<_Function>::ClassType;
+    this->Construct([function, receiver](_Types... args) -> _Return
+    {
+        return (reinterpret_cast<ClassType*>(receiver)->*function)(std::move(args)...);
+    });
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+InplaceDelegate<_Return(_Types...), _Capacity>::~InplaceDelegate()
+{
+    this->Reset();
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+template <typename... _Args2>
+_Return InplaceDelegate<_Return(_Types...), _Capacity>::operator()(_Args2&&... args) const
+{
+    if (m_invoker == nullptr)
+    {
+        return _Return();
+    }
+
+    return m_invoker(m_storage, std::forward<_Args2>(args)...);
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+InplaceDelegate<_Return(_Types...), _Capacity>& InplaceDelegate<_Return(_Types...), _Capacity>::operator=(InplaceDelegate&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        this->Reset();
+        this->Move(std::move(rhs));
+    }
+
+    return *this;
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+InplaceDelegate<_Return(_Types...), _Capacity>& InplaceDelegate<_Return(_Types...), _Capacity>::operator=(std::nullptr_t) noexcept
+{
+    this->Reset();
+    return *this;
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+constexpr bool InplaceDelegate<_Return(_Types...), _Capacity>::operator==(std::nullptr_t rhs) const noexcept
+{
+    return m_invoker == rhs;
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+constexpr bool InplaceDelegate<_Return(_Types...), _Capacity>::operator!=(std::nullptr_t rhs) const noexcept
+{
+    return m_invoker != rhs;
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+constexpr size_t InplaceDelegate<_Return(_Types...), _Capacity>::GetCapacity() noexcept
+{
+    return _Capacity;
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+template <typename _Function>
+void InplaceDelegate<_Return(_Types...), _Capacity>::Construct(_Function&& function)
+{
+    using FunctionType = std::decay_t<_Function>;
+    static_assert(sizeof(FunctionType) <= _Capacity, "The callable doesn't fit in the storage. Raise the capacity of the InplaceDelegate.");
+    static_assert(alignof(FunctionType) <= alignof(std::max_align_t), "The callable is over-aligned for the storage.");
+    static_assert(std::is_nothrow_move_constructible_v<FunctionType>, "The callable must be nothrow move constructible, because the delegate is moved in place.");
+
+    new (m_storage) FunctionType(std::forward<_Function>(function));
+    m_invoker = &InplaceDelegate::Invoke<FunctionType>;
+    if constexpr (std::is_trivially_copyable_v<FunctionType> == false)
+    {
+        m_relocator = &InplaceDelegate::Relocate<FunctionType>;
+    }
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+void InplaceDelegate<_Return(_Types...), _Capacity>::Move(InplaceDelegate&& rhs) noexcept
+{
+    if (rhs.m_invoker == nullptr)
+    {
+        return;
+    }
+
+    if (rhs.m_relocator != nullptr)
+    {
+        rhs.m_relocator(m_storage, rhs.m_storage);
+    }
+    else
+    {
+        std::memcpy(m_storage, rhs.m_storage, _Capacity);
+    }
+
+    m_invoker = std::exchange(rhs.m_invoker, nullptr);
+    m_relocator = std::exchange(rhs.m_relocator, nullptr);
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+void InplaceDelegate<_Return(_Types...), _Capacity>::Reset() noexcept
+{
+    if (m_relocator != nullptr)
+    {
+        m_relocator(nullptr, m_storage);
+    }
+
+    m_invoker = nullptr;
+    m_relocator = nullptr;
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+template <typename _Function>
+_Return InplaceDelegate<_Return(_Types...), _Capacity>::Invoke(const void* storage, _Types... args)
+{
+    return (*static_cast<const _Function*>(storage))(std::move(args)...);
+}
+
+template <typename _Return, typename... _Types, size_t _Capacity>
+template <typename _Function>
+void InplaceDelegate<_Return(_Types...), _Capacity>::Relocate(void* dest, void* src) noexcept
+{
+    auto* function = static_cast<_Function*>(src);
+    if (dest != nullptr)
+    {
+        new (dest) _Function(std::move(*function));
+    }
+
+    function->~_Function();
+}
+
+}
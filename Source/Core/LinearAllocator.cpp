@@ -0,0 +1,78 @@
+#include "PrecompiledHeader.h"
+
+#include <bit>
+#include <new>
+
+#include "LinearAllocator.h"
+
+namespace tg
+{
+
+LinearAllocator::LinearAllocator(size_t capacity)
+{
+    this->Reserve(capacity);
+}
+
+LinearAllocator::~LinearAllocator()
+{
+    this->FreeOverflowBlocks(nullptr);
+}
+
+void LinearAllocator::Rewind(const Marker& marker) noexcept
+{
+    m_highWaterMark = this->GetHighWaterMark();
+
+    this->FreeOverflowBlocks(marker.overflowBlock);
+    m_offset = marker.offset;
+}
+
+void LinearAllocator::Reset()
+{
+    this->Rewind(Marker{0, nullptr});
+
+    if (m_overflowCount > 0)
+    {
+        // Round up the high-water mark, because the padding of the alignment can differ once the overflow moves into the buffer.
+        this->Reserve(std::bit_ceil(m_highWaterMark));
+        m_overflowCount = 0;
+    }
+}
+
+void LinearAllocator::Reserve(size_t capacity)
+{
+    if (capacity <= m_capacity)
+    {
+        return;
+    }
+
+    // The buffer of new[] is aligned for std::max_align_t, which is the default alignment of Allocate.
+    m_buffer = std::make_unique_for_overwrite<std::byte[]>(capacity);
+    m_capacity = capacity;
+    m_offset = 0;
+}
+
+void* LinearAllocator::AllocateOverflow(size_t size, size_t alignment)
+{
+    auto* block = static_cast<OverflowBlock*>(::operator new(sizeof(OverflowBlock) + size + alignment));
+    block->prev = m_overflowBlock;
+    block->size = size;
+
+    m_overflowBlock = block;
+    m_overflowSize += size;
+    ++m_overflowCount;
+
+    return reinterpret_cast<void*>(AlignOf(reinterpret_cast<uintptr_t>(block + 1), alignment));
+}
+
+void LinearAllocator::FreeOverflowBlocks(const OverflowBlock* lastBlock) noexcept
+{
+    while (m_overflowBlock != lastBlock)
+    {
+        auto* prevBlock = m_overflowBlock->prev;
+        m_overflowSize -= m_overflowBlock->size;
+        ::operator delete(m_overflowBlock);
+        m_overflowBlock = prevBlock;
+    }
+}
+
+}
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "Algorithm.h"
+#include "NonCopyable.h"
+
+namespace tg
+{
+
+/**
+ * @brief   Allocates the memory by bumping an offset in a single buffer, and frees all of it at once.
+ * @remark  The allocations which don't fit in the buffer fall back to the global heap instead of failing. They are counted
+ *          as the overflow and freed on rewind, and Reset grows the buffer to the high-water mark, so the allocator stops
+ *          touching the heap once the workload settles. The allocator isn't thread safe.
+ */
+class LinearAllocator final :
+    private NonCopyable
+{
+/**@section Type */
+private:
+    struct OverflowBlock
+    {
+        OverflowBlock* prev;
+        size_t size;
+    };
+
+public:
+    /**
+     * @brief   The state of the allocator which can be restored by Rewind.
+     */
+    struct Marker
+    {
+        size_t offset;
+        OverflowBlock* overflowBlock;
+    };
+
+/**@section Constructor */
+public:
+    LinearAllocator() noexcept = default;
+    explicit LinearAllocator(size_t capacity);
+
+/**@section Destructor */
+public:
+    ~LinearAllocator();
+
+/**@section Method */
+public:
+    /**
+     * @brief   Allocates the uninitialized memory.
+     * @param size          The size of the memory in bytes.
+     * @param alignment     The alignment of the memory. It must be a power of two.
+     * @return  The allocated memory. It stays valid until the allocator is rewound over it.
+     */
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief   Allocates the uninitialized memory for the array of the specified type.
+     * @param count     The number of elements.
+     * @return  The allocated array.
+     */
+    template <typename _Type>
+    [[nodiscard]] _Type* Allocate(size_t count);
+
+    /**
+     * @brief   Gives the memory back to the allocator if it was the last allocation.
+     * @param ptr   The memory which was allocated by this allocator.
+     * @param size  The size of the memory in bytes.
+     * @remark  The other memory is reclaimed when the allocator is rewound or reset.
+     */
+    void Deallocate(void* ptr, size_t size) noexcept;
+
+    /**
+     * @brief   Gets the current state of the allocator.
+     * @return  The marker which can be passed to Rewind.
+     */
+    [[nodiscard]] Marker GetMarker() const noexcept;
+
+    /**
+     * @brief   Frees all of the memory which was allocated after the marker was taken.
+     * @param marker    The marker which was taken from this allocator.
+     */
+    void Rewind(const Marker& marker) noexcept;
+
+    /**
+     * @brief   Frees all of the memory. If the allocator has overflowed, the buffer is grown to cover the high-water mark.
+     */
+    void Reset();
+
+    /**
+     * @brief   Replaces the buffer with a larger one.
+     * @param capacity  The size of the buffer in bytes.
+     * @remark  The allocator must be empty, because the buffer is reallocated.
+     */
+    void Reserve(size_t capacity);
+
+    [[nodiscard]] size_t GetCapacity() const noexcept;
+
+    /**
+     * @brief   Gets the size of the memory which is in use, including the overflow.
+     */
+    [[nodiscard]] size_t GetUsedSize() const noexcept;
+
+    /**
+     * @brief   Gets the size of the overflow since the last reset.
+     */
+    [[nodiscard]] size_t GetOverflowSize() const noexcept;
+
+    /**
+     * @brief   Gets the number of the allocations which have overflowed since the last reset.
+     */
+    [[nodiscard]] size_t GetOverflowCount() const noexcept;
+
+    /**
+     * @brief   Gets the largest size of the memory which has been in use at once.
+     */
+    [[nodiscard]] size_t GetHighWaterMark() const noexcept;
+
+private:
+    [[nodiscard]] void* AllocateOverflow(size_t size, size_t alignment);
+    void FreeOverflowBlocks(const OverflowBlock* lastBlock) noexcept;
+
+/**@section Variable */
+private:
+    std::unique_ptr<std::byte[]> m_buffer;
+    size_t m_capacity = 0;
+    size_t m_offset = 0;
+    OverflowBlock* m_overflowBlock = nullptr;
+    size_t m_overflowSize = 0;
+    size_t m_overflowCount = 0;
+    size_t m_highWaterMark = 0;
+};
+
+/**
+ * @brief   The allocator of the standard containers which takes the memory from a LinearAllocator.
+ * @remark  The containers must not outlive the memory, so they are meant to be the temporaries of a frame or a scope.
+ */
+template <typename _Type>
+class LinearAllocatorAdapter
+{
+/**@section Type */
+public:
+    using value_type = _Type;
+
+/**@section Constructor */
+public:
+    LinearAllocatorAdapter(LinearAllocator& allocator) noexcept;
+    template <typename _Type2>
+    LinearAllocatorAdapter(const LinearAllocatorAdapter<_Type2>& rhs) noexcept;
+
+/**@section Operator */
+public:
+    template <typename _Type2>
+    bool operator==(const LinearAllocatorAdapter<_Type2>& rhs) const noexcept;
+    template <typename _Type2>
+    bool operator!=(const LinearAllocatorAdapter<_Type2>& rhs) const noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] _Type* allocate(size_t count);
+    void deallocate(_Type* ptr, size_t count) noexcept;
+    [[nodiscard]] LinearAllocator& GetAllocator() const noexcept;
+
+/**@section Variable */
+private:
+    LinearAllocator* m_allocator;
+};
+
+inline void* LinearAllocator::Allocate(size_t size, size_t alignment)
+{
+    const auto bufferAddress = reinterpret_cast<uintptr_t>(m_buffer.get());
+    const auto alignedOffset = AlignOf(bufferAddress + m_offset, alignment) - bufferAddress;
+    if (alignedOffset + size > m_capacity)
+    {
+        return this->AllocateOverflow(size, alignment);
+    }
+
+    m_offset = alignedOffset + size;
+    return reinterpret_cast<void*>(bufferAddress + alignedOffset);
+}
+
+template <typename _Type>
+_Type* LinearAllocator::Allocate(size_t count)
+{
+    return static_cast<_Type*>(this->Allocate(sizeof(_Type) * count, alignof(_Type)));
+}
+
+inline void LinearAllocator::Deallocate(void* ptr, size_t size) noexcept
+{
+    if (static_cast<std::byte*>(ptr) + size == m_buffer.get() + m_offset)
+    {
+        m_offset -= size;
+    }
+}
+
+inline LinearAllocator::Marker LinearAllocator::GetMarker() const noexcept
+{
+    return Marker{m_offset, m_overflowBlock};
+}
+
+inline size_t LinearAllocator::GetCapacity() const noexcept
+{
+    return m_capacity;
+}
+
+inline size_t LinearAllocator::GetUsedSize() const noexcept
+{
+    return m_offset + m_overflowSize;
+}
+
+inline size_t LinearAllocator::GetOverflowSize() const noexcept
+{
+    return m_overflowSize;
+}
+
+inline size_t LinearAllocator::GetOverflowCount() const noexcept
+{
+    return m_overflowCount;
+}
+
+inline size_t LinearAllocator::GetHighWaterMark() const noexcept
+{
+    return std::max(m_highWaterMark, this->GetUsedSize());
+}
+
+template <typename _Type>
+LinearAllocatorAdapter<_Type>::LinearAllocatorAdapter(LinearAllocator& allocator) noexcept :
+    m_allocator(&allocator)
+{
+}
+
+template <typename _Type>
+template <typename _Type2>
+LinearAllocatorAdapter<_Type>::LinearAllocatorAdapter(const LinearAllocatorAdapter<_Type2>& rhs) noexcept :
+    m_allocator(&rhs.GetAllocator())
+{
+}
+
+template <typename _Type>
+template <typename _Type2>
+bool LinearAllocatorAdapter<_Type>::operator==(const LinearAllocatorAdapter<_Type2>& rhs) const noexcept
+{
+    return m_allocator == &rhs.GetAllocator();
+}
+
+template <typename _Type>
+template <typename _Type2>
+bool LinearAllocatorAdapter<_Type>::operator!=(const LinearAllocatorAdapter<_Type2>& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+template <typename _Type>
+_Type* LinearAllocatorAdapter<_Type>::allocate(size_t count)
+{
+    return m_allocator->template Allocate<_Type>(count);
+}
+
+template <typename _Type>
+void LinearAllocatorAdapter<_Type>::deallocate(_Type* ptr, size_t count) noexcept
+{
+    m_allocator->Deallocate(ptr, sizeof(_Type) * count);
+}
+
+template <typename _Type>
+LinearAllocator& LinearAllocatorAdapter<_Type>::GetAllocator() const noexcept
+{
+    return *m_allocator;
+}
+
+}
@@ -0,0 +1,78 @@
+#include "PrecompiledHeader.h"
+
+#include <array>
+
+#include "MemoryResource.h"
+
+namespace tg
+{
+
+TrackingMemoryResource::TrackingMemoryResource(std::pmr::memory_resource* upstream) noexcept :
+    m_upstream(upstream)
+{
+}
+
+TrackingMemoryResource* TrackingMemoryResource::GetInstance(MemoryTag tag) noexcept
+{
+    // Never destroyed, because the containers of the static objects can free their memory at exit.
+    static auto* resources = new std::array<TrackingMemoryResource, static_cast<size_t>(MemoryTag::Count)>();
+
+    return &(*resources)[static_cast<size_t>(tag)];
+}
+
+std::pmr::memory_resource* TrackingMemoryResource::GetUpstream() const noexcept
+{
+    return m_upstream;
+}
+
+size_t TrackingMemoryResource::GetAllocatedSize() const noexcept
+{
+    return m_allocatedSize.load(std::memory_order_relaxed);
+}
+
+size_t TrackingMemoryResource::GetPeakAllocatedSize() const noexcept
+{
+    return m_peakAllocatedSize.load(std::memory_order_relaxed);
+}
+
+size_t TrackingMemoryResource::GetAllocationCount() const noexcept
+{
+    return m_allocationCount.load(std::memory_order_relaxed);
+}
+
+size_t TrackingMemoryResource::GetTotalAllocationCount() const noexcept
+{
+    return m_totalAllocationCount.load(std::memory_order_relaxed);
+}
+
+void* TrackingMemoryResource::do_allocate(size_t size, size_t alignment)
+{
+    auto* ptr = m_upstream->allocate(size, alignment);
+
+    // The counters are only statistics, so they don't order the other memory operations.
+    const auto allocatedSize = m_allocatedSize.fetch_add(size, std::memory_order_relaxed) + size;
+    auto peakAllocatedSize = m_peakAllocatedSize.load(std::memory_order_relaxed);
+    while (peakAllocatedSize < allocatedSize && m_peakAllocatedSize.compare_exchange_weak(peakAllocatedSize, allocatedSize, std::memory_order_relaxed) == false)
+    {
+    }
+    m_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    m_totalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    return ptr;
+}
+
+void TrackingMemoryResource::do_deallocate(void* ptr, size_t size, size_t alignment)
+{
+    m_upstream->deallocate(ptr, size, alignment);
+
+    m_allocatedSize.fetch_sub(size, std::memory_order_relaxed);
+    m_allocationCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool TrackingMemoryResource::do_is_equal(const std::pmr::memory_resource& rhs) const noexcept
+{
+    // The memory could be freed through another resource of the same upstream, but then the counters would go wrong.
+    return this == &rhs;
+}
+
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+#include "PoolAllocator.h"
+
+namespace tg
+{
+
+/**
+ * @brief   The subsystems whose memory is accounted separately.
+ */
+enum class MemoryTag
+{
+    General,
+    Scene,
+    Asset,
+    Graphics,
+    Text,
+    Count,
+};
+
+/**
+ * @brief   The memory resource which counts the memory that passes through it, and forwards the allocations to the upstream.
+ * @remark  Each subsystem allocates from the resource of its tag by default, so the memory usage can be reported per
+ *          subsystem. An arena such as std::pmr::monotonic_buffer_resource can be put on top of a tagged resource, and be
+ *          passed to a subsystem instead, e.g. to free the memory of a level in one shot while it's still accounted.
+ */
+class TrackingMemoryResource final :
+    public std::pmr::memory_resource
+{
+/**@section Constructor */
+public:
+    explicit TrackingMemoryResource(std::pmr::memory_resource* upstream = PoolMemoryResource::GetInstance()) noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Gets the resource of the specified subsystem.
+     * @param tag   The tag of the subsystem.
+     * @return  The shared resource which allocates from PoolMemoryResource.
+     */
+    [[nodiscard]] static TrackingMemoryResource* GetInstance(MemoryTag tag) noexcept;
+    [[nodiscard]] std::pmr::memory_resource* GetUpstream() const noexcept;
+
+    /**
+     * @brief   Gets the number of the bytes which are allocated and not freed yet.
+     */
+    [[nodiscard]] size_t GetAllocatedSize() const noexcept;
+
+    /**
+     * @brief   Gets the largest number of the bytes which have been allocated at once.
+     */
+    [[nodiscard]] size_t GetPeakAllocatedSize() const noexcept;
+
+    /**
+     * @brief   Gets the number of the allocations which are not freed yet.
+     */
+    [[nodiscard]] size_t GetAllocationCount() const noexcept;
+
+    /**
+     * @brief   Gets the number of the allocations which have been made, including the freed ones.
+     */
+    [[nodiscard]] size_t GetTotalAllocationCount() const noexcept;
+
+private:
+    void* do_allocate(size_t size, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t size, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& rhs) const noexcept override;
+
+/**@section Variable */
+private:
+    std::pmr::memory_resource* m_upstream;
+    std::atomic<size_t> m_allocatedSize = 0;
+    std::atomic<size_t> m_peakAllocatedSize = 0;
+    std::atomic<size_t> m_allocationCount = 0;
+    std::atomic<size_t> m_totalAllocationCount = 0;
+};
+
+}
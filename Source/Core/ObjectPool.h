@@ -0,0 +1,464 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#include "NonCopyable.h"
+
+namespace tg
+{
+
+template <typename _Type>
+struct PoolHandle
+{
+/**@section Operator */
+public:
+    constexpr bool operator==(const PoolHandle& rhs) const noexcept;
+    constexpr bool operator!=(const PoolHandle& rhs) const noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Checks whether the handle was issued by a pool.
+     * @return  True if the handle was issued by a pool, false otherwise.
+     * @remark  This doesn't check whether the object which the handle points to is still alive. Use ObjectPool::IsValid instead.
+     */
+    [[nodiscard]] constexpr bool IsNull() const noexcept;
+
+/**@section Variable */
+public:
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+    uint32_t index = InvalidIndex;
+    uint32_t generation = 0;
+};
+
+template <typename _Type>
+constexpr bool PoolHandle<_Type>::operator==(const PoolHandle& rhs) const noexcept
+{
+    return index == rhs.index && generation == rhs.generation;
+}
+
+template <typename _Type>
+constexpr bool PoolHandle<_Type>::operator!=(const PoolHandle& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+template <typename _Type>
+constexpr bool PoolHandle<_Type>::IsNull() const noexcept
+{
+    return index == InvalidIndex;
+}
+
+/**
+ * @brief   Stores the objects of a single type in fixed-size chunks and recycles the freed slots.
+ * @remark  The address of an object never changes while it is alive. Each slot has a generation counter
+ *          which is increased whenever the slot is freed, so that the stale handles can be detected in O(1).
+ */
+template <typename _Type, size_t _ChunkCapacity = 128>
+class ObjectPool final :
+    private NonCopyable
+{
+/**@section Type */
+public:
+    using Handle = PoolHandle<_Type>;
+    using ValueType = _Type;
+
+private:
+    struct Slot
+    {
+        alignas(_Type) std::byte storage[sizeof(_Type)];
+        uint32_t index;
+        uint32_t generation;
+        bool isAlive;
+    };
+
+    struct ChunkDeleter
+    {
+        void operator()(Slot* chunk) const noexcept;
+
+        std::pmr::memory_resource* memoryResource;
+    };
+
+/**@section Constructor */
+public:
+    ObjectPool() noexcept = default;
+
+    /**
+     * @brief   Initializes the pool.
+     * @param memoryResource    The resource which the chunks and the free list are allocated from.
+     */
+    explicit ObjectPool(std::pmr::memory_resource* memoryResource) noexcept;
+
+    ObjectPool(ObjectPool&& rhs) noexcept;
+
+/**@section Destructor */
+public:
+    ~ObjectPool();
+
+/**@section Operator */
+public:
+    /**
+     * @brief   Destroys the alive objects of this pool, and takes the objects of rhs.
+     */
+    ObjectPool& operator=(ObjectPool&& rhs) noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Constructs a new object in a free slot.
+     * @param args  Arguments for construct the object.
+     * @return  The handle of the created object.
+     */
+    template <typename... _Types>
+    Handle Create(_Types&&... args);
+
+    /**
+     * @brief   Destroys the object and returns its slot to the free list.
+     * @param handle    The handle of the object.
+     * @return  True if the object was destroyed, false if the handle was stale.
+     */
+    bool Destroy(const Handle& handle);
+
+    /**
+     * @brief   Destroys the object and returns its slot to the free list.
+     * @param object    The object which was created by this pool.
+     * @return  True if the object was destroyed, false otherwise.
+     */
+    bool Destroy(const _Type* object);
+
+    /**
+     * @brief   Destroys all of the alive objects. The allocated chunks are kept for reuse.
+     */
+    void Clear();
+
+    /**
+     * @brief   Allocates the chunks in advance so that the specified number of objects can be created without allocation.
+     * @param capacity  The number of objects.
+     */
+    void Reserve(size_t capacity);
+
+    /**
+     * @brief   Checks whether the object which the handle points to is alive.
+     * @param handle    The handle of the object.
+     * @return  True if the object is alive, false otherwise.
+     */
+    [[nodiscard]] bool IsValid(const Handle& handle) const noexcept;
+
+    /**
+     * @brief   Gets the object which the handle points to.
+     * @param handle    The handle of the object.
+     * @return  The object or nullptr if the handle was stale.
+     */
+    [[nodiscard]] _Type* Get(const Handle& handle) noexcept;
+
+    /**
+     * @brief   Gets the object which the handle points to.
+     * @param handle    The handle of the object.
+     * @return  The object or nullptr if the handle was stale.
+     */
+    [[nodiscard]] const _Type* Get(const Handle& handle) const noexcept;
+
+    /**
+     * @brief   Gets the handle of the object which was created by this pool.
+     * @param object    The object.
+     * @return  The handle of the object.
+     */
+    [[nodiscard]] static Handle GetHandle(const _Type* object) noexcept;
+
+    /**
+     * @brief   Invokes the callback with every alive object in slot order.
+     * @param callback  The callback which receives _Type&.
+     */
+    template <typename _Callback>
+    void ForEach(const _Callback& callback);
+
+    /**
+     * @brief   Invokes the callback with every alive object whose slot index is in [beginIndex, endIndex).
+     * @param beginIndex    The first slot index.
+     * @param endIndex      The slot index past the last one.
+     * @param callback      The callback which receives _Type&.
+     * @remark  Disjoint ranges can be visited from different threads as long as no object is created or destroyed meanwhile.
+     */
+    template <typename _Callback>
+    void ForEach(size_t beginIndex, size_t endIndex, const _Callback& callback);
+
+    [[nodiscard]] size_t GetSize() const noexcept;
+    [[nodiscard]] size_t GetCapacity() const noexcept;
+    [[nodiscard]] std::pmr::memory_resource* GetMemoryResource() const noexcept;
+
+private:
+    void AddChunk();
+    [[nodiscard]] Slot& GetSlot(uint32_t index) noexcept;
+    [[nodiscard]] const Slot& GetSlot(uint32_t index) const noexcept;
+    void DestroySlot(Slot& slot);
+
+/**@section Variable */
+private:
+    std::pmr::vector<std::unique_ptr<Slot[], ChunkDeleter>> m_chunks;
+    std::pmr::vector<uint32_t> m_freeIndices;
+    size_t m_size = 0;
+};
+
+template <typename _Type, size_t _ChunkCapacity>
+void ObjectPool<_Type, _ChunkCapacity>::ChunkDeleter::operator()(Slot* chunk) const noexcept
+{
+    memoryResource->deallocate(chunk, sizeof(Slot) * _ChunkCapacity, alignof(Slot));
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+ObjectPool<_Type, _ChunkCapacity>::ObjectPool(std::pmr::memory_resource* memoryResource) noexcept :
+    m_chunks(memoryResource),
+    m_freeIndices(memoryResource)
+{
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+ObjectPool<_Type, _ChunkCapacity>::ObjectPool(ObjectPool&& rhs) noexcept :
+    m_chunks(std::move(rhs.m_chunks)),
+    m_freeIndices(std::move(rhs.m_freeIndices)),
+    m_size(rhs.m_size)
+{
+    rhs.m_size = 0;
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+ObjectPool<_Type, _ChunkCapacity>::~ObjectPool()
+{
+    this->Clear();
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+ObjectPool<_Type, _ChunkCapacity>& ObjectPool<_Type, _ChunkCapacity>::operator=(ObjectPool&& rhs) noexcept
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    // The defaulted assignment would free the chunks of this pool without destroying the objects in them.
+    this->Clear();
+
+    m_chunks = std::move(rhs.m_chunks);
+    m_freeIndices = std::move(rhs.m_freeIndices);
+    m_size = rhs.m_size;
+
+    // The vectors which have the different memory resources are moved element-wise, so they keep the emptied chunks.
+    rhs.m_chunks.clear();
+    rhs.m_freeIndices.clear();
+    rhs.m_size = 0;
+
+    return *this;
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+template <typename... _Types>
+typename ObjectPool<_Type, _ChunkCapacity>::Handle ObjectPool<_Type, _ChunkCapacity>::Create(_Types&&... args)
+{
+    if (m_freeIndices.empty())
+    {
+        this->AddChunk();
+    }
+
+    auto& slot = this->GetSlot(m_freeIndices.back());
+    new (&slot.storage[0]) _Type(std::forward<_Types>(args)...);
+
+    // Pop the free index after the construction, so that the slot isn't lost if the constructor throws.
+    m_freeIndices.pop_back();
+    slot.isAlive = true;
+    ++m_size;
+
+    return Handle{slot.index, slot.generation};
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+bool ObjectPool<_Type, _ChunkCapacity>::Destroy(const Handle& handle)
+{
+    if (this->IsValid(handle) == false)
+    {
+        return false;
+    }
+
+    this->DestroySlot(this->GetSlot(handle.index));
+    return true;
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+bool ObjectPool<_Type, _ChunkCapacity>::Destroy(const _Type* object)
+{
+    if (object == nullptr)
+    {
+        return false;
+    }
+
+    return this->Destroy(GetHandle(object));
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+void ObjectPool<_Type, _ChunkCapacity>::Clear()
+{
+    for (auto& chunk : m_chunks)
+    {
+        for (size_t i = 0; i < _ChunkCapacity; ++i)
+        {
+            if (chunk[i].isAlive)
+            {
+                this->DestroySlot(chunk[i]);
+            }
+        }
+    }
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+void ObjectPool<_Type, _ChunkCapacity>::Reserve(size_t capacity)
+{
+    while (this->GetCapacity() < capacity)
+    {
+        this->AddChunk();
+    }
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+bool ObjectPool<_Type, _ChunkCapacity>::IsValid(const Handle& handle) const noexcept
+{
+    if (handle.index >= this->GetCapacity())
+    {
+        return false;
+    }
+
+    const auto& slot = this->GetSlot(handle.index);
+    return slot.isAlive && slot.generation == handle.generation;
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+_Type* ObjectPool<_Type, _ChunkCapacity>::Get(const Handle& handle) noexcept
+{
+    if (this->IsValid(handle) == false)
+    {
+        return nullptr;
+    }
+
+    return std::launder(reinterpret_cast<_Type*>(&this->GetSlot(handle.index).storage[0]));
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+const _Type* ObjectPool<_Type, _ChunkCapacity>::Get(const Handle& handle) const noexcept
+{
+    return const_cast<ObjectPool*>(this)->Get(handle);
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+typename ObjectPool<_Type, _ChunkCapacity>::Handle ObjectPool<_Type, _ChunkCapacity>::GetHandle(const _Type* object) noexcept
+{
+    // The object storage is the first member of the slot, so the slot can be reached from the object address.
+    const auto* slot = reinterpret_cast<const Slot*>(reinterpret_cast<const std::byte*>(object) - offsetof(Slot, storage));
+    return Handle{slot->index, slot->generation};
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+template <typename _Callback>
+void ObjectPool<_Type, _ChunkCapacity>::ForEach(const _Callback& callback)
+{
+    // Iterate by index because the callback may create objects, which can reallocate m_chunks.
+    for (size_t chunkIndex = 0; chunkIndex < m_chunks.size(); ++chunkIndex)
+    {
+        for (size_t i = 0; i < _ChunkCapacity; ++i)
+        {
+            auto& slot = m_chunks[chunkIndex][i];
+            if (slot.isAlive)
+            {
+                callback(*std::launder(reinterpret_cast<_Type*>(&slot.storage[0])));
+            }
+        }
+    }
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+template <typename _Callback>
+void ObjectPool<_Type, _ChunkCapacity>::ForEach(size_t beginIndex, size_t endIndex, const _Callback& callback)
+{
+    for (auto i = beginIndex; i < endIndex && i < this->GetCapacity(); ++i)
+    {
+        auto& slot = this->GetSlot(static_cast<uint32_t>(i));
+        if (slot.isAlive)
+        {
+            callback(*std::launder(reinterpret_cast<_Type*>(&slot.storage[0])));
+        }
+    }
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+size_t ObjectPool<_Type, _ChunkCapacity>::GetSize() const noexcept
+{
+    return m_size;
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+size_t ObjectPool<_Type, _ChunkCapacity>::GetCapacity() const noexcept
+{
+    return m_chunks.size() * _ChunkCapacity;
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+std::pmr::memory_resource* ObjectPool<_Type, _ChunkCapacity>::GetMemoryResource() const noexcept
+{
+    return m_chunks.get_allocator().resource();
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+void ObjectPool<_Type, _ChunkCapacity>::AddChunk()
+{
+    const auto baseIndex = static_cast<uint32_t>(this->GetCapacity());
+
+    auto* memoryResource = this->GetMemoryResource();
+    auto chunk = std::unique_ptr<Slot[], ChunkDeleter>(static_cast<Slot*>(memoryResource->allocate(sizeof(Slot) * _ChunkCapacity, alignof(Slot))), ChunkDeleter{memoryResource});
+    for (size_t i = 0; i < _ChunkCapacity; ++i)
+    {
+        new (&chunk[i]) Slot;
+        chunk[i].index = baseIndex + static_cast<uint32_t>(i);
+        chunk[i].generation = 0;
+        chunk[i].isAlive = false;
+    }
+    m_chunks.push_back(std::move(chunk));
+
+    // Reserve the free list to the full capacity, so returning a slot never allocates.
+    m_freeIndices.reserve(this->GetCapacity());
+
+    // Push in reverse order so that the slots are handed out in ascending order.
+    for (size_t i = _ChunkCapacity; i > 0; --i)
+    {
+        m_freeIndices.push_back(baseIndex + static_cast<uint32_t>(i - 1));
+    }
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+typename ObjectPool<_Type, _ChunkCapacity>::Slot& ObjectPool<_Type, _ChunkCapacity>::GetSlot(uint32_t index) noexcept
+{
+    return m_chunks[index / _ChunkCapacity][index % _ChunkCapacity];
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+const typename ObjectPool<_Type, _ChunkCapacity>::Slot& ObjectPool<_Type, _ChunkCapacity>::GetSlot(uint32_t index) const noexcept
+{
+    return m_chunks[index / _ChunkCapacity][index % _ChunkCapacity];
+}
+
+template <typename _Type, size_t _ChunkCapacity>
+void ObjectPool<_Type, _ChunkCapacity>::DestroySlot(Slot& slot)
+{
+    // Mark the slot as dead before destruction, so that reentrant lookups during the destructor see a stale handle.
+    slot.isAlive = false;
+    ++slot.generation;
+    --m_size;
+
+    std::launder(reinterpret_cast<_Type*>(&slot.storage[0]))->~_Type();
+
+    m_freeIndices.push_back(slot.index);
+}
+
+}
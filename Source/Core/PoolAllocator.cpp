@@ -0,0 +1,188 @@
+#include "PrecompiledHeader.h"
+
+#include <utility>
+
+#include "PoolAllocator.h"
+
+namespace tg
+{
+namespace detail
+{
+
+BlockPool::BlockPool(size_t blockSize, size_t batchSize) noexcept :
+    m_blockSize(blockSize),
+    m_batchSize(batchSize)
+{
+}
+
+void BlockPool::Refill(PoolThreadCache& cache)
+{
+    if (cache.spare.head != nullptr)
+    {
+        cache.head = cache.spare.head;
+        cache.count = cache.spare.count;
+        cache.spare = {};
+        return;
+    }
+
+    std::lock_guard lockGuard(m_mutex);
+
+    if (m_batches.empty())
+    {
+        const auto batchByteSize = m_batchSize * m_blockSize;
+        auto& chunk = m_chunks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(BatchCountPerChunk * batchByteSize));
+        for (size_t i = 0; i < BatchCountPerChunk; ++i)
+        {
+            auto* batchBegin = &chunk[i * batchByteSize];
+            for (size_t j = 0; j < m_batchSize; ++j)
+            {
+                reinterpret_cast<PoolFreeBlock*>(&batchBegin[j * m_blockSize])->next = (j + 1 < m_batchSize) ? reinterpret_cast<PoolFreeBlock*>(&batchBegin[(j + 1) * m_blockSize]) : nullptr;
+            }
+
+            m_batches.push_back(PoolBatch{reinterpret_cast<PoolFreeBlock*>(batchBegin), m_batchSize});
+        }
+    }
+
+    const auto batch = m_batches.back();
+    m_batches.pop_back();
+
+    cache.head = batch.head;
+    cache.count = batch.count;
+}
+
+void BlockPool::Flush(PoolThreadCache& cache) noexcept
+{
+    if (cache.spare.head != nullptr)
+    {
+        this->ReturnBatch(cache.spare);
+        cache.spare = {};
+    }
+
+    if (cache.head == nullptr)
+    {
+        return;
+    }
+
+    if (cache.isClosed)
+    {
+        this->ReturnBatch(PoolBatch{cache.head, cache.count});
+    }
+    else
+    {
+        cache.spare = PoolBatch{cache.head, cache.count};
+    }
+
+    cache.head = nullptr;
+    cache.count = 0;
+}
+
+void BlockPool::Close(PoolThreadCache& cache) noexcept
+{
+    cache.isClosed = true;
+    this->Flush(cache);
+}
+
+size_t BlockPool::GetCapacity()
+{
+    std::lock_guard lockGuard(m_mutex);
+    return m_chunks.size() * BatchCountPerChunk * m_batchSize;
+}
+
+void BlockPool::ReturnBatch(const PoolBatch& batch) noexcept
+{
+    std::lock_guard lockGuard(m_mutex);
+    m_batches.push_back(batch);
+}
+
+}
+
+SmallObjectAllocator::ThreadCacheCloser::~ThreadCacheCloser()
+{
+    for (size_t i = 0; i < SizeClasses.size(); ++i)
+    {
+        GetBlockPool(i).Close(m_threadCaches[i]);
+    }
+}
+
+void SmallObjectAllocator::Refill(size_t sizeClassIndex)
+{
+    OpenThreadCaches();
+    GetBlockPool(sizeClassIndex).Refill(m_threadCaches[sizeClassIndex]);
+}
+
+void SmallObjectAllocator::Flush(size_t sizeClassIndex) noexcept
+{
+    GetBlockPool(sizeClassIndex).Flush(m_threadCaches[sizeClassIndex]);
+}
+
+void SmallObjectAllocator::OpenThreadCaches() noexcept
+{
+    // All of the caches are closed at once, so the first one tells whether the thread is exiting.
+    if (m_threadCaches[0].isClosed == false)
+    {
+        [[maybe_unused]] thread_local ThreadCacheCloser closer;
+    }
+}
+
+detail::BlockPool& SmallObjectAllocator::GetBlockPool(size_t sizeClassIndex)
+{
+    // Never destroyed, because the blocks can be freed by the static objects at exit.
+    static auto* blockPools = []<size_t... _Indices>(std::index_sequence<_Indices...>)
+    {
+        return new std::array<detail::BlockPool, SizeClasses.size()>{detail::BlockPool(SizeClasses[_Indices], BatchSizes[_Indices])...};
+    }(std::make_index_sequence<SizeClasses.size()>());
+
+    return (*blockPools)[sizeClassIndex];
+}
+
+PoolMemoryResource::PoolMemoryResource(std::pmr::memory_resource* upstream) noexcept :
+    m_upstream(upstream)
+{
+}
+
+PoolMemoryResource* PoolMemoryResource::GetInstance() noexcept
+{
+    // Never destroyed, because the containers of the static objects can free their memory at exit.
+    static auto* resource = new PoolMemoryResource();
+    return resource;
+}
+
+std::pmr::memory_resource* PoolMemoryResource::GetUpstream() const noexcept
+{
+    return m_upstream;
+}
+
+void* PoolMemoryResource::do_allocate(size_t size, size_t alignment)
+{
+    if (size > SmallObjectAllocator::MaxSize || alignment > alignof(std::max_align_t))
+    {
+        return m_upstream->allocate(size, alignment);
+    }
+
+    return SmallObjectAllocator::Allocate(size);
+}
+
+void PoolMemoryResource::do_deallocate(void* ptr, size_t size, size_t alignment)
+{
+    if (size > SmallObjectAllocator::MaxSize || alignment > alignof(std::max_align_t))
+    {
+        m_upstream->deallocate(ptr, size, alignment);
+        return;
+    }
+
+    SmallObjectAllocator::Deallocate(ptr, size);
+}
+
+bool PoolMemoryResource::do_is_equal(const std::pmr::memory_resource& rhs) const noexcept
+{
+    // The pools are shared, so the resources are only different in their upstreams.
+    if (this == &rhs)
+    {
+        return true;
+    }
+
+    const auto* poolMemoryResource = dynamic_cast<const PoolMemoryResource*>(&rhs);
+    return poolMemoryResource != nullptr && poolMemoryResource->m_upstream->is_equal(*m_upstream);
+}
+
+}
@@ -0,0 +1,414 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "NonCopyable.h"
+
+namespace tg
+{
+namespace detail
+{
+
+struct PoolFreeBlock
+{
+    PoolFreeBlock* next;
+};
+
+struct PoolBatch
+{
+    PoolFreeBlock* head;
+    size_t count;
+};
+
+/**
+ * @brief   The free lists of a thread. It's trivially destructible, so it can still be used after the thread has flushed
+ *          it on exit, e.g. by the static objects which are destroyed after the thread locals.
+ * @remark  The full batch is set aside as the spare instead of being returned at once, so that alternating allocations and
+ *          frees don't bounce at the boundary. The lists are never walked.
+ */
+struct PoolThreadCache
+{
+/**@section Method */
+public:
+    [[nodiscard]] void* Pop() noexcept;
+
+    /**
+     * @brief   Pushes the freed block.
+     * @return  True if the cache has to be flushed.
+     */
+    [[nodiscard]] bool Push(void* ptr, size_t batchSize) noexcept;
+
+/**@section Variable */
+public:
+    PoolFreeBlock* head;
+    size_t count;
+    PoolBatch spare;
+    bool isClosed;
+};
+
+/**
+ * @brief   The central pool of a block size which exchanges the batches with the thread caches.
+ */
+class BlockPool final :
+    private NonCopyable
+{
+/**@section Constructor */
+public:
+    BlockPool(size_t blockSize, size_t batchSize) noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Fills the empty cache with its spare or a batch of the pool.
+     */
+    void Refill(PoolThreadCache& cache);
+
+    /**
+     * @brief   Sets the full cache aside as the spare, or returns all of the blocks if the cache is closed.
+     */
+    void Flush(PoolThreadCache& cache) noexcept;
+
+    /**
+     * @brief   Returns all of the blocks of the exiting thread, and makes the later frees of the thread go to the pool directly.
+     */
+    void Close(PoolThreadCache& cache) noexcept;
+
+    [[nodiscard]] size_t GetCapacity();
+
+    /**
+     * @brief   Gets the number of the blocks which are moved between a thread and the pool at once.
+     */
+    [[nodiscard]] static constexpr size_t GetBatchSize(size_t blockSize) noexcept;
+
+private:
+    void ReturnBatch(const PoolBatch& batch) noexcept;
+
+/**@section Variable */
+private:
+    static constexpr size_t BatchCountPerChunk = 8;
+
+    size_t m_blockSize;
+    size_t m_batchSize;
+    std::mutex m_mutex;
+    std::vector<PoolBatch> m_batches;
+    std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+};
+
+inline void* PoolThreadCache::Pop() noexcept
+{
+    auto* block = head;
+    head = block->next;
+    --count;
+
+    return block;
+}
+
+inline bool PoolThreadCache::Push(void* ptr, size_t batchSize) noexcept
+{
+    auto* block = static_cast<PoolFreeBlock*>(ptr);
+    block->next = head;
+    head = block;
+
+    return ++count >= batchSize || isClosed;
+}
+
+constexpr size_t BlockPool::GetBatchSize(size_t blockSize) noexcept
+{
+    return std::max<size_t>(4096 / blockSize, 8);
+}
+
+}
+
+/**
+ * @brief   Allocates the fixed-size blocks from the free list of the calling thread.
+ * @remark  Each thread caches the freed blocks, and exchanges them with the central pool in batches, so the lock of the
+ *          pool is taken once per batch instead of once per allocation. The blocks can be freed by any thread. The memory
+ *          of the pool is never given back to the system, but the blocks of the exited threads are reused.
+ *          The blocks are aligned to the largest power of two which divides the block size, up to alignof(std::max_align_t).
+ */
+template <size_t _BlockSize>
+class PoolAllocator final
+{
+    static_assert(_BlockSize >= sizeof(void*) && _BlockSize % alignof(void*) == 0, "The block must be able to hold a pointer.");
+
+/**@section Type */
+private:
+    struct ThreadCacheCloser
+    {
+        ~ThreadCacheCloser();
+    };
+
+/**@section Constructor */
+public:
+    PoolAllocator() = delete;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Allocates a block.
+     * @return  The uninitialized block of BlockSize bytes.
+     */
+    [[nodiscard]] static void* Allocate();
+
+    /**
+     * @brief   Frees the block into the cache of the calling thread.
+     * @param ptr   The block which was allocated by this allocator.
+     */
+    static void Deallocate(void* ptr) noexcept;
+
+    /**
+     * @brief   Gets the number of the blocks which have been carved out of the system memory.
+     */
+    [[nodiscard]] static size_t GetCapacity();
+
+private:
+    static void Refill();
+    static void Flush() noexcept;
+    static void OpenThreadCache() noexcept;
+    [[nodiscard]] static detail::BlockPool& GetBlockPool();
+
+/**@section Variable */
+public:
+    static constexpr size_t BlockSize = _BlockSize;
+    static constexpr size_t BatchSize = detail::BlockPool::GetBatchSize(_BlockSize);
+
+private:
+    inline static thread_local detail::PoolThreadCache m_threadCache{};
+};
+
+/**
+ * @brief   Allocates the small objects from the pool of the nearest size class.
+ * @remark  There are four size classes between each power of two, so at most a fifth of a block is wasted. The size class
+ *          is looked up from a table instead of dispatching to each PoolAllocator, so the branches don't depend on the
+ *          size. The sizes which are larger than MaxSize fall back to the global heap.
+ */
+class SmallObjectAllocator final
+{
+/**@section Type */
+private:
+    struct ThreadCacheCloser
+    {
+        ~ThreadCacheCloser();
+    };
+
+/**@section Constructor */
+public:
+    SmallObjectAllocator() = delete;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Allocates the uninitialized memory which is aligned for std::max_align_t.
+     * @param size  The size of the memory in bytes.
+     * @return  The allocated memory.
+     */
+    [[nodiscard]] static void* Allocate(size_t size);
+
+    /**
+     * @brief   Frees the memory.
+     * @param ptr   The memory which was allocated by this allocator.
+     * @param size  The size which was passed to Allocate.
+     */
+    static void Deallocate(void* ptr, size_t size) noexcept;
+
+private:
+    [[nodiscard]] static size_t GetSizeClassIndex(size_t size) noexcept;
+    static void Refill(size_t sizeClassIndex);
+    static void Flush(size_t sizeClassIndex) noexcept;
+    static void OpenThreadCaches() noexcept;
+    [[nodiscard]] static detail::BlockPool& GetBlockPool(size_t sizeClassIndex);
+
+/**@section Variable */
+public:
+    static constexpr size_t MaxSize = 512;
+
+private:
+    // Every size class is a multiple of the alignment of std::max_align_t, so all of the blocks are aligned for it.
+    static constexpr size_t SizeClassGranularity = alignof(std::max_align_t);
+    static constexpr std::array<size_t, 16> SizeClasses{16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512};
+    static constexpr auto SizeClassIndices = []()
+    {
+        std::array<uint8_t, MaxSize / SizeClassGranularity + 1> sizeClassIndices{};
+        for (size_t i = 0, sizeClassIndex = 0; i < sizeClassIndices.size(); ++i)
+        {
+            while (SizeClasses[sizeClassIndex] < i * SizeClassGranularity)
+            {
+                ++sizeClassIndex;
+            }
+            sizeClassIndices[i] = static_cast<uint8_t>(sizeClassIndex);
+        }
+        return sizeClassIndices;
+    }();
+    static constexpr auto BatchSizes = []()
+    {
+        std::array<size_t, SizeClasses.size()> batchSizes{};
+        for (size_t i = 0; i < SizeClasses.size(); ++i)
+        {
+            batchSizes[i] = detail::BlockPool::GetBatchSize(SizeClasses[i]);
+        }
+        return batchSizes;
+    }();
+
+    inline static thread_local std::array<detail::PoolThreadCache, SizeClasses.size()> m_threadCaches{};
+};
+
+/**
+ * @brief   The memory resource which allocates the small objects from SmallObjectAllocator.
+ * @remark  The allocations which are too large or over-aligned for the pools are forwarded to the upstream resource.
+ */
+class PoolMemoryResource final :
+    public std::pmr::memory_resource
+{
+/**@section Constructor */
+public:
+    explicit PoolMemoryResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Gets the resource which forwards the large allocations to the global heap.
+     * @return  The shared resource.
+     */
+    [[nodiscard]] static PoolMemoryResource* GetInstance() noexcept;
+    [[nodiscard]] std::pmr::memory_resource* GetUpstream() const noexcept;
+
+private:
+    void* do_allocate(size_t size, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t size, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& rhs) const noexcept override;
+
+/**@section Variable */
+private:
+    std::pmr::memory_resource* m_upstream;
+};
+
+template <size_t _BlockSize>
+PoolAllocator<_BlockSize>::ThreadCacheCloser::~ThreadCacheCloser()
+{
+    GetBlockPool().Close(m_threadCache);
+}
+
+template <size_t _BlockSize>
+void* PoolAllocator<_BlockSize>::Allocate()
+{
+    if (m_threadCache.head == nullptr)
+    {
+        Refill();
+    }
+
+    return m_threadCache.Pop();
+}
+
+template <size_t _BlockSize>
+void PoolAllocator<_BlockSize>::Deallocate(void* ptr) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    if (m_threadCache.count == 0)
+    {
+        OpenThreadCache();
+    }
+
+    if (m_threadCache.Push(ptr, BatchSize))
+    {
+        Flush();
+    }
+}
+
+template <size_t _BlockSize>
+size_t PoolAllocator<_BlockSize>::GetCapacity()
+{
+    return GetBlockPool().GetCapacity();
+}
+
+template <size_t _BlockSize>
+void PoolAllocator<_BlockSize>::Refill()
+{
+    OpenThreadCache();
+    GetBlockPool().Refill(m_threadCache);
+}
+
+template <size_t _BlockSize>
+void PoolAllocator<_BlockSize>::Flush() noexcept
+{
+    GetBlockPool().Flush(m_threadCache);
+}
+
+template <size_t _BlockSize>
+void PoolAllocator<_BlockSize>::OpenThreadCache() noexcept
+{
+    // The closer is only touched when the cache is empty, so the hot path doesn't check the initialization of the thread local.
+    if (m_threadCache.isClosed == false)
+    {
+        [[maybe_unused]] thread_local ThreadCacheCloser closer;
+    }
+}
+
+template <size_t _BlockSize>
+detail::BlockPool& PoolAllocator<_BlockSize>::GetBlockPool()
+{
+    // Never destroyed, because the blocks can be freed by the static objects at exit.
+    static auto* blockPool = new detail::BlockPool(_BlockSize, BatchSize);
+    return *blockPool;
+}
+
+inline void* SmallObjectAllocator::Allocate(size_t size)
+{
+    if (size > MaxSize)
+    {
+        return ::operator new(size);
+    }
+
+    const auto sizeClassIndex = GetSizeClassIndex(size);
+    auto& cache = m_threadCaches[sizeClassIndex];
+    if (cache.head == nullptr)
+    {
+        Refill(sizeClassIndex);
+    }
+
+    return cache.Pop();
+}
+
+inline void SmallObjectAllocator::Deallocate(void* ptr, size_t size) noexcept
+{
+    if (size > MaxSize)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    const auto sizeClassIndex = GetSizeClassIndex(size);
+    auto& cache = m_threadCaches[sizeClassIndex];
+    if (cache.count == 0)
+    {
+        OpenThreadCaches();
+    }
+
+    if (cache.Push(ptr, BatchSizes[sizeClassIndex]))
+    {
+        Flush(sizeClassIndex);
+    }
+}
+
+inline size_t SmallObjectAllocator::GetSizeClassIndex(size_t size) noexcept
+{
+    return SizeClassIndices[(size + SizeClassGranularity - 1) / SizeClassGranularity];
+}
+
+}
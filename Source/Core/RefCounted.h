@@ -0,0 +1,331 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace tg
+{
+
+enum class RefCountPolicy
+{
+    Atomic,
+    NonAtomic,
+};
+
+/**
+ * @brief   The base of the objects which hold their own reference count, so that Ref doesn't need a separate control block.
+ * @remark  The count starts from zero, and the object is deleted as _Derived when the last reference is released. The types
+ *          which are only used on the main thread can use RefCountPolicy::NonAtomic to count without the atomic instructions.
+ *          Copying or moving the object doesn't carry the count over.
+ */
+template <typename _Derived, RefCountPolicy _Policy = RefCountPolicy::Atomic>
+class RefCounted
+{
+/**@section Constructor */
+protected:
+    RefCounted() noexcept = default;
+    RefCounted(const RefCounted& rhs) noexcept;
+
+/**@section Destructor */
+protected:
+    ~RefCounted() = default;
+
+/**@section Operator */
+protected:
+    RefCounted& operator=(const RefCounted& rhs) noexcept;
+
+/**@section Method */
+public:
+    void AddRef() const noexcept;
+
+    /**
+     * @brief   Releases a reference, and deletes the object if it was the last one.
+     */
+    void Release() const noexcept;
+
+    [[nodiscard]] int32_t GetRefCount() const noexcept;
+
+/**@section Variable */
+public:
+    static constexpr RefCountPolicy Policy = _Policy;
+
+private:
+    mutable std::conditional_t<_Policy == RefCountPolicy::Atomic, std::atomic<int32_t>, int32_t> m_refCount = 0;
+};
+
+/**
+ * @brief   The smart pointer which shares the ownership of a RefCounted object.
+ * @remark  A reference can be made again from the raw pointer, so the getters can return the borrowed pointers and the
+ *          callers only take a Ref when they keep the object.
+ */
+template <typename _Type>
+class Ref final
+{
+/**@section Type */
+public:
+    using ElementType = _Type;
+
+/**@section Constructor */
+public:
+    constexpr Ref() noexcept = default;
+    constexpr Ref(std::nullptr_t) noexcept;
+
+    /**
+     * @brief   Takes a reference to the object.
+     * @param ptr   The object or nullptr.
+     */
+    explicit Ref(_Type* ptr) noexcept;
+    Ref(const Ref& rhs) noexcept;
+    Ref(Ref&& rhs) noexcept;
+    template <typename _OtherType> requires std::is_convertible_v<_OtherType*, _Type*>
+    Ref(const Ref<_OtherType>& rhs) noexcept;
+    template <typename _OtherType> requires std::is_convertible_v<_OtherType*, _Type*>
+    Ref(Ref<_OtherType>&& rhs) noexcept;
+
+/**@section Destructor */
+public:
+    ~Ref();
+
+/**@section Operator */
+public:
+    Ref& operator=(const Ref& rhs) noexcept;
+    Ref& operator=(Ref&& rhs) noexcept;
+    Ref& operator=(std::nullptr_t) noexcept;
+    [[nodiscard]] _Type& operator*() const noexcept;
+    [[nodiscard]] _Type* operator->() const noexcept;
+    [[nodiscard]] explicit operator bool() const noexcept;
+    template <typename _OtherType>
+    [[nodiscard]] bool operator==(const Ref<_OtherType>& rhs) const noexcept;
+    [[nodiscard]] bool operator==(std::nullptr_t) const noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Gets the object without taking a reference.
+     * @return  The object or nullptr.
+     */
+    [[nodiscard]] _Type* Get() const noexcept;
+
+    /**
+     * @brief   Releases the current object, and takes a reference to the specified one.
+     * @param ptr   The object or nullptr.
+     */
+    void Reset(_Type* ptr = nullptr) noexcept;
+
+/**@section Variable */
+private:
+    template <typename>
+    friend class Ref;
+
+    _Type* m_ptr = nullptr;
+};
+
+/**
+ * @brief   Creates a new object and takes the first reference to it.
+ * @param args  Arguments for construct the object.
+ * @return  The reference to the created object.
+ */
+template <typename _Type, typename... _Types>
+[[nodiscard]] Ref<_Type> MakeRef(_Types&&... args);
+
+template <typename _Derived, RefCountPolicy _Policy>
+RefCounted<_Derived, _Policy>::RefCounted(const RefCounted&) noexcept :
+    m_refCount(0)
+{
+}
+
+template <typename _Derived, RefCountPolicy _Policy>
+RefCounted<_Derived, _Policy>& RefCounted<_Derived, _Policy>::operator=(const RefCounted&) noexcept
+{
+    return *this;
+}
+
+template <typename _Derived, RefCountPolicy _Policy>
+void RefCounted<_Derived, _Policy>::AddRef() const noexcept
+{
+    if constexpr (_Policy == RefCountPolicy::Atomic)
+    {
+        // Taking a new reference needs an existing one, so there is nothing to synchronize with.
+        m_refCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        ++m_refCount;
+    }
+}
+
+template <typename _Derived, RefCountPolicy _Policy>
+void RefCounted<_Derived, _Policy>::Release() const noexcept
+{
+    if constexpr (_Policy == RefCountPolicy::Atomic)
+    {
+        // The last release must see every write which was made through the other references before the deletion.
+        if (m_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete static_cast<const _Derived*>(this);
+        }
+    }
+    else
+    {
+        if (--m_refCount == 0)
+        {
+            delete static_cast<const _Derived*>(this);
+        }
+    }
+}
+
+template <typename _Derived, RefCountPolicy _Policy>
+int32_t RefCounted<_Derived, _Policy>::GetRefCount() const noexcept
+{
+    if constexpr (_Policy == RefCountPolicy::Atomic)
+    {
+        return m_refCount.load(std::memory_order_relaxed);
+    }
+    else
+    {
+        return m_refCount;
+    }
+}
+
+template <typename _Type>
+constexpr Ref<_Type>::Ref(std::nullptr_t) noexcept
+{
+}
+
+template <typename _Type>
+Ref<_Type>::Ref(_Type* ptr) noexcept :
+    m_ptr(ptr)
+{
+    if (m_ptr != nullptr)
+    {
+        m_ptr->AddRef();
+    }
+}
+
+template <typename _Type>
+Ref<_Type>::Ref(const Ref& rhs) noexcept :
+    Ref(rhs.m_ptr)
+{
+}
+
+template <typename _Type>
+Ref<_Type>::Ref(Ref&& rhs) noexcept :
+    m_ptr(std::exchange(rhs.m_ptr, nullptr))
+{
+}
+
+template <typename _Type>
+template <typename _OtherType> requires std::is_convertible_v<_OtherType*, _Type*>
+Ref<_Type>::Ref(const Ref<_OtherType>& rhs) noexcept :
+    Ref(static_cast<_Type*>(rhs.m_ptr))
+{
+}
+
+template <typename _Type>
+template <typename _OtherType> requires std::is_convertible_v<_OtherType*, _Type*>
+Ref<_Type>::Ref(Ref<_OtherType>&& rhs) noexcept :
+    m_ptr(std::exchange(rhs.m_ptr, nullptr))
+{
+}
+
+template <typename _Type>
+Ref<_Type>::~Ref()
+{
+    if (m_ptr != nullptr)
+    {
+        m_ptr->Release();
+    }
+}
+
+template <typename _Type>
+Ref<_Type>& Ref<_Type>::operator=(const Ref& rhs) noexcept
+{
+    this->Reset(rhs.m_ptr);
+    return *this;
+}
+
+template <typename _Type>
+Ref<_Type>& Ref<_Type>::operator=(Ref&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        auto* prevPtr = std::exchange(m_ptr, std::exchange(rhs.m_ptr, nullptr));
+        if (prevPtr != nullptr)
+        {
+            prevPtr->Release();
+        }
+    }
+
+    return *this;
+}
+
+template <typename _Type>
+Ref<_Type>& Ref<_Type>::operator=(std::nullptr_t) noexcept
+{
+    this->Reset();
+    return *this;
+}
+
+template <typename _Type>
+_Type& Ref<_Type>::operator*() const noexcept
+{
+    return *m_ptr;
+}
+
+template <typename _Type>
+_Type* Ref<_Type>::operator->() const noexcept
+{
+    return m_ptr;
+}
+
+template <typename _Type>
+Ref<_Type>::operator bool() const noexcept
+{
+    return m_ptr != nullptr;
+}
+
+template <typename _Type>
+template <typename _OtherType>
+bool Ref<_Type>::operator==(const Ref<_OtherType>& rhs) const noexcept
+{
+    return m_ptr == rhs.m_ptr;
+}
+
+template <typename _Type>
+bool Ref<_Type>::operator==(std::nullptr_t) const noexcept
+{
+    return m_ptr == nullptr;
+}
+
+template <typename _Type>
+_Type* Ref<_Type>::Get() const noexcept
+{
+    return m_ptr;
+}
+
+template <typename _Type>
+void Ref<_Type>::Reset(_Type* ptr) noexcept
+{
+    // Take the new reference first, so that resetting to the same object doesn't delete it.
+    if (ptr != nullptr)
+    {
+        ptr->AddRef();
+    }
+
+    auto* prevPtr = std::exchange(m_ptr, ptr);
+    if (prevPtr != nullptr)
+    {
+        prevPtr->Release();
+    }
+}
+
+template <typename _Type, typename... _Types>
+Ref<_Type> MakeRef(_Types&&... args)
+{
+    return Ref<_Type>(new _Type(std::forward<_Types>(args)...));
+}
+
+}
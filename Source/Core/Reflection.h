@@ -0,0 +1,352 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "Algorithm.h"
+#include "TypeId.h"
+
+namespace tg
+{
+
+enum class FieldFlags : uint32_t
+{
+    None = 0x0,
+    Transient = 0x1, // The field is skipped by the serializer.
+    ReadOnly = 0x2,  // The field can be shown by the inspector but can't be edited.
+};
+
+constexpr FieldFlags operator|(FieldFlags lhs, FieldFlags rhs) noexcept;
+constexpr FieldFlags operator&(FieldFlags lhs, FieldFlags rhs) noexcept;
+
+/**
+ * @brief   The family of the type indices which FieldInfo::GetTypeId and FieldDesc::typeId use.
+ */
+class ReflectedTypeFamily;
+
+/**
+ * @brief   Describes a data member at compile time.
+ * @remark  The name of the member is stored without the "m_" prefix.
+ */
+template <typename _Class, typename _Field>
+struct FieldInfo
+{
+/**@section Type */
+public:
+    using ClassType = _Class;
+    using FieldType = _Field;
+
+/**@section Constructor */
+public:
+    constexpr FieldInfo(std::string_view name, _Field _Class::* pointer, FieldFlags flags = FieldFlags::None) noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] constexpr _Field& Get(_Class& object) const noexcept;
+    [[nodiscard]] constexpr const _Field& Get(const _Class& object) const noexcept;
+    [[nodiscard]] constexpr bool HasFlag(FieldFlags flag) const noexcept;
+
+    /**
+     * @brief   Gets the byte offset of the field in the specified type.
+     * @remark  The type must be standard layout, so it derives from ClassType at the offset 0 if they differ.
+     */
+    template <typename _Object = _Class> requires std::is_base_of_v<_Class, _Object> && std::is_standard_layout_v<_Object>
+    [[nodiscard]] size_t GetOffset() const noexcept;
+
+    /**
+     * @brief   Gets the dense index of the field type in ReflectedTypeFamily.
+     */
+    [[nodiscard]] uint32_t GetTypeId() const noexcept;
+
+/**@section Variable */
+public:
+    std::string_view name;
+    _Field _Class::* pointer;
+    FieldFlags flags;
+};
+
+/**
+ * @brief   Describes a member function at compile time.
+ */
+template <typename _Method> requires std::is_member_function_pointer_v<_Method>
+struct MethodInfo
+{
+/**@section Type */
+public:
+    using ClassType = typename FunctionTraits<_Method>::ClassType;
+    using ReturnType = typename FunctionTraits<_Method>::ReturnType;
+
+/**@section Constructor */
+public:
+    constexpr MethodInfo(std::string_view name, _Method pointer) noexcept;
+
+/**@section Method */
+public:
+    template <typename _Object, typename... _Args>
+    decltype(auto) Invoke(_Object&& object, _Args&&... args) const;
+
+/**@section Variable */
+public:
+    std::string_view name;
+    _Method pointer;
+};
+
+/**
+ * @brief   Describes a field at runtime for the code which can't be specialized by the type, like the inspector.
+ */
+struct FieldDesc
+{
+    std::string_view name;
+    size_t offset;
+    size_t size;
+    uint32_t typeId;
+    FieldFlags flags;
+};
+
+/**
+ * @brief   Provides the members which were declared by TGON_REFLECT or TGON_REFLECT_EXTERNAL.
+ */
+template <typename _Type>
+struct Reflection
+{
+};
+
+template <typename _Type> requires requires { _Type::GetReflectedMembers(); }
+struct Reflection<_Type>
+{
+/**@section Method */
+public:
+    [[nodiscard]] static constexpr auto GetMembers() noexcept;
+};
+
+template <typename _Type>
+concept Reflectable = requires { Reflection<_Type>::GetMembers(); };
+
+}
+
+namespace tg::detail
+{
+
+template <typename _Type>
+constexpr bool IsFieldInfo = false;
+
+template <typename _Class, typename _Field>
+constexpr bool IsFieldInfo<FieldInfo<_Class, _Field>> = true;
+
+template <typename _Type>
+constexpr bool IsMethodInfo = false;
+
+template <typename _Method>
+constexpr bool IsMethodInfo<MethodInfo<_Method>> = true;
+
+constexpr std::string_view TrimMemberPrefix(std::string_view name) noexcept
+{
+    return name.starts_with("m_") ? name.substr(2) : name;
+}
+
+template <template <typename> typename _Predicate, typename _Tuple>
+constexpr auto FilterTuple(const _Tuple& tuple) noexcept
+{
+    return std::apply([](const auto&... elements)
+    {
+        return std::tuple_cat([](const auto& element)
+        {
+            if constexpr (_Predicate<std::remove_cvref_t<decltype(element)>>::value)
+            {
+                return std::make_tuple(element);
+            }
+            else
+            {
+                return std::tuple<>();
+            }
+        }(elements)...);
+    }, tuple);
+}
+
+template <typename _Type>
+struct FieldInfoPredicate : std::bool_constant<IsFieldInfo<_Type>> {};
+
+template <typename _Type>
+struct MethodInfoPredicate : std::bool_constant<IsMethodInfo<_Type>> {};
+
+}
+
+namespace tg
+{
+
+/**
+ * @brief   The fields of the type in the declared order. It's a constant expression, so the fields can be visited without
+ *          any runtime lookup.
+ */
+template <Reflectable _Type>
+inline constexpr auto ReflectedFields = detail::FilterTuple<detail::FieldInfoPredicate>(Reflection<_Type>::GetMembers());
+
+/**
+ * @brief   The methods of the type in the declared order.
+ */
+template <Reflectable _Type>
+inline constexpr auto ReflectedMethods = detail::FilterTuple<detail::MethodInfoPredicate>(Reflection<_Type>::GetMembers());
+
+template <Reflectable _Type>
+constexpr size_t GetFieldCount() noexcept
+{
+    return std::tuple_size_v<std::remove_cv_t<decltype(ReflectedFields<_Type>)>>;
+}
+
+template <Reflectable _Type>
+constexpr size_t GetMethodCount() noexcept
+{
+    return std::tuple_size_v<std::remove_cv_t<decltype(ReflectedMethods<_Type>)>>;
+}
+
+/**
+ * @brief   Calls the function with every FieldInfo of the type.
+ */
+template <Reflectable _Type, typename _Function>
+constexpr void ForEachField(_Function&& function)
+{
+    std::apply([&](const auto&... fields) { (function(fields), ...); }, ReflectedFields<_Type>);
+}
+
+/**
+ * @brief   Calls the function with every MethodInfo of the type.
+ */
+template <Reflectable _Type, typename _Function>
+constexpr void ForEachMethod(_Function&& function)
+{
+    std::apply([&](const auto&... methods) { (function(methods), ...); }, ReflectedMethods<_Type>);
+}
+
+/**
+ * @brief   Gets the runtime descriptions of the fields, which are built on first use.
+ * @return  The descriptions in the declared order.
+ * @remark  The offsets are only defined for the standard layout types.
+ */
+template <Reflectable _Type> requires std::is_standard_layout_v<_Type>
+std::span<const FieldDesc> GetFieldDescs()
+{
+    static const auto fieldDescs = std::apply([](const auto&... fields)
+    {
+        return std::array<FieldDesc, sizeof...(fields)>{FieldDesc{
+            fields.name,
+            fields.template GetOffset<_Type>(),
+            sizeof(typename std::remove_cvref_t<decltype(fields)>::FieldType),
+            fields.GetTypeId(),
+            fields.flags
+        }...};
+    }, ReflectedFields<_Type>);
+
+    return fieldDescs;
+}
+
+constexpr FieldFlags operator|(FieldFlags lhs, FieldFlags rhs) noexcept
+{
+    return static_cast<FieldFlags>(UnderlyingCast(lhs) | UnderlyingCast(rhs));
+}
+
+constexpr FieldFlags operator&(FieldFlags lhs, FieldFlags rhs) noexcept
+{
+    return static_cast<FieldFlags>(UnderlyingCast(lhs) & UnderlyingCast(rhs));
+}
+
+template <typename _Class, typename _Field>
+constexpr FieldInfo<_Class, _Field>::FieldInfo(std::string_view name, _Field _Class::* pointer, FieldFlags flags) noexcept :
+    name(detail::TrimMemberPrefix(name)),
+    pointer(pointer),
+    flags(flags)
+{
+}
+
+template <typename _Class, typename _Field>
+constexpr _Field& FieldInfo<_Class, _Field>::Get(_Class& object) const noexcept
+{
+    return object.*pointer;
+}
+
+template <typename _Class, typename _Field>
+constexpr const _Field& FieldInfo<_Class, _Field>::Get(const _Class& object) const noexcept
+{
+    return object.*pointer;
+}
+
+template <typename _Class, typename _Field>
+constexpr bool FieldInfo<_Class, _Field>::HasFlag(FieldFlags flag) const noexcept
+{
+    return (flags & flag) == flag;
+}
+
+template <typename _Class, typename _Field>
+template <typename _Object> requires std::is_base_of_v<_Class, _Object> && std::is_standard_layout_v<_Object>
+size_t FieldInfo<_Class, _Field>::GetOffset() const noexcept
+{
+    // offsetof needs the name of the member, so the offset is read from the member pointer. The Itanium and the MSVC ABI
+    // store the data member pointer of a class without virtual bases as the byte offset of the member.
+    using OffsetType = std::conditional_t<sizeof(_Field _Class::*) == sizeof(int32_t), int32_t, ptrdiff_t>;
+    static_assert(sizeof(OffsetType) == sizeof(_Field _Class::*), "The data member pointer must hold only the offset.");
+
+    return static_cast<size_t>(std::bit_cast<OffsetType>(pointer));
+}
+
+template <typename _Class, typename _Field>
+uint32_t FieldInfo<_Class, _Field>::GetTypeId() const noexcept
+{
+    return TypeId<ReflectedTypeFamily>::Get<_Field>();
+}
+
+template <typename _Method> requires std::is_member_function_pointer_v<_Method>
+constexpr MethodInfo<_Method>::MethodInfo(std::string_view name, _Method pointer) noexcept :
+    name(name),
+    pointer(pointer)
+{
+}
+
+template <typename _Method> requires std::is_member_function_pointer_v<_Method>
+template <typename _Object, typename... _Args>
+decltype(auto) MethodInfo<_Method>::Invoke(_Object&& object, _Args&&... args) const
+{
+    return std::invoke(pointer, std::forward<_Object>(object), std::forward<_Args>(args)...);
+}
+
+template <typename _Type> requires requires { _Type::GetReflectedMembers(); }
+constexpr auto Reflection<_Type>::GetMembers() noexcept
+{
+    return _Type::GetReflectedMembers();
+}
+
+}
+
+/**
+ * @brief   Declares the reflected members in the class body, so the protected and private members can be listed.
+ * @remark  The members of the base class aren't included unless they are listed again.
+ *          e.g. TGON_REFLECT(Foo, TGON_REFLECT_FIELD(m_value), TGON_REFLECT_FIELD(m_cache, tg::FieldFlags::Transient))
+ */
+#define TGON_REFLECT(classType, ...)\
+    static constexpr auto GetReflectedMembers() noexcept\
+    {\
+        using ReflectedType = classType;\
+        return std::make_tuple(__VA_ARGS__);\
+    }
+
+/**
+ * @brief   Declares the reflected members of the type which can't be modified, at the global namespace.
+ */
+#define TGON_REFLECT_EXTERNAL(classType, ...)\
+    template <>\
+    struct tg::Reflection<classType>\
+    {\
+        static constexpr auto GetMembers() noexcept\
+        {\
+            using ReflectedType = classType;\
+            return std::make_tuple(__VA_ARGS__);\
+        }\
+    };
+
+#define TGON_REFLECT_FIELD(field, ...) tg::FieldInfo(#field, &ReflectedType::field __VA_OPT__(,) __VA_ARGS__)
+#define TGON_REFLECT_METHOD(method) tg::MethodInfo(#method, &ReflectedType::method)
@@ -0,0 +1,323 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "NonCopyable.h"
+
+namespace tg
+{
+
+/**
+ * @brief   The FIFO queue which stores the elements in a circular array of fixed capacity.
+ * @remark  Unlike std::deque, pushing and popping never allocate the memory, so the owner decides when to grow it by
+ *          calling Reserve. The capacity is rounded up to a power of two to wrap the indices with a mask.
+ */
+template <typename _Type>
+class RingBuffer final :
+    private NonCopyable
+{
+/**@section Type */
+public:
+    using ValueType = _Type;
+
+    template <bool _IsConst>
+    class BasicIterator
+    {
+    /**@section Type */
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = _Type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<_IsConst, const _Type&, _Type&>;
+        using pointer = std::conditional_t<_IsConst, const _Type*, _Type*>;
+        using ContainerType = std::conditional_t<_IsConst, const RingBuffer, RingBuffer>;
+
+    /**@section Constructor */
+    public:
+        constexpr BasicIterator() noexcept = default;
+        BasicIterator(ContainerType* container, size_t index) noexcept : m_container(container), m_index(index) {}
+
+    /**@section Operator */
+    public:
+        [[nodiscard]] reference operator*() const noexcept { return (*m_container)[m_index]; }
+        [[nodiscard]] pointer operator->() const noexcept { return &(*m_container)[m_index]; }
+        BasicIterator& operator++() noexcept { ++m_index; return *this; }
+        BasicIterator operator++(int) noexcept { auto prevIt = *this; ++m_index; return prevIt; }
+        [[nodiscard]] bool operator==(const BasicIterator& rhs) const noexcept { return m_index == rhs.m_index; }
+
+    /**@section Variable */
+    private:
+        ContainerType* m_container = nullptr;
+        size_t m_index = 0;
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+/**@section Constructor */
+public:
+    RingBuffer() noexcept = default;
+
+    /**
+     * @brief   Allocates the memory for the specified number of elements.
+     * @param capacity  The minimum capacity, which is rounded up to a power of two.
+     */
+    explicit RingBuffer(size_t capacity);
+    RingBuffer(RingBuffer&& rhs) noexcept;
+
+/**@section Destructor */
+public:
+    ~RingBuffer();
+
+/**@section Operator */
+public:
+    RingBuffer& operator=(RingBuffer&& rhs) noexcept;
+
+    /**
+     * @brief   Gets the element which is index-th from the front.
+     */
+    [[nodiscard]] _Type& operator[](size_t index) noexcept;
+    [[nodiscard]] const _Type& operator[](size_t index) const noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Constructs a new element at the back.
+     * @param args  Arguments for construct the element.
+     * @return  False if the buffer is full, and nothing was constructed.
+     */
+    template <typename... _Types>
+    bool EmplaceBack(_Types&&... args);
+    bool PushBack(const _Type& value);
+    bool PushBack(_Type&& value);
+
+    /**
+     * @brief   Removes the front element. The buffer must not be empty.
+     */
+    void PopFront() noexcept;
+    void Clear() noexcept;
+
+    /**
+     * @brief   Grows the capacity, keeping the order of the elements.
+     * @param capacity  The minimum capacity, which is rounded up to a power of two.
+     */
+    void Reserve(size_t capacity);
+    [[nodiscard]] _Type& Front() noexcept;
+    [[nodiscard]] const _Type& Front() const noexcept;
+    [[nodiscard]] _Type& Back() noexcept;
+    [[nodiscard]] const _Type& Back() const noexcept;
+    [[nodiscard]] size_t GetSize() const noexcept;
+    [[nodiscard]] size_t GetCapacity() const noexcept;
+    [[nodiscard]] bool IsEmpty() const noexcept;
+    [[nodiscard]] bool IsFull() const noexcept;
+    [[nodiscard]] Iterator begin() noexcept;
+    [[nodiscard]] ConstIterator begin() const noexcept;
+    [[nodiscard]] Iterator end() noexcept;
+    [[nodiscard]] ConstIterator end() const noexcept;
+
+/**@section Variable */
+private:
+    _Type* m_data = nullptr;
+    size_t m_capacity = 0;
+    size_t m_head = 0;
+    size_t m_size = 0;
+};
+
+template <typename _Type>
+RingBuffer<_Type>::RingBuffer(size_t capacity)
+{
+    this->Reserve(capacity);
+}
+
+template <typename _Type>
+RingBuffer<_Type>::RingBuffer(RingBuffer&& rhs) noexcept :
+    m_data(std::exchange(rhs.m_data, nullptr)),
+    m_capacity(std::exchange(rhs.m_capacity, 0)),
+    m_head(std::exchange(rhs.m_head, 0)),
+    m_size(std::exchange(rhs.m_size, 0))
+{
+}
+
+template <typename _Type>
+RingBuffer<_Type>::~RingBuffer()
+{
+    this->Clear();
+    std::allocator<_Type>().deallocate(m_data, m_capacity);
+}
+
+template <typename _Type>
+RingBuffer<_Type>& RingBuffer<_Type>::operator=(RingBuffer&& rhs) noexcept
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    this->Clear();
+    std::allocator<_Type>().deallocate(m_data, m_capacity);
+
+    m_data = std::exchange(rhs.m_data, nullptr);
+    m_capacity = std::exchange(rhs.m_capacity, 0);
+    m_head = std::exchange(rhs.m_head, 0);
+    m_size = std::exchange(rhs.m_size, 0);
+
+    return *this;
+}
+
+template <typename _Type>
+_Type& RingBuffer<_Type>::operator[](size_t index) noexcept
+{
+    return m_data[(m_head + index) & (m_capacity - 1)];
+}
+
+template <typename _Type>
+const _Type& RingBuffer<_Type>::operator[](size_t index) const noexcept
+{
+    return m_data[(m_head + index) & (m_capacity - 1)];
+}
+
+template <typename _Type>
+template <typename... _Types>
+bool RingBuffer<_Type>::EmplaceBack(_Types&&... args)
+{
+    if (this->IsFull())
+    {
+        return false;
+    }
+
+    std::construct_at(&m_data[(m_head + m_size) & (m_capacity - 1)], std::forward<_Types>(args)...);
+    ++m_size;
+
+    return true;
+}
+
+template <typename _Type>
+bool RingBuffer<_Type>::PushBack(const _Type& value)
+{
+    return this->EmplaceBack(value);
+}
+
+template <typename _Type>
+bool RingBuffer<_Type>::PushBack(_Type&& value)
+{
+    return this->EmplaceBack(std::move(value));
+}
+
+template <typename _Type>
+void RingBuffer<_Type>::PopFront() noexcept
+{
+    std::destroy_at(&m_data[m_head]);
+    m_head = (m_head + 1) & (m_capacity - 1);
+    --m_size;
+}
+
+template <typename _Type>
+void RingBuffer<_Type>::Clear() noexcept
+{
+    while (m_size > 0)
+    {
+        this->PopFront();
+    }
+    m_head = 0;
+}
+
+template <typename _Type>
+void RingBuffer<_Type>::Reserve(size_t capacity)
+{
+    capacity = std::bit_ceil(capacity);
+    if (capacity <= m_capacity)
+    {
+        return;
+    }
+
+    auto* data = std::allocator<_Type>().allocate(capacity);
+    for (size_t i = 0; i < m_size; ++i)
+    {
+        auto& value = (*this)[i];
+        std::construct_at(&data[i], std::move_if_noexcept(value));
+        std::destroy_at(&value);
+    }
+    std::allocator<_Type>().deallocate(m_data, m_capacity);
+
+    m_data = data;
+    m_capacity = capacity;
+    m_head = 0;
+}
+
+template <typename _Type>
+_Type& RingBuffer<_Type>::Front() noexcept
+{
+    return m_data[m_head];
+}
+
+template <typename _Type>
+const _Type& RingBuffer<_Type>::Front() const noexcept
+{
+    return m_data[m_head];
+}
+
+template <typename _Type>
+_Type& RingBuffer<_Type>::Back() noexcept
+{
+    return (*this)[m_size - 1];
+}
+
+template <typename _Type>
+const _Type& RingBuffer<_Type>::Back() const noexcept
+{
+    return (*this)[m_size - 1];
+}
+
+template <typename _Type>
+size_t RingBuffer<_Type>::GetSize() const noexcept
+{
+    return m_size;
+}
+
+template <typename _Type>
+size_t RingBuffer<_Type>::GetCapacity() const noexcept
+{
+    return m_capacity;
+}
+
+template <typename _Type>
+bool RingBuffer<_Type>::IsEmpty() const noexcept
+{
+    return m_size == 0;
+}
+
+template <typename _Type>
+bool RingBuffer<_Type>::IsFull() const noexcept
+{
+    return m_size == m_capacity;
+}
+
+template <typename _Type>
+typename RingBuffer<_Type>::Iterator RingBuffer<_Type>::begin() noexcept
+{
+    return Iterator(this, 0);
+}
+
+template <typename _Type>
+typename RingBuffer<_Type>::ConstIterator RingBuffer<_Type>::begin() const noexcept
+{
+    return ConstIterator(this, 0);
+}
+
+template <typename _Type>
+typename RingBuffer<_Type>::Iterator RingBuffer<_Type>::end() noexcept
+{
+    return Iterator(this, m_size);
+}
+
+template <typename _Type>
+typename RingBuffer<_Type>::ConstIterator RingBuffer<_Type>::end() const noexcept
+{
+    return ConstIterator(this, m_size);
+}
+
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <typeinfo>
 
 #include "TypeTraits.h"
@@ -28,10 +30,25 @@ public:
     [[nodiscard]] const char* GetName() const noexcept;
     [[nodiscard]] const Rtti* GetSuperRtti() const noexcept;
 
+    /**
+     * @brief   Checks whether the type is the same as or derived from the specified type.
+     * @param rhs   The base type to check.
+     * @return  True if the type is the same as or derived from rhs, false otherwise.
+     */
+    [[nodiscard]] bool IsA(const Rtti* rhs) const noexcept;
+
 /**@section Variable */
+public:
+    static constexpr uint32_t MaxHierarchyDepth = 16;
+
 private:
     const std::type_info* m_typeInfo;
     const Rtti* m_superRtti;
+    uint32_t m_depth;
+
+    // Holds the chain from the root type to this type, so IsA can be answered with a single index.
+    // The types which are deeper than MaxHierarchyDepth aren't stored, and IsA walks m_superRtti for them instead.
+    std::array<const Rtti*, MaxHierarchyDepth> m_hierarchy{};
 };
 
 template <typename _Type>
@@ -57,8 +74,18 @@ inline const Rtti* GetRtti<void>()
 
 inline Rtti::Rtti(const std::type_info& typeInfo, const Rtti* superRtti) noexcept :
     m_typeInfo(&typeInfo),
-    m_superRtti(superRtti)
+    m_superRtti(superRtti),
+    m_depth(superRtti != nullptr ? superRtti->m_depth + 1 : 0)
 {
+    if (superRtti != nullptr)
+    {
+        m_hierarchy = superRtti->m_hierarchy;
+    }
+
+    if (m_depth < MaxHierarchyDepth)
+    {
+        m_hierarchy[m_depth] = this;
+    }
 }
 
 inline size_t Rtti::GetHashCode() const noexcept
@@ -76,6 +103,27 @@ inline const Rtti* Rtti::GetSuperRtti() const noexcept
     return m_superRtti;
 }
 
+inline bool Rtti::IsA(const Rtti* rhs) const noexcept
+{
+    if (rhs == nullptr || rhs->m_depth > m_depth)
+    {
+        return false;
+    }
+
+    if (rhs->m_depth < MaxHierarchyDepth)
+    {
+        return m_hierarchy[rhs->m_depth] == rhs;
+    }
+
+    auto* rtti = this;
+    while (rtti->m_depth > rhs->m_depth)
+    {
+        rtti = rtti->m_superRtti;
+    }
+
+    return rtti == rhs;
+}
+
 inline bool Rtti::operator==(const Rtti& rhs) const noexcept
 {
     return m_typeInfo == rhs.m_typeInfo;
@@ -1,6 +1,1398 @@
 #pragma once
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
 #if TGON_SIMD_SSE2
 #include <emmintrin.h>
+#   if defined(__SSE4_1__) || defined(__AVX__)
+#       define TGON_SIMD_SSE41 1
+#       include <smmintrin.h>
+#   endif
+#   if defined(__AVX__) || defined(__AVX2__)
+#       define TGON_SIMD_AVX 1
+#       include <immintrin.h>
+#   endif
+#   if defined(__AVX2__)
+#       define TGON_SIMD_AVX2 1
+#   endif
+#   if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+#       define TGON_SIMD_FMA 1
+#   endif
+#   if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#       define TGON_SIMD_F16C 1
+#   endif
+#elif TGON_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+// The SIMD types are compiled with different instruction sets in the translation units which are selected at runtime.
+// Putting them into a namespace per instruction set keeps the linker from merging those inline functions.
+#if TGON_SIMD_AVX2
+#   define TGON_SIMD_NAMESPACE avx2
+#elif TGON_SIMD_SSE41
+#   define TGON_SIMD_NAMESPACE sse41
+#elif TGON_SIMD_SSE2
+#   define TGON_SIMD_NAMESPACE sse2
+#elif TGON_SIMD_NEON
+#   define TGON_SIMD_NAMESPACE neon
+#else
+#   define TGON_SIMD_NAMESPACE scalar
+#endif
+
+namespace tg
+{
+inline namespace TGON_SIMD_NAMESPACE
+{
+
+struct Int4;
+struct Int8;
+
+/**
+ * @brief   Four packed floats. The comparison methods return a mask whose lanes have every bit set or cleared.
+ */
+struct Float4
+{
+/**@section Type */
+public:
+#if TGON_SIMD_SSE2
+    using NativeType = __m128;
+#elif TGON_SIMD_NEON
+    using NativeType = float32x4_t;
+#else
+    struct NativeType
+    {
+        float lanes[4];
+    };
+#endif
+
+/**@section Constructor */
+public:
+    Float4() noexcept = default;
+    Float4(NativeType value) noexcept;
+
+/**@section Operator */
+public:
+    Float4 operator+(const Float4& rhs) const noexcept;
+    Float4 operator-(const Float4& rhs) const noexcept;
+    Float4 operator*(const Float4& rhs) const noexcept;
+    Float4 operator/(const Float4& rhs) const noexcept;
+    Float4 operator-() const noexcept;
+    Float4 operator&(const Float4& rhs) const noexcept;
+    Float4 operator|(const Float4& rhs) const noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] static Float4 Load(const float* src) noexcept;
+    [[nodiscard]] static Float4 LoadAligned(const float* src) noexcept;
+    [[nodiscard]] static Float4 Splat(float value) noexcept;
+    [[nodiscard]] static Float4 Set(float x, float y, float z, float w) noexcept;
+    [[nodiscard]] static Float4 Zero() noexcept;
+    void Store(float* dest) const noexcept;
+    void StoreAligned(float* dest) const noexcept;
+    [[nodiscard]] static Float4 Min(const Float4& lhs, const Float4& rhs) noexcept;
+    [[nodiscard]] static Float4 Max(const Float4& lhs, const Float4& rhs) noexcept;
+
+    /**
+     * @brief   Computes a * b + c. It's a single fused instruction if FMA is available.
+     */
+    [[nodiscard]] static Float4 MultiplyAdd(const Float4& a, const Float4& b, const Float4& c) noexcept;
+    [[nodiscard]] static Float4 Sqrt(const Float4& value) noexcept;
+
+    /**
+     * @brief   Approximates 1 / sqrt(value) with the relative error of 1.5 * 2^-12 on x86 and 2^-8 on ARM.
+     */
+    [[nodiscard]] static Float4 ReciprocalSqrtEstimate(const Float4& value) noexcept;
+    [[nodiscard]] static Float4 Abs(const Float4& value) noexcept;
+    [[nodiscard]] static Float4 CompareLess(const Float4& lhs, const Float4& rhs) noexcept;
+    [[nodiscard]] static Float4 CompareLessEqual(const Float4& lhs, const Float4& rhs) noexcept;
+    [[nodiscard]] static Float4 CompareEqual(const Float4& lhs, const Float4& rhs) noexcept;
+
+    /**
+     * @brief   Picks the lanes of a where the mask is set, and the lanes of b otherwise.
+     */
+    [[nodiscard]] static Float4 Select(const Float4& mask, const Float4& a, const Float4& b) noexcept;
+    [[nodiscard]] static float Dot(const Float4& lhs, const Float4& rhs) noexcept;
+
+    /**
+     * @brief   Computes the cross product of the xyz lanes. The w lane is zero if both w lanes are finite.
+     */
+    [[nodiscard]] static Float4 Cross3(const Float4& lhs, const Float4& rhs) noexcept;
+
+    /**
+     * @brief   Rearranges the lanes. Each template argument is the index of the source lane.
+     */
+    template <int32_t _X, int32_t _Y, int32_t _Z, int32_t _W>
+    [[nodiscard]] Float4 Shuffle() const noexcept;
+
+    /**
+     * @brief   Picks the first two lanes from lhs and the last two lanes from rhs.
+     */
+    template <int32_t _X, int32_t _Y, int32_t _Z, int32_t _W>
+    [[nodiscard]] static Float4 Shuffle(const Float4& lhs, const Float4& rhs) noexcept;
+    static void Transpose(Float4& row0, Float4& row1, Float4& row2, Float4& row3) noexcept;
+    template <int32_t _Index>
+    [[nodiscard]] Float4 Broadcast() const noexcept;
+    [[nodiscard]] float GetX() const noexcept;
+    [[nodiscard]] float HorizontalSum() const noexcept;
+
+    /**
+     * @brief   Gathers the sign bits of the lanes.
+     * @return  The bit mask whose bit N is the sign bit of lane N.
+     */
+    [[nodiscard]] int32_t GetSignMask() const noexcept;
+    [[nodiscard]] Int4 AsInt4() const noexcept;
+    [[nodiscard]] Int4 ToInt4() const noexcept;
+
+    /**
+     * @brief   Converts the lanes to the nearest integers, and the halfway values to the even ones.
+     */
+    [[nodiscard]] Int4 RoundToInt4() const noexcept;
+
+/**@section Variable */
+public:
+    NativeType value;
+};
+
+struct Int4
+{
+/**@section Type */
+public:
+#if TGON_SIMD_SSE2
+    using NativeType = __m128i;
+#elif TGON_SIMD_NEON
+    using NativeType = int32x4_t;
+#else
+    struct NativeType
+    {
+        int32_t lanes[4];
+    };
+#endif
+
+/**@section Constructor */
+public:
+    Int4() noexcept = default;
+    Int4(NativeType value) noexcept;
+
+/**@section Operator */
+public:
+    Int4 operator+(const Int4& rhs) const noexcept;
+    Int4 operator-(const Int4& rhs) const noexcept;
+    Int4 operator*(const Int4& rhs) const noexcept;
+    Int4 operator&(const Int4& rhs) const noexcept;
+    Int4 operator|(const Int4& rhs) const noexcept;
+    Int4 operator^(const Int4& rhs) const noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] static Int4 Load(const int32_t* src) noexcept;
+    [[nodiscard]] static Int4 Splat(int32_t value) noexcept;
+    [[nodiscard]] static Int4 Set(int32_t x, int32_t y, int32_t z, int32_t w) noexcept;
+    [[nodiscard]] static Int4 Zero() noexcept;
+    void Store(int32_t* dest) const noexcept;
+    [[nodiscard]] static Int4 Min(const Int4& lhs, const Int4& rhs) noexcept;
+    [[nodiscard]] static Int4 Max(const Int4& lhs, const Int4& rhs) noexcept;
+    [[nodiscard]] static Int4 CompareEqual(const Int4& lhs, const Int4& rhs) noexcept;
+    [[nodiscard]] static Int4 CompareLess(const Int4& lhs, const Int4& rhs) noexcept;
+    [[nodiscard]] static Int4 Select(const Int4& mask, const Int4& a, const Int4& b) noexcept;
+    template <int32_t _Count>
+    [[nodiscard]] Int4 ShiftLeft() const noexcept;
+    template <int32_t _Count>
+    [[nodiscard]] Int4 ShiftRightLogical() const noexcept;
+    template <int32_t _Count>
+    [[nodiscard]] Int4 ShiftRightArithmetic() const noexcept;
+    [[nodiscard]] int32_t GetX() const noexcept;
+    [[nodiscard]] Float4 AsFloat4() const noexcept;
+    [[nodiscard]] Float4 ToFloat4() const noexcept;
+
+/**@section Variable */
+public:
+    NativeType value;
+};
+
+/**
+ * @brief   Eight packed floats. It consists of two Float4 if AVX isn't available.
+ */
+struct Float8
+{
+/**@section Type */
+public:
+#if TGON_SIMD_AVX
+    using NativeType = __m256;
+#else
+    struct NativeType
+    {
+        Float4 low;
+        Float4 high;
+    };
+#endif
+
+/**@section Constructor */
+public:
+    Float8() noexcept = default;
+    Float8(NativeType value) noexcept;
+
+/**@section Operator */
+public:
+    Float8 operator+(const Float8& rhs) const noexcept;
+    Float8 operator-(const Float8& rhs) const noexcept;
+    Float8 operator*(const Float8& rhs) const noexcept;
+    Float8 operator/(const Float8& rhs) const noexcept;
+    Float8 operator&(const Float8& rhs) const noexcept;
+    Float8 operator|(const Float8& rhs) const noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] static Float8 Load(const float* src) noexcept;
+    [[nodiscard]] static Float8 Splat(float value) noexcept;
+    [[nodiscard]] static Float8 Zero() noexcept;
+    void Store(float* dest) const noexcept;
+    [[nodiscard]] static Float8 Min(const Float8& lhs, const Float8& rhs) noexcept;
+    [[nodiscard]] static Float8 Max(const Float8& lhs, const Float8& rhs) noexcept;
+    [[nodiscard]] static Float8 MultiplyAdd(const Float8& a, const Float8& b, const Float8& c) noexcept;
+    [[nodiscard]] static Float8 Sqrt(const Float8& value) noexcept;
+    [[nodiscard]] static Float8 ReciprocalSqrtEstimate(const Float8& value) noexcept;
+    [[nodiscard]] static Float8 Abs(const Float8& value) noexcept;
+    [[nodiscard]] static Float8 CompareLess(const Float8& lhs, const Float8& rhs) noexcept;
+    [[nodiscard]] static Float8 Select(const Float8& mask, const Float8& a, const Float8& b) noexcept;
+    [[nodiscard]] int32_t GetSignMask() const noexcept;
+    [[nodiscard]] Int8 AsInt8() const noexcept;
+
+    /**
+     * @brief   Converts the lanes to the nearest integers, and the halfway values to the even ones.
+     */
+    [[nodiscard]] Int8 RoundToInt8() const noexcept;
+
+/**@section Variable */
+public:
+    NativeType value;
+};
+
+/**
+ * @brief   Eight packed 32-bit integers. It consists of two Int4 if AVX2 isn't available.
+ */
+struct Int8
+{
+/**@section Type */
+public:
+#if TGON_SIMD_AVX2
+    using NativeType = __m256i;
+#else
+    struct NativeType
+    {
+        Int4 low;
+        Int4 high;
+    };
+#endif
+
+/**@section Constructor */
+public:
+    Int8() noexcept = default;
+    Int8(NativeType value) noexcept;
+
+/**@section Operator */
+public:
+    Int8 operator+(const Int8& rhs) const noexcept;
+    Int8 operator-(const Int8& rhs) const noexcept;
+    Int8 operator&(const Int8& rhs) const noexcept;
+    Int8 operator|(const Int8& rhs) const noexcept;
+    Int8 operator^(const Int8& rhs) const noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] static Int8 Load(const int32_t* src) noexcept;
+    [[nodiscard]] static Int8 Splat(int32_t value) noexcept;
+    void Store(int32_t* dest) const noexcept;
+    [[nodiscard]] static Int8 CompareEqual(const Int8& lhs, const Int8& rhs) noexcept;
+    [[nodiscard]] static Int8 CompareLess(const Int8& lhs, const Int8& rhs) noexcept;
+    [[nodiscard]] static Int8 Select(const Int8& mask, const Int8& a, const Int8& b) noexcept;
+    template <int32_t _Count>
+    [[nodiscard]] Int8 ShiftLeft() const noexcept;
+    template <int32_t _Count>
+    [[nodiscard]] Int8 ShiftRightLogical() const noexcept;
+    template <int32_t _Count>
+    [[nodiscard]] Int8 ShiftRightArithmetic() const noexcept;
+    [[nodiscard]] Float8 AsFloat8() const noexcept;
+    [[nodiscard]] Float8 ToFloat8() const noexcept;
+
+/**@section Variable */
+public:
+    NativeType value;
+};
+
+inline Float4::Float4(NativeType value) noexcept :
+    value(value)
+{
+}
+
+inline Float4 Float4::operator+(const Float4& rhs) const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_add_ps(value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vaddq_f32(value, rhs.value);
+#else
+    return NativeType{{value.lanes[0] + rhs.value.lanes[0], value.lanes[1] + rhs.value.lanes[1], value.lanes[2] + rhs.value.lanes[2], value.lanes[3] + rhs.value.lanes[3]}};
+#endif
+}
+
+inline Float4 Float4::operator-(const Float4& rhs) const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_sub_ps(value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vsubq_f32(value, rhs.value);
+#else
+    return NativeType{{value.lanes[0] - rhs.value.lanes[0], value.lanes[1] - rhs.value.lanes[1], value.lanes[2] - rhs.value.lanes[2], value.lanes[3] - rhs.value.lanes[3]}};
+#endif
+}
+
+inline Float4 Float4::operator*(const Float4& rhs) const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_mul_ps(value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vmulq_f32(value, rhs.value);
+#else
+    return NativeType{{value.lanes[0] * rhs.value.lanes[0], value.lanes[1] * rhs.value.lanes[1], value.lanes[2] * rhs.value.lanes[2], value.lanes[3] * rhs.value.lanes[3]}};
+#endif
+}
+
+inline Float4 Float4::operator/(const Float4& rhs) const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_div_ps(value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vdivq_f32(value, rhs.value);
+#else
+    return NativeType{{value.lanes[0] / rhs.value.lanes[0], value.lanes[1] / rhs.value.lanes[1], value.lanes[2] / rhs.value.lanes[2], value.lanes[3] / rhs.value.lanes[3]}};
+#endif
+}
+
+inline Float4 Float4::operator-() const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_xor_ps(value, _mm_set1_ps(-0.0f));
+#elif TGON_SIMD_NEON
+    return vnegq_f32(value);
+#else
+    return NativeType{{-value.lanes[0], -value.lanes[1], -value.lanes[2], -value.lanes[3]}};
+#endif
+}
+
+inline Float4 Float4::operator&(const Float4& rhs) const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_and_ps(value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(value), vreinterpretq_u32_f32(rhs.value)));
+#else
+    return (this->AsInt4() & rhs.AsInt4()).AsFloat4();
+#endif
+}
+
+inline Float4 Float4::operator|(const Float4& rhs) const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_or_ps(value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(value), vreinterpretq_u32_f32(rhs.value)));
+#else
+    return (this->AsInt4() | rhs.AsInt4()).AsFloat4();
+#endif
+}
+
+inline Float4 Float4::Load(const float* src) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_loadu_ps(src);
+#elif TGON_SIMD_NEON
+    return vld1q_f32(src);
+#else
+    return NativeType{{src[0], src[1], src[2], src[3]}};
+#endif
+}
+
+inline Float4 Float4::LoadAligned(const float* src) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_load_ps(src);
+#else
+    return Load(src);
+#endif
+}
+
+inline Float4 Float4::Splat(float value) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_set1_ps(value);
+#elif TGON_SIMD_NEON
+    return vdupq_n_f32(value);
+#else
+    return NativeType{{value, value, value, value}};
+#endif
+}
+
+inline Float4 Float4::Set(float x, float y, float z, float w) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_setr_ps(x, y, z, w);
+#else
+    const float lanes[4] = {x, y, z, w};
+    return Load(lanes);
+#endif
+}
+
+inline Float4 Float4::Zero() noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_setzero_ps();
+#else
+    return Splat(0.0f);
+#endif
+}
+
+inline void Float4::Store(float* dest) const noexcept
+{
+#if TGON_SIMD_SSE2
+    _mm_storeu_ps(dest, value);
+#elif TGON_SIMD_NEON
+    vst1q_f32(dest, value);
+#else
+    std::memcpy(dest, value.lanes, sizeof(value.lanes));
+#endif
+}
+
+inline void Float4::StoreAligned(float* dest) const noexcept
+{
+#if TGON_SIMD_SSE2
+    _mm_store_ps(dest, value);
+#else
+    this->Store(dest);
+#endif
+}
+
+inline Float4 Float4::Min(const Float4& lhs, const Float4& rhs) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_min_ps(lhs.value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vminq_f32(lhs.value, rhs.value);
+#else
+    return Select(CompareLess(rhs, lhs), rhs, lhs);
+#endif
+}
+
+inline Float4 Float4::Max(const Float4& lhs, const Float4& rhs) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_max_ps(lhs.value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vmaxq_f32(lhs.value, rhs.value);
+#else
+    return Select(CompareLess(lhs, rhs), rhs, lhs);
+#endif
+}
+
+inline Float4 Float4::MultiplyAdd(const Float4& a, const Float4& b, const Float4& c) noexcept
+{
+#if TGON_SIMD_FMA
+    return _mm_fmadd_ps(a.value, b.value, c.value);
+#elif TGON_SIMD_NEON
+    return vfmaq_f32(c.value, a.value, b.value);
+#else
+    return a * b + c;
+#endif
+}
+
+inline Float4 Float4::Sqrt(const Float4& value) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_sqrt_ps(value.value);
+#elif TGON_SIMD_NEON
+    return vsqrtq_f32(value.value);
+#else
+    return NativeType{{std::sqrt(value.value.lanes[0]), std::sqrt(value.value.lanes[1]), std::sqrt(value.value.lanes[2]), std::sqrt(value.value.lanes[3])}};
+#endif
+}
+
+inline Float4 Float4::ReciprocalSqrtEstimate(const Float4& value) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_rsqrt_ps(value.value);
+#elif TGON_SIMD_NEON
+    return vrsqrteq_f32(value.value);
+#else
+    return NativeType{{1.0f / std::sqrt(value.value.lanes[0]), 1.0f / std::sqrt(value.value.lanes[1]), 1.0f / std::sqrt(value.value.lanes[2]), 1.0f / std::sqrt(value.value.lanes[3])}};
+#endif
+}
+
+inline Float4 Float4::Abs(const Float4& value) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), value.value);
+#elif TGON_SIMD_NEON
+    return vabsq_f32(value.value);
+#else
+    return NativeType{{std::abs(value.value.lanes[0]), std::abs(value.value.lanes[1]), std::abs(value.value.lanes[2]), std::abs(value.value.lanes[3])}};
+#endif
+}
+
+inline Float4 Float4::CompareLess(const Float4& lhs, const Float4& rhs) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_cmplt_ps(lhs.value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vreinterpretq_f32_u32(vcltq_f32(lhs.value, rhs.value));
+#else
+    Int4 mask;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        mask.value.lanes[i] = lhs.value.lanes[i] < rhs.value.lanes[i] ? -1 : 0;
+    }
+    return mask.AsFloat4();
+#endif
+}
+
+inline Float4 Float4::CompareLessEqual(const Float4& lhs, const Float4& rhs) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_cmple_ps(lhs.value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vreinterpretq_f32_u32(vcleq_f32(lhs.value, rhs.value));
+#else
+    Int4 mask;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        mask.value.lanes[i] = lhs.value.lanes[i] <= rhs.value.lanes[i] ? -1 : 0;
+    }
+    return mask.AsFloat4();
+#endif
+}
+
+inline Float4 Float4::CompareEqual(const Float4& lhs, const Float4& rhs) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_cmpeq_ps(lhs.value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vreinterpretq_f32_u32(vceqq_f32(lhs.value, rhs.value));
+#else
+    Int4 mask;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        mask.value.lanes[i] = lhs.value.lanes[i] == rhs.value.lanes[i] ? -1 : 0;
+    }
+    return mask.AsFloat4();
+#endif
+}
+
+inline Float4 Float4::Select(const Float4& mask, const Float4& a, const Float4& b) noexcept
+{
+#if TGON_SIMD_SSE41
+    return _mm_blendv_ps(b.value, a.value, mask.value);
+#elif TGON_SIMD_SSE2
+    return _mm_or_ps(_mm_and_ps(mask.value, a.value), _mm_andnot_ps(mask.value, b.value));
+#elif TGON_SIMD_NEON
+    return vbslq_f32(vreinterpretq_u32_f32(mask.value), a.value, b.value);
+#else
+    return Int4::Select(mask.AsInt4(), a.AsInt4(), b.AsInt4()).AsFloat4();
+#endif
+}
+
+inline float Float4::Dot(const Float4& lhs, const Float4& rhs) noexcept
+{
+#if TGON_SIMD_SSE41
+    return _mm_cvtss_f32(_mm_dp_ps(lhs.value, rhs.value, 0xF1));
+#else
+    return (lhs * rhs).HorizontalSum();
+#endif
+}
+
+inline Float4 Float4::Cross3(const Float4& lhs, const Float4& rhs) noexcept
+{
+    return lhs.Shuffle<1, 2, 0, 3>() * rhs.Shuffle<2, 0, 1, 3>() - lhs.Shuffle<2, 0, 1, 3>() * rhs.Shuffle<1, 2, 0, 3>();
+}
+
+template <int32_t _X, int32_t _Y, int32_t _Z, int32_t _W>
+Float4 Float4::Shuffle() const noexcept
+{
+    static_assert(_X >= 0 && _X < 4 && _Y >= 0 && _Y < 4 && _Z >= 0 && _Z < 4 && _W >= 0 && _W < 4, "The lane index is out of range.");
+
+#if TGON_SIMD_SSE2
+    return _mm_shuffle_ps(value, value, _MM_SHUFFLE(_W, _Z, _Y, _X));
+#else
+    float lanes[4];
+    this->Store(lanes);
+    return Set(lanes[_X], lanes[_Y], lanes[_Z], lanes[_W]);
+#endif
+}
+
+template <int32_t _X, int32_t _Y, int32_t _Z, int32_t _W>
+Float4 Float4::Shuffle(const Float4& lhs, const Float4& rhs) noexcept
+{
+    static_assert(_X >= 0 && _X < 4 && _Y >= 0 && _Y < 4 && _Z >= 0 && _Z < 4 && _W >= 0 && _W < 4, "The lane index is out of range.");
+
+#if TGON_SIMD_SSE2
+    return _mm_shuffle_ps(lhs.value, rhs.value, _MM_SHUFFLE(_W, _Z, _Y, _X));
+#else
+    float lhsLanes[4], rhsLanes[4];
+    lhs.Store(lhsLanes);
+    rhs.Store(rhsLanes);
+    return Set(lhsLanes[_X], lhsLanes[_Y], rhsLanes[_Z], rhsLanes[_W]);
+#endif
+}
+
+inline void Float4::Transpose(Float4& row0, Float4& row1, Float4& row2, Float4& row3) noexcept
+{
+#if TGON_SIMD_SSE2
+    _MM_TRANSPOSE4_PS(row0.value, row1.value, row2.value, row3.value);
+#else
+    float m[16];
+    row0.Store(&m[0]);
+    row1.Store(&m[4]);
+    row2.Store(&m[8]);
+    row3.Store(&m[12]);
+    row0 = Set(m[0], m[4], m[8], m[12]);
+    row1 = Set(m[1], m[5], m[9], m[13]);
+    row2 = Set(m[2], m[6], m[10], m[14]);
+    row3 = Set(m[3], m[7], m[11], m[15]);
+#endif
+}
+
+template <int32_t _Index>
+Float4 Float4::Broadcast() const noexcept
+{
+#if TGON_SIMD_NEON
+    return vdupq_laneq_f32(value, _Index);
+#else
+    return this->Shuffle<_Index, _Index, _Index, _Index>();
+#endif
+}
+
+inline float Float4::GetX() const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_cvtss_f32(value);
+#elif TGON_SIMD_NEON
+    return vgetq_lane_f32(value, 0);
+#else
+    return value.lanes[0];
+#endif
+}
+
+inline float Float4::HorizontalSum() const noexcept
+{
+#if TGON_SIMD_SSE2
+    const auto sum = _mm_add_ps(value, _mm_movehl_ps(value, value));
+    return _mm_cvtss_f32(_mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1))));
+#elif TGON_SIMD_NEON
+    return vaddvq_f32(value);
+#else
+    return (value.lanes[0] + value.lanes[1]) + (value.lanes[2] + value.lanes[3]);
+#endif
+}
+
+inline int32_t Float4::GetSignMask() const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_movemask_ps(value);
+#else
+    int32_t lanes[4];
+    this->AsInt4().Store(lanes);
+    return ((lanes[0] >> 31) & 1) | ((lanes[1] >> 31) & 2) | ((lanes[2] >> 31) & 4) | ((lanes[3] >> 31) & 8);
+#endif
+}
+
+inline Int4 Float4::AsInt4() const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_castps_si128(value);
+#elif TGON_SIMD_NEON
+    return vreinterpretq_s32_f32(value);
+#else
+    Int4 ret;
+    std::memcpy(&ret.value, &value, sizeof(value));
+    return ret;
+#endif
+}
+
+inline Int4 Float4::ToInt4() const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_cvttps_epi32(value);
+#elif TGON_SIMD_NEON
+    return vcvtq_s32_f32(value);
+#else
+    return Int4::NativeType{{static_cast<int32_t>(value.lanes[0]), static_cast<int32_t>(value.lanes[1]), static_cast<int32_t>(value.lanes[2]), static_cast<int32_t>(value.lanes[3])}};
+#endif
+}
+
+inline Int4 Float4::RoundToInt4() const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_cvtps_epi32(value);
+#elif TGON_SIMD_NEON
+    return vcvtnq_s32_f32(value);
+#else
+    return Int4::NativeType{{static_cast<int32_t>(std::nearbyint(value.lanes[0])), static_cast<int32_t>(std::nearbyint(value.lanes[1])), static_cast<int32_t>(std::nearbyint(value.lanes[2])), static_cast<int32_t>(std::nearbyint(value.lanes[3]))}};
+#endif
+}
+
+inline Int4::Int4(NativeType value) noexcept :
+    value(value)
+{
+}
+
+inline Int4 Int4::operator+(const Int4& rhs) const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_add_epi32(value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vaddq_s32(value, rhs.value);
+#else
+    NativeType ret;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        ret.lanes[i] = static_cast<int32_t>(static_cast<uint32_t>(value.lanes[i]) + static_cast<uint32_t>(rhs.value.lanes[i]));
+    }
+    return ret;
+#endif
+}
+
+inline Int4 Int4::operator-(const Int4& rhs) const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_sub_epi32(value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vsubq_s32(value, rhs.value);
+#else
+    NativeType ret;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        ret.lanes[i] = static_cast<int32_t>(static_cast<uint32_t>(value.lanes[i]) - static_cast<uint32_t>(rhs.value.lanes[i]));
+    }
+    return ret;
+#endif
+}
+
+inline Int4 Int4::operator*(const Int4& rhs) const noexcept
+{
+#if TGON_SIMD_SSE41
+    return _mm_mullo_epi32(value, rhs.value);
+#elif TGON_SIMD_SSE2
+    // SSE2 only multiplies the even lanes, so multiply the odd lanes separately and interleave the low halves.
+    const auto even = _mm_mul_epu32(value, rhs.value);
+    const auto odd = _mm_mul_epu32(_mm_srli_si128(value, 4), _mm_srli_si128(rhs.value, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#elif TGON_SIMD_NEON
+    return vmulq_s32(value, rhs.value);
+#else
+    NativeType ret;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        ret.lanes[i] = static_cast<int32_t>(static_cast<uint32_t>(value.lanes[i]) * static_cast<uint32_t>(rhs.value.lanes[i]));
+    }
+    return ret;
+#endif
+}
+
+inline Int4 Int4::operator&(const Int4& rhs) const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_and_si128(value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vandq_s32(value, rhs.value);
+#else
+    return NativeType{{value.lanes[0] & rhs.value.lanes[0], value.lanes[1] & rhs.value.lanes[1], value.lanes[2] & rhs.value.lanes[2], value.lanes[3] & rhs.value.lanes[3]}};
+#endif
+}
+
+inline Int4 Int4::operator|(const Int4& rhs) const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_or_si128(value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vorrq_s32(value, rhs.value);
+#else
+    return NativeType{{value.lanes[0] | rhs.value.lanes[0], value.lanes[1] | rhs.value.lanes[1], value.lanes[2] | rhs.value.lanes[2], value.lanes[3] | rhs.value.lanes[3]}};
+#endif
+}
+
+inline Int4 Int4::operator^(const Int4& rhs) const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_xor_si128(value, rhs.value);
+#elif TGON_SIMD_NEON
+    return veorq_s32(value, rhs.value);
+#else
+    return NativeType{{value.lanes[0] ^ rhs.value.lanes[0], value.lanes[1] ^ rhs.value.lanes[1], value.lanes[2] ^ rhs.value.lanes[2], value.lanes[3] ^ rhs.value.lanes[3]}};
+#endif
+}
+
+inline Int4 Int4::Load(const int32_t* src) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+#elif TGON_SIMD_NEON
+    return vld1q_s32(src);
+#else
+    return NativeType{{src[0], src[1], src[2], src[3]}};
+#endif
+}
+
+inline Int4 Int4::Splat(int32_t value) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_set1_epi32(value);
+#elif TGON_SIMD_NEON
+    return vdupq_n_s32(value);
+#else
+    return NativeType{{value, value, value, value}};
+#endif
+}
+
+inline Int4 Int4::Set(int32_t x, int32_t y, int32_t z, int32_t w) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_setr_epi32(x, y, z, w);
+#else
+    const int32_t lanes[4] = {x, y, z, w};
+    return Load(lanes);
+#endif
+}
+
+inline Int4 Int4::Zero() noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_setzero_si128();
+#else
+    return Splat(0);
+#endif
+}
+
+inline void Int4::Store(int32_t* dest) const noexcept
+{
+#if TGON_SIMD_SSE2
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), value);
+#elif TGON_SIMD_NEON
+    vst1q_s32(dest, value);
+#else
+    std::memcpy(dest, value.lanes, sizeof(value.lanes));
+#endif
+}
+
+inline Int4 Int4::Min(const Int4& lhs, const Int4& rhs) noexcept
+{
+#if TGON_SIMD_SSE41
+    return _mm_min_epi32(lhs.value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vminq_s32(lhs.value, rhs.value);
+#else
+    return Select(CompareLess(lhs, rhs), lhs, rhs);
+#endif
+}
+
+inline Int4 Int4::Max(const Int4& lhs, const Int4& rhs) noexcept
+{
+#if TGON_SIMD_SSE41
+    return _mm_max_epi32(lhs.value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vmaxq_s32(lhs.value, rhs.value);
+#else
+    return Select(CompareLess(lhs, rhs), rhs, lhs);
+#endif
+}
+
+inline Int4 Int4::CompareEqual(const Int4& lhs, const Int4& rhs) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_cmpeq_epi32(lhs.value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vreinterpretq_s32_u32(vceqq_s32(lhs.value, rhs.value));
+#else
+    NativeType ret;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        ret.lanes[i] = lhs.value.lanes[i] == rhs.value.lanes[i] ? -1 : 0;
+    }
+    return ret;
+#endif
+}
+
+inline Int4 Int4::CompareLess(const Int4& lhs, const Int4& rhs) noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_cmplt_epi32(lhs.value, rhs.value);
+#elif TGON_SIMD_NEON
+    return vreinterpretq_s32_u32(vcltq_s32(lhs.value, rhs.value));
+#else
+    NativeType ret;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        ret.lanes[i] = lhs.value.lanes[i] < rhs.value.lanes[i] ? -1 : 0;
+    }
+    return ret;
+#endif
+}
+
+inline Int4 Int4::Select(const Int4& mask, const Int4& a, const Int4& b) noexcept
+{
+#if TGON_SIMD_SSE41
+    return _mm_blendv_epi8(b.value, a.value, mask.value);
+#elif TGON_SIMD_SSE2
+    return _mm_or_si128(_mm_and_si128(mask.value, a.value), _mm_andnot_si128(mask.value, b.value));
 #elif TGON_SIMD_NEON
-#endif
\ No newline at end of file
+    return vbslq_s32(vreinterpretq_u32_s32(mask.value), a.value, b.value);
+#else
+    return (mask & a) | ((mask ^ Splat(-1)) & b);
+#endif
+}
+
+template <int32_t _Count>
+Int4 Int4::ShiftLeft() const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_slli_epi32(value, _Count);
+#elif TGON_SIMD_NEON
+    return vshlq_n_s32(value, _Count);
+#else
+    NativeType ret;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        ret.lanes[i] = static_cast<int32_t>(static_cast<uint32_t>(value.lanes[i]) << _Count);
+    }
+    return ret;
+#endif
+}
+
+template <int32_t _Count>
+Int4 Int4::ShiftRightLogical() const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_srli_epi32(value, _Count);
+#elif TGON_SIMD_NEON
+    return vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(value), _Count));
+#else
+    NativeType ret;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        ret.lanes[i] = static_cast<int32_t>(static_cast<uint32_t>(value.lanes[i]) >> _Count);
+    }
+    return ret;
+#endif
+}
+
+template <int32_t _Count>
+Int4 Int4::ShiftRightArithmetic() const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_srai_epi32(value, _Count);
+#elif TGON_SIMD_NEON
+    return vshrq_n_s32(value, _Count);
+#else
+    NativeType ret;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        ret.lanes[i] = value.lanes[i] >> _Count;
+    }
+    return ret;
+#endif
+}
+
+inline int32_t Int4::GetX() const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_cvtsi128_si32(value);
+#elif TGON_SIMD_NEON
+    return vgetq_lane_s32(value, 0);
+#else
+    return value.lanes[0];
+#endif
+}
+
+inline Float4 Int4::AsFloat4() const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_castsi128_ps(value);
+#elif TGON_SIMD_NEON
+    return vreinterpretq_f32_s32(value);
+#else
+    Float4 ret;
+    std::memcpy(&ret.value, &value, sizeof(value));
+    return ret;
+#endif
+}
+
+inline Float4 Int4::ToFloat4() const noexcept
+{
+#if TGON_SIMD_SSE2
+    return _mm_cvtepi32_ps(value);
+#elif TGON_SIMD_NEON
+    return vcvtq_f32_s32(value);
+#else
+    return Float4::NativeType{{static_cast<float>(value.lanes[0]), static_cast<float>(value.lanes[1]), static_cast<float>(value.lanes[2]), static_cast<float>(value.lanes[3])}};
+#endif
+}
+
+inline Float8::Float8(NativeType value) noexcept :
+    value(value)
+{
+}
+
+inline Float8 Float8::operator+(const Float8& rhs) const noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_add_ps(value, rhs.value);
+#else
+    return NativeType{value.low + rhs.value.low, value.high + rhs.value.high};
+#endif
+}
+
+inline Float8 Float8::operator-(const Float8& rhs) const noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_sub_ps(value, rhs.value);
+#else
+    return NativeType{value.low - rhs.value.low, value.high - rhs.value.high};
+#endif
+}
+
+inline Float8 Float8::operator*(const Float8& rhs) const noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_mul_ps(value, rhs.value);
+#else
+    return NativeType{value.low * rhs.value.low, value.high * rhs.value.high};
+#endif
+}
+
+inline Float8 Float8::operator/(const Float8& rhs) const noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_div_ps(value, rhs.value);
+#else
+    return NativeType{value.low / rhs.value.low, value.high / rhs.value.high};
+#endif
+}
+
+inline Float8 Float8::operator&(const Float8& rhs) const noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_and_ps(value, rhs.value);
+#else
+    return NativeType{value.low & rhs.value.low, value.high & rhs.value.high};
+#endif
+}
+
+inline Float8 Float8::operator|(const Float8& rhs) const noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_or_ps(value, rhs.value);
+#else
+    return NativeType{value.low | rhs.value.low, value.high | rhs.value.high};
+#endif
+}
+
+inline Float8 Float8::Load(const float* src) noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_loadu_ps(src);
+#else
+    return NativeType{Float4::Load(src), Float4::Load(src + 4)};
+#endif
+}
+
+inline Float8 Float8::Splat(float value) noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_set1_ps(value);
+#else
+    return NativeType{Float4::Splat(value), Float4::Splat(value)};
+#endif
+}
+
+inline Float8 Float8::Zero() noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_setzero_ps();
+#else
+    return NativeType{Float4::Zero(), Float4::Zero()};
+#endif
+}
+
+inline void Float8::Store(float* dest) const noexcept
+{
+#if TGON_SIMD_AVX
+    _mm256_storeu_ps(dest, value);
+#else
+    value.low.Store(dest);
+    value.high.Store(dest + 4);
+#endif
+}
+
+inline Float8 Float8::Min(const Float8& lhs, const Float8& rhs) noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_min_ps(lhs.value, rhs.value);
+#else
+    return NativeType{Float4::Min(lhs.value.low, rhs.value.low), Float4::Min(lhs.value.high, rhs.value.high)};
+#endif
+}
+
+inline Float8 Float8::Max(const Float8& lhs, const Float8& rhs) noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_max_ps(lhs.value, rhs.value);
+#else
+    return NativeType{Float4::Max(lhs.value.low, rhs.value.low), Float4::Max(lhs.value.high, rhs.value.high)};
+#endif
+}
+
+inline Float8 Float8::MultiplyAdd(const Float8& a, const Float8& b, const Float8& c) noexcept
+{
+#if TGON_SIMD_FMA
+    return _mm256_fmadd_ps(a.value, b.value, c.value);
+#elif TGON_SIMD_AVX
+    return _mm256_add_ps(_mm256_mul_ps(a.value, b.value), c.value);
+#else
+    return NativeType{Float4::MultiplyAdd(a.value.low, b.value.low, c.value.low), Float4::MultiplyAdd(a.value.high, b.value.high, c.value.high)};
+#endif
+}
+
+inline Float8 Float8::Sqrt(const Float8& value) noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_sqrt_ps(value.value);
+#else
+    return NativeType{Float4::Sqrt(value.value.low), Float4::Sqrt(value.value.high)};
+#endif
+}
+
+inline Float8 Float8::ReciprocalSqrtEstimate(const Float8& value) noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_rsqrt_ps(value.value);
+#else
+    return NativeType{Float4::ReciprocalSqrtEstimate(value.value.low), Float4::ReciprocalSqrtEstimate(value.value.high)};
+#endif
+}
+
+inline Float8 Float8::Abs(const Float8& value) noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value.value);
+#else
+    return NativeType{Float4::Abs(value.value.low), Float4::Abs(value.value.high)};
+#endif
+}
+
+inline Float8 Float8::CompareLess(const Float8& lhs, const Float8& rhs) noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_cmp_ps(lhs.value, rhs.value, _CMP_LT_OQ);
+#else
+    return NativeType{Float4::CompareLess(lhs.value.low, rhs.value.low), Float4::CompareLess(lhs.value.high, rhs.value.high)};
+#endif
+}
+
+inline Float8 Float8::Select(const Float8& mask, const Float8& a, const Float8& b) noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_blendv_ps(b.value, a.value, mask.value);
+#else
+    return NativeType{Float4::Select(mask.value.low, a.value.low, b.value.low), Float4::Select(mask.value.high, a.value.high, b.value.high)};
+#endif
+}
+
+inline int32_t Float8::GetSignMask() const noexcept
+{
+#if TGON_SIMD_AVX
+    return _mm256_movemask_ps(value);
+#else
+    return value.low.GetSignMask() | (value.high.GetSignMask() << 4);
+#endif
+}
+
+inline Int8 Float8::AsInt8() const noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_castps_si256(value);
+#elif TGON_SIMD_AVX
+    return Int8::NativeType{_mm_castps_si128(_mm256_castps256_ps128(value)), _mm_castps_si128(_mm256_extractf128_ps(value, 1))};
+#else
+    return Int8::NativeType{value.low.AsInt4(), value.high.AsInt4()};
+#endif
+}
+
+inline Int8 Float8::RoundToInt8() const noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_cvtps_epi32(value);
+#elif TGON_SIMD_AVX
+    const auto ret = _mm256_cvtps_epi32(value);
+    return Int8::NativeType{_mm256_castsi256_si128(ret), _mm256_extractf128_si256(ret, 1)};
+#else
+    return Int8::NativeType{value.low.RoundToInt4(), value.high.RoundToInt4()};
+#endif
+}
+
+inline Int8::Int8(NativeType value) noexcept :
+    value(value)
+{
+}
+
+inline Int8 Int8::operator+(const Int8& rhs) const noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_add_epi32(value, rhs.value);
+#else
+    return NativeType{value.low + rhs.value.low, value.high + rhs.value.high};
+#endif
+}
+
+inline Int8 Int8::operator-(const Int8& rhs) const noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_sub_epi32(value, rhs.value);
+#else
+    return NativeType{value.low - rhs.value.low, value.high - rhs.value.high};
+#endif
+}
+
+inline Int8 Int8::operator&(const Int8& rhs) const noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_and_si256(value, rhs.value);
+#else
+    return NativeType{value.low & rhs.value.low, value.high & rhs.value.high};
+#endif
+}
+
+inline Int8 Int8::operator|(const Int8& rhs) const noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_or_si256(value, rhs.value);
+#else
+    return NativeType{value.low | rhs.value.low, value.high | rhs.value.high};
+#endif
+}
+
+inline Int8 Int8::operator^(const Int8& rhs) const noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_xor_si256(value, rhs.value);
+#else
+    return NativeType{value.low ^ rhs.value.low, value.high ^ rhs.value.high};
+#endif
+}
+
+inline Int8 Int8::Load(const int32_t* src) noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+#else
+    return NativeType{Int4::Load(src), Int4::Load(src + 4)};
+#endif
+}
+
+inline Int8 Int8::Splat(int32_t value) noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_set1_epi32(value);
+#else
+    return NativeType{Int4::Splat(value), Int4::Splat(value)};
+#endif
+}
+
+inline void Int8::Store(int32_t* dest) const noexcept
+{
+#if TGON_SIMD_AVX2
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), value);
+#else
+    value.low.Store(dest);
+    value.high.Store(dest + 4);
+#endif
+}
+
+inline Int8 Int8::CompareEqual(const Int8& lhs, const Int8& rhs) noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_cmpeq_epi32(lhs.value, rhs.value);
+#else
+    return NativeType{Int4::CompareEqual(lhs.value.low, rhs.value.low), Int4::CompareEqual(lhs.value.high, rhs.value.high)};
+#endif
+}
+
+inline Int8 Int8::CompareLess(const Int8& lhs, const Int8& rhs) noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_cmpgt_epi32(rhs.value, lhs.value);
+#else
+    return NativeType{Int4::CompareLess(lhs.value.low, rhs.value.low), Int4::CompareLess(lhs.value.high, rhs.value.high)};
+#endif
+}
+
+inline Int8 Int8::Select(const Int8& mask, const Int8& a, const Int8& b) noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_blendv_epi8(b.value, a.value, mask.value);
+#else
+    return NativeType{Int4::Select(mask.value.low, a.value.low, b.value.low), Int4::Select(mask.value.high, a.value.high, b.value.high)};
+#endif
+}
+
+template <int32_t _Count>
+Int8 Int8::ShiftLeft() const noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_slli_epi32(value, _Count);
+#else
+    return NativeType{value.low.ShiftLeft<_Count>(), value.high.ShiftLeft<_Count>()};
+#endif
+}
+
+template <int32_t _Count>
+Int8 Int8::ShiftRightLogical() const noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_srli_epi32(value, _Count);
+#else
+    return NativeType{value.low.ShiftRightLogical<_Count>(), value.high.ShiftRightLogical<_Count>()};
+#endif
+}
+
+template <int32_t _Count>
+Int8 Int8::ShiftRightArithmetic() const noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_srai_epi32(value, _Count);
+#else
+    return NativeType{value.low.ShiftRightArithmetic<_Count>(), value.high.ShiftRightArithmetic<_Count>()};
+#endif
+}
+
+inline Float8 Int8::AsFloat8() const noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_castsi256_ps(value);
+#elif TGON_SIMD_AVX
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(value.low.AsFloat4().value), value.high.AsFloat4().value, 1);
+#else
+    return Float8::NativeType{value.low.AsFloat4(), value.high.AsFloat4()};
+#endif
+}
+
+inline Float8 Int8::ToFloat8() const noexcept
+{
+#if TGON_SIMD_AVX2
+    return _mm256_cvtepi32_ps(value);
+#elif TGON_SIMD_AVX
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(value.low.ToFloat4().value), value.high.ToFloat4().value, 1);
+#else
+    return Float8::NativeType{value.low.ToFloat4(), value.high.ToFloat4()};
+#endif
+}
+
+}
+}
@@ -0,0 +1,481 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+namespace tg
+{
+
+/**
+ * @brief   The vector which keeps up to _InlineCapacity elements inside of itself without allocating the memory.
+ * @remark  The elements are moved to the memory of the allocator once the size exceeds _InlineCapacity. The inline
+ *          elements are moved along with the vector, so moving it invalidates the iterators unlike std::vector.
+ */
+template <typename _Type, size_t _InlineCapacity, typename _Allocator = std::allocator<_Type>>
+class SmallVector final
+{
+    static_assert(_InlineCapacity > 0, "Use std::vector if nothing is stored inline.");
+
+/**@section Type */
+public:
+    using ValueType = _Type;
+    using AllocatorType = _Allocator;
+    using Iterator = _Type*;
+    using ConstIterator = const _Type*;
+
+private:
+    using AllocatorTraits = std::allocator_traits<_Allocator>;
+
+/**@section Constructor */
+public:
+    SmallVector() noexcept(std::is_nothrow_default_constructible_v<_Allocator>) = default;
+    explicit SmallVector(const _Allocator& allocator) noexcept;
+    SmallVector(std::initializer_list<_Type> values, const _Allocator& allocator = _Allocator());
+    SmallVector(const SmallVector& rhs);
+    SmallVector(SmallVector&& rhs) noexcept(std::is_nothrow_move_constructible_v<_Type>);
+
+/**@section Destructor */
+public:
+    ~SmallVector();
+
+/**@section Operator */
+public:
+    SmallVector& operator=(const SmallVector& rhs);
+    SmallVector& operator=(SmallVector&& rhs) noexcept(std::is_nothrow_move_constructible_v<_Type>);
+    [[nodiscard]] _Type& operator[](size_t index) noexcept;
+    [[nodiscard]] const _Type& operator[](size_t index) const noexcept;
+
+/**@section Method */
+public:
+    void PushBack(const _Type& value);
+    void PushBack(_Type&& value);
+
+    /**
+     * @brief   Constructs a new element at the end.
+     * @param args  Arguments for construct the element.
+     * @return  The constructed element.
+     */
+    template <typename... _Types>
+    _Type& EmplaceBack(_Types&&... args);
+
+    void PopBack() noexcept;
+
+    /**
+     * @brief   Constructs a new element before the specified position.
+     * @return  The iterator of the constructed element.
+     */
+    template <typename... _Types>
+    Iterator Emplace(ConstIterator pos, _Types&&... args);
+    Iterator Insert(ConstIterator pos, const _Type& value);
+    Iterator Insert(ConstIterator pos, _Type&& value);
+
+    /**
+     * @brief   Removes the element at the specified position.
+     * @return  The iterator of the element which followed the removed one.
+     */
+    Iterator Erase(ConstIterator pos);
+    void Clear() noexcept;
+
+    /**
+     * @brief   Allocates the memory in advance so that the specified number of elements can be stored without growing.
+     */
+    void Reserve(size_t capacity);
+    void Resize(size_t size);
+    [[nodiscard]] _Type& Front() noexcept;
+    [[nodiscard]] const _Type& Front() const noexcept;
+    [[nodiscard]] _Type& Back() noexcept;
+    [[nodiscard]] const _Type& Back() const noexcept;
+    [[nodiscard]] _Type* Data() noexcept;
+    [[nodiscard]] const _Type* Data() const noexcept;
+    [[nodiscard]] size_t GetSize() const noexcept;
+    [[nodiscard]] size_t GetCapacity() const noexcept;
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+    /**
+     * @brief   Checks whether the elements are stored inside of the vector.
+     */
+    [[nodiscard]] bool IsInline() const noexcept;
+    [[nodiscard]] _Allocator GetAllocator() const noexcept;
+    [[nodiscard]] Iterator begin() noexcept;
+    [[nodiscard]] ConstIterator begin() const noexcept;
+    [[nodiscard]] Iterator end() noexcept;
+    [[nodiscard]] ConstIterator end() const noexcept;
+
+private:
+    [[nodiscard]] _Type* GetInlineData() noexcept;
+    void Reallocate(size_t capacity);
+    void Deallocate() noexcept;
+
+/**@section Variable */
+private:
+    alignas(_Type) std::byte m_inlineStorage[sizeof(_Type) * _InlineCapacity];
+    _Type* m_data = reinterpret_cast<_Type*>(m_inlineStorage);
+    size_t m_size = 0;
+    size_t m_capacity = _InlineCapacity;
+    [[no_unique_address]] _Allocator m_allocator;
+};
+
+namespace pmr
+{
+
+template <typename _Type, size_t _InlineCapacity>
+using SmallVector = tg::SmallVector<_Type, _InlineCapacity, std::pmr::polymorphic_allocator<_Type>>;
+
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+SmallVector<_Type, _InlineCapacity, _Allocator>::SmallVector(const _Allocator& allocator) noexcept :
+    m_allocator(allocator)
+{
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+SmallVector<_Type, _InlineCapacity, _Allocator>::SmallVector(std::initializer_list<_Type> values, const _Allocator& allocator) :
+    m_allocator(allocator)
+{
+    this->Reserve(values.size());
+    for (const auto& value : values)
+    {
+        this->EmplaceBack(value);
+    }
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+SmallVector<_Type, _InlineCapacity, _Allocator>::SmallVector(const SmallVector& rhs) :
+    m_allocator(AllocatorTraits::select_on_container_copy_construction(rhs.m_allocator))
+{
+    this->Reserve(rhs.m_size);
+    for (const auto& value : rhs)
+    {
+        this->EmplaceBack(value);
+    }
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+SmallVector<_Type, _InlineCapacity, _Allocator>::SmallVector(SmallVector&& rhs) noexcept(std::is_nothrow_move_constructible_v<_Type>) :
+    m_allocator(std::move(rhs.m_allocator))
+{
+    if (rhs.IsInline() == false)
+    {
+        // The allocated memory is taken as it is.
+        m_data = std::exchange(rhs.m_data, rhs.GetInlineData());
+        m_size = std::exchange(rhs.m_size, 0);
+        m_capacity = std::exchange(rhs.m_capacity, _InlineCapacity);
+        return;
+    }
+
+    std::uninitialized_move(rhs.begin(), rhs.end(), m_data);
+    m_size = rhs.m_size;
+    rhs.Clear();
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+SmallVector<_Type, _InlineCapacity, _Allocator>::~SmallVector()
+{
+    this->Clear();
+    this->Deallocate();
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+SmallVector<_Type, _InlineCapacity, _Allocator>& SmallVector<_Type, _InlineCapacity, _Allocator>::operator=(const SmallVector& rhs)
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    this->Clear();
+    this->Reserve(rhs.m_size);
+    for (const auto& value : rhs)
+    {
+        this->EmplaceBack(value);
+    }
+
+    return *this;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+SmallVector<_Type, _InlineCapacity, _Allocator>& SmallVector<_Type, _InlineCapacity, _Allocator>::operator=(SmallVector&& rhs) noexcept(std::is_nothrow_move_constructible_v<_Type>)
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    this->Clear();
+
+    // The memory of rhs can be taken only if this allocator is able to free it.
+    if (rhs.IsInline() == false && (AllocatorTraits::propagate_on_container_move_assignment::value || m_allocator == rhs.m_allocator))
+    {
+        this->Deallocate();
+        if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+        {
+            m_allocator = std::move(rhs.m_allocator);
+        }
+
+        m_data = std::exchange(rhs.m_data, rhs.GetInlineData());
+        m_size = std::exchange(rhs.m_size, 0);
+        m_capacity = std::exchange(rhs.m_capacity, _InlineCapacity);
+        return *this;
+    }
+
+    this->Reserve(rhs.m_size);
+    std::uninitialized_move(rhs.begin(), rhs.end(), m_data);
+    m_size = rhs.m_size;
+    rhs.Clear();
+
+    return *this;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+_Type& SmallVector<_Type, _InlineCapacity, _Allocator>::operator[](size_t index) noexcept
+{
+    return m_data[index];
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+const _Type& SmallVector<_Type, _InlineCapacity, _Allocator>::operator[](size_t index) const noexcept
+{
+    return m_data[index];
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+void SmallVector<_Type, _InlineCapacity, _Allocator>::PushBack(const _Type& value)
+{
+    this->EmplaceBack(value);
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+void SmallVector<_Type, _InlineCapacity, _Allocator>::PushBack(_Type&& value)
+{
+    this->EmplaceBack(std::move(value));
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+template <typename... _Types>
+_Type& SmallVector<_Type, _InlineCapacity, _Allocator>::EmplaceBack(_Types&&... args)
+{
+    if (m_size < m_capacity)
+    {
+        AllocatorTraits::construct(m_allocator, m_data + m_size, std::forward<_Types>(args)...);
+        return m_data[m_size++];
+    }
+
+    // The new element is constructed before the old ones are moved, because the arguments can refer to them.
+    const auto capacity = std::max<size_t>(m_capacity * 2, 1);
+    auto* data = AllocatorTraits::allocate(m_allocator, capacity);
+    try
+    {
+        AllocatorTraits::construct(m_allocator, data + m_size, std::forward<_Types>(args)...);
+    }
+    catch (...)
+    {
+        AllocatorTraits::deallocate(m_allocator, data, capacity);
+        throw;
+    }
+
+    std::uninitialized_move(this->begin(), this->end(), data);
+    std::destroy(this->begin(), this->end());
+    this->Deallocate();
+
+    m_data = data;
+    m_capacity = capacity;
+    return m_data[m_size++];
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+void SmallVector<_Type, _InlineCapacity, _Allocator>::PopBack() noexcept
+{
+    AllocatorTraits::destroy(m_allocator, m_data + --m_size);
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+template <typename... _Types>
+typename SmallVector<_Type, _InlineCapacity, _Allocator>::Iterator SmallVector<_Type, _InlineCapacity, _Allocator>::Emplace(ConstIterator pos, _Types&&... args)
+{
+    const auto index = static_cast<size_t>(pos - m_data);
+    this->EmplaceBack(std::forward<_Types>(args)...);
+    std::rotate(m_data + index, m_data + m_size - 1, m_data + m_size);
+
+    return m_data + index;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+typename SmallVector<_Type, _InlineCapacity, _Allocator>::Iterator SmallVector<_Type, _InlineCapacity, _Allocator>::Insert(ConstIterator pos, const _Type& value)
+{
+    return this->Emplace(pos, value);
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+typename SmallVector<_Type, _InlineCapacity, _Allocator>::Iterator SmallVector<_Type, _InlineCapacity, _Allocator>::Insert(ConstIterator pos, _Type&& value)
+{
+    return this->Emplace(pos, std::move(value));
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+typename SmallVector<_Type, _InlineCapacity, _Allocator>::Iterator SmallVector<_Type, _InlineCapacity, _Allocator>::Erase(ConstIterator pos)
+{
+    auto* it = m_data + (pos - m_data);
+    std::move(it + 1, this->end(), it);
+    this->PopBack();
+
+    return it;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+void SmallVector<_Type, _InlineCapacity, _Allocator>::Clear() noexcept
+{
+    while (m_size > 0)
+    {
+        this->PopBack();
+    }
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+void SmallVector<_Type, _InlineCapacity, _Allocator>::Reserve(size_t capacity)
+{
+    if (capacity > m_capacity)
+    {
+        this->Reallocate(capacity);
+    }
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+void SmallVector<_Type, _InlineCapacity, _Allocator>::Resize(size_t size)
+{
+    this->Reserve(size);
+    while (m_size < size)
+    {
+        this->EmplaceBack();
+    }
+    while (m_size > size)
+    {
+        this->PopBack();
+    }
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+_Type& SmallVector<_Type, _InlineCapacity, _Allocator>::Front() noexcept
+{
+    return m_data[0];
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+const _Type& SmallVector<_Type, _InlineCapacity, _Allocator>::Front() const noexcept
+{
+    return m_data[0];
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+_Type& SmallVector<_Type, _InlineCapacity, _Allocator>::Back() noexcept
+{
+    return m_data[m_size - 1];
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+const _Type& SmallVector<_Type, _InlineCapacity, _Allocator>::Back() const noexcept
+{
+    return m_data[m_size - 1];
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+_Type* SmallVector<_Type, _InlineCapacity, _Allocator>::Data() noexcept
+{
+    return m_data;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+const _Type* SmallVector<_Type, _InlineCapacity, _Allocator>::Data() const noexcept
+{
+    return m_data;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+size_t SmallVector<_Type, _InlineCapacity, _Allocator>::GetSize() const noexcept
+{
+    return m_size;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+size_t SmallVector<_Type, _InlineCapacity, _Allocator>::GetCapacity() const noexcept
+{
+    return m_capacity;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+bool SmallVector<_Type, _InlineCapacity, _Allocator>::IsEmpty() const noexcept
+{
+    return m_size == 0;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+bool SmallVector<_Type, _InlineCapacity, _Allocator>::IsInline() const noexcept
+{
+    return m_data == reinterpret_cast<const _Type*>(m_inlineStorage);
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+_Allocator SmallVector<_Type, _InlineCapacity, _Allocator>::GetAllocator() const noexcept
+{
+    return m_allocator;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+typename SmallVector<_Type, _InlineCapacity, _Allocator>::Iterator SmallVector<_Type, _InlineCapacity, _Allocator>::begin() noexcept
+{
+    return m_data;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+typename SmallVector<_Type, _InlineCapacity, _Allocator>::ConstIterator SmallVector<_Type, _InlineCapacity, _Allocator>::begin() const noexcept
+{
+    return m_data;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+typename SmallVector<_Type, _InlineCapacity, _Allocator>::Iterator SmallVector<_Type, _InlineCapacity, _Allocator>::end() noexcept
+{
+    return m_data + m_size;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+typename SmallVector<_Type, _InlineCapacity, _Allocator>::ConstIterator SmallVector<_Type, _InlineCapacity, _Allocator>::end() const noexcept
+{
+    return m_data + m_size;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+_Type* SmallVector<_Type, _InlineCapacity, _Allocator>::GetInlineData() noexcept
+{
+    return reinterpret_cast<_Type*>(m_inlineStorage);
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+void SmallVector<_Type, _InlineCapacity, _Allocator>::Reallocate(size_t capacity)
+{
+    auto* data = AllocatorTraits::allocate(m_allocator, capacity);
+    std::uninitialized_move(this->begin(), this->end(), data);
+    std::destroy(this->begin(), this->end());
+    this->Deallocate();
+
+    m_data = data;
+    m_capacity = capacity;
+}
+
+template <typename _Type, size_t _InlineCapacity, typename _Allocator>
+void SmallVector<_Type, _InlineCapacity, _Allocator>::Deallocate() noexcept
+{
+    if (this->IsInline() == false)
+    {
+        AllocatorTraits::deallocate(m_allocator, m_data, m_capacity);
+        m_data = this->GetInlineData();
+        m_capacity = _InlineCapacity;
+    }
+}
+
+}
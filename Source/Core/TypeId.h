@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "TypeTraits.h"
+
+namespace tg
+{
+
+/**
+ * @brief   Assigns dense, zero-based indices to the types which belong to the same family.
+ * @remark  The index of a type is fixed on first use and stays the same during the lifetime of the process.
+ *          Each family has its own counter, so the indices can be used directly as array or bitmask indices.
+ */
+template <typename _Family>
+class TypeId final
+{
+/**@section Constructor */
+public:
+    TypeId() = delete;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Gets the index of the specified type in the family.
+     * @return  The dense index of the type.
+     */
+    template <typename _Type>
+    [[nodiscard]] static uint32_t Get() noexcept;
+
+    /**
+     * @brief   Gets the number of the types which received an index so far.
+     * @return  The number of the types.
+     */
+    [[nodiscard]] static uint32_t GetCount() noexcept;
+
+private:
+    [[nodiscard]] static std::atomic<uint32_t>& GetCounter() noexcept;
+};
+
+template <typename _Family>
+template <typename _Type>
+uint32_t TypeId<_Family>::Get() noexcept
+{
+    if constexpr (IsRawType<_Type>)
+    {
+        static const uint32_t typeId = GetCounter().fetch_add(1, std::memory_order_relaxed);
+        return typeId;
+    }
+    else
+    {
+        return Get<RawType<_Type>>();
+    }
+}
+
+template <typename _Family>
+uint32_t TypeId<_Family>::GetCount() noexcept
+{
+    return GetCounter().load(std::memory_order_relaxed);
+}
+
+template <typename _Family>
+std::atomic<uint32_t>& TypeId<_Family>::GetCounter() noexcept
+{
+    static std::atomic<uint32_t> counter;
+    return counter;
+}
+
+}
@@ -65,6 +65,12 @@ struct FunctionTraits<_Return(_Class::*)(_Types...) volatile> : FunctionTraits<_
 template <typename _Return, typename _Class, typename... _Types>
 struct FunctionTraits<_Return(_Class::*)(_Types...) const volatile> : FunctionTraits<_Return(_Class::*)(_Types...)> {};
 
+template <typename _Return, typename _Class, typename... _Types>
+struct FunctionTraits<_Return(_Class::*)(_Types...) noexcept> : FunctionTraits<_Return(_Class::*)(_Types...)> {};
+
+template <typename _Return, typename _Class, typename... _Types>
+struct FunctionTraits<_Return(_Class::*)(_Types...) const noexcept> : FunctionTraits<_Return(_Class::*)(_Types...)> {};
+
 template <typename _Function>
 struct FunctionTraits :
     FunctionTraits<decltype(&_Function::operator())>
@@ -1,7 +1,6 @@
 #include "PrecompiledHeader.h"
 
-#include "Core/MakeSharedEnabler.h"
-#include "IO/File.h"
+#include "IO/MemoryMappedFile.h"
 
 #include "Font.h"
 
@@ -10,42 +9,59 @@ namespace tg
 
 extern const char* ConvertFTErrorToString(FT_Error error);
 
-Font::Font(std::shared_ptr<std::remove_pointer_t<FT_Library>>&& library, std::vector<std::byte>&& fileData) :
+Font::Font(std::shared_ptr<std::remove_pointer_t<FT_Library>>&& library, FileData&& fileData, std::pmr::memory_resource* memoryResource) :
     m_fileData(std::move(fileData)),
-    m_library(std::move(library))
+    m_library(std::move(library)),
+    m_fontFaces(memoryResource)
 {
 }
 
-std::shared_ptr<Font> Font::Create(std::shared_ptr<std::remove_pointer_t<FT_Library>> library, const char8_t* filePath)
+Ref<Font> Font::Create(std::shared_ptr<std::remove_pointer_t<FT_Library>> library, const char8_t* filePath, std::pmr::memory_resource* memoryResource)
 {
-    auto fileData = File::ReadAllBytes(filePath, ReturnVectorTag{});
-    if (fileData.has_value() == false)
+    // FreeType reads the tables and the glyphs at scattered offsets, so the read ahead would be wasted.
+    auto mappedFile = MemoryMappedFile::Open(filePath, MemoryAdvice::Random);
+    if (mappedFile.has_value() == false)
     {
         return {};
     }
 
-    return Create(std::move(library), std::move(*fileData));
+    return Create(std::move(library), std::move(*mappedFile), memoryResource);
 }
 
-std::shared_ptr<Font> Font::Create(std::shared_ptr<std::remove_pointer_t<FT_Library>> library, std::vector<std::byte>&& fileData)
+Ref<Font> Font::Create(std::shared_ptr<std::remove_pointer_t<FT_Library>> library, std::vector<std::byte>&& fileData, std::pmr::memory_resource* memoryResource)
 {
-    return std::make_shared<MakeSharedEnabler<Font>>(std::move(library), std::move(fileData));
+    return Ref<Font>(new Font(std::move(library), std::move(fileData), memoryResource));
 }
 
-std::shared_ptr<FontFace> Font::GetFontFace(int32_t fontSize)
+Ref<Font> Font::Create(std::shared_ptr<std::remove_pointer_t<FT_Library>> library, MemoryMappedFile&& mappedFile, std::pmr::memory_resource* memoryResource)
 {
-    const auto it = m_fontFaces.find(fontSize);
+    return Ref<Font>(new Font(std::move(library), std::move(mappedFile), memoryResource));
+}
+
+FontFace* Font::GetFontFace(int32_t fontSize)
+{
+    const auto it = m_fontFaces.Find(fontSize);
     if (it != m_fontFaces.end())
     {
-        return it->second;
+        return it->second.Get();
     }
 
-    return m_fontFaces.emplace_hint(it, fontSize, FontFace::Create(m_library, std::span(m_fileData), fontSize))->second;
+    return m_fontFaces.TryEmplace(fontSize, FontFace::Create(m_library, this->GetFileData(), fontSize, m_fontFaces.GetAllocator().resource())).first->second.Get();
 }
 
-std::shared_ptr<const FontFace> Font::GetFontFace(int32_t fontSize) const
+const FontFace* Font::GetFontFace(int32_t fontSize) const
 {
     return const_cast<Font*>(this)->GetFontFace(fontSize);
 }
 
+std::span<const std::byte> Font::GetFileData() const noexcept
+{
+    if (const auto* mappedFile = std::get_if<MemoryMappedFile>(&m_fileData); mappedFile != nullptr)
+    {
+        return mappedFile->GetView();
+    }
+
+    return std::get<std::vector<std::byte>>(m_fileData);
+}
+
 }
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <variant>
+
 #include "Core/NonCopyable.h"
+#include "IO/MemoryMappedFile.h"
 
 #include "FontFace.h"
 
@@ -8,11 +11,16 @@ namespace tg
 {
 
 class Font :
+    public RefCounted<Font>,
     private NonCopyable
 {
+/**@section Type */
+private:
+    using FileData = std::variant<std::vector<std::byte>, MemoryMappedFile>;
+
 /**@section Constructor */
 protected:
-    Font(std::shared_ptr<std::remove_pointer_t<FT_Library>>&& library, std::vector<std::byte>&& fileData);
+    Font(std::shared_ptr<std::remove_pointer_t<FT_Library>>&& library, FileData&& fileData, std::pmr::memory_resource* memoryResource);
 
 /**@section Method */
 public:
@@ -20,37 +28,52 @@ public:
      * @brief   Creates a instance of object.
      * @param library   The handle to the FreeType library instance.
      * @param filePath  The font file path.
+     * @param memoryResource    The resource which the font faces and their glyph tables are allocated from.
      * @return  The instantiated object.
+     * @remark  The file is mapped rather than read, so the font faces read the glyphs straight out of the page cache.
      */
-    [[nodiscard]] static std::shared_ptr<Font> Create(std::shared_ptr<std::remove_pointer_t<FT_Library>> library, const char8_t* filePath);
+    [[nodiscard]] static Ref<Font> Create(std::shared_ptr<std::remove_pointer_t<FT_Library>> library, const char8_t* filePath, std::pmr::memory_resource* memoryResource = TrackingMemoryResource::GetInstance(MemoryTag::Asset));
 
     /**
      * @brief   Creates a instance of object.
      * @param library   The handle to the FreeType library instance.
      * @param fileData  The font file data.
+     * @param memoryResource    The resource which the font faces and their glyph tables are allocated from.
      * @return  The instantiated object.
      */
-    [[nodiscard]] static std::shared_ptr<Font> Create(std::shared_ptr<std::remove_pointer_t<FT_Library>> library, std::vector<std::byte>&& fileData);
+    [[nodiscard]] static Ref<Font> Create(std::shared_ptr<std::remove_pointer_t<FT_Library>> library, std::vector<std::byte>&& fileData, std::pmr::memory_resource* memoryResource = TrackingMemoryResource::GetInstance(MemoryTag::Asset));
+
+    /**
+     * @brief   Creates a instance of object.
+     * @param library   The handle to the FreeType library instance.
+     * @param mappedFile    The mapped font file, which is owned by the font since the font faces refer to it.
+     * @param memoryResource    The resource which the font faces and their glyph tables are allocated from.
+     * @return  The instantiated object.
+     */
+    [[nodiscard]] static Ref<Font> Create(std::shared_ptr<std::remove_pointer_t<FT_Library>> library, MemoryMappedFile&& mappedFile, std::pmr::memory_resource* memoryResource = TrackingMemoryResource::GetInstance(MemoryTag::Asset));
 
     /**
      * @brief   Gets the font face.
      * @param fontSize  The size of font face to get.
-     * @return  The font face or nullptr.
+     * @return  The font face or nullptr. It's owned by the font.
      */
-    [[nodiscard]] std::shared_ptr<FontFace> GetFontFace(int32_t fontSize);
+    [[nodiscard]] FontFace* GetFontFace(int32_t fontSize);
 
     /**
      * @brief   Gets the font face.
      * @param fontSize  The size of font face to get.
-     * @return  The font face or nullptr.
+     * @return  The font face or nullptr. It's owned by the font.
      */
-    [[nodiscard]] std::shared_ptr<const FontFace> GetFontFace(int32_t fontSize) const;
+    [[nodiscard]] const FontFace* GetFontFace(int32_t fontSize) const;
+
+private:
+    [[nodiscard]] std::span<const std::byte> GetFileData() const noexcept;
 
 /**@section Variable */
 private:
-    std::vector<std::byte> m_fileData;
+    FileData m_fileData;
     std::shared_ptr<std::remove_pointer_t<FT_Library>> m_library;
-    mutable std::unordered_map<int32_t, std::shared_ptr<FontFace>> m_fontFaces;
+    mutable pmr::FlatHashMap<int32_t, Ref<FontFace>> m_fontFaces;
 };
 
 }
@@ -1,18 +1,17 @@
 #include "PrecompiledHeader.h"
 
-#include "Core/MakeSharedEnabler.h"
-
 #include "FontFace.h"
 
 namespace tg
 {
 
-FontFace::FontFace(std::unique_ptr<std::remove_pointer_t<FT_Face>, void(*)(FT_Face)> fontFace) noexcept :
-    m_fontFace(std::move(fontFace))
+FontFace::FontFace(std::unique_ptr<std::remove_pointer_t<FT_Face>, void(*)(FT_Face)> fontFace, std::pmr::memory_resource* memoryResource) noexcept :
+    m_fontFace(std::move(fontFace)),
+    m_glyphData(memoryResource)
 {
 }
 
-std::shared_ptr<FontFace> FontFace::Create(const std::shared_ptr<std::remove_pointer_t<FT_Library>>& library, const std::span<const std::byte>& fileData, int32_t fontSize)
+Ref<FontFace> FontFace::Create(const std::shared_ptr<std::remove_pointer_t<FT_Library>>& library, const std::span<const std::byte>& fileData, int32_t fontSize, std::pmr::memory_resource* memoryResource)
 {
     FT_Face face = nullptr;
     if (FT_New_Memory_Face(library.get(), reinterpret_cast<const FT_Byte*>(fileData.data()), static_cast<FT_Long>(fileData.size()), 0, &face))
@@ -30,16 +29,16 @@ std::shared_ptr<FontFace> FontFace::Create(const std::shared_ptr<std::remove_poi
         return {};
     }
 
-    return std::make_shared<MakeSharedEnabler<FontFace>>(decltype(m_fontFace)(face, [](FT_Face face)
+    return Ref<FontFace>(new FontFace(decltype(m_fontFace)(face, [](FT_Face face)
     {
         FT_Done_Face(face);
-    }));
+    }), memoryResource));
 }
 
 const GlyphData* FontFace::GetGlyphData(char32_t c) const
 {
-    const auto it = m_glyphData.find(c);
-    if (it != m_glyphData.cend())
+    const auto it = m_glyphData.Find(c);
+    if (it != m_glyphData.end())
     {
         return &it->second;
     }
@@ -61,7 +60,7 @@ const GlyphData* FontFace::GetGlyphData(char32_t c) const
 
     const auto bearing = IntVector2(static_cast<int32_t>(m_fontFace->glyph->bitmap_left), static_cast<int32_t>(m_fontFace->glyph->bitmap_top));
     const auto advance = IntVector2(static_cast<int32_t>(m_fontFace->glyph->advance.x >> 6), static_cast<int32_t>(m_fontFace->glyph->advance.y >> 6));
-    return &m_glyphData.insert(it, {c, GlyphData{c, GlyphMetrics{bitmapExtent, bearing, advance}, std::move(bitmap)}})->second;
+    return &m_glyphData.TryEmplace(c, GlyphData{c, GlyphMetrics{bitmapExtent, bearing, advance}, std::move(bitmap)}).first->second;
 }
 
 IntVector2 FontFace::GetKerning(char32_t lhs, char32_t rhs) const
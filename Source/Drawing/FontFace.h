@@ -1,11 +1,14 @@
 #pragma once
 
+#include <memory_resource>
 #include <span>
-#include <unordered_map>
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
+#include "Core/FlatHashMap.h"
+#include "Core/MemoryResource.h"
 #include "Core/NonCopyable.h"
+#include "Core/RefCounted.h"
 #include "Math/Vector2.h"
 #include "Math/Extent.h"
 
@@ -27,24 +30,27 @@ struct GlyphData final
 };
 
 class FontFace :
+    public RefCounted<FontFace>,
     private NonCopyable
 {
 /**@section Constructor */
 protected:
-    explicit FontFace(std::unique_ptr<std::remove_pointer_t<FT_Face>, void(*)(FT_Face)> fontFace) noexcept;
+    FontFace(std::unique_ptr<std::remove_pointer_t<FT_Face>, void(*)(FT_Face)> fontFace, std::pmr::memory_resource* memoryResource) noexcept;
 
 /**@section Method */
 public:
     /**
      * @brief   Creates a instance of object.
+     * @param memoryResource    The resource which the glyph table is allocated from.
      * @return  The instantiated object.
      */
-    static std::shared_ptr<FontFace> Create(const std::shared_ptr<std::remove_pointer_t<FT_Library>>& library, const std::span<const std::byte>& fileData, int32_t fontSize);
+    static Ref<FontFace> Create(const std::shared_ptr<std::remove_pointer_t<FT_Library>>& library, const std::span<const std::byte>& fileData, int32_t fontSize, std::pmr::memory_resource* memoryResource = TrackingMemoryResource::GetInstance(MemoryTag::Asset));
 
     /**
      * @brief   Gets the glyph data of the specified character.
      * @param c    Glyph identifier character.
      * @return  The character glyph data or nullptr.
+     * @remark  The glyph data is moved when the other glyphs are loaded, so the pointer must not be kept.
      */
     const GlyphData* GetGlyphData(char32_t c) const;
 
@@ -59,7 +65,7 @@ public:
 /**@section Variable */
 private:
     std::unique_ptr<std::remove_pointer_t<FT_Face>, void(*)(FT_Face)> m_fontFace;
-    mutable std::unordered_map<char32_t, GlyphData> m_glyphData;
+    mutable pmr::FlatHashMap<char32_t, GlyphData> m_glyphData;
 };
 
 }
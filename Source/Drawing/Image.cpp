@@ -10,7 +10,7 @@
 
 #include "Core/Algorithm.h"
 #include "Core/Simd.h"
-#include "IO/File.h"
+#include "IO/MemoryMappedFile.h"
 
 #include "Image.h"
 
@@ -246,19 +246,20 @@ std::byte Image::operator[](int32_t index) const
 
 std::optional<Image> Image::Create(const char8_t* filePath)
 {
-    auto fileData = File::ReadAllBytes(filePath, ReturnVectorTag{});
-    if (fileData.has_value() == false)
+    // The decoder reads the file from the beginning to the end once, so it's decoded straight out of the page cache.
+    const auto mappedFile = MemoryMappedFile::Open(filePath, MemoryAdvice::Sequential | MemoryAdvice::WillNeed);
+    if (mappedFile.has_value() == false)
     {
         return {};
     }
 
-    return Create(*fileData);
+    return Create(mappedFile->GetView());
 }
 
 std::optional<Image> Image::Create(const std::span<const std::byte>& bytes)
 {
     int width = 0, height = 0;
-    auto imageData = std::unique_ptr<std::byte[]>(reinterpret_cast<std::byte*>(stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(&bytes[0]), static_cast<int>(bytes.size()), &width, &height, nullptr, STBI_rgb_alpha)));
+    auto imageData = std::unique_ptr<std::byte[]>(reinterpret_cast<std::byte*>(stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(bytes.data()), static_cast<int>(bytes.size()), &width, &height, nullptr, STBI_rgb_alpha)));
     if (imageData == nullptr)
     {
         return {};
@@ -1,10 +1,15 @@
 #include "PrecompiledHeader.h"
 
+#include <array>
+#include <fmt/format.h>
+
+#include "Diagnostics/Debug.h"
 #include "Platform/Environment.h"
 #include "Engine/Application.h"
 
 #include "Engine.h"
 #include "AssetModule.h"
+#include "EventModule.h"
 #include "InputModule.h"
 #include "TimerModule.h"
 #include "TaskModule.h"
@@ -34,6 +39,7 @@ Engine& Engine::GetInstance() noexcept
 void Engine::Initialize()
 {
     this->AddModule<TaskModule>();
+    this->AddModule<EventModule>();
     this->AddModule<AudioModule>();
     this->AddModule<TimeModule>();
     this->AddModule<TimerModule>();
@@ -45,6 +51,7 @@ void Engine::Initialize()
 void Engine::Update()
 {
     this->UpdateModule();
+    this->EndFrame();
 }
 
 void Engine::UpdateModule()
@@ -85,6 +92,29 @@ float Engine::GetTargetFrameRate() const noexcept
     return 1.0f / m_targetSecondPerFrame;
 }
 
+FrameAllocator& Engine::GetFrameAllocator() noexcept
+{
+    return m_frameAllocator;
+}
+
+void Engine::EndFrame()
+{
+    // The buffers grow to the high-water mark when they're reset, so the report shows up only until the frames settle.
+    const auto& frameAllocator = m_frameAllocator;
+    for (const auto* allocator : {&frameAllocator.GetCurrent(), &frameAllocator.GetCurrentShared()})
+    {
+        if (allocator->GetOverflowCount() > 0)
+        {
+            // The message is formatted on the stack, so the report doesn't allocate from the heap by itself.
+            std::array<char8_t, 256> message;
+            const auto result = fmt::format_to_n(message.data(), message.size(), u8"The frame allocator has overflowed. (Shared: {0}, Capacity: {1}, High-water mark: {2}, Overflow count: {3})", allocator == &frameAllocator.GetCurrentShared(), allocator->GetCapacity(), allocator->GetHighWaterMark(), allocator->GetOverflowCount());
+            Debug::WriteLine(std::u8string_view(message.data(), std::min(result.size, message.size())));
+        }
+    }
+
+    m_frameAllocator.SwapBuffers();
+}
+
 void Engine::UpdateModuleStage(ModuleStage moduleStage)
 {
     for (auto& module : m_moduleStage[UnderlyingCast(moduleStage)])
@@ -98,6 +128,8 @@ void Engine::UpdateModuleStage(ModuleStage moduleStage)
 
 void Engine::RemoveAllModule()
 {
+    m_moduleTable.clear();
+
     for (auto& modules : m_moduleStage)
     {
         while (modules.empty() == false)
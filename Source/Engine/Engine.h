@@ -4,6 +4,8 @@
 #include <vector>
 
 #include "Core/Algorithm.h"
+#include "Core/FrameAllocator.h"
+#include "Core/TypeId.h"
 #include "Graphics/VideoMode.h"
 #include "Platform/WindowStyle.h"
 
@@ -101,15 +103,26 @@ public:
      */
     float GetTargetFrameRate() const noexcept;
 
+    /**
+     * @brief   Gets the allocator of the temporary memory which lives until the end of the next frame.
+     * @return  The frame allocator.
+     */
+    FrameAllocator& GetFrameAllocator() noexcept;
+
 private:
     void UpdateModule();
     void UpdateModuleStage(ModuleStage moduleStage);
     void RemoveAllModule();
+    void EndFrame();
 
 /**@section Variable */
 private:
     EngineConfiguration m_engineConfig;
     std::array<std::vector<std::unique_ptr<Module>>, 3> m_moduleStage;
+
+    // Indexed by TypeId<Module>, so FindModule doesn't need to walk every stage.
+    std::vector<Module*> m_moduleTable;
+    FrameAllocator m_frameAllocator;
     int64_t m_prevFrameTime = 0;
     float m_frameTime = 0.0f;
     float m_targetSecondPerFrame = -1.0f;
@@ -122,6 +135,13 @@ _Module* Engine::AddModule(_Types&&... args)
     auto* rawModule = module.get();
     m_moduleStage[UnderlyingCast(_Module::ModuleStage)].push_back(std::move(module));
 
+    const auto moduleIndex = TypeId<Module>::Get<_Module>();
+    if (moduleIndex >= m_moduleTable.size())
+    {
+        m_moduleTable.resize(moduleIndex + 1);
+    }
+    m_moduleTable[moduleIndex] = rawModule;
+
     rawModule->Initialize();
 
     return rawModule;
@@ -130,18 +150,13 @@ _Module* Engine::AddModule(_Types&&... args)
 template <typename _Module> requires Modularizable<_Module>
 _Module* Engine::FindModule() noexcept
 {
-    for (auto& modules : m_moduleStage)
+    const auto moduleIndex = TypeId<Module>::Get<_Module>();
+    if (moduleIndex >= m_moduleTable.size())
     {
-        for (auto& module : modules)
-        {
-            if (module->GetRtti() == tg::GetRtti<_Module>())
-            {
-                return reinterpret_cast<_Module*>(module.get());
-            }
-        }
+        return nullptr;
     }
 
-    return nullptr;
+    return static_cast<_Module*>(m_moduleTable[moduleIndex]);
 }
 
 template <typename _Module> requires Modularizable<_Module>
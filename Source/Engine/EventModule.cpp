@@ -0,0 +1,23 @@
+#include "PrecompiledHeader.h"
+
+#include "EventModule.h"
+
+namespace tg
+{
+
+EventBus& EventModule::GetEventBus() noexcept
+{
+    return m_eventBus;
+}
+
+const EventBus& EventModule::GetEventBus() const noexcept
+{
+    return m_eventBus;
+}
+
+void EventModule::Update()
+{
+    m_eventBus.DispatchQueuedEvents();
+}
+
+}
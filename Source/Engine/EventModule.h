@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Core/EventBus.h"
+
+#include "Module.h"
+
+namespace tg
+{
+
+class EventModule :
+	public Module
+{
+public:
+    TGON_RTTI(EventModule)
+
+/**@section Method */
+public:
+    EventBus& GetEventBus() noexcept;
+    const EventBus& GetEventBus() const noexcept;
+
+    /**
+     * @brief   Dispatches the events which were queued or posted during the last frame.
+     */
+    void Update() override;
+
+/**@section Variable */
+public:
+    static constexpr auto ModuleStage = ModuleStage::Update;
+
+private:
+    EventBus m_eventBus;
+};
+
+}
@@ -1,38 +1,392 @@
 #include "PrecompiledHeader.h"
 
+#include <algorithm>
+#include <atomic>
+
+#include "Game/TransformComponent.h"
+#include "IO/File.h"
+#include "Threading/DispatchQueue.h"
+
+#include "Engine.h"
 #include "SceneModule.h"
+#include "TaskModule.h"
 
 namespace tg
 {
 
+Scene::Scene(FrameAllocator& frameAllocator, std::pmr::memory_resource* memoryResource) :
+    m_gameObjectPool(memoryResource),
+    m_frameAllocator(&frameAllocator)
+{
+}
+
 void Scene::Update()
 {
-    for (auto& gameObject : m_gameObjects)
+    if (m_commandBuffers.empty())
     {
-        if (gameObject->IsActive())
+        m_commandBuffers.emplace_back(*m_frameAllocator);
+    }
+
+    auto* prevCommandBuffer = EntityCommandBuffer::SetCurrent(&m_commandBuffers[0]);
+    for (size_t i = 0; i < TickScheduler::TickGroupCount; ++i)
+    {
+        m_tickScheduler.Tick(static_cast<TickGroup>(i));
+    }
+    EntityCommandBuffer::SetCurrent(prevCommandBuffer);
+
+    m_tickScheduler.AdvanceFrame();
+    this->PlaybackCommandBuffers(1);
+}
+
+void Scene::UpdateParallel(ConcurrentDispatchQueue& dispatchQueue, int32_t chunkCount)
+{
+    if (chunkCount <= 1)
+    {
+        this->Update();
+        return;
+    }
+
+    while (m_commandBuffers.size() < static_cast<size_t>(chunkCount))
+    {
+        m_commandBuffers.emplace_back(*m_frameAllocator);
+    }
+
+    for (size_t i = 0; i < TickScheduler::TickGroupCount; ++i)
+    {
+        const auto dueCount = m_tickScheduler.BeginTick(static_cast<TickGroup>(i));
+        const auto chunkSize = (dueCount + chunkCount - 1) / chunkCount;
+
+        std::atomic<int32_t> remainingChunkCount = chunkCount;
+        for (int32_t j = 0; j < chunkCount; ++j)
         {
-            gameObject->Update();
+            dispatchQueue.AddAsyncTask([this, j, chunkSize, &remainingChunkCount]()
+            {
+                // The chunks share the objects, so the structural changes can only be recorded until the playback.
+                auto* prevCommandBuffer = EntityCommandBuffer::SetCurrent(&m_commandBuffers[j]);
+                const auto prevIsStructureLocked = GameObject::SetStructureLocked(true);
+                m_tickScheduler.Tick(j * chunkSize, (j + 1) * chunkSize);
+                GameObject::SetStructureLocked(prevIsStructureLocked);
+                EntityCommandBuffer::SetCurrent(prevCommandBuffer);
+
+                remainingChunkCount.fetch_sub(1, std::memory_order_release);
+            });
+        }
+
+        while (remainingChunkCount.load(std::memory_order_acquire) > 0)
+        {
+            std::this_thread::yield();
         }
+
+        m_tickScheduler.EndTick();
+    }
+
+    m_tickScheduler.AdvanceFrame();
+    this->PlaybackCommandBuffers(static_cast<size_t>(chunkCount));
+}
+
+void Scene::PlaybackCommandBuffers(size_t commandBufferCount)
+{
+    for (size_t i = 0; i < commandBufferCount; ++i)
+    {
+        // Keep the buffer current during playback, so the commands which are recorded by Component::Initialize run in this sync point.
+        auto* prevCommandBuffer = EntityCommandBuffer::SetCurrent(&m_commandBuffers[i]);
+        m_commandBuffers[i].Playback(*this);
+        EntityCommandBuffer::SetCurrent(prevCommandBuffer);
+    }
+}
+
+GameObjectHandle Scene::Instantiate(StringHash name)
+{
+    assert(GameObject::IsStructureLocked() == false && "Record the structural changes into EntityCommandBuffer::GetCurrent() during the parallel update.");
+
+    return m_gameObjectPool.Create(std::move(name), &m_tickScheduler, m_gameObjectPool.GetMemoryResource());
+}
+
+bool Scene::Destroy(const GameObjectHandle& handle)
+{
+    assert(GameObject::IsStructureLocked() == false && "Record the structural changes into EntityCommandBuffer::GetCurrent() during the parallel update.");
+
+    auto* gameObject = m_gameObjectPool.Get(handle);
+    if (gameObject == nullptr)
+    {
+        return false;
     }
+
+    // The children refer to the parent by the raw pointer, so they are detached before the slot is reused.
+    if (gameObject->GetChildCount() > 0)
+    {
+        m_gameObjectPool.ForEach([gameObject](GameObject& child)
+        {
+            if (child.GetParent() == gameObject)
+            {
+                child.SetParent(nullptr);
+            }
+        });
+    }
+
+    gameObject->SetParent(nullptr);
+
+    return m_gameObjectPool.Destroy(handle);
+}
+
+GameObject* Scene::FindGameObject(const GameObjectHandle& handle) noexcept
+{
+    return m_gameObjectPool.Get(handle);
+}
+
+const GameObject* Scene::FindGameObject(const GameObjectHandle& handle) const noexcept
+{
+    return m_gameObjectPool.Get(handle);
+}
+
+bool Scene::IsValid(const GameObjectHandle& handle) const noexcept
+{
+    return m_gameObjectPool.IsValid(handle);
+}
+
+std::pmr::memory_resource* Scene::GetMemoryResource() const noexcept
+{
+    return m_gameObjectPool.GetMemoryResource();
+}
+
+SceneLoadOperation::SceneLoadOperation(std::shared_ptr<Scene> scene, LoadSceneMode loadSceneMode) noexcept :
+    m_scene(std::move(scene)),
+    m_loadSceneMode(loadSceneMode)
+{
+}
+
+float SceneLoadOperation::GetProgress() const noexcept
+{
+    switch (m_state.load(std::memory_order_acquire))
+    {
+    case State::Reading:
+        return 0.0f;
+
+    case State::Instantiating:
+        return 0.5f + 0.5f * static_cast<float>(m_instantiatedCount) / static_cast<float>(std::max<size_t>(m_sceneData->objects.size(), 1));
+
+    default:
+        return 1.0f;
+    }
+}
+
+bool SceneLoadOperation::IsDone() const noexcept
+{
+    const auto state = m_state.load(std::memory_order_acquire);
+    return state == State::Succeeded || state == State::Failed;
+}
+
+bool SceneLoadOperation::IsSucceeded() const noexcept
+{
+    return m_state.load(std::memory_order_acquire) == State::Succeeded;
+}
+
+const std::shared_ptr<Scene>& SceneLoadOperation::GetScene() const noexcept
+{
+    return m_scene;
+}
+
+LoadSceneMode SceneLoadOperation::GetLoadSceneMode() const noexcept
+{
+    return m_loadSceneMode;
+}
+
+void SceneModule::Initialize()
+{
+    SceneSerializer::RegisterComponent<TransformComponent>("TransformComponent");
 }
 
 void SceneModule::Update()
 {
-    if (m_activeScene != nullptr)
+    for (auto& scene : m_unloadingScenes)
     {
-        m_activeScene->Update();
+        m_sceneList.erase(std::remove(m_sceneList.begin(), m_sceneList.end(), scene), m_sceneList.end());
+        if (m_activeScene == scene)
+        {
+            m_activeScene = m_sceneList.empty() ? nullptr : m_sceneList.front();
+        }
+    }
+    m_unloadingScenes.clear();
+
+    this->UpdateLoadOperations();
+
+    for (auto& scene : m_sceneList)
+    {
+        scene->Update();
     }
 }
 
 void SceneModule::NewScene(NewSceneSetup newSceneSetup)
 {
+    auto scene = std::make_shared<Scene>(Engine::GetInstance().GetFrameAllocator());
+    if (newSceneSetup == NewSceneSetup::DefaultGameObjects)
+    {
+        const auto handle = scene->Instantiate(StringHash("Main Camera"));
+        scene->FindGameObject(handle)->AddComponent<TransformComponent>();
+    }
+
+    this->OpenScene(scene, LoadSceneMode::Single);
+
+    if (OnNewSceneCreated != nullptr)
+    {
+        OnNewSceneCreated(scene, newSceneSetup);
+    }
+}
+
+std::shared_ptr<SceneLoadOperation> SceneModule::LoadScene(const std::string& path, LoadSceneMode loadSceneMode)
+{
+    auto loadOperation = std::make_shared<SceneLoadOperation>(std::make_shared<Scene>(Engine::GetInstance().GetFrameAllocator()), loadSceneMode);
+    m_loadOperations.push_back(loadOperation);
+
+    if (OnOpeningScene != nullptr)
+    {
+        OnOpeningScene(loadOperation->GetScene(), loadSceneMode);
+    }
+
+    // The init-capture drops the const of the reference, so the task can be moved into the queue without throwing.
+    auto readTask = [loadOperation, path = path]()
+    {
+        if (auto fileData = File::ReadAllBytes(reinterpret_cast<const char8_t*>(path.c_str()), ReturnVectorTag{}); fileData.has_value())
+        {
+            loadOperation->m_sceneData = SceneSerializer::Deserialize(std::move(*fileData));
+        }
+
+        loadOperation->m_state.store(loadOperation->m_sceneData.has_value() ? SceneLoadOperation::State::Instantiating : SceneLoadOperation::State::Failed, std::memory_order_release);
+    };
+
+    if (auto* taskModule = Engine::GetInstance().FindModule<TaskModule>(); taskModule != nullptr)
+    {
+        taskModule->GetGlobalDispatchQueue().AddAsyncTask(readTask);
+    }
+    else
+    {
+        readTask();
+    }
+
+    return loadOperation;
+}
+
+void SceneModule::UnloadScene(const std::shared_ptr<Scene>& scene)
+{
+    m_unloadingScenes.push_back(scene);
+}
+
+void SceneModule::SetLoadingTimeBudget(std::chrono::microseconds loadingTimeBudget) noexcept
+{
+    m_loadingTimeBudget = loadingTimeBudget;
 }
 
-void SceneModule::LoadScene(const std::string& path, LoadSceneMode loadSceneMode)
+std::chrono::microseconds SceneModule::GetLoadingTimeBudget() const noexcept
 {
+    return m_loadingTimeBudget;
+}
+
+const std::shared_ptr<Scene>& SceneModule::GetActiveScene() const noexcept
+{
+    return m_activeScene;
+}
+
+void SceneModule::UpdateLoadOperations()
+{
+    // Reading the clock costs more than instantiating a small object, so check the budget once per batch.
+    constexpr size_t BatchSize = 16;
+
+    const auto deadline = std::chrono::steady_clock::now() + m_loadingTimeBudget;
+    while (m_loadOperations.empty() == false)
+    {
+        auto& loadOperation = *m_loadOperations.front();
+
+        // The scenes are opened in the order they were requested, so wait for the front one.
+        const auto state = loadOperation.m_state.load(std::memory_order_acquire);
+        if (state == SceneLoadOperation::State::Reading)
+        {
+            break;
+        }
+
+        if (state == SceneLoadOperation::State::Instantiating)
+        {
+            const auto& sceneData = *loadOperation.m_sceneData;
+            bool isSucceeded = true;
+            while (loadOperation.m_instantiatedCount < sceneData.objects.size())
+            {
+                isSucceeded = SceneSerializer::Instantiate(sceneData, loadOperation.m_instantiatedCount++, *loadOperation.m_scene, loadOperation.m_handles);
+                if (isSucceeded == false || (loadOperation.m_instantiatedCount % BatchSize == 0 && std::chrono::steady_clock::now() >= deadline))
+                {
+                    break;
+                }
+            }
+
+            // The malformed component fails the load like the malformed file, so the partially loaded scene is never opened.
+            if (isSucceeded == false)
+            {
+                loadOperation.m_handles = {};
+                loadOperation.m_state.store(SceneLoadOperation::State::Failed, std::memory_order_release);
+                m_loadOperations.pop_front();
+                continue;
+            }
+
+            if (loadOperation.m_instantiatedCount < sceneData.objects.size())
+            {
+                break;
+            }
+
+            loadOperation.m_handles = {};
+            this->OpenScene(loadOperation.m_scene, loadOperation.m_loadSceneMode);
+            loadOperation.m_state.store(SceneLoadOperation::State::Succeeded, std::memory_order_release);
+
+            if (OnOpenScene != nullptr)
+            {
+                OnOpenScene(loadOperation.m_scene, loadOperation.m_loadSceneMode);
+            }
+        }
+
+        m_loadOperations.pop_front();
+    }
+}
+
+void SceneModule::OpenScene(const std::shared_ptr<Scene>& scene, LoadSceneMode loadSceneMode)
+{
+    if (loadSceneMode == LoadSceneMode::Single)
+    {
+        m_sceneList.clear();
+        m_activeScene = scene;
+    }
+    else if (m_activeScene == nullptr)
+    {
+        m_activeScene = scene;
+    }
+
+    m_sceneList.push_back(scene);
+}
+
+GameObjectHandle SceneModule::Instantiate(StringHash name)
+{
+    if (m_activeScene == nullptr)
+    {
+        return {};
+    }
+
+    return m_activeScene->Instantiate(std::move(name));
+}
+
+bool SceneModule::Destroy(const GameObjectHandle& handle)
+{
+    if (m_activeScene == nullptr)
+    {
+        return false;
+    }
+
+    return m_activeScene->Destroy(handle);
+}
+
+GameObject* SceneModule::FindGameObject(const GameObjectHandle& handle) noexcept
+{
+    if (m_activeScene == nullptr)
+    {
+        return nullptr;
+    }
+
+    return m_activeScene->FindGameObject(handle);
 }
 
-//std::shared_ptr<GameObject> SceneManagement::Instantiate()
-//{
-//}
 }
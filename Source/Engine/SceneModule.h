@@ -1,15 +1,23 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <optional>
 #include <string>
 
 #include "Core/Delegate.h"
+#include "Game/EntityCommandBuffer.h"
 #include "Game/GameObject.h"
 
 #include "Module.h"
+#include "SceneSerializer.h"
 
 namespace tg
 {
 
+class ConcurrentDispatchQueue;
+
 enum class NewSceneSetup
 {
     EmptyScene,
@@ -28,13 +36,158 @@ class Scene :
 public:
     TGON_RTTI(Scene)
 
+/**@section Constructor */
+public:
+    /**
+     * @brief   Initializes the scene.
+     * @param frameAllocator    The allocator which the command buffers of the updates take their memory from. It must outlive the scene.
+     * @param memoryResource    The resource which the objects and their component lists are allocated from.
+     * @remark  A level arena such as std::pmr::monotonic_buffer_resource can be passed, so that the memory of the level is
+     *          freed in one shot with the arena. The arena must outlive the scene.
+     */
+    explicit Scene(FrameAllocator& frameAllocator, std::pmr::memory_resource* memoryResource = TrackingMemoryResource::GetInstance(MemoryTag::Scene));
+
 /**@section Method */
 public:
     void Initialize();
+
+    /**
+     * @brief   Updates the components which are due in this frame, group by group on the calling thread.
+     * @remark  The structural changes which are recorded into EntityCommandBuffer::GetCurrent() are applied at the end of the update.
+     */
     void Update();
 
+    /**
+     * @brief   Updates the components which are due in this frame by splitting each tick group into chunks.
+     * @param dispatchQueue     The queue which runs the chunks. It must not be the queue of the calling thread.
+     * @param chunkCount        The number of chunks.
+     * @remark  The tick groups are still updated in order. Each chunk records its structural changes into its own command
+     *          buffer, and the buffers are played back in chunk order at the end of the update, so the result doesn't
+     *          depend on the thread scheduling. The components must not change the structure directly while their chunk
+     *          runs, which is asserted through GameObject::IsStructureLocked.
+     */
+    void UpdateParallel(ConcurrentDispatchQueue& dispatchQueue, int32_t chunkCount);
+
+    /**
+     * @brief   Instantiates a new GameObject in the scene.
+     * @param name  The name of the object.
+     * @return  The handle of the instantiated object.
+     */
+    GameObjectHandle Instantiate(StringHash name = {});
+
+    /**
+     * @brief   Destroys the object and its components. The children of the object are detached from it.
+     * @param handle    The handle of the object.
+     * @return  True if the object was destroyed, false if the handle was stale.
+     */
+    bool Destroy(const GameObjectHandle& handle);
+
+    /**
+     * @brief   Finds the object which the handle points to.
+     * @param handle    The handle of the object.
+     * @return  The found object or nullptr if the handle was stale.
+     */
+    [[nodiscard]] GameObject* FindGameObject(const GameObjectHandle& handle) noexcept;
+
+    /**
+     * @brief   Finds the object which the handle points to.
+     * @param handle    The handle of the object.
+     * @return  The found object or nullptr if the handle was stale.
+     */
+    [[nodiscard]] const GameObject* FindGameObject(const GameObjectHandle& handle) const noexcept;
+
+    /**
+     * @brief   Checks whether the object which the handle points to is still alive.
+     * @param handle    The handle of the object.
+     * @return  True if the object is alive, false otherwise.
+     */
+    [[nodiscard]] bool IsValid(const GameObjectHandle& handle) const noexcept;
+    [[nodiscard]] std::pmr::memory_resource* GetMemoryResource() const noexcept;
+
+    /**
+     * @brief   Invokes the callback with every active object which holds all of the specified types of component.
+     * @param callback  The callback which receives GameObject& and the references of the components.
+     */
+    template <typename... _Components, typename _Callback>
+    void ForEach(const _Callback& callback);
+
+    /**
+     * @brief   Invokes the callback with every object including the inactive ones.
+     * @param callback  The callback which receives GameObject&.
+     */
+    template <typename _Callback>
+    void ForEachGameObject(const _Callback& callback);
+
+private:
+    void PlaybackCommandBuffers(size_t commandBufferCount);
+
+/**@section Variable */
+private:
+    // Declared before the pool because the components unregister themselves from the scheduler on destruction.
+    TickScheduler m_tickScheduler;
+    ObjectPool<GameObject> m_gameObjectPool;
+    FrameAllocator* m_frameAllocator;
+    std::deque<EntityCommandBuffer> m_commandBuffers;
+};
+
+template <typename... _Components, typename _Callback>
+void Scene::ForEach(const _Callback& callback)
+{
+    const auto queryMask = ComponentMask::Create<_Components...>();
+    m_gameObjectPool.ForEach([&](GameObject& gameObject)
+    {
+        if (gameObject.IsActive() && gameObject.GetComponentMask().Contains(queryMask))
+        {
+            callback(gameObject, *gameObject.FindComponent<_Components>()...);
+        }
+    });
+}
+
+template <typename _Callback>
+void Scene::ForEachGameObject(const _Callback& callback)
+{
+    m_gameObjectPool.ForEach(callback);
+}
+
+class SceneLoadOperation final :
+    private NonCopyable
+{
+/**@section Type */
+private:
+    enum class State
+    {
+        Reading,
+        Instantiating,
+        Succeeded,
+        Failed,
+    };
+
+/**@section Constructor */
+public:
+    SceneLoadOperation(std::shared_ptr<Scene> scene, LoadSceneMode loadSceneMode) noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Gets the progress of the loading.
+     * @return  The progress in the range of [0, 1]. Reading and parsing the file take the first half.
+     */
+    [[nodiscard]] float GetProgress() const noexcept;
+    [[nodiscard]] bool IsDone() const noexcept;
+    [[nodiscard]] bool IsSucceeded() const noexcept;
+    [[nodiscard]] const std::shared_ptr<Scene>& GetScene() const noexcept;
+    [[nodiscard]] LoadSceneMode GetLoadSceneMode() const noexcept;
+
+/**@section Variable */
 private:
-    std::vector<std::shared_ptr<GameObject>> m_gameObjects;
+    friend class SceneModule;
+
+    std::shared_ptr<Scene> m_scene;
+    LoadSceneMode m_loadSceneMode;
+    std::atomic<State> m_state = State::Reading;
+    std::optional<SceneData> m_sceneData;
+    std::vector<GameObjectHandle> m_handles;
+    size_t m_instantiatedCount = 0;
 };
 
 class SceneModule :
@@ -51,45 +204,99 @@ public:
 
 /**@section Method */
 public:
+    /**
+     * @brief   Initializes the object.
+     */
+    void Initialize() override;
+
     /**
      * @brief   Updates the frame of the object.
+     * @remark  The loading scenes are instantiated first within the loading time budget, and then every open scene is updated.
      */
     void Update() override;
 
     /**
-     * @brief   Creates a new scene.
+     * @brief   Creates a new scene and makes it the active scene.
      * @param newSceneSetup     The setup parameter allows you to select whether or not the default set of object should be added to the new scene.
      */
     void NewScene(NewSceneSetup newSceneSetup);
 
     /**
-     * @brief   Loads the specified name of scene.
-     * @param name              The name of scene.
-     * @param loadSceneMode     It allows you to select whether or not merge objects to active scene.
+     * @brief   Starts loading the specified scene file.
+     * @param path              The path of the scene file.
+     * @param loadSceneMode     Single replaces every open scene, and Additive opens the scene alongside the others.
+     * @return  The operation which reports the progress.
+     * @remark  The file is read and parsed on the global dispatch queue. The objects are instantiated on the main thread
+     *          within the loading time budget per frame, and the scene is opened after every object was instantiated.
+     *          OnOpeningScene is invoked when the loading starts, and OnOpenScene is invoked when the scene is opened.
+     */
+    std::shared_ptr<SceneLoadOperation> LoadScene(const std::string& path, LoadSceneMode loadSceneMode);
+
+    /**
+     * @brief   Closes the scene which was opened by NewScene or LoadScene.
+     * @param scene     The scene to close.
+     * @remark  The scene is closed at the beginning of the next update, so it's safe to call from the scene update.
+     */
+    void UnloadScene(const std::shared_ptr<Scene>& scene);
+
+    /**
+     * @brief   Sets the time which can be spent for instantiating the loading scenes per frame.
+     * @param loadingTimeBudget     The time budget.
      */
-    void LoadScene(const std::string& name, LoadSceneMode loadSceneMode);
+    void SetLoadingTimeBudget(std::chrono::microseconds loadingTimeBudget) noexcept;
+
+    [[nodiscard]] std::chrono::microseconds GetLoadingTimeBudget() const noexcept;
+
+    /**
+     * @brief   Gets the active scene which receives the new objects.
+     * @return  The active scene or nullptr.
+     */
+    [[nodiscard]] const std::shared_ptr<Scene>& GetActiveScene() const noexcept;
 
     /**
      * @brief   Instantiate a new GameObject to the active scene.
-     * @return  A new instantiated object.
+     * @param name  The name of the object.
+     * @return  The handle of the instantiated object.
      */
-    std::shared_ptr<GameObject> Instantiate();
+    GameObjectHandle Instantiate(StringHash name = {});
+
+    /**
+     * @brief   Destroys the object in the active scene.
+     * @param handle    The handle of the object.
+     * @return  True if the object was destroyed, false if the handle was stale.
+     */
+    bool Destroy(const GameObjectHandle& handle);
+
+    /**
+     * @brief   Finds the object in the active scene.
+     * @param handle    The handle of the object.
+     * @return  The found object or nullptr if the handle was stale.
+     */
+    [[nodiscard]] GameObject* FindGameObject(const GameObjectHandle& handle) noexcept;
 
     /**
      * @brief   Makes object don't destroy on load new scene.
-     * @param object    The target object.
+     * @param handle    The handle of the target object.
      */
-    void DontDestroyOnLoad(std::shared_ptr<GameObject> object);
+    void DontDestroyOnLoad(const GameObjectHandle& handle);
 
 /**@section Variable */
 public:
     static constexpr auto ModuleStage = ModuleStage::Update;
+    NewSceneCreatedCallback OnNewSceneCreated;
     SceneOpeningCallback OnOpeningScene;
     SceneOpenCallback OnOpenScene;
 
+private:
+    void UpdateLoadOperations();
+    void OpenScene(const std::shared_ptr<Scene>& scene, LoadSceneMode loadSceneMode);
+
 protected:
     std::shared_ptr<Scene> m_activeScene;
     std::vector<std::shared_ptr<Scene>> m_sceneList;
+    std::vector<std::shared_ptr<Scene>> m_unloadingScenes;
+    std::deque<std::shared_ptr<SceneLoadOperation>> m_loadOperations;
+    std::chrono::microseconds m_loadingTimeBudget = std::chrono::microseconds(2000);
 };
 
 }
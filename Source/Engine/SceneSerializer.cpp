@@ -0,0 +1,237 @@
+#include "PrecompiledHeader.h"
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+#include "SceneModule.h"
+#include "SceneSerializer.h"
+
+namespace tg
+{
+namespace
+{
+
+constexpr uint32_t SceneMagic = 0x43534754; // "TGSC"
+constexpr uint32_t SceneVersion = 1;
+
+std::mutex g_componentTypeMutex;
+
+// std::deque keeps the addresses of the types, because SceneComponentData refers to them.
+std::deque<SceneComponentType> g_componentTypes;
+
+template <typename _Type>
+void WriteValue(std::vector<std::byte>& bytes, const _Type& value)
+{
+    const auto* src = reinterpret_cast<const std::byte*>(&value);
+    bytes.insert(bytes.end(), src, src + sizeof(_Type));
+}
+
+template <typename _Type>
+bool ReadValue(std::span<const std::byte> bytes, size_t& offset, _Type& value)
+{
+    if (bytes.size() - offset < sizeof(_Type))
+    {
+        return false;
+    }
+
+    std::memcpy(&value, &bytes[offset], sizeof(_Type));
+    offset += sizeof(_Type);
+
+    return true;
+}
+
+const SceneComponentType* FindComponentType(uint32_t nameHash)
+{
+    auto iter = std::find_if(g_componentTypes.begin(), g_componentTypes.end(), [&](const SceneComponentType& componentType)
+    {
+        return componentType.nameHash == nameHash;
+    });
+
+    return iter != g_componentTypes.end() ? &*iter : nullptr;
+}
+
+}
+
+std::vector<std::byte> SceneSerializer::Serialize(Scene& scene)
+{
+    std::vector<GameObject*> gameObjects;
+    scene.ForEachGameObject([&](GameObject& gameObject)
+    {
+        gameObjects.push_back(&gameObject);
+    });
+
+    // Write the parents first, so the loader can resolve them with the handles which were already instantiated.
+    auto getDepth = [](const GameObject* gameObject)
+    {
+        int32_t depth = 0;
+        while ((gameObject = gameObject->GetParent()) != nullptr)
+        {
+            ++depth;
+        }
+        return depth;
+    };
+    std::stable_sort(gameObjects.begin(), gameObjects.end(), [&](const GameObject* lhs, const GameObject* rhs)
+    {
+        return getDepth(lhs) < getDepth(rhs);
+    });
+
+    std::unordered_map<const GameObject*, int32_t> objectIndices;
+    for (size_t i = 0; i < gameObjects.size(); ++i)
+    {
+        objectIndices.emplace(gameObjects[i], static_cast<int32_t>(i));
+    }
+
+    std::vector<std::byte> fileData;
+    WriteValue(fileData, SceneMagic);
+    WriteValue(fileData, SceneVersion);
+    WriteValue(fileData, static_cast<uint32_t>(gameObjects.size()));
+
+    std::lock_guard lockGuard(g_componentTypeMutex);
+    for (auto* gameObject : gameObjects)
+    {
+        const auto& name = gameObject->GetName();
+        WriteValue(fileData, static_cast<uint32_t>(name.Length()));
+        fileData.insert(fileData.end(), reinterpret_cast<const std::byte*>(name.Data()), reinterpret_cast<const std::byte*>(name.Data()) + name.Length());
+
+        const auto parentIter = objectIndices.find(gameObject->GetParent());
+        WriteValue(fileData, parentIter != objectIndices.end() ? parentIter->second : int32_t(-1));
+        WriteValue(fileData, static_cast<uint8_t>(gameObject->IsActive()));
+
+        const auto componentCountOffset = fileData.size();
+        uint32_t componentCount = 0;
+        WriteValue(fileData, componentCount);
+
+        for (auto& componentType : g_componentTypes)
+        {
+            if (componentType.has(*gameObject) == false)
+            {
+                continue;
+            }
+
+            WriteValue(fileData, componentType.nameHash);
+
+            const auto payloadSizeOffset = fileData.size();
+            WriteValue(fileData, uint32_t(0));
+            componentType.write(*gameObject, fileData);
+
+            const auto payloadSize = static_cast<uint32_t>(fileData.size() - payloadSizeOffset - sizeof(uint32_t));
+            std::memcpy(&fileData[payloadSizeOffset], &payloadSize, sizeof(payloadSize));
+            ++componentCount;
+        }
+
+        std::memcpy(&fileData[componentCountOffset], &componentCount, sizeof(componentCount));
+    }
+
+    return fileData;
+}
+
+std::optional<SceneData> SceneSerializer::Deserialize(std::vector<std::byte> fileData)
+{
+    SceneData sceneData;
+    sceneData.fileData = std::move(fileData);
+
+    const std::span<const std::byte> bytes = sceneData.fileData;
+    size_t offset = 0;
+
+    uint32_t magic = 0, version = 0, objectCount = 0;
+    if (ReadValue(bytes, offset, magic) == false || magic != SceneMagic ||
+        ReadValue(bytes, offset, version) == false || version != SceneVersion ||
+        ReadValue(bytes, offset, objectCount) == false)
+    {
+        return {};
+    }
+
+    // Every object takes at least 13 bytes, so a broken count can't make us reserve a huge buffer.
+    sceneData.objects.reserve(std::min<size_t>(objectCount, bytes.size() / 13));
+
+    std::lock_guard lockGuard(g_componentTypeMutex);
+    for (uint32_t i = 0; i < objectCount; ++i)
+    {
+        uint32_t nameLength = 0;
+        if (ReadValue(bytes, offset, nameLength) == false || bytes.size() - offset < nameLength)
+        {
+            return {};
+        }
+
+        auto& objectData = sceneData.objects.emplace_back();
+        objectData.name.assign(reinterpret_cast<const char*>(&bytes[offset]), nameLength);
+        offset += nameLength;
+
+        uint8_t isActive = 0;
+        uint32_t componentCount = 0;
+        if (ReadValue(bytes, offset, objectData.parentIndex) == false || objectData.parentIndex >= static_cast<int32_t>(i) ||
+            ReadValue(bytes, offset, isActive) == false ||
+            ReadValue(bytes, offset, componentCount) == false)
+        {
+            return {};
+        }
+        objectData.isActive = isActive != 0;
+        objectData.componentBegin = static_cast<uint32_t>(sceneData.components.size());
+
+        for (uint32_t j = 0; j < componentCount; ++j)
+        {
+            uint32_t nameHash = 0, payloadSize = 0;
+            if (ReadValue(bytes, offset, nameHash) == false || ReadValue(bytes, offset, payloadSize) == false || bytes.size() - offset < payloadSize)
+            {
+                return {};
+            }
+
+            if (auto* componentType = FindComponentType(nameHash); componentType != nullptr)
+            {
+                sceneData.components.push_back({componentType, bytes.subspan(offset, payloadSize)});
+            }
+            offset += payloadSize;
+        }
+
+        objectData.componentEnd = static_cast<uint32_t>(sceneData.components.size());
+    }
+
+    return sceneData;
+}
+
+bool SceneSerializer::Instantiate(const SceneData& sceneData, size_t objectIndex, Scene& scene, std::vector<GameObjectHandle>& handles)
+{
+    if (handles.size() < sceneData.objects.size())
+    {
+        handles.resize(sceneData.objects.size());
+    }
+
+    const auto& objectData = sceneData.objects[objectIndex];
+    const auto handle = scene.Instantiate(StringHash(objectData.name));
+    auto* gameObject = scene.FindGameObject(handle);
+
+    // Activate the object after adding the components, so they are registered to the tick scheduler only once.
+    gameObject->SetActive(false);
+    bool isSucceeded = true;
+    for (auto i = objectData.componentBegin; i < objectData.componentEnd; ++i)
+    {
+        const auto& componentData = sceneData.components[i];
+        isSucceeded = componentData.type->read(*gameObject, componentData.payload) && isSucceeded;
+    }
+    gameObject->SetActive(objectData.isActive);
+
+    if (objectData.parentIndex >= 0)
+    {
+        gameObject->SetParent(scene.FindGameObject(handles[objectData.parentIndex]));
+    }
+
+    handles[objectIndex] = handle;
+
+    return isSucceeded;
+}
+
+void SceneSerializer::RegisterComponent(const SceneComponentType& componentType)
+{
+    std::lock_guard lockGuard(g_componentTypeMutex);
+    if (auto* registeredType = const_cast<SceneComponentType*>(FindComponentType(componentType.nameHash)); registeredType != nullptr)
+    {
+        *registeredType = componentType;
+        return;
+    }
+
+    g_componentTypes.push_back(componentType);
+}
+
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Game/GameObject.h"
+#include "Serialization/BinaryReader.h"
+#include "Serialization/BinaryWriter.h"
+#include "Text/Hash.h"
+
+namespace tg
+{
+
+class Scene;
+
+struct SceneComponentType
+{
+    uint32_t nameHash;
+    bool(*read)(GameObject& gameObject, std::span<const std::byte> payload);
+    void(*write)(GameObject& gameObject, std::vector<std::byte>& payload);
+    bool(*has)(const GameObject& gameObject);
+};
+
+struct SceneComponentData
+{
+    const SceneComponentType* type;
+    std::span<const std::byte> payload;
+};
+
+struct SceneObjectData
+{
+    std::string name;
+    int32_t parentIndex;
+    bool isActive;
+    uint32_t componentBegin;
+    uint32_t componentEnd;
+};
+
+/**
+ * @brief   The parsed content of a scene file.
+ * @remark  It holds the file data, so the component payloads can refer to it without copying.
+ */
+struct SceneData
+{
+    std::vector<std::byte> fileData;
+    std::vector<SceneObjectData> objects;
+    std::vector<SceneComponentData> components;
+};
+
+/**
+ * @brief   Reads and writes the binary scene format.
+ * @remark  The file starts with the magic "TGSC", the version, and the object count. Every object record holds the name,
+ *          the index of the parent which always precedes the object, the active state, and the component records.
+ *          Every component record holds the hash of the registered type name and the size of the payload followed by
+ *          the payload. The components which aren't registered are skipped on reading.
+ */
+class SceneSerializer final
+{
+/**@section Constructor */
+public:
+    SceneSerializer() = delete;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Registers the component type to the scene format.
+     * @param name  The unique name of the component type which is stored in the file.
+     * @remark  The component must have bool Deserialize(std::span<const std::byte>), which returns false if the payload is
+     *          malformed, and void Serialize(std::vector<std::byte>&) const, or be reflected by TGON_REFLECT, in which case the
+     *          fields are read and written by BinaryReader and BinaryWriter.
+     *          The types must be registered before loading any scene.
+     */
+    template <typename _Component>
+    static void RegisterComponent(const char* name);
+
+    /**
+     * @brief   Writes every object of the scene and its registered components.
+     * @param scene     The scene to write.
+     * @return  The scene file data.
+     */
+    [[nodiscard]] static std::vector<std::byte> Serialize(Scene& scene);
+
+    /**
+     * @brief   Parses the scene file data.
+     * @param fileData  The scene file data.
+     * @return  The parsed scene or std::nullopt if the data is malformed.
+     * @remark  It doesn't touch any scene, so it can be called from worker threads.
+     */
+    [[nodiscard]] static std::optional<SceneData> Deserialize(std::vector<std::byte> fileData);
+
+    /**
+     * @brief   Instantiates an object of the parsed scene.
+     * @param sceneData     The parsed scene.
+     * @param objectIndex   The index of the object to instantiate. The parent must have been instantiated before.
+     * @param scene         The scene to instantiate the object.
+     * @param handles       The handles of the instantiated objects, which are indexed by object index.
+     * @return  False if a component payload of the object is malformed. The object is instantiated anyway.
+     */
+    [[nodiscard]] static bool Instantiate(const SceneData& sceneData, size_t objectIndex, Scene& scene, std::vector<GameObjectHandle>& handles);
+
+private:
+    static void RegisterComponent(const SceneComponentType& componentType);
+};
+
+template <typename _Component>
+void SceneSerializer::RegisterComponent(const char* name)
+{
+    RegisterComponent(SceneComponentType{
+        static_cast<uint32_t>(X65599Hash(name)),
+        [](GameObject& gameObject, std::span<const std::byte> payload)
+        {
+            // An object holds only one component per type, so the repeated record is malformed.
+            if (gameObject.FindComponent<_Component>() != nullptr)
+            {
+                return false;
+            }
+
+            auto* component = gameObject.AddComponent<_Component>();
+            if constexpr (requires { component->Deserialize(payload); })
+            {
+                return component->Deserialize(payload);
+            }
+            else
+            {
+                return BinaryReader(payload).Read(*component);
+            }
+        },
+        [](GameObject& gameObject, std::vector<std::byte>& payload)
+        {
+            const auto* component = gameObject.FindComponent<_Component>();
+            if constexpr (requires { component->Serialize(payload); })
+            {
+                component->Serialize(payload);
+            }
+            else
+            {
+                BinaryWriter(payload).Write(*component);
+            }
+        },
+        [](const GameObject& gameObject)
+        {
+            return gameObject.GetComponentMask().Test(GetComponentTypeIndex<_Component>());
+        }
+    });
+}
+
+}
@@ -6,7 +6,8 @@ namespace tg
 {
 
 TaskModule::TaskModule(int32_t threadPoolCount) :
-    m_globalDispatchQueue(threadPoolCount)
+    m_globalDispatchQueue(threadPoolCount),
+    m_asyncFileIO(&m_mainDispatchQueue)
 {
 }
 
@@ -30,6 +31,16 @@ const ConcurrentDispatchQueue& TaskModule::GetGlobalDispatchQueue() const
     return const_cast<TaskModule*>(this)->GetGlobalDispatchQueue();
 }
 
+AsyncFileIO& TaskModule::GetAsyncFileIO() noexcept
+{
+    return m_asyncFileIO;
+}
+
+const AsyncFileIO& TaskModule::GetAsyncFileIO() const noexcept
+{
+    return m_asyncFileIO;
+}
+
 void TaskModule::Update()
 {
     m_mainDispatchQueue.Dispatch();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "IO/AsyncFileIO.h"
 #include "Threading/DispatchQueue.h"
 
 #include "Module.h"
@@ -23,6 +24,12 @@ public:
     const SerialDispatchQueue& GetMainDispatchQueue() const noexcept;
     ConcurrentDispatchQueue& GetGlobalDispatchQueue();
     const ConcurrentDispatchQueue& GetGlobalDispatchQueue() const;
+
+    /**
+     * @brief   Gets the file reader whose completion handlers are called on the main dispatch queue.
+     */
+    AsyncFileIO& GetAsyncFileIO() noexcept;
+    const AsyncFileIO& GetAsyncFileIO() const noexcept;
     void Update() override;
     
 /**@section Variable */
@@ -32,6 +39,7 @@ public:
 private:
     SerialDispatchQueue m_mainDispatchQueue;
     ConcurrentDispatchQueue m_globalDispatchQueue;
+    AsyncFileIO m_asyncFileIO;
 };
 
 }
@@ -12,7 +12,7 @@ TimerModule::TimerModule() noexcept :
 {
 }
 
-TimerHandle TimerModule::SetTimer(Delegate<void()> callback, float interval, bool isLoop)
+TimerHandle TimerModule::SetTimer(TimerCallback callback, float interval, bool isLoop)
 {
     const auto timerHandle = CreateTimerHandle();
 
@@ -2,7 +2,7 @@
 
 #include <vector>
 
-#include "Core/Delegate.h"
+#include "Core/InplaceDelegate.h"
 
 #include "Module.h"
 
@@ -10,6 +10,7 @@ namespace tg
 {
 
 using TimerHandle = int64_t;
+using TimerCallback = InplaceDelegate<void()>;
 
 class TimerModule :
 	public Module
@@ -22,7 +23,7 @@ private:
     struct TimerInfo
     {
         TimerHandle timerHandle;
-        Delegate<void()> callback;
+        TimerCallback callback;
         float elapsedTime = 0.0f;
         float interval = 0.0f;
         bool isLoop = false;
@@ -36,7 +37,7 @@ public:
 /**@section Method */
 public:
     void Update() override;
-    TimerHandle SetTimer(Delegate<void()> callback, float interval, bool isLoop);
+    TimerHandle SetTimer(TimerCallback callback, float interval, bool isLoop);
     bool ClearTimer(TimerHandle timerHandle);
     [[nodiscard]] float GetTimerElapsed(TimerHandle timerHandle) const noexcept;
 
@@ -39,19 +39,13 @@ LRESULT CALLBACK OnHandleMessage(HWND wndHandle, UINT msg, WPARAM wParam, LPARAM
             {
             case SC_MINIMIZE:
                 {
-                    if (window->OnMinimize != nullptr)
-                    {
-                        window->OnMinimize();
-                    }
+                    window->OnMinimize.Publish({});
                 }
                 break;
 
             case SC_MAXIMIZE:
                 {
-                    if (window->OnMaximize != nullptr)
-                    {
-                        window->OnMaximize();
-                    }
+                    window->OnMaximize.Publish({});
                 }
                 break;
 
@@ -63,55 +57,37 @@ LRESULT CALLBACK OnHandleMessage(HWND wndHandle, UINT msg, WPARAM wParam, LPARAM
 
     case WM_SETFOCUS:
         {
-            if (window->OnGetFocus != nullptr)
-            {
-                window->OnGetFocus();
-            }
+            window->OnGetFocus.Publish({});
         }
         break;
 
     case WM_KILLFOCUS:
         {
-            if (window->OnLoseFocus != nullptr)
-            {
-                window->OnLoseFocus();
-            }
+            window->OnLoseFocus.Publish({});
         }
         break;
 
     case WM_MOVE:
         {
-            if (window->OnMove != nullptr)
-            {
-                window->OnMove(static_cast<int32_t>(LOWORD(lParam)), static_cast<int32_t>(HIWORD(lParam)));
-            }
+            window->OnMove.Publish({static_cast<int32_t>(LOWORD(lParam)), static_cast<int32_t>(HIWORD(lParam))});
         }
         break;
 
     case WM_SIZE:
         {
-            if (window->OnResize != nullptr)
-            {
-                window->OnResize(static_cast<int32_t>(LOWORD(lParam)), static_cast<int32_t>(HIWORD(lParam)));
-            }
+            window->OnResize.Publish({static_cast<int32_t>(LOWORD(lParam)), static_cast<int32_t>(HIWORD(lParam))});
         }
         break;
 
     case WM_CLOSE:
         {
-            if (window->OnWillClose != nullptr)
-            {
-                window->OnWillClose();
-            }
+            window->OnWillClose.Publish({});
         }
         break;
 
     case WM_DESTROY:
         {
-            if (window->OnDidClose != nullptr)
-            {
-                window->OnDidClose();
-            }
+            window->OnDidClose.Publish({});
 
             PostQuitMessage(0);
         }
@@ -84,6 +84,11 @@ const Matrix4x4& CameraComponent::GetViewProjectionMatrix() const noexcept
     return m_matViewProj;
 }
 
+Matrix4x4 CameraComponent::GetWorldViewProjectionMatrix(const Matrix3x4& matWorld) const noexcept
+{
+    return matWorld * m_matViewProj;
+}
+
 void CameraComponent::SetEyePt(const Vector3& eyePt) noexcept
 {
     m_eyePt = eyePt;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Graphics/RenderTarget.h"
+#include "Math/Matrix3x4.h"
 #include "Math/Matrix4x4.h"
 #include "Math/Rect.h"
 
@@ -46,6 +47,12 @@ public:
     [[nodiscard]] const Matrix4x4& GetProjectionMatrix() const noexcept;
     [[nodiscard]] const Matrix4x4& GetViewProjectionMatrix() const noexcept;
 
+    /**
+     * @brief   Concatenates the affine world matrix with the view projection matrix.
+     * @remark  It takes 12 vector multiply-adds instead of the 16 of the 4x4 product.
+     */
+    [[nodiscard]] Matrix4x4 GetWorldViewProjectionMatrix(const Matrix3x4& matWorld) const noexcept;
+
 /**@section Variable */
 protected:
     ProjectionMode m_projectionMode;
@@ -1,13 +1,25 @@
 #include "PrecompiledHeader.h"
 
+#include <algorithm>
+
 #include "Component.h"
+#include "GameObject.h"
 
 namespace tg
 {
 
-void Component::SetGameObject(GameObject* gameObject) noexcept
+Component::~Component()
+{
+    if (m_tickScheduler != nullptr)
+    {
+        m_tickScheduler->Remove(this);
+    }
+}
+
+void Component::SetGameObject(GameObject* gameObject)
 {
     m_gameObject = gameObject;
+    this->RefreshTickRegistration();
 }
 
 GameObject* Component::GetGameObject() noexcept
@@ -20,9 +32,12 @@ const GameObject* Component::GetGameObject() const noexcept
     return m_gameObject;
 }
 
-void Component::SetActive(bool isActive) noexcept
+void Component::SetActive(bool isActive)
 {
+    assert(GameObject::IsStructureLocked() == false && "Change the tick state of the components outside of the parallel update.");
+
     m_isActive = isActive;
+    this->RefreshTickRegistration();
 }
 
 bool Component::IsActive() const noexcept
@@ -30,4 +45,95 @@ bool Component::IsActive() const noexcept
     return m_isActive;
 }
 
+void Component::SetTickGroup(TickGroup tickGroup)
+{
+    assert(GameObject::IsStructureLocked() == false && "Change the tick state of the components outside of the parallel update.");
+
+    if (m_tickGroup == tickGroup)
+    {
+        return;
+    }
+
+    if (m_tickScheduler != nullptr)
+    {
+        m_tickScheduler->Remove(this);
+        m_tickScheduler = nullptr;
+    }
+
+    m_tickGroup = tickGroup;
+    this->RefreshTickRegistration();
+}
+
+TickGroup Component::GetTickGroup() const noexcept
+{
+    return m_tickGroup;
+}
+
+void Component::SetTickInterval(uint32_t frameInterval)
+{
+    assert(GameObject::IsStructureLocked() == false && "Change the tick state of the components outside of the parallel update.");
+
+    frameInterval = std::max(frameInterval, uint32_t(1));
+    if (m_tickInterval == frameInterval)
+    {
+        return;
+    }
+
+    if (m_tickScheduler != nullptr)
+    {
+        m_tickScheduler->Remove(this);
+        m_tickScheduler = nullptr;
+    }
+
+    m_tickInterval = frameInterval;
+    this->RefreshTickRegistration();
+}
+
+uint32_t Component::GetTickInterval() const noexcept
+{
+    return m_tickInterval;
+}
+
+void Component::Sleep()
+{
+    assert(GameObject::IsStructureLocked() == false && "Change the tick state of the components outside of the parallel update.");
+
+    m_isSleeping = true;
+    this->RefreshTickRegistration();
+}
+
+void Component::WakeUp()
+{
+    assert(GameObject::IsStructureLocked() == false && "Change the tick state of the components outside of the parallel update.");
+
+    m_isSleeping = false;
+    this->RefreshTickRegistration();
+}
+
+bool Component::IsSleeping() const noexcept
+{
+    return m_isSleeping;
+}
+
+void Component::RefreshTickRegistration()
+{
+    auto* tickScheduler = m_gameObject != nullptr ? m_gameObject->GetTickScheduler() : nullptr;
+    const auto shouldTick = tickScheduler != nullptr && m_isActive && m_isSleeping == false && m_gameObject->IsActive();
+    if (shouldTick == (m_tickScheduler != nullptr))
+    {
+        return;
+    }
+
+    if (shouldTick)
+    {
+        m_tickScheduler = tickScheduler;
+        m_tickScheduler->Add(this);
+    }
+    else
+    {
+        m_tickScheduler->Remove(this);
+        m_tickScheduler = nullptr;
+    }
+}
+
 }
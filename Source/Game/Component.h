@@ -1,7 +1,10 @@
 #pragma once
 
+#include "Core/ObjectPool.h"
 #include "Core/RuntimeObject.h"
 
+#include "TickScheduler.h"
+
 namespace tg
 {
 
@@ -13,20 +16,99 @@ class Component :
 public:
     TGON_RTTI(Component)
 
+/**@section Destructor */
+public:
+    ~Component() override;
+
 /**@section Method */
 public:
     virtual void Initialize() {}
     virtual void Update() {}
-    void SetGameObject(GameObject* gameObject) noexcept;
-    void SetActive(bool isActive) noexcept;
+    void SetGameObject(GameObject* gameObject);
+
+    /**
+     * @brief   Activates or deactivates the component.
+     * @remark  The setters of the tick state unregister the component from the buckets which the parallel update reads
+     *          from the other threads, so they must not be called while GameObject::IsStructureLocked is true.
+     */
+    void SetActive(bool isActive);
+
+    /**
+     * @brief   Sets the group which decides when the component is updated in a frame.
+     * @param tickGroup     The tick group.
+     */
+    void SetTickGroup(TickGroup tickGroup);
+
+    /**
+     * @brief   Sets how often the component is updated.
+     * @param frameInterval     The number of frames between the updates. 1 updates the component every frame.
+     */
+    void SetTickInterval(uint32_t frameInterval);
+
+    /**
+     * @brief   Stops updating the component until WakeUp is called.
+     */
+    void Sleep();
+
+    /**
+     * @brief   Resumes updating the component.
+     */
+    void WakeUp();
+
+    /**
+     * @brief   Registers or unregisters the component to the tick scheduler by its current state.
+     * @remark  It must be called when the active state of the owner object changes.
+     */
+    void RefreshTickRegistration();
+
     [[nodiscard]] GameObject* GetGameObject() noexcept;
     [[nodiscard]] const GameObject* GetGameObject() const noexcept;
     [[nodiscard]] bool IsActive() const noexcept;
+    [[nodiscard]] bool IsSleeping() const noexcept;
+    [[nodiscard]] TickGroup GetTickGroup() const noexcept;
+    [[nodiscard]] uint32_t GetTickInterval() const noexcept;
 
 /**@section Variable */
 protected:
     GameObject* m_gameObject{};
     bool m_isActive = true;
+    bool m_isSleeping = false;
+    TickGroup m_tickGroup = TickGroup::Update;
+    uint32_t m_tickInterval = 1;
+
+private:
+    friend class TickScheduler;
+
+    TickScheduler* m_tickScheduler = nullptr;
+    TickSlot m_tickSlot;
 };
 
+struct ComponentDeleter
+{
+/**@section Operator */
+public:
+    void operator()(Component* component) const;
+
+/**@section Variable */
+public:
+    void(*release)(Component*) = nullptr;
+};
+
+/**
+ * @brief   Gets the pool which stores all of the components of the specified type.
+ * @return  The component pool.
+ */
+template <typename _Component>
+ObjectPool<_Component>& GetComponentPool()
+{
+    // The pool is intentionally leaked because components can be released by static objects after the pool would have been destroyed.
+    static auto* componentPool = new ObjectPool<_Component>();
+    return *componentPool;
+}
+
+inline void ComponentDeleter::operator()(Component* component) const
+{
+    release(component);
+}
+
 }
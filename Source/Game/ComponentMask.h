@@ -0,0 +1,182 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "Core/TypeId.h"
+
+namespace tg
+{
+
+class Component;
+
+/**
+ * @brief   Gets the dense index of the specified component type.
+ * @return  The component type index which can be used as a bit of ComponentMask.
+ * @remark  The process is aborted when more types than ComponentMask::MaxComponentTypeCount are registered, since the
+ *          index couldn't be stored in the mask.
+ */
+template <typename _Component>
+[[nodiscard]] uint32_t GetComponentTypeIndex() noexcept;
+
+class ComponentMask final
+{
+/**@section Operator */
+public:
+    constexpr bool operator==(const ComponentMask& rhs) const noexcept;
+    constexpr bool operator!=(const ComponentMask& rhs) const noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Creates a mask which contains all of the specified component types.
+     * @return  The created mask.
+     */
+    template <typename... _Components>
+    [[nodiscard]] static ComponentMask Create() noexcept;
+    constexpr void Set(uint32_t typeIndex) noexcept;
+    constexpr void Reset(uint32_t typeIndex) noexcept;
+    constexpr void Clear() noexcept;
+    [[nodiscard]] constexpr bool Test(uint32_t typeIndex) const noexcept;
+
+    /**
+     * @brief   Checks whether the mask contains all of the bits of the specified mask.
+     * @param rhs   The mask to check.
+     * @return  True if every bit of rhs is also set in this mask, false otherwise.
+     */
+    [[nodiscard]] constexpr bool Contains(const ComponentMask& rhs) const noexcept;
+
+    /**
+     * @brief   Counts the set bits below the specified bit.
+     * @param typeIndex     The bit index.
+     * @return  The number of the set bits below typeIndex.
+     * @remark  If the components are stored in ascending order of the type index, this is the position of the component.
+     */
+    [[nodiscard]] constexpr uint32_t Rank(uint32_t typeIndex) const noexcept;
+    [[nodiscard]] constexpr uint32_t Count() const noexcept;
+
+/**@section Variable */
+public:
+    static constexpr uint32_t MaxComponentTypeCount = 128;
+
+private:
+    static constexpr uint32_t BitsPerWord = 64;
+
+    std::array<uint64_t, MaxComponentTypeCount / BitsPerWord> m_words{};
+};
+
+namespace detail
+{
+
+[[nodiscard]] inline uint32_t RegisterComponentTypeIndex(uint32_t typeIndex) noexcept
+{
+    if (typeIndex >= ComponentMask::MaxComponentTypeCount)
+    {
+        std::fprintf(stderr, "Too many component types. (Max: %u)\n", ComponentMask::MaxComponentTypeCount);
+        std::abort();
+    }
+
+    return typeIndex;
+}
+
+}
+
+template <typename _Component>
+uint32_t GetComponentTypeIndex() noexcept
+{
+    // The index is checked once per type, so the mask operations only have to assert it.
+    static const uint32_t typeIndex = detail::RegisterComponentTypeIndex(TypeId<Component>::Get<_Component>());
+    return typeIndex;
+}
+
+constexpr bool ComponentMask::operator==(const ComponentMask& rhs) const noexcept
+{
+    return m_words == rhs.m_words;
+}
+
+constexpr bool ComponentMask::operator!=(const ComponentMask& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+template <typename... _Components>
+ComponentMask ComponentMask::Create() noexcept
+{
+    ComponentMask mask;
+    (mask.Set(GetComponentTypeIndex<_Components>()), ...);
+
+    return mask;
+}
+
+constexpr void ComponentMask::Set(uint32_t typeIndex) noexcept
+{
+    assert(typeIndex < MaxComponentTypeCount && "Too many component types.");
+    m_words[typeIndex / BitsPerWord] |= uint64_t(1) << (typeIndex % BitsPerWord);
+}
+
+constexpr void ComponentMask::Reset(uint32_t typeIndex) noexcept
+{
+    assert(typeIndex < MaxComponentTypeCount && "Too many component types.");
+    m_words[typeIndex / BitsPerWord] &= ~(uint64_t(1) << (typeIndex % BitsPerWord));
+}
+
+constexpr void ComponentMask::Clear() noexcept
+{
+    m_words = {};
+}
+
+constexpr bool ComponentMask::Test(uint32_t typeIndex) const noexcept
+{
+    if (typeIndex >= MaxComponentTypeCount)
+    {
+        return false;
+    }
+
+    return (m_words[typeIndex / BitsPerWord] & (uint64_t(1) << (typeIndex % BitsPerWord))) != 0;
+}
+
+constexpr bool ComponentMask::Contains(const ComponentMask& rhs) const noexcept
+{
+    for (size_t i = 0; i < m_words.size(); ++i)
+    {
+        if ((m_words[i] & rhs.m_words[i]) != rhs.m_words[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+constexpr uint32_t ComponentMask::Rank(uint32_t typeIndex) const noexcept
+{
+    assert(typeIndex < MaxComponentTypeCount && "Too many component types.");
+
+    const auto wordIndex = typeIndex / BitsPerWord;
+
+    uint32_t rank = 0;
+    for (uint32_t i = 0; i < wordIndex; ++i)
+    {
+        rank += static_cast<uint32_t>(std::popcount(m_words[i]));
+    }
+
+    const auto lowerBits = (uint64_t(1) << (typeIndex % BitsPerWord)) - 1;
+    return rank + static_cast<uint32_t>(std::popcount(m_words[wordIndex] & lowerBits));
+}
+
+constexpr uint32_t ComponentMask::Count() const noexcept
+{
+    uint32_t count = 0;
+    for (auto word : m_words)
+    {
+        count += static_cast<uint32_t>(std::popcount(word));
+    }
+
+    return count;
+}
+
+}
@@ -0,0 +1,159 @@
+#include "PrecompiledHeader.h"
+
+#include "Core/Algorithm.h"
+#include "Engine/SceneModule.h"
+
+#include "EntityCommandBuffer.h"
+
+namespace tg
+{
+namespace
+{
+
+thread_local EntityCommandBuffer* g_currentCommandBuffer;
+
+}
+
+EntityCommandBuffer::EntityCommandBuffer(FrameAllocator& frameAllocator) noexcept :
+    m_frameAllocator(&frameAllocator)
+{
+}
+
+EntityCommandBuffer::~EntityCommandBuffer()
+{
+    this->Clear();
+}
+
+GameObjectHandle EntityCommandBuffer::Instantiate(StringHash name)
+{
+    const auto pendingIndex = m_pendingCount++;
+    this->Record([pendingIndex, name = std::move(name)](EntityCommandBuffer& commandBuffer, Scene& scene)
+    {
+        // The command can be recorded during playback, after the pending handles were sized.
+        if (pendingIndex >= commandBuffer.m_pendingHandles.size())
+        {
+            commandBuffer.m_pendingHandles.resize(pendingIndex + 1);
+        }
+
+        commandBuffer.m_pendingHandles[pendingIndex] = scene.Instantiate(name);
+    });
+
+    return GameObjectHandle{PendingIndexBit | pendingIndex, 0};
+}
+
+void EntityCommandBuffer::Destroy(const GameObjectHandle& target)
+{
+    this->Record([target](EntityCommandBuffer& commandBuffer, Scene& scene)
+    {
+        scene.Destroy(commandBuffer.Resolve(target));
+    });
+}
+
+void EntityCommandBuffer::SetActive(const GameObjectHandle& target, bool isActive)
+{
+    this->Record([target, isActive](EntityCommandBuffer& commandBuffer, Scene& scene)
+    {
+        if (auto* gameObject = commandBuffer.FindTarget(scene, target); gameObject != nullptr)
+        {
+            gameObject->SetActive(isActive);
+        }
+    });
+}
+
+void EntityCommandBuffer::SetParent(const GameObjectHandle& target, const GameObjectHandle& parent)
+{
+    this->Record([target, parent](EntityCommandBuffer& commandBuffer, Scene& scene)
+    {
+        if (auto* gameObject = commandBuffer.FindTarget(scene, target); gameObject != nullptr)
+        {
+            gameObject->SetParent(parent.IsNull() ? nullptr : commandBuffer.FindTarget(scene, parent));
+        }
+    });
+}
+
+void EntityCommandBuffer::Playback(Scene& scene)
+{
+    m_pendingHandles.assign(m_pendingCount, GameObjectHandle{});
+
+    // The commands which are recorded during playback are appended to the list, so they are executed in this loop too.
+    for (auto* command = m_head; command != nullptr; command = command->next)
+    {
+        command->execute(command, *this, scene);
+    }
+
+    this->Clear();
+}
+
+void EntityCommandBuffer::Clear()
+{
+    for (auto* command = m_head; command != nullptr;)
+    {
+        auto* next = command->next;
+        command->destroy(command);
+        command = next;
+    }
+
+    // The page is reclaimed by the frame allocator, so it must not be kept into the later frames.
+    m_head = nullptr;
+    m_tail = nullptr;
+    m_page = nullptr;
+    m_pageOffset = 0;
+    m_pendingCount = 0;
+    m_pendingHandles.clear();
+}
+
+bool EntityCommandBuffer::IsEmpty() const noexcept
+{
+    return m_head == nullptr;
+}
+
+EntityCommandBuffer* EntityCommandBuffer::SetCurrent(EntityCommandBuffer* commandBuffer) noexcept
+{
+    auto* prevCommandBuffer = g_currentCommandBuffer;
+    g_currentCommandBuffer = commandBuffer;
+
+    return prevCommandBuffer;
+}
+
+EntityCommandBuffer* EntityCommandBuffer::GetCurrent() noexcept
+{
+    return g_currentCommandBuffer;
+}
+
+void* EntityCommandBuffer::Allocate(size_t size, size_t alignment)
+{
+    if (size + alignment > PageSize)
+    {
+        return m_frameAllocator->AllocateShared(size, alignment);
+    }
+
+    const auto pageAddress = reinterpret_cast<uintptr_t>(m_page);
+    auto alignedOffset = AlignOf(pageAddress + m_pageOffset, alignment) - pageAddress;
+    if (m_page == nullptr || alignedOffset + size > PageSize)
+    {
+        // The rest of the full page is left behind, since the frame allocator reclaims it with the page.
+        m_page = static_cast<std::byte*>(m_frameAllocator->AllocateShared(PageSize));
+        alignedOffset = AlignOf(reinterpret_cast<uintptr_t>(m_page), alignment) - reinterpret_cast<uintptr_t>(m_page);
+    }
+
+    m_pageOffset = alignedOffset + size;
+    return m_page + alignedOffset;
+}
+
+GameObjectHandle EntityCommandBuffer::Resolve(const GameObjectHandle& target) const noexcept
+{
+    if (target.IsNull() || (target.index & PendingIndexBit) == 0)
+    {
+        return target;
+    }
+
+    const auto pendingIndex = target.index & ~PendingIndexBit;
+    return pendingIndex < m_pendingHandles.size() ? m_pendingHandles[pendingIndex] : GameObjectHandle{};
+}
+
+GameObject* EntityCommandBuffer::FindTarget(Scene& scene, const GameObjectHandle& target) const
+{
+    return scene.FindGameObject(this->Resolve(target));
+}
+
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "Core/FrameAllocator.h"
+#include "Core/NonCopyable.h"
+#include "Text/StringHash.h"
+
+#include "GameObject.h"
+
+namespace tg
+{
+
+class Scene;
+
+/**
+ * @brief   Records the structural changes of a scene and applies them later at a sync point.
+ * @remark  The commands are played back in the order they were recorded. The memory of the commands comes from the
+ *          shared buffer of the frame allocator in pages, so recording doesn't touch the global heap and the buffers of
+ *          the threads can record at the same time. The commands must be played back or cleared before the end of the
+ *          next frame, when the frame allocator reclaims their memory.
+ */
+class EntityCommandBuffer final :
+    private NonCopyable
+{
+/**@section Struct */
+private:
+    struct Command
+    {
+        void(*execute)(Command* command, EntityCommandBuffer& commandBuffer, Scene& scene);
+        void(*destroy)(Command* command);
+        Command* next;
+    };
+
+    template <typename _Function>
+    struct CommandImpl :
+        Command
+    {
+        _Function function;
+    };
+
+/**@section Constructor */
+public:
+    /**
+     * @brief   Initializes the buffer.
+     * @param frameAllocator    The allocator which the memory of the commands is taken from. It must outlive the buffer.
+     */
+    explicit EntityCommandBuffer(FrameAllocator& frameAllocator) noexcept;
+
+/**@section Destructor */
+public:
+    ~EntityCommandBuffer();
+
+/**@section Method */
+public:
+    /**
+     * @brief   Records the instantiation of a new GameObject.
+     * @param name  The name of the object.
+     * @return  The pending handle of the object. It can only be passed to the other commands of this buffer until playback.
+     */
+    GameObjectHandle Instantiate(StringHash name = {});
+
+    /**
+     * @brief   Records the destruction of the object.
+     * @param target    The handle of the object.
+     */
+    void Destroy(const GameObjectHandle& target);
+
+    /**
+     * @brief   Records the addition of a component.
+     * @param target    The handle of the object.
+     * @param args      Arguments for construct the specified type of component.
+     */
+    template <typename _Component, typename... _Types>
+    void AddComponent(const GameObjectHandle& target, _Types&&... args);
+
+    /**
+     * @brief   Records the removal of a component.
+     * @param target    The handle of the object.
+     */
+    template <typename _Component>
+    void RemoveComponent(const GameObjectHandle& target);
+
+    /**
+     * @brief   Records the activation or deactivation of the object.
+     * @param target    The handle of the object.
+     * @param isActive  True activates the object and false deactivates the object.
+     */
+    void SetActive(const GameObjectHandle& target, bool isActive);
+
+    /**
+     * @brief   Records the change of the parent.
+     * @param target    The handle of the object.
+     * @param parent    The handle of the new parent or a null handle.
+     */
+    void SetParent(const GameObjectHandle& target, const GameObjectHandle& parent);
+
+    /**
+     * @brief   Applies all of the recorded commands to the scene and clears the buffer.
+     * @param scene     The scene to apply the commands.
+     */
+    void Playback(Scene& scene);
+
+    /**
+     * @brief   Discards all of the recorded commands.
+     */
+    void Clear();
+
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+    /**
+     * @brief   Sets the buffer which is used by the current thread.
+     * @param commandBuffer     The command buffer or nullptr.
+     * @return  The buffer which was used by the current thread.
+     */
+    static EntityCommandBuffer* SetCurrent(EntityCommandBuffer* commandBuffer) noexcept;
+
+    /**
+     * @brief   Gets the buffer which is used by the current thread.
+     * @return  The command buffer or nullptr if the thread isn't updating a scene.
+     */
+    [[nodiscard]] static EntityCommandBuffer* GetCurrent() noexcept;
+
+private:
+    template <typename _Function>
+    void Record(_Function function);
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment);
+    [[nodiscard]] GameObjectHandle Resolve(const GameObjectHandle& target) const noexcept;
+    [[nodiscard]] GameObject* FindTarget(Scene& scene, const GameObjectHandle& target) const;
+
+/**@section Variable */
+private:
+    static constexpr size_t PageSize = 16 * 1024;
+    static constexpr uint32_t PendingIndexBit = 0x80000000;
+
+    FrameAllocator* m_frameAllocator;
+    std::byte* m_page = nullptr;
+    size_t m_pageOffset = 0;
+    Command* m_head = nullptr;
+    Command* m_tail = nullptr;
+    uint32_t m_pendingCount = 0;
+    std::vector<GameObjectHandle> m_pendingHandles;
+};
+
+template <typename _Component, typename... _Types>
+void EntityCommandBuffer::AddComponent(const GameObjectHandle& target, _Types&&... args)
+{
+    this->Record([target, args = std::make_tuple(std::forward<_Types>(args)...)](EntityCommandBuffer& commandBuffer, Scene& scene) mutable
+    {
+        if (auto* gameObject = commandBuffer.FindTarget(scene, target); gameObject != nullptr)
+        {
+            std::apply([&](auto&&... args)
+            {
+                gameObject->template AddComponent<_Component>(std::move(args)...);
+            }, std::move(args));
+        }
+    });
+}
+
+template <typename _Component>
+void EntityCommandBuffer::RemoveComponent(const GameObjectHandle& target)
+{
+    this->Record([target](EntityCommandBuffer& commandBuffer, Scene& scene)
+    {
+        if (auto* gameObject = commandBuffer.FindTarget(scene, target); gameObject != nullptr)
+        {
+            gameObject->template RemoveComponent<_Component>();
+        }
+    });
+}
+
+template <typename _Function>
+void EntityCommandBuffer::Record(_Function function)
+{
+    using CommandType = CommandImpl<_Function>;
+
+    auto* command = new (this->Allocate(sizeof(CommandType), alignof(CommandType))) CommandType{{
+        [](Command* command, EntityCommandBuffer& commandBuffer, Scene& scene)
+        {
+            static_cast<CommandType*>(command)->function(commandBuffer, scene);
+        },
+        [](Command* command)
+        {
+            static_cast<CommandType*>(command)->~CommandType();
+        },
+        nullptr
+    }, std::move(function)};
+
+    if (m_tail == nullptr)
+    {
+        m_head = command;
+    }
+    else
+    {
+        m_tail->next = command;
+    }
+    m_tail = command;
+}
+
+}
@@ -5,19 +5,30 @@
 
 namespace tg
 {
+namespace
+{
+
+thread_local bool g_isStructureLocked;
+
+}
 
-GameObject::GameObject(StringHash name) :
-    m_name(std::move(name))
+GameObject::GameObject(StringHash name, TickScheduler* tickScheduler, std::pmr::memory_resource* memoryResource) :
+    m_name(std::move(name)),
+    m_tickScheduler(tickScheduler),
+    m_components(memoryResource)
 {
 }
 
 void GameObject::Update()
 {
-    for (auto& component : m_components)
+    for (size_t i = 0; i < TickScheduler::TickGroupCount; ++i)
     {
-        if (component->IsActive())
+        for (auto& component : m_components)
         {
-            component->Update();
+            if (component->IsActive() && component->IsSleeping() == false && component->GetTickGroup() == static_cast<TickGroup>(i))
+            {
+                component->Update();
+            }
         }
     }
 }
@@ -27,9 +38,20 @@ void GameObject::SetName(StringHash name)
     m_name = std::move(name);
 }
 
-void GameObject::SetActive(bool isActive) noexcept
+void GameObject::SetActive(bool isActive)
 {
+    assert(IsStructureLocked() == false && "Record the structural changes into EntityCommandBuffer::GetCurrent() during the parallel update.");
+
+    if (m_isActive == isActive)
+    {
+        return;
+    }
+
     m_isActive = isActive;
+    for (auto& component : m_components)
+    {
+        component->RefreshTickRegistration();
+    }
 }
 
 bool GameObject::IsActive() const noexcept
@@ -37,9 +59,64 @@ bool GameObject::IsActive() const noexcept
     return m_isActive;
 }
 
+void GameObject::SetParent(GameObject* parent) noexcept
+{
+    assert(IsStructureLocked() == false && "Record the structural changes into EntityCommandBuffer::GetCurrent() during the parallel update.");
+
+    if (m_parent != nullptr)
+    {
+        --m_parent->m_childCount;
+    }
+
+    m_parent = parent;
+
+    if (m_parent != nullptr)
+    {
+        ++m_parent->m_childCount;
+    }
+}
+
+GameObject* GameObject::GetParent() noexcept
+{
+    return m_parent;
+}
+
+const GameObject* GameObject::GetParent() const noexcept
+{
+    return m_parent;
+}
+
+int32_t GameObject::GetChildCount() const noexcept
+{
+    return m_childCount;
+}
+
+TickScheduler* GameObject::GetTickScheduler() noexcept
+{
+    return m_tickScheduler;
+}
+
 const StringHash& GameObject::GetName() const noexcept
 {
     return m_name;
 }
 
+const ComponentMask& GameObject::GetComponentMask() const noexcept
+{
+    return m_componentMask;
+}
+
+bool GameObject::SetStructureLocked(bool isLocked) noexcept
+{
+    const auto prevIsLocked = g_isStructureLocked;
+    g_isStructureLocked = isLocked;
+
+    return prevIsLocked;
+}
+
+bool GameObject::IsStructureLocked() noexcept
+{
+    return g_isStructureLocked;
+}
+
 }
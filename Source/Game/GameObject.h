@@ -1,15 +1,24 @@
 #pragma once
 
-#include <vector>
+#include <memory_resource>
 
+#include "Core/MemoryResource.h"
+#include "Core/ObjectPool.h"
 #include "Core/RuntimeObject.h"
+#include "Core/SmallVector.h"
 #include "Text/StringHash.h"
 
 #include "Component.h"
+#include "ComponentMask.h"
+#include "TickScheduler.h"
 
 namespace tg
 {
 
+class GameObject;
+
+using GameObjectHandle = PoolHandle<GameObject>;
+
 class GameObject final :
     public RuntimeObject
 {
@@ -18,12 +27,19 @@ public:
 
 /**@section Constructor */
 public:
-    explicit GameObject(StringHash name = {});
+    /**
+     * @brief   Initializes the object.
+     * @param name              The name of the object.
+     * @param tickScheduler     The scheduler which updates the components, or nullptr to update them through GameObject::Update.
+     * @param memoryResource    The resource which the component list is allocated from.
+     */
+    explicit GameObject(StringHash name = {}, TickScheduler* tickScheduler = nullptr, std::pmr::memory_resource* memoryResource = TrackingMemoryResource::GetInstance(MemoryTag::Scene));
 
 /**@section Method */
 public:
     /**
-     * @brief   Updates the frame of the object.
+     * @brief   Updates every active component in the order of the tick group.
+     * @remark  The tick intervals are ignored. The objects which have a tick scheduler are updated by the scheduler instead.
      */
     void Update();
 
@@ -31,10 +47,18 @@ public:
      * @brief   Adds a component to the object.
      * @param args  Arguments for construct the specified type of component.
      * @return  The added component.
+     * @remark  An object can hold only one component per type. If it already exists, the existing component is returned.
      */
     template <typename _Component, typename... _Types>
     _Component* AddComponent(_Types&&... args);
 
+    /**
+     * @brief   Removes the component of the specified type.
+     * @return  True if the component was removed, false if the object doesn't have it.
+     */
+    template <typename _Component>
+    bool RemoveComponent();
+
     /**
      * @brief   Finds the component of the specified type.
      * @return  The found component or nullptr.
@@ -49,6 +73,12 @@ public:
     template <typename _Component>
     [[nodiscard]] const _Component* FindComponent() const;
 
+    /**
+     * @brief   Gets the mask of the component types which the object holds.
+     * @return  The component mask.
+     */
+    [[nodiscard]] const ComponentMask& GetComponentMask() const noexcept;
+
     /**
      * @brief   Sets the name of the object.
      * @param name  The object name.
@@ -59,7 +89,38 @@ public:
      * @brief   Activates or deactivates the object.
      * @param isActive  True activates the object and false deactivates the object.
      */
-    void SetActive(bool isActive) noexcept;
+    void SetActive(bool isActive);
+
+    /**
+     * @brief   Sets the parent of the object.
+     * @param parent    The parent object or nullptr.
+     * @remark  The parent must be in the same scene, which detaches the children when the parent is destroyed.
+     */
+    void SetParent(GameObject* parent) noexcept;
+
+    /**
+     * @brief   Gets the parent of the object.
+     * @return  The parent object or nullptr.
+     */
+    [[nodiscard]] GameObject* GetParent() noexcept;
+
+    /**
+     * @brief   Gets the parent of the object.
+     * @return  The parent object or nullptr.
+     */
+    [[nodiscard]] const GameObject* GetParent() const noexcept;
+
+    /**
+     * @brief   Gets the number of the objects whose parent is this object.
+     * @return  The number of the children.
+     */
+    [[nodiscard]] int32_t GetChildCount() const noexcept;
+
+    /**
+     * @brief   Gets the scheduler which updates the components of the object.
+     * @return  The tick scheduler or nullptr.
+     */
+    [[nodiscard]] TickScheduler* GetTickScheduler() noexcept;
 
     /**
      * @brief   Gets the name of the object.
@@ -73,40 +134,91 @@ public:
      */
     [[nodiscard]] bool IsActive() const noexcept;
 
+    /**
+     * @brief   Forbids or allows the structural changes of the objects on the current thread.
+     * @param isLocked  True forbids adding or removing the components, changing the active state or the parent, and
+     *                  instantiating or destroying the objects. They must be recorded into EntityCommandBuffer::GetCurrent() instead.
+     *                  It also forbids changing the tick state of the components, like Component::Sleep.
+     * @return  The previous state of the current thread.
+     * @remark  Scene::UpdateParallel locks the threads which run its chunks, since the chunks share the objects.
+     */
+    static bool SetStructureLocked(bool isLocked) noexcept;
+
+    /**
+     * @brief   Checks whether the structural changes are forbidden on the current thread.
+     * @return  True if they must be recorded into a command buffer.
+     */
+    [[nodiscard]] static bool IsStructureLocked() noexcept;
+
 /**@section Variable */
 protected:
     StringHash m_name;
     bool m_isActive = true;
     GameObject* m_parent = nullptr;
-    std::vector<std::unique_ptr<Component>> m_components;
+    int32_t m_childCount = 0;
+    TickScheduler* m_tickScheduler = nullptr;
+    ComponentMask m_componentMask;
+
+    // Sorted in ascending order of the component type index, so m_componentMask.Rank gives the position of a component.
+    // The most of the objects have only a few components, which are kept inline without allocating the list.
+    pmr::SmallVector<std::unique_ptr<Component, ComponentDeleter>, 4> m_components;
 };
 
 template <typename _Component, typename... _Types>
 _Component* GameObject::AddComponent(_Types&&... args)
 {
-    auto component = std::make_unique<_Component>(std::forward<_Types>(args)...);
-    auto rawComponent = component.get();
-    component->SetGameObject(this);
-    component->Initialize();
+    assert(IsStructureLocked() == false && "Record the structural changes into EntityCommandBuffer::GetCurrent() during the parallel update.");
+
+    const auto typeIndex = GetComponentTypeIndex<_Component>();
+    if (m_componentMask.Test(typeIndex))
+    {
+        assert(false && "The object already has the component of the specified type.");
+        return static_cast<_Component*>(m_components[m_componentMask.Rank(typeIndex)].get());
+    }
 
-    m_components.push_back(std::move(component));
+    auto& componentPool = GetComponentPool<_Component>();
+    auto component = std::unique_ptr<Component, ComponentDeleter>(componentPool.Get(componentPool.Create(std::forward<_Types>(args)...)), ComponentDeleter{[](Component* component)
+    {
+        GetComponentPool<_Component>().Destroy(static_cast<_Component*>(component));
+    }});
+
+    auto rawComponent = static_cast<_Component*>(component.get());
+    rawComponent->SetGameObject(this);
+    rawComponent->Initialize();
+
+    m_components.Insert(m_components.begin() + m_componentMask.Rank(typeIndex), std::move(component));
+    m_componentMask.Set(typeIndex);
 
     return rawComponent;
 }
 
+template <typename _Component>
+bool GameObject::RemoveComponent()
+{
+    assert(IsStructureLocked() == false && "Record the structural changes into EntityCommandBuffer::GetCurrent() during the parallel update.");
+
+    const auto typeIndex = GetComponentTypeIndex<_Component>();
+    if (m_componentMask.Test(typeIndex) == false)
+    {
+        return false;
+    }
+
+    m_components.Erase(m_components.begin() + m_componentMask.Rank(typeIndex));
+    m_componentMask.Reset(typeIndex);
+
+    return true;
+}
+
 template <typename _Component>
 _Component* GameObject::FindComponent()
 {
-    auto componentId = tg::GetRtti<_Component>()->GetHashCode();
-    for (auto& component : m_components)
+    const auto typeIndex = GetComponentTypeIndex<_Component>();
+    if (m_componentMask.Test(typeIndex) == false)
     {
-        if (component->GetRtti()->GetHashCode() == componentId)
-        {
-            return component.get();
-        }
+        return nullptr;
     }
 
-    return nullptr;
+    return static_cast<_Component*>(m_components[m_componentMask.Rank(typeIndex)].get());
 }
 
 template <typename _Component>
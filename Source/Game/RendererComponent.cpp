@@ -5,24 +5,24 @@
 namespace tg
 {
     
-RendererComponent::RendererComponent(const std::shared_ptr<Material>& material) noexcept :
+RendererComponent::RendererComponent(const Ref<Material>& material) noexcept :
     m_material(material)
 {
 }
 
-void RendererComponent::SetMaterial(const std::shared_ptr<Material>& material)
+void RendererComponent::SetMaterial(const Ref<Material>& material)
 {
     m_material = material;
 }
 
-std::shared_ptr<Material> RendererComponent::GetMaterial() noexcept
+Material* RendererComponent::GetMaterial() noexcept
 {
-    return m_material;
+    return m_material.Get();
 }
 
-std::shared_ptr<const Material> RendererComponent::GetMaterial() const noexcept
+const Material* RendererComponent::GetMaterial() const noexcept
 {
-    return m_material;
+    return m_material.Get();
 }
 
 }
@@ -15,17 +15,17 @@ public:
 
 /**@section Constructor */
 public:
-    explicit RendererComponent(const std::shared_ptr<Material>& material = nullptr) noexcept;
+    explicit RendererComponent(const Ref<Material>& material = nullptr) noexcept;
     
 /**@section Method */
 public:
-    void SetMaterial(const std::shared_ptr<Material>& material);
-    [[nodiscard]] std::shared_ptr<Material> GetMaterial() noexcept;
-    [[nodiscard]] std::shared_ptr<const Material> GetMaterial() const noexcept;
+    void SetMaterial(const Ref<Material>& material);
+    [[nodiscard]] Material* GetMaterial() noexcept;
+    [[nodiscard]] const Material* GetMaterial() const noexcept;
     
 /**@section Variable */
 protected:
-    std::shared_ptr<Material> m_material;
+    Ref<Material> m_material;
 };
 
 }
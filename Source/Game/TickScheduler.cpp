@@ -0,0 +1,209 @@
+#include "PrecompiledHeader.h"
+
+#include <algorithm>
+
+#include "Component.h"
+#include "TickScheduler.h"
+
+namespace tg
+{
+
+void TickScheduler::Add(Component* component)
+{
+    if (m_isTicking)
+    {
+        std::lock_guard lockGuard(m_pendingMutex);
+        if (component->m_tickSlot.isPending == false)
+        {
+            component->m_tickSlot.isPending = true;
+            m_pendingComponents.push_back(component);
+        }
+        return;
+    }
+
+    this->Insert(component);
+}
+
+void TickScheduler::Remove(Component* component)
+{
+    if (m_isTicking)
+    {
+        std::lock_guard lockGuard(m_pendingMutex);
+        auto& tickSlot = component->m_tickSlot;
+        if (tickSlot.isPending)
+        {
+            tickSlot.isPending = false;
+            m_pendingComponents.erase(std::find(m_pendingComponents.begin(), m_pendingComponents.end(), component));
+        }
+
+        if (tickSlot.IsNull() == false)
+        {
+            // The bucket can be iterated right now, so just leave a hole and compact it at EndTick.
+            auto& bucket = m_groups[static_cast<size_t>(tickSlot.group)][tickSlot.listIndex].buckets[tickSlot.bucketIndex];
+            bucket[tickSlot.position] = nullptr;
+            m_dirtyBuckets.push_back(&bucket);
+            tickSlot = {};
+        }
+        return;
+    }
+
+    this->Erase(component);
+}
+
+void TickScheduler::Tick(TickGroup group)
+{
+    const auto dueCount = this->BeginTick(group);
+    this->Tick(0, dueCount);
+    this->EndTick();
+}
+
+size_t TickScheduler::BeginTick(TickGroup group)
+{
+    m_isTicking = true;
+    m_dueBuckets.clear();
+    m_dueOffsets.clear();
+
+    size_t dueCount = 0;
+    for (auto& intervalList : m_groups[static_cast<size_t>(group)])
+    {
+        auto& bucket = intervalList.buckets[m_frameIndex % intervalList.interval];
+        if (bucket.empty())
+        {
+            continue;
+        }
+
+        m_dueBuckets.push_back(&bucket);
+        m_dueOffsets.push_back(dueCount);
+        dueCount += bucket.size();
+    }
+
+    return dueCount;
+}
+
+void TickScheduler::Tick(size_t begin, size_t end)
+{
+    for (size_t i = 0; i < m_dueBuckets.size(); ++i)
+    {
+        auto& bucket = *m_dueBuckets[i];
+        const auto bucketBegin = m_dueOffsets[i];
+        const auto bucketEnd = bucketBegin + bucket.size();
+        if (bucketEnd <= begin)
+        {
+            continue;
+        }
+        if (bucketBegin >= end)
+        {
+            break;
+        }
+
+        const auto first = std::max(begin, bucketBegin) - bucketBegin;
+        const auto last = std::min(end, bucketEnd) - bucketBegin;
+        for (auto j = first; j < last; ++j)
+        {
+            if (auto* component = bucket[j]; component != nullptr)
+            {
+                component->Update();
+            }
+        }
+    }
+}
+
+void TickScheduler::EndTick()
+{
+    m_isTicking = false;
+
+    for (auto* bucket : m_dirtyBuckets)
+    {
+        this->Compact(*bucket);
+    }
+    m_dirtyBuckets.clear();
+
+    for (auto* component : m_pendingComponents)
+    {
+        component->m_tickSlot.isPending = false;
+        this->Insert(component);
+    }
+    m_pendingComponents.clear();
+}
+
+void TickScheduler::AdvanceFrame() noexcept
+{
+    ++m_frameIndex;
+}
+
+uint64_t TickScheduler::GetFrameIndex() const noexcept
+{
+    return m_frameIndex;
+}
+
+void TickScheduler::Insert(Component* component)
+{
+    auto& tickSlot = component->m_tickSlot;
+    if (tickSlot.IsNull() == false)
+    {
+        return;
+    }
+
+    const auto group = component->GetTickGroup();
+    const auto interval = std::max(component->GetTickInterval(), uint32_t(1));
+
+    auto& intervalLists = m_groups[static_cast<size_t>(group)];
+    auto iter = std::find_if(intervalLists.begin(), intervalLists.end(), [&](const IntervalList& intervalList)
+    {
+        return intervalList.interval == interval;
+    });
+    if (iter == intervalLists.end())
+    {
+        intervalLists.push_back(IntervalList{interval, std::vector<std::vector<Component*>>(interval)});
+        iter = intervalLists.end() - 1;
+    }
+
+    // Put the component into the least loaded bucket to spread the ticks evenly across the frames.
+    auto& buckets = iter->buckets;
+    const auto bucketIter = std::min_element(buckets.begin(), buckets.end(), [](const auto& lhs, const auto& rhs)
+    {
+        return lhs.size() < rhs.size();
+    });
+
+    tickSlot.group = group;
+    tickSlot.listIndex = static_cast<uint32_t>(iter - intervalLists.begin());
+    tickSlot.bucketIndex = static_cast<uint32_t>(bucketIter - buckets.begin());
+    tickSlot.position = static_cast<uint32_t>(bucketIter->size());
+    bucketIter->push_back(component);
+}
+
+void TickScheduler::Erase(Component* component)
+{
+    auto& tickSlot = component->m_tickSlot;
+    if (tickSlot.IsNull())
+    {
+        return;
+    }
+
+    auto& bucket = m_groups[static_cast<size_t>(tickSlot.group)][tickSlot.listIndex].buckets[tickSlot.bucketIndex];
+    if (tickSlot.position + 1 != bucket.size())
+    {
+        bucket[tickSlot.position] = bucket.back();
+        bucket[tickSlot.position]->m_tickSlot.position = tickSlot.position;
+    }
+    bucket.pop_back();
+
+    tickSlot = {};
+}
+
+void TickScheduler::Compact(std::vector<Component*>& bucket)
+{
+    uint32_t position = 0;
+    for (auto* component : bucket)
+    {
+        if (component != nullptr)
+        {
+            component->m_tickSlot.position = position;
+            bucket[position++] = component;
+        }
+    }
+
+    bucket.resize(position);
+}
+
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "Core/NonCopyable.h"
+
+namespace tg
+{
+
+class Component;
+
+enum class TickGroup
+{
+    PrePhysics,
+    Update,
+    PostUpdate,
+    Late,
+};
+
+struct TickSlot
+{
+/**@section Method */
+public:
+    [[nodiscard]] constexpr bool IsNull() const noexcept;
+
+/**@section Variable */
+public:
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+    TickGroup group = TickGroup::Update;
+    uint32_t listIndex = InvalidIndex;
+    uint32_t bucketIndex = 0;
+    uint32_t position = 0;
+    bool isPending = false;
+};
+
+/**
+ * @brief   Schedules the Update of the components by tick group and tick interval.
+ * @remark  A component which ticks every N frames is placed into one of N buckets, and only the bucket which matches
+ *          the current frame is ticked. The least loaded bucket is chosen on registration, so the low frequency ticks
+ *          are spread evenly across the frames. Inactive and sleeping components are removed from the buckets, so the
+ *          scheduler never touches their memory.
+ */
+class TickScheduler final :
+    private NonCopyable
+{
+/**@section Struct */
+private:
+    struct IntervalList
+    {
+        uint32_t interval;
+        std::vector<std::vector<Component*>> buckets;
+    };
+
+/**@section Method */
+public:
+    /**
+     * @brief   Registers the component to its tick group.
+     * @param component     The component to register.
+     * @remark  The registration which is requested during ticking is applied at EndTick.
+     */
+    void Add(Component* component);
+
+    /**
+     * @brief   Unregisters the component.
+     * @param component     The component to unregister.
+     * @remark  It's safe to call during ticking. The component won't be ticked anymore in the current frame.
+     */
+    void Remove(Component* component);
+
+    /**
+     * @brief   Ticks every component of the group which is due in the current frame.
+     * @param group     The tick group.
+     */
+    void Tick(TickGroup group);
+
+    /**
+     * @brief   Collects the components of the group which are due in the current frame.
+     * @param group     The tick group.
+     * @return  The number of the due components.
+     * @remark  The due components can be ticked in ranges with Tick(begin, end), which is safe to call from multiple threads.
+     */
+    size_t BeginTick(TickGroup group);
+
+    /**
+     * @brief   Ticks the due components in the range of [begin, end).
+     * @param begin     The first index of the due components.
+     * @param end       The index after the last due component.
+     */
+    void Tick(size_t begin, size_t end);
+
+    /**
+     * @brief   Applies the registrations which were changed during ticking.
+     */
+    void EndTick();
+
+    /**
+     * @brief   Moves to the next frame.
+     */
+    void AdvanceFrame() noexcept;
+
+    [[nodiscard]] uint64_t GetFrameIndex() const noexcept;
+
+private:
+    void Insert(Component* component);
+    void Erase(Component* component);
+    void Compact(std::vector<Component*>& bucket);
+
+/**@section Variable */
+public:
+    static constexpr size_t TickGroupCount = 4;
+
+private:
+    uint64_t m_frameIndex = 0;
+    std::array<std::vector<IntervalList>, TickGroupCount> m_groups;
+    bool m_isTicking = false;
+    std::vector<std::vector<Component*>*> m_dueBuckets;
+    std::vector<size_t> m_dueOffsets;
+
+    // Protects the registrations which are requested during ticking, because they can come from worker threads.
+    std::mutex m_pendingMutex;
+    std::vector<Component*> m_pendingComponents;
+    std::vector<std::vector<Component*>*> m_dirtyBuckets;
+};
+
+constexpr bool TickSlot::IsNull() const noexcept
+{
+    return listIndex == InvalidIndex;
+}
+
+}
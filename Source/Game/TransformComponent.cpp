@@ -2,6 +2,8 @@
 
 #include "Math/Mathf.h"
 #include "Game/GameObject.h"
+#include "Serialization/BinaryReader.h"
+#include "Serialization/BinaryWriter.h"
 
 #include "TransformComponent.h"
 
@@ -14,12 +16,17 @@ void TransformComponent::SetLocalPosition(const Vector3& localPosition) noexcept
     m_isDirty = true;
 }
 
-void TransformComponent::SetLocalRotation(const Vector3& localRotation) noexcept
+void TransformComponent::SetLocalRotation(const Quaternion& localRotation) noexcept
 {
     m_localRotation = localRotation;
     m_isDirty = true;
 }
 
+void TransformComponent::SetLocalEulerAngles(const Vector3& localEulerAngles) noexcept
+{
+    this->SetLocalRotation(Quaternion::Euler(localEulerAngles.x * Mathf::Deg2Rad, localEulerAngles.y * Mathf::Deg2Rad, localEulerAngles.z * Mathf::Deg2Rad));
+}
+
 void TransformComponent::SetLocalScale(const Vector3& localScale) noexcept
 {
     m_localScale = localScale;
@@ -31,17 +38,22 @@ const Vector3& TransformComponent::GetLocalPosition() const noexcept
     return m_localPosition;
 }
 
-const Vector3& TransformComponent::GetLocalRotation() const noexcept
+const Quaternion& TransformComponent::GetLocalRotation() const noexcept
 {
     return m_localRotation;
 }
 
+Vector3 TransformComponent::GetLocalEulerAngles() const noexcept
+{
+    return m_localRotation.ToEulerAngles() * Mathf::Rad2Deg;
+}
+
 const Vector3& TransformComponent::GetLocalScale() const noexcept
 {
     return m_localScale;
 }
 
-const Matrix4x4& TransformComponent::GetWorldMatrix() const noexcept
+const Matrix3x4& TransformComponent::GetWorldMatrix() const noexcept
 {
     if (m_isDirty)
     {
@@ -61,11 +73,50 @@ void TransformComponent::Update()
     }
 }
 
+// The scene files store the position, rotation and scale as ten floats.
+static_assert(detail::FixedBinarySize<TransformComponent> == sizeof(float) * 10);
+
+void TransformComponent::Serialize(std::vector<std::byte>& payload) const
+{
+    BinaryWriter(payload).Write(*this);
+}
+
+bool TransformComponent::Deserialize(std::span<const std::byte> payload)
+{
+    // The reflected fields are fixed size, so the read fails without touching them if the payload is smaller.
+    if (BinaryReader(payload).Read(*this))
+    {
+        m_isDirty = true;
+        return true;
+    }
+
+    // The older payload stores the rotation as euler angles in degrees.
+    float values[9];
+    if (payload.size() < sizeof(values))
+    {
+        return false;
+    }
+
+    std::memcpy(values, payload.data(), sizeof(values));
+    m_localPosition = Vector3(values[0], values[1], values[2]);
+    m_localRotation = Quaternion::Euler(values[3] * Mathf::Deg2Rad, values[4] * Mathf::Deg2Rad, values[5] * Mathf::Deg2Rad);
+    m_localScale = Vector3(values[6], values[7], values[8]);
+    m_isDirty = true;
+
+    return true;
+}
+
 void TransformComponent::UpdateWorldMatrix() const
 {
-    m_matWorld = Matrix4x4::Scale(m_localScale.x, m_localScale.y, m_localScale.z);
-    m_matWorld *= Matrix4x4::Rotate(m_localRotation.x * Mathf::Deg2Rad, m_localRotation.y * Mathf::Deg2Rad, m_localRotation.z * Mathf::Deg2Rad);
-    m_matWorld *= Matrix4x4::Translate(m_localPosition.x, m_localPosition.y, m_localPosition.z);
+    // Scale * Rotation * Translation only scales the columns of the rotation and appends the translation.
+    m_matWorld = Matrix3x4(m_localRotation.ToMatrix());
+    const auto scale = Float4::Set(m_localScale.x, m_localScale.y, m_localScale.z, 1.0f);
+    (Float4::Load(&m_matWorld.m00) * scale).Store(&m_matWorld.m00);
+    (Float4::Load(&m_matWorld.m10) * scale).Store(&m_matWorld.m10);
+    (Float4::Load(&m_matWorld.m20) * scale).Store(&m_matWorld.m20);
+    m_matWorld.m03 = m_localPosition.x;
+    m_matWorld.m13 = m_localPosition.y;
+    m_matWorld.m23 = m_localPosition.z;
 
    /* if (auto owner = this->GetGameObject().lock(); owner != nullptr)
     {
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <span>
+#include <vector>
 
-#include "Math/Matrix4x4.h"
+#include "Core/Reflection.h"
+#include "Math/Matrix3x4.h"
+#include "Math/Quaternion.h"
 
 #include "Component.h"
 
@@ -14,6 +18,13 @@ class TransformComponent :
 {
 public:
     TGON_RTTI(TransformComponent)
+    TGON_REFLECT(TransformComponent,
+        TGON_REFLECT_FIELD(m_localPosition),
+        TGON_REFLECT_FIELD(m_localRotation),
+        TGON_REFLECT_FIELD(m_localScale),
+        TGON_REFLECT_FIELD(m_matWorld, FieldFlags::Transient),
+        TGON_REFLECT_FIELD(m_isDirty, FieldFlags::Transient),
+        TGON_REFLECT_METHOD(GetWorldMatrix))
 
 /**@section Constructor */
 public:
@@ -22,13 +33,27 @@ public:
 /**@section Method */
 public:
     void SetLocalPosition(const Vector3& localPosition) noexcept;
-    void SetLocalRotation(const Vector3& localRotation) noexcept;
+    void SetLocalRotation(const Quaternion& localRotation) noexcept;
+
+    /**
+     * @brief   Sets the local rotation by the euler angles.
+     * @param localEulerAngles  The yaw, pitch and roll in degrees which are applied like Matrix4x4::Rotate.
+     */
+    void SetLocalEulerAngles(const Vector3& localEulerAngles) noexcept;
     void SetLocalScale(const Vector3& localScale) noexcept;
     [[nodiscard]] const Vector3& GetLocalPosition() const noexcept;
-    [[nodiscard]] const Vector3& GetLocalRotation() const noexcept;
+    [[nodiscard]] const Quaternion& GetLocalRotation() const noexcept;
+    [[nodiscard]] Vector3 GetLocalEulerAngles() const noexcept;
     [[nodiscard]] const Vector3& GetLocalScale() const noexcept;
-    [[nodiscard]] const Matrix4x4& GetWorldMatrix() const noexcept;
+
+    /**
+     * @brief   Gets the world matrix, which is affine and so is stored without its constant last column.
+     * @remark  Expand it by ToMatrix4x4 or CameraComponent::GetWorldViewProjectionMatrix only where the 4x4 form is needed.
+     */
+    [[nodiscard]] const Matrix3x4& GetWorldMatrix() const noexcept;
     void Update() override;
+    void Serialize(std::vector<std::byte>& payload) const;
+    bool Deserialize(std::span<const std::byte> payload);
 
 private:
     void UpdateWorldMatrix() const;
@@ -36,9 +61,9 @@ private:
 /**@section Variable */
 protected:
     Vector3 m_localPosition;
-    Vector3 m_localRotation;
+    Quaternion m_localRotation;
     Vector3 m_localScale = Vector3(1.0f, 1.0f, 1.0f);
-    mutable Matrix4x4 m_matWorld;
+    mutable Matrix3x4 m_matWorld;
     mutable bool m_isDirty = true;
 };
 
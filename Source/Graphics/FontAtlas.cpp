@@ -5,12 +5,12 @@
 namespace tg
 {
 
-FontAtlas::FontAtlas(const std::shared_ptr<Font>& font) :
+FontAtlas::FontAtlas(const Ref<Font>& font) :
     m_font(font)
 {
 }
 
-FontAtlas::FontAtlas(std::shared_ptr<Font>&& font) :
+FontAtlas::FontAtlas(Ref<Font>&& font) :
     m_font(std::move(font))
 {
 }
@@ -29,13 +29,13 @@ FontAtlas& FontAtlas::operator=(FontAtlas&& rhs) noexcept
     return *this;
 }
 
-void FontAtlas::Initialize(const std::shared_ptr<Font>& font)
+void FontAtlas::Initialize(const Ref<Font>& font)
 {
     m_textureAtlas.Initialize(FontAtlas::DefaultAtlasSize, FontAtlas::DefaultPixelFormat, FontAtlas::DefaultPaddingOffset);
     m_font = font;
 }
 
-void FontAtlas::Initialize(std::shared_ptr<Font>&& font)
+void FontAtlas::Initialize(Ref<Font>&& font)
 {
     m_textureAtlas.Initialize(FontAtlas::DefaultAtlasSize, FontAtlas::DefaultPixelFormat, FontAtlas::DefaultPaddingOffset);
     m_font = std::move(font);
@@ -47,29 +47,32 @@ std::optional<Rect> FontAtlas::GetTextureRect(char32_t c, int32_t fontSize) cons
     return m_textureAtlas.GetTextureRect(textureAtlasKey);
 }
 
-std::shared_ptr<const Texture> FontAtlas::GetAtlasTexture() const noexcept
+const Texture* FontAtlas::GetAtlasTexture() const noexcept
 {
     return m_textureAtlas.GetAtlasTexture();
 }
 
-std::shared_ptr<Texture> FontAtlas::GetAtlasTexture() noexcept
+Texture* FontAtlas::GetAtlasTexture() noexcept
 {
     return m_textureAtlas.GetAtlasTexture();
 }
 
-const GlyphData* FontAtlas::GetGlyphData(char32_t c, int32_t fontSize) const
+std::optional<GlyphMetrics> FontAtlas::GetGlyphMetrics(char32_t c, int32_t fontSize) const
 {
+    // The glyph data is moved when the font face loads the other glyphs, so only the copied metrics are returned.
     const auto glyphData = m_font->GetFontFace(fontSize)->GetGlyphData(c);
-    if (glyphData != nullptr)
+    if (glyphData == nullptr)
     {
-        const auto textureAtlasKey = CreateTextureAtlasKey(c, fontSize);
-        if (m_textureAtlas.Contains(textureAtlasKey) == false)
-        {
-            m_textureAtlas.Insert(textureAtlasKey, &glyphData->bitmap[0], glyphData->metrics.size);
-        }
+        return {};
+    }
+
+    const auto textureAtlasKey = CreateTextureAtlasKey(c, fontSize);
+    if (m_textureAtlas.Contains(textureAtlasKey) == false)
+    {
+        m_textureAtlas.Insert(textureAtlasKey, &glyphData->bitmap[0], glyphData->metrics.size);
     }
     
-    return glyphData;
+    return glyphData->metrics;
 }
 
 IntVector2 FontAtlas::GetKerning(char32_t lhs, char32_t rhs, int32_t fontSize) const
@@ -16,8 +16,8 @@ public:
 /**@section Constructor */
 public:
     FontAtlas() = default;
-    explicit FontAtlas(const std::shared_ptr<Font>& font);
-    explicit FontAtlas(std::shared_ptr<Font>&& font);
+    explicit FontAtlas(const Ref<Font>& font);
+    explicit FontAtlas(Ref<Font>&& font);
     FontAtlas(FontAtlas&& rhs) noexcept;
         
 /**@section Operator */
@@ -26,12 +26,12 @@ public:
 
 /**@section Method */
 public:
-    void Initialize(const std::shared_ptr<Font>& font);
-    void Initialize(std::shared_ptr<Font>&& font);
+    void Initialize(const Ref<Font>& font);
+    void Initialize(Ref<Font>&& font);
     std::optional<Rect> GetTextureRect(char32_t c, int32_t fontSize) const;
-    std::shared_ptr<Texture> GetAtlasTexture() noexcept;
-    std::shared_ptr<const Texture> GetAtlasTexture() const noexcept;
-    const GlyphData* GetGlyphData(char32_t c, int32_t fontSize) const;
+    Texture* GetAtlasTexture() noexcept;
+    const Texture* GetAtlasTexture() const noexcept;
+    std::optional<GlyphMetrics> GetGlyphMetrics(char32_t c, int32_t fontSize) const;
     IntVector2 GetKerning(char32_t lhs, char32_t rhs, int32_t fontSize) const;
 
 private:
@@ -43,7 +43,7 @@ private:
     static constexpr auto DefaultPixelFormat = PixelFormat::RGBA8888;
     static constexpr auto DefaultPaddingOffset = 2;
 
-    std::shared_ptr<Font> m_font;
+    Ref<Font> m_font;
     mutable BasicTextureAtlas<TextureAtlasKey> m_textureAtlas = {FontAtlas::DefaultAtlasSize, FontAtlas::DefaultPixelFormat, FontAtlas::DefaultPaddingOffset};
 };
 
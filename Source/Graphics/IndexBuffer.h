@@ -6,10 +6,13 @@
 #include "OpenGL/OpenGLIndexBuffer.h"
 #endif
 
+#include "Core/RefCounted.h"
+
 namespace tg
 {
     
 class IndexBuffer :
+    public RefCounted<IndexBuffer, RefCountPolicy::NonAtomic>,
     private PlatformIndexBuffer
 {
 /**@section Constructor */
@@ -1,7 +1,5 @@
 #include "PrecompiledHeader.h"
 
-#include "Core/MakeSharedEnabler.h"
-
 #include "Material.h"
 
 namespace tg
@@ -23,7 +21,7 @@ std::optional<Material> Material::Create(const char* vertexShaderCode, const cha
     return Material(std::move(*shaderProgram));
 }
 
-std::shared_ptr<Material> Material::Create(const char* vertexShaderCode, const char* fragmentShaderCode, ReturnPointerTag)
+Ref<Material> Material::Create(const char* vertexShaderCode, const char* fragmentShaderCode, ReturnPointerTag)
 {
     auto shaderProgram = ShaderProgram::Create(vertexShaderCode, fragmentShaderCode);
     if (!shaderProgram)
@@ -31,7 +29,7 @@ std::shared_ptr<Material> Material::Create(const char* vertexShaderCode, const c
         return {};
     }
 
-    return std::make_shared<MakeSharedEnabler<Material>>(std::move(*shaderProgram));
+    return Ref<Material>(new Material(std::move(*shaderProgram)));
 }
 
 void Material::Use()
@@ -1,7 +1,6 @@
 #pragma once
 
-#include <memory>
-
+#include "Core/RefCounted.h"
 #include "Core/TagDispatch.h"
 
 #include "ShaderProgram.h"
@@ -9,7 +8,8 @@
 namespace tg
 {
 
-class Material
+class Material :
+    public RefCounted<Material, RefCountPolicy::NonAtomic>
 {
 /**@section Constructor */
 protected:
@@ -18,7 +18,7 @@ protected:
 /**@section Method */
 public:
     [[nodiscard]] static std::optional<Material> Create(const char* vertexShaderCode, const char* fragmentShaderCode);
-    [[nodiscard]] static std::shared_ptr<Material> Create(const char* vertexShaderCode, const char* fragmentShaderCode, ReturnPointerTag);
+    [[nodiscard]] static Ref<Material> Create(const char* vertexShaderCode, const char* fragmentShaderCode, ReturnPointerTag);
     void Use();
     void Disuse();
     void SetParameter1f(const char* name, float f);
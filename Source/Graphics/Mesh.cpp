@@ -5,7 +5,7 @@
 namespace tg
 {
 
-Mesh::Mesh(const std::shared_ptr<VertexBuffer>& vertexBuffer, const std::shared_ptr<IndexBuffer>& indexBuffer) :
+Mesh::Mesh(const Ref<VertexBuffer>& vertexBuffer, const Ref<IndexBuffer>& indexBuffer) :
     m_vertexBuffer(vertexBuffer),
     m_indexBuffer(indexBuffer)
 {
@@ -24,34 +24,34 @@ void Mesh::Use()
     }
 }
 
-void Mesh::SetVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer)
+void Mesh::SetVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
 {
     m_vertexBuffer = vertexBuffer;
 }
 
-void Mesh::SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer)
+void Mesh::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
 {
     m_indexBuffer = indexBuffer;
 }
 
-std::shared_ptr<VertexBuffer> Mesh::GetVertexBuffer() noexcept
+VertexBuffer* Mesh::GetVertexBuffer() noexcept
 {
-    return m_vertexBuffer;
+    return m_vertexBuffer.Get();
 }
     
-std::shared_ptr<const VertexBuffer> Mesh::GetVertexBuffer() const noexcept
+const VertexBuffer* Mesh::GetVertexBuffer() const noexcept
 {
-    return m_vertexBuffer;
+    return m_vertexBuffer.Get();
 }
 
-std::shared_ptr<IndexBuffer> Mesh::GetIndexBuffer() noexcept
+IndexBuffer* Mesh::GetIndexBuffer() noexcept
 {
-    return m_indexBuffer;
+    return m_indexBuffer.Get();
 }
 
-std::shared_ptr<const IndexBuffer> Mesh::GetIndexBuffer() const noexcept
+const IndexBuffer* Mesh::GetIndexBuffer() const noexcept
 {
-    return m_indexBuffer;
+    return m_indexBuffer.Get();
 }
 
 }
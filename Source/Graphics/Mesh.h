@@ -1,6 +1,6 @@
 #pragma once
 
-#include <memory>
+#include "Core/RefCounted.h"
 
 #include "VertexBuffer.h"
 #include "IndexBuffer.h"
@@ -8,27 +8,28 @@
 namespace tg
 {
 
-class Mesh
+class Mesh :
+    public RefCounted<Mesh, RefCountPolicy::NonAtomic>
 {
 /**@section Constructor */
 public:
     Mesh() = default;
-    Mesh(const std::shared_ptr<VertexBuffer>& vertexBuffer, const std::shared_ptr<IndexBuffer>& indexBuffer);
+    Mesh(const Ref<VertexBuffer>& vertexBuffer, const Ref<IndexBuffer>& indexBuffer);
 
 /**@section Method */
 public:
     void Use();
-    void SetVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer);
-    void SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer);
-    std::shared_ptr<VertexBuffer> GetVertexBuffer() noexcept;
-    std::shared_ptr<const VertexBuffer> GetVertexBuffer() const noexcept;
-    std::shared_ptr<IndexBuffer> GetIndexBuffer() noexcept;
-    std::shared_ptr<const IndexBuffer> GetIndexBuffer() const noexcept;
+    void SetVertexBuffer(const Ref<VertexBuffer>& vertexBuffer);
+    void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer);
+    [[nodiscard]] VertexBuffer* GetVertexBuffer() noexcept;
+    [[nodiscard]] const VertexBuffer* GetVertexBuffer() const noexcept;
+    [[nodiscard]] IndexBuffer* GetIndexBuffer() noexcept;
+    [[nodiscard]] const IndexBuffer* GetIndexBuffer() const noexcept;
 
 /**@section Variable */
 protected:
-    std::shared_ptr<VertexBuffer> m_vertexBuffer;
-    std::shared_ptr<IndexBuffer> m_indexBuffer;
+    Ref<VertexBuffer> m_vertexBuffer;
+    Ref<IndexBuffer> m_indexBuffer;
 };
 
 }
@@ -22,7 +22,8 @@ constexpr GLenum ConvertVertexFormatTypeToNative(VertexFormat vertexFormatType)
         GL_SHORT,
         GL_UNSIGNED_SHORT,
         GL_INT,
-        GL_UNSIGNED_INT
+        GL_UNSIGNED_INT,
+        GL_HALF_FLOAT
     };
     
     return nativeVertexFormatTypes[static_cast<int>(vertexFormatType)];
@@ -66,6 +67,11 @@ VertexBuffer::~VertexBuffer()
 }
 
 std::optional<VertexBuffer> VertexBuffer::Create(const std::initializer_list<VertexBufferLayout>& vertexBufferLayouts)
+{
+    return Create(std::span(vertexBufferLayouts.begin(), vertexBufferLayouts.size()));
+}
+
+std::optional<VertexBuffer> VertexBuffer::Create(std::span<const VertexBufferLayout> vertexBufferLayouts)
 {
     const auto vertexBufferId = CreateVertexBufferId();
     if (vertexBufferId == 0)
@@ -86,7 +92,12 @@ void VertexBuffer::SetData(const void* data, std::size_t dataByteCount, bool isD
 
 void VertexBuffer::SetLayoutDescriptor(const std::initializer_list<VertexBufferLayout>& vertexBufferLayouts)
 {
-    m_vertexBufferLayouts = vertexBufferLayouts;
+    this->SetLayoutDescriptor(std::span(vertexBufferLayouts.begin(), vertexBufferLayouts.size()));
+}
+
+void VertexBuffer::SetLayoutDescriptor(std::span<const VertexBufferLayout> vertexBufferLayouts)
+{
+    m_vertexBufferLayouts.assign(vertexBufferLayouts.begin(), vertexBufferLayouts.end());
 }
 
 void VertexBuffer::Use()
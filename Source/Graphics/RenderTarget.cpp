@@ -10,14 +10,14 @@ RenderTarget::RenderTarget(const FExtent2D& extent, int32_t depthBits, int32_t s
 {
 }
 
-std::shared_ptr<Texture> RenderTarget::GetTexture() noexcept
+Texture* RenderTarget::GetTexture() noexcept
 {
-    return m_texture;
+    return m_texture.Get();
 }
 
-std::shared_ptr<const Texture> RenderTarget::GetTexture() const noexcept
+const Texture* RenderTarget::GetTexture() const noexcept
 {
-    return m_texture;
+    return m_texture.Get();
 }
 
 }
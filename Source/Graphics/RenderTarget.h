@@ -20,11 +20,11 @@ public:
 public:
     void Use();
     void Disuse();
-    std::shared_ptr<Texture> GetTexture() noexcept;
-    std::shared_ptr<const Texture> GetTexture() const noexcept;
+    [[nodiscard]] Texture* GetTexture() noexcept;
+    [[nodiscard]] const Texture* GetTexture() const noexcept;
 
 private:
-    std::shared_ptr<Texture> m_texture;
+    Ref<Texture> m_texture;
 };
 
 }
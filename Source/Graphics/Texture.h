@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/RefCounted.h"
 #include "Math/Vector2.h"
 #include "Drawing/Image.h"
 
@@ -25,6 +26,7 @@ enum class WrapMode
 };
 
 class Texture final :
+    public RefCounted<Texture, RefCountPolicy::NonAtomic>,
     private PlatformTexture
 {
 /**@section Constructor */
@@ -1,11 +1,13 @@
 #pragma once
 
-#include <unordered_map>
 #include <optional>
 #include <memory>
+#include <memory_resource>
 #include <array>
 #include <stb_rect_pack.h>
 
+#include "Core/FlatHashMap.h"
+#include "Core/MemoryResource.h"
 #include "Core/NonCopyable.h"
 #include "Math/Rect.h"
 #include "Math/Extent.h"
@@ -25,7 +27,7 @@ private:
 
 /**@section Constructor */
 public:
-    BasicTextureAtlas(const I32Extent2D& atlasSize, PixelFormat atlasPixelFormat, int32_t paddingOffset = DefaultPaddingOffset);
+    BasicTextureAtlas(const I32Extent2D& atlasSize, PixelFormat atlasPixelFormat, int32_t paddingOffset = DefaultPaddingOffset, std::pmr::memory_resource* memoryResource = TrackingMemoryResource::GetInstance(MemoryTag::Graphics));
     BasicTextureAtlas(BasicTextureAtlas&& rhs) noexcept;
 
 /**@section Operator */
@@ -40,16 +42,16 @@ public:
     std::optional<Rect> GetTextureRect(const _KeyType& key) const;
     int32_t GetTextureCount() const noexcept;
     int32_t GetPaddingOffset() const noexcept;
-    std::shared_ptr<const Texture> GetAtlasTexture() const noexcept;
-    std::shared_ptr<Texture> GetAtlasTexture() noexcept;
+    const Texture* GetAtlasTexture() const noexcept;
+    Texture* GetAtlasTexture() noexcept;
 
 /**@section Variable */
 private:
-    std::shared_ptr<Texture> m_atlasTexture;
+    Ref<Texture> m_atlasTexture;
     stbrp_context m_context {};
     std::array<stbrp_node, 4096> m_nodes {};
     std::array<stbrp_rect, 4096> m_nodeRects {};
-    mutable std::unordered_map<_KeyType, Rect> m_packedTextureInfos;
+    mutable pmr::FlatHashMap<_KeyType, Rect> m_packedTextureInfos;
     int32_t m_paddingOffset = 0;
 };
 
@@ -58,8 +60,9 @@ using I32TextureAtlas = BasicTextureAtlas<int32_t>;
 using I64extureAtlas = BasicTextureAtlas<int64_t>;
 
 template <typename _KeyType>
-inline BasicTextureAtlas<_KeyType>::BasicTextureAtlas(const I32Extent2D& atlasSize, PixelFormat atlasPixelFormat, int32_t paddingOffset) :
-    m_atlasTexture(std::make_shared<Texture>(nullptr, atlasSize, atlasPixelFormat, FilterMode::Linear, WrapMode::Clamp, false, true)),
+inline BasicTextureAtlas<_KeyType>::BasicTextureAtlas(const I32Extent2D& atlasSize, PixelFormat atlasPixelFormat, int32_t paddingOffset, std::pmr::memory_resource* memoryResource) :
+    m_atlasTexture(MakeRef<Texture>(nullptr, atlasSize, atlasPixelFormat, FilterMode::Linear, WrapMode::Clamp, false, true)),
+    m_packedTextureInfos(memoryResource),
     m_paddingOffset(paddingOffset)
 {
     stbrp_init_target(&m_context, static_cast<int>(atlasSize.width), static_cast<int>(atlasSize.height), &m_nodes[0], 4096);
@@ -71,6 +74,7 @@ inline BasicTextureAtlas<_KeyType>::BasicTextureAtlas(BasicTextureAtlas&& rhs) n
     m_context(rhs.m_context),
     m_nodes(rhs.m_nodes),
     m_nodeRects(rhs.m_nodeRects),
+    m_packedTextureInfos(std::move(rhs.m_packedTextureInfos)),
     m_paddingOffset(rhs.m_paddingOffset)
 {
     rhs.m_paddingOffset = 0;
@@ -83,6 +87,7 @@ inline BasicTextureAtlas<_KeyType>& BasicTextureAtlas<_KeyType>::operator=(Basic
     m_context = rhs.m_context;
     m_nodes = rhs.m_nodes;
     m_nodeRects = rhs.m_nodeRects;
+    m_packedTextureInfos = std::move(rhs.m_packedTextureInfos);
     m_paddingOffset = rhs.m_paddingOffset;
     
     rhs.m_paddingOffset = 0;
@@ -95,13 +100,13 @@ inline void BasicTextureAtlas<_KeyType>::Initialize(const I32Extent2D& atlasSize
 {
     if ((m_atlasTexture == nullptr) || (m_atlasTexture->GetSize() != atlasSize) || (m_atlasTexture->GetPixelFormat() != atlasPixelFormat))
     {
-        m_atlasTexture = std::make_shared<Texture>(nullptr, atlasSize, atlasPixelFormat, FilterMode::Linear, WrapMode::Clamp, false, true);
+        m_atlasTexture = MakeRef<Texture>(nullptr, atlasSize, atlasPixelFormat, FilterMode::Linear, WrapMode::Clamp, false, true);
     }
 
     m_context = {};
     m_nodes = {};
     m_nodeRects = {};
-    m_packedTextureInfos.clear();
+    m_packedTextureInfos.Clear();
     m_paddingOffset = paddingOffset;
 
     stbrp_init_target(&m_context, static_cast<int>(atlasSize.width), static_cast<int>(atlasSize.height), &m_nodes[0], 4096);
@@ -110,13 +115,13 @@ inline void BasicTextureAtlas<_KeyType>::Initialize(const I32Extent2D& atlasSize
 template <typename _KeyType>
 inline bool BasicTextureAtlas<_KeyType>::Insert(const _KeyType& key, const std::byte* imageData, const I32Extent2D& size)
 {
-    stbrp_rect rect{static_cast<int>(m_packedTextureInfos.size()), static_cast<stbrp_coord>(size.width + m_paddingOffset), static_cast<stbrp_coord>(size.height + m_paddingOffset), 0, 0, 0};
+    stbrp_rect rect{static_cast<int>(m_packedTextureInfos.GetSize()), static_cast<stbrp_coord>(size.width + m_paddingOffset), static_cast<stbrp_coord>(size.height + m_paddingOffset), 0, 0, 0};
 
     bool isPackingSucceed = stbrp_pack_rects(&m_context, &rect, 1) == 1;
     if (isPackingSucceed)
     {
         m_atlasTexture->SetData(imageData, Vector2(rect.x, rect.y), size, m_atlasTexture->GetPixelFormat());
-        m_packedTextureInfos.emplace(key, Rect(static_cast<float>(rect.x), static_cast<float>(rect.y), static_cast<float>(rect.w - m_paddingOffset), static_cast<float>(rect.h - m_paddingOffset)));
+        m_packedTextureInfos.TryEmplace(key, Rect(static_cast<float>(rect.x), static_cast<float>(rect.y), static_cast<float>(rect.w - m_paddingOffset), static_cast<float>(rect.h - m_paddingOffset)));
     }
 
     return isPackingSucceed;
@@ -125,13 +130,13 @@ inline bool BasicTextureAtlas<_KeyType>::Insert(const _KeyType& key, const std::
 template <typename _KeyType>
 inline bool BasicTextureAtlas<_KeyType>::Contains(const _KeyType& key)
 {
-    return m_packedTextureInfos.find(key) != m_packedTextureInfos.end();
+    return m_packedTextureInfos.Contains(key);
 }
 
 template <typename _KeyType>
 inline std::optional<Rect> BasicTextureAtlas<_KeyType>::GetTextureRect(const _KeyType& key) const
 {
-    auto it = m_packedTextureInfos.find(key);
+    auto it = m_packedTextureInfos.Find(key);
     if (it == m_packedTextureInfos.end())
     {
         return {};
@@ -143,7 +148,7 @@ inline std::optional<Rect> BasicTextureAtlas<_KeyType>::GetTextureRect(const _Ke
 template <typename _KeyType>
 inline int32_t BasicTextureAtlas<_KeyType>::GetTextureCount() const noexcept
 {
-    return static_cast<int32_t>(m_packedTextureInfos.size());
+    return static_cast<int32_t>(m_packedTextureInfos.GetSize());
 }
 
 template <typename _KeyType>
@@ -153,15 +158,15 @@ inline int32_t BasicTextureAtlas<_KeyType>::GetPaddingOffset() const noexcept
 }
 
 template <typename _KeyType>
-inline std::shared_ptr<const Texture> BasicTextureAtlas<_KeyType>::GetAtlasTexture() const noexcept
+inline const Texture* BasicTextureAtlas<_KeyType>::GetAtlasTexture() const noexcept
 {
-    return m_atlasTexture;
+    return m_atlasTexture.Get();
 }
 
 template <typename _KeyType>
-inline std::shared_ptr<Texture> BasicTextureAtlas<_KeyType>::GetAtlasTexture() noexcept
+inline Texture* BasicTextureAtlas<_KeyType>::GetAtlasTexture() noexcept
 {
-    return m_atlasTexture;
+    return m_atlasTexture.Get();
 }
 
 }
@@ -7,6 +7,8 @@
 #include "OpenGL/OpenGLVertexBuffer.h"
 #endif
 
+#include "Core/RefCounted.h"
+
 namespace tg
 {
 
@@ -20,6 +22,7 @@ enum class VertexFormat
     UnsignedShort,
     Int,
     UnsignedInt,
+    HalfFloat,
 };
 
 enum class VertexAttributeIndex
@@ -41,6 +44,7 @@ struct VertexBufferLayout
 };
 
 class VertexBuffer final :
+    public RefCounted<VertexBuffer, RefCountPolicy::NonAtomic>,
     private PlatformVertexBuffer
 {
 /**@section Constructor */
@@ -63,10 +67,12 @@ public:
     [[nodiscard]] PlatformVertexBuffer& GetPlatformDependency() noexcept;
     [[nodiscard]] const PlatformVertexBuffer& GetPlatformDependency() const noexcept;
     [[nodiscard]] static std::optional<VertexBuffer> Create(const std::initializer_list<VertexBufferLayout>& vertexBufferLayouts = {});
+    [[nodiscard]] static std::optional<VertexBuffer> Create(std::span<const VertexBufferLayout> vertexBufferLayouts);
     template <typename _Type>
     void SetData(const std::span<_Type>& data, bool isDynamicUsage);
     void SetData(const void* data, std::size_t dataByteCount, bool isDynamicUsage);
     void SetLayoutDescriptor(const std::initializer_list<VertexBufferLayout>& vertexBufferLayouts);
+    void SetLayoutDescriptor(std::span<const VertexBufferLayout> vertexBufferLayouts);
     void Use();
     void Disuse();
 
@@ -1,8 +1,15 @@
 #pragma once
 
+#include <cstddef>
+#include <span>
+
 #include "Math/Vector3.h"
 #include "Math/Vector2.h"
 #include "Math/Color.h"
+#include "Math/Half.h"
+#include "Math/PackedVector.h"
+
+#include "VertexBuffer.h"
 
 namespace tg
 {
@@ -41,4 +48,61 @@ struct V3F_N3F_T2F
     Vector2 uv;
 };
 
+/**
+ * @brief   The compact version of V3F_C4F_T2F, which takes 16 bytes instead of 36.
+ * @remark  The positions are quantized to the bounds of the mesh. Multiply QuantizedPosition::GetDequantizationMatrix
+ *          into the world matrix to restore them.
+ */
+struct V4S_C4B_T2H
+{
+/**@section Method */
+public:
+    [[nodiscard]] static std::span<const VertexBufferLayout> GetLayouts() noexcept;
+
+/**@section Variable */
+public:
+    QuantizedPosition position;
+    Color32 color;
+    Half2 uv;
+};
+
+/**
+ * @brief   The compact version of V3F_N3F_T2F, which takes 16 bytes instead of 32.
+ * @remark  The normals are encoded by the octahedral mapping, so the vertex shader has to decode them.
+ */
+struct V4S_N2S_T2H
+{
+/**@section Method */
+public:
+    [[nodiscard]] static std::span<const VertexBufferLayout> GetLayouts() noexcept;
+
+/**@section Variable */
+public:
+    QuantizedPosition position;
+    OctahedralNormal normal;
+    Half2 uv;
+};
+
+inline std::span<const VertexBufferLayout> V4S_C4B_T2H::GetLayouts() noexcept
+{
+    static constexpr VertexBufferLayout layouts[] = {
+        {VertexAttributeIndex::Position, 3, VertexFormat::Short, true, sizeof(V4S_C4B_T2H), offsetof(V4S_C4B_T2H, position)},
+        {VertexAttributeIndex::Color, 4, VertexFormat::UnsignedByte, true, sizeof(V4S_C4B_T2H), offsetof(V4S_C4B_T2H, color)},
+        {VertexAttributeIndex::UV, 2, VertexFormat::HalfFloat, false, sizeof(V4S_C4B_T2H), offsetof(V4S_C4B_T2H, uv)},
+    };
+    return layouts;
+}
+
+inline std::span<const VertexBufferLayout> V4S_N2S_T2H::GetLayouts() noexcept
+{
+    static constexpr VertexBufferLayout layouts[] = {
+        {VertexAttributeIndex::Position, 3, VertexFormat::Short, true, sizeof(V4S_N2S_T2H), offsetof(V4S_N2S_T2H, position)},
+        {VertexAttributeIndex::Normal, 2, VertexFormat::Short, true, sizeof(V4S_N2S_T2H), offsetof(V4S_N2S_T2H, normal)},
+        {VertexAttributeIndex::UV, 2, VertexFormat::HalfFloat, false, sizeof(V4S_N2S_T2H), offsetof(V4S_N2S_T2H, uv)},
+    };
+    return layouts;
+}
+
+static_assert(sizeof(V4S_C4B_T2H) == 16 && sizeof(V4S_N2S_T2H) == 16);
+
 }
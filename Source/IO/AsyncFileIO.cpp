@@ -0,0 +1,320 @@
+#include "PrecompiledHeader.h"
+
+#include <condition_variable>
+#include <mutex>
+
+#include "Core/RingBuffer.h"
+#include "Threading/Thread.h"
+
+#include "AsyncFileIO.h"
+
+namespace tg
+{
+namespace
+{
+
+/**
+ * @brief   Reads the files with the blocking calls on the dedicated threads, so the workers of the dispatch queues are
+ *          never occupied by the disk.
+ */
+class ThreadPoolAsyncFileReader final :
+    public detail::AsyncFileReader
+{
+/**@section Constructor */
+public:
+    explicit ThreadPoolAsyncFileReader(int32_t threadCount);
+
+/**@section Destructor */
+public:
+    ~ThreadPoolAsyncFileReader() override;
+
+/**@section Method */
+public:
+    void Submit(std::span<const Ref<detail::AsyncReadTask>> tasks) override;
+    [[nodiscard]] AsyncFileIOBackend GetBackend() const noexcept override;
+
+private:
+    void IOThreadHandler();
+
+/**@section Variable */
+private:
+    static constexpr size_t InitialTaskQueueCapacity = 64;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    RingBuffer<Ref<detail::AsyncReadTask>> m_taskQueue;
+    std::vector<Thread> m_threadPool;
+    bool m_needToDestroy = false;
+};
+
+ThreadPoolAsyncFileReader::ThreadPoolAsyncFileReader(int32_t threadCount)
+{
+    m_threadPool.reserve(threadCount);
+    for (int32_t i = 0; i < threadCount; ++i)
+    {
+        m_threadPool.emplace_back(&ThreadPoolAsyncFileReader::IOThreadHandler, this);
+    }
+}
+
+ThreadPoolAsyncFileReader::~ThreadPoolAsyncFileReader()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_needToDestroy = true;
+    }
+    m_cv.notify_all();
+
+    for (auto& thread : m_threadPool)
+    {
+        if (thread.Joinable())
+        {
+            thread.Join();
+        }
+    }
+}
+
+void ThreadPoolAsyncFileReader::Submit(std::span<const Ref<detail::AsyncReadTask>> tasks)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        for (const auto& task : tasks)
+        {
+            if (m_taskQueue.IsFull())
+            {
+                m_taskQueue.Reserve(std::max(m_taskQueue.GetCapacity() * 2, InitialTaskQueueCapacity));
+            }
+
+            m_taskQueue.PushBack(task);
+        }
+    }
+
+    if (tasks.size() == 1)
+    {
+        m_cv.notify_one();
+    }
+    else
+    {
+        m_cv.notify_all();
+    }
+}
+
+AsyncFileIOBackend ThreadPoolAsyncFileReader::GetBackend() const noexcept
+{
+    return AsyncFileIOBackend::ThreadPool;
+}
+
+void ThreadPoolAsyncFileReader::IOThreadHandler()
+{
+    std::unique_lock lock(m_mutex);
+
+    while (true)
+    {
+        m_cv.wait(lock, [this]()
+        {
+            return (m_taskQueue.IsEmpty() == false) || m_needToDestroy;
+        });
+
+        // The submitted reads are finished before the destruction, since their buffers are written by them.
+        if (m_taskQueue.IsEmpty())
+        {
+            return;
+        }
+
+        auto task = std::move(m_taskQueue.Front());
+        m_taskQueue.PopFront();
+
+        lock.unlock();
+        {
+            task->Complete(detail::ReadFileAt(task->m_nativeFileHandle, task->m_offset, task->m_buffer.data(), static_cast<int64_t>(task->m_buffer.size())));
+            task = nullptr;
+        }
+        lock.lock();
+    }
+}
+
+}
+
+AsyncFile::AsyncFile(NativeFileHandle nativeFileHandle) noexcept :
+    m_nativeFileHandle(nativeFileHandle)
+{
+}
+
+AsyncFile::AsyncFile(AsyncFile&& rhs) noexcept :
+    m_nativeFileHandle(std::exchange(rhs.m_nativeFileHandle, InvalidNativeFileHandle))
+{
+}
+
+AsyncFile::~AsyncFile()
+{
+    this->Close();
+}
+
+AsyncFile& AsyncFile::operator=(AsyncFile&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        this->Close();
+        m_nativeFileHandle = std::exchange(rhs.m_nativeFileHandle, InvalidNativeFileHandle);
+    }
+
+    return *this;
+}
+
+AsyncFile::NativeFileHandle AsyncFile::GetNativeHandle() const noexcept
+{
+    return m_nativeFileHandle;
+}
+
+bool AsyncFile::IsClosed() const noexcept
+{
+    return m_nativeFileHandle == InvalidNativeFileHandle;
+}
+
+namespace detail
+{
+
+AsyncReadTask::AsyncReadTask(AsyncFile::NativeFileHandle nativeFileHandle, int64_t offset, std::span<std::byte> buffer, AsyncReadCompletionHandler onComplete, DispatchQueue* completionQueue) noexcept :
+    m_nativeFileHandle(nativeFileHandle),
+    m_offset(offset),
+    m_buffer(buffer),
+    m_onComplete(std::move(onComplete)),
+    m_completionQueue(completionQueue)
+{
+}
+
+void AsyncReadTask::Complete(int64_t readBytes)
+{
+    m_readBytes = readBytes;
+    m_ownedFile.reset();
+
+    m_isCompleted.store(true, std::memory_order_release);
+    m_isCompleted.notify_all();
+
+    if (m_onComplete == nullptr)
+    {
+        return;
+    }
+
+    if (m_completionQueue == nullptr)
+    {
+        m_onComplete(m_readBytes);
+        return;
+    }
+
+    // The task is kept alive by the queued handler, so the handler can be called after every handle was released.
+    m_completionQueue->AddAsyncTask([task = Ref<AsyncReadTask>(this)]()
+    {
+        task->m_onComplete(task->m_readBytes);
+    });
+}
+
+}
+
+AsyncReadHandle::AsyncReadHandle(Ref<detail::AsyncReadTask> task) noexcept :
+    m_task(std::move(task))
+{
+}
+
+bool AsyncReadHandle::IsCompleted() const noexcept
+{
+    return m_task->m_isCompleted.load(std::memory_order_acquire);
+}
+
+void AsyncReadHandle::Wait() const noexcept
+{
+    m_task->m_isCompleted.wait(false, std::memory_order_acquire);
+}
+
+int64_t AsyncReadHandle::GetReadBytes() const noexcept
+{
+    return this->IsCompleted() ? m_task->m_readBytes : -1;
+}
+
+bool AsyncReadHandle::IsValid() const noexcept
+{
+    return m_task != nullptr;
+}
+
+AsyncFileIO::AsyncFileIO(DispatchQueue* completionQueue, AsyncFileIOBackend preferredBackend, int32_t threadCount, uint32_t queueDepth) :
+    m_completionQueue(completionQueue)
+{
+    if (preferredBackend == AsyncFileIOBackend::IoUring)
+    {
+        m_reader = detail::CreateNativeAsyncFileReader(queueDepth);
+    }
+
+    if (m_reader == nullptr)
+    {
+        m_reader = std::make_unique<ThreadPoolAsyncFileReader>(threadCount);
+    }
+}
+
+AsyncFileIO::~AsyncFileIO() = default;
+
+AsyncReadHandle AsyncFileIO::ReadAsync(const AsyncFile& file, int64_t offset, std::span<std::byte> buffer, AsyncReadCompletionHandler onComplete)
+{
+    AsyncReadRequest request{&file, offset, buffer, std::move(onComplete)};
+    return std::move(this->ReadAsync({&request, 1})[0]);
+}
+
+AsyncReadHandle AsyncFileIO::ReadAsync(const char8_t* path, int64_t offset, std::span<std::byte> buffer, AsyncReadCompletionHandler onComplete)
+{
+    // Fail the negative offset before opening the file, like the batch reads do.
+    auto file = offset >= 0 ? AsyncFile::Open(path) : std::nullopt;
+    if (file.has_value() == false)
+    {
+        auto task = MakeRef<detail::AsyncReadTask>(AsyncFile::NativeFileHandle(), offset, buffer, std::move(onComplete), m_completionQueue);
+        task->Complete(-1);
+        return AsyncReadHandle(std::move(task));
+    }
+
+    auto task = MakeRef<detail::AsyncReadTask>(file->GetNativeHandle(), offset, buffer, std::move(onComplete), m_completionQueue);
+    task->m_ownedFile = std::move(file);
+    m_reader->Submit({&task, 1});
+
+    return AsyncReadHandle(std::move(task));
+}
+
+std::vector<AsyncReadHandle> AsyncFileIO::ReadAsync(std::span<AsyncReadRequest> requests)
+{
+    std::vector<Ref<detail::AsyncReadTask>> tasks;
+    tasks.reserve(requests.size());
+
+    std::vector<AsyncReadHandle> handles;
+    handles.reserve(requests.size());
+
+    for (auto& request : requests)
+    {
+        const bool isFileOpened = request.file != nullptr && request.file->IsClosed() == false;
+        auto task = MakeRef<detail::AsyncReadTask>(isFileOpened ? request.file->GetNativeHandle() : AsyncFile::NativeFileHandle(), request.offset, request.buffer, std::move(request.onComplete), m_completionQueue);
+        if (isFileOpened && request.offset >= 0)
+        {
+            tasks.push_back(task);
+        }
+        else
+        {
+            task->Complete(-1);
+        }
+
+        handles.emplace_back(std::move(task));
+    }
+
+    if (tasks.empty() == false)
+    {
+        m_reader->Submit(tasks);
+    }
+
+    return handles;
+}
+
+AsyncFileIOBackend AsyncFileIO::GetBackend() const noexcept
+{
+    return m_reader->GetBackend();
+}
+
+DispatchQueue* AsyncFileIO::GetCompletionQueue() const noexcept
+{
+    return m_completionQueue;
+}
+
+}
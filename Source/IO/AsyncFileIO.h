@@ -0,0 +1,256 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "Core/InplaceDelegate.h"
+#include "Core/NonCopyable.h"
+#include "Core/RefCounted.h"
+#include "Threading/DispatchQueue.h"
+
+#include "FileStream.h"
+
+namespace tg
+{
+
+enum class AsyncFileIOBackend
+{
+    ThreadPool, // The dedicated I/O threads read the files with the blocking calls.
+    IoUring,    // The reads are queued to the kernel through io_uring, so no thread blocks on them.
+};
+
+/**
+ * @brief   The read-only file which is read at the explicit offsets, so it can be shared by the concurrent reads.
+ */
+class AsyncFile final
+{
+/**@section Type */
+public:
+    using NativeFileHandle = FileStream::NativeFileHandle;
+
+/**@section Constructor */
+public:
+    AsyncFile(const AsyncFile& rhs) = delete;
+    AsyncFile(AsyncFile&& rhs) noexcept;
+
+private:
+    explicit AsyncFile(NativeFileHandle nativeFileHandle) noexcept;
+
+/**@section Destructor */
+public:
+    ~AsyncFile();
+
+/**@section Operator */
+public:
+    AsyncFile& operator=(const AsyncFile& rhs) = delete;
+    AsyncFile& operator=(AsyncFile&& rhs) noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Opens the file to read.
+     * @param path      The path of the file.
+     * @param options   The expected access pattern. Only SequentialScan and RandomAccess are used.
+     * @return  The opened file, or std::nullopt if the file couldn't be opened.
+     */
+    [[nodiscard]] static std::optional<AsyncFile> Open(const char8_t* path, FileOptions options = FileOptions::None);
+    void Close() noexcept;
+    [[nodiscard]] int64_t Length() const;
+    [[nodiscard]] NativeFileHandle GetNativeHandle() const noexcept;
+    [[nodiscard]] bool IsClosed() const noexcept;
+
+/**@section Variable */
+private:
+#if TGON_PLATFORM_WINDOWS
+    static inline const NativeFileHandle InvalidNativeFileHandle = reinterpret_cast<void*>(static_cast<intptr_t>(-1));
+#else
+    static constexpr NativeFileHandle InvalidNativeFileHandle = -1;
+#endif
+
+    NativeFileHandle m_nativeFileHandle = InvalidNativeFileHandle;
+};
+
+/**
+ * @brief   The handler which is called with the number of the read bytes, which is less than the buffer size only at the
+ *          end of the file, or -1 if the read failed.
+ */
+using AsyncReadCompletionHandler = InplaceDelegate<void(int64_t readBytes)>;
+
+namespace detail
+{
+
+class AsyncReadTask final :
+    public RefCounted<AsyncReadTask>
+{
+/**@section Constructor */
+public:
+    AsyncReadTask(AsyncFile::NativeFileHandle nativeFileHandle, int64_t offset, std::span<std::byte> buffer, AsyncReadCompletionHandler onComplete, DispatchQueue* completionQueue) noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Publishes the result, and calls the handler on the completion queue or on the calling thread if there is no queue.
+     * @param readBytes     The number of the read bytes, or -1 if the read failed.
+     */
+    void Complete(int64_t readBytes);
+
+/**@section Variable */
+public:
+    AsyncFile::NativeFileHandle m_nativeFileHandle;
+    int64_t m_offset;
+    std::span<std::byte> m_buffer;
+
+    // The number of the bytes which were read so far. The short read is continued from here.
+    int64_t m_transferredBytes = 0;
+
+    // The file which was opened for the read by path. It's closed with the task.
+    std::optional<AsyncFile> m_ownedFile;
+
+    AsyncReadCompletionHandler m_onComplete;
+    DispatchQueue* m_completionQueue;
+    int64_t m_readBytes = -1;
+    std::atomic<bool> m_isCompleted = false;
+};
+
+/**
+ * @brief   The backend which performs the submitted reads and completes them.
+ */
+class AsyncFileReader
+{
+/**@section Destructor */
+public:
+    virtual ~AsyncFileReader() = default;
+
+/**@section Method */
+public:
+    virtual void Submit(std::span<const Ref<AsyncReadTask>> tasks) = 0;
+    [[nodiscard]] virtual AsyncFileIOBackend GetBackend() const noexcept = 0;
+};
+
+/**
+ * @brief   Creates the backend which is native to the platform.
+ * @param queueDepth    The maximum number of the reads which are in flight at once.
+ * @return  The backend, or nullptr if the platform or the kernel doesn't support it.
+ */
+std::unique_ptr<AsyncFileReader> CreateNativeAsyncFileReader(uint32_t queueDepth);
+
+/**
+ * @brief   Reads the file at the offset with a blocking call.
+ * @return  The number of the read bytes, which is less than count only at the end of the file, or -1 if the read failed.
+ */
+int64_t ReadFileAt(AsyncFile::NativeFileHandle nativeFileHandle, int64_t offset, std::byte* buffer, int64_t count);
+
+}
+
+/**
+ * @brief   The handle of a submitted read.
+ */
+class AsyncReadHandle final
+{
+/**@section Constructor */
+public:
+    AsyncReadHandle() noexcept = default;
+    explicit AsyncReadHandle(Ref<detail::AsyncReadTask> task) noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Checks whether the read was finished. The buffer can be accessed once this returns true.
+     */
+    [[nodiscard]] bool IsCompleted() const noexcept;
+
+    /**
+     * @brief   Blocks the calling thread until the read is finished.
+     * @remark  The completion handler may not have been called yet, since it's called on the completion queue.
+     */
+    void Wait() const noexcept;
+
+    /**
+     * @brief   Gets the number of the read bytes.
+     * @return  The number of the read bytes, or -1 if the read failed or wasn't finished yet.
+     */
+    [[nodiscard]] int64_t GetReadBytes() const noexcept;
+    [[nodiscard]] bool IsValid() const noexcept;
+
+/**@section Variable */
+private:
+    Ref<detail::AsyncReadTask> m_task;
+};
+
+struct AsyncReadRequest
+{
+    const AsyncFile* file = nullptr;
+    int64_t offset = 0;
+    std::span<std::byte> buffer;
+    AsyncReadCompletionHandler onComplete;
+};
+
+/**
+ * @brief   Reads the files in the background, so the loading of the assets doesn't block the main thread or occupy the
+ *          workers of the global dispatch queue.
+ * @remark  On Linux the reads are queued to the kernel through io_uring. If it's unavailable, or on the other platforms,
+ *          they are read by a small pool of dedicated I/O threads. The buffers and the files must be kept alive until
+ *          the reads are completed, and the destructor waits for every submitted read.
+ */
+class AsyncFileIO final :
+    private NonCopyable
+{
+/**@section Constructor */
+public:
+    /**
+     * @param completionQueue       The queue on which the completion handlers are called, e.g. the main dispatch queue.
+     *                              If it's nullptr, they are called on the I/O thread.
+     * @param preferredBackend      The backend to use if it's supported.
+     * @param threadCount           The number of the I/O threads of the thread pool backend.
+     * @param queueDepth            The maximum number of the reads which are queued to the kernel at once.
+     */
+    explicit AsyncFileIO(DispatchQueue* completionQueue = nullptr, AsyncFileIOBackend preferredBackend = AsyncFileIOBackend::IoUring, int32_t threadCount = DefaultThreadCount, uint32_t queueDepth = DefaultQueueDepth);
+
+/**@section Destructor */
+public:
+    ~AsyncFileIO();
+
+/**@section Method */
+public:
+    /**
+     * @brief   Reads the bytes of the file into the buffer.
+     * @param file          The file to read. It must be kept open until the read is completed.
+     * @param offset        The byte offset in the file to start reading.
+     * @param buffer        The buffer to read into.
+     * @param onComplete    The handler which is called when the read is completed.
+     * @return  The handle of the read.
+     */
+    AsyncReadHandle ReadAsync(const AsyncFile& file, int64_t offset, std::span<std::byte> buffer, AsyncReadCompletionHandler onComplete = {});
+
+    /**
+     * @brief   Reads the bytes of the file at the path into the buffer.
+     * @remark  The file is opened on the calling thread and closed after the read. Open an AsyncFile to read a file many times.
+     *          If the file couldn't be opened, the read fails immediately.
+     */
+    AsyncReadHandle ReadAsync(const char8_t* path, int64_t offset, std::span<std::byte> buffer, AsyncReadCompletionHandler onComplete = {});
+
+    /**
+     * @brief   Submits the reads together, so the backend is woken up once for the whole batch.
+     * @param requests  The reads to submit. Their completion handlers are moved out.
+     * @return  The handles of the reads in the order of the requests.
+     */
+    std::vector<AsyncReadHandle> ReadAsync(std::span<AsyncReadRequest> requests);
+    [[nodiscard]] AsyncFileIOBackend GetBackend() const noexcept;
+    [[nodiscard]] DispatchQueue* GetCompletionQueue() const noexcept;
+
+/**@section Variable */
+public:
+    static constexpr int32_t DefaultThreadCount = 2;
+    static constexpr uint32_t DefaultQueueDepth = 256;
+
+private:
+    DispatchQueue* m_completionQueue;
+    std::unique_ptr<detail::AsyncFileReader> m_reader;
+};
+
+}
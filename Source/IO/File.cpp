@@ -1,5 +1,6 @@
 #include "PrecompiledHeader.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <fstream>
 
@@ -7,6 +8,7 @@
 
 #include "File.h"
 #include "FileStream.h"
+#include "MemoryMappedFile.h"
 
 namespace tg
 {
@@ -120,58 +122,29 @@ bool File::SetLastWriteTime(const char8_t* path, const DateTime& lastWriteTime)
 
 std::unique_ptr<std::byte[]> File::ReadAllBytes(const char8_t* path, ReturnPointerTag)
 {
-#ifdef _MSC_VER
-    FILE* fp = nullptr;
-    fopen_s(&fp, reinterpret_cast<const char*>(path), "rb");
-#else
-    FILE* fp = fopen(reinterpret_cast<const char*>(path), "rb");
-#endif
-    if (fp == nullptr)
+    const auto mappedFile = MemoryMappedFile::Open(path, MemoryAdvice::Sequential);
+    if (mappedFile.has_value() == false)
     {
         return nullptr;
     }
 
-    fseek(fp, 0, SEEK_END);
-    const auto fileSize = static_cast<size_t>(ftell(fp));
-    fseek(fp, 0, SEEK_SET);
+    // The bytes are copied once from the page cache, without being zeroed before.
+    auto fileData = std::make_unique_for_overwrite<std::byte[]>(mappedFile->GetSize());
+    std::copy(mappedFile->GetView().begin(), mappedFile->GetView().end(), fileData.get());
 
-    auto fileData = std::make_unique<std::byte[]>(static_cast<size_t>(fileSize));
-#ifdef _MSC_VER
-    fread_s(&fileData[0], fileSize, 1, fileSize, fp);
-#else
-    fread(&fileData[0], 1, fileSize, fp);
-#endif
-
-    fclose(fp);
     return fileData;
 }
 
 std::optional<std::vector<std::byte>> File::ReadAllBytes(const char8_t* path, ReturnVectorTag)
 {
-#ifdef _MSC_VER
-    FILE* fp = nullptr;
-    fopen_s(&fp, reinterpret_cast<const char*>(path), "rb");
-#else
-    FILE* fp = fopen(reinterpret_cast<const char*>(path), "rb");
-#endif
-    if (fp == nullptr)
+    const auto mappedFile = MemoryMappedFile::Open(path, MemoryAdvice::Sequential);
+    if (mappedFile.has_value() == false)
     {
         return {};
     }
 
-    fseek(fp, 0, SEEK_END);
-    const auto fileSize = static_cast<size_t>(ftell(fp));
-    fseek(fp, 0, SEEK_SET);
-
-    std::vector<std::byte> fileData(fileSize);
-#ifdef _MSC_VER
-    fread_s(&fileData[0], fileSize, 1, fileSize, fp);
-#else
-    fread(&fileData[0], 1, fileSize, fp);
-#endif
-
-    fclose(fp);
-    return fileData;
+    const auto fileData = mappedFile->GetView();
+    return std::vector<std::byte>(fileData.begin(), fileData.end());
 }
 
 std::optional<std::u8string> File::ReadAllText(const char8_t* path)
@@ -297,9 +270,7 @@ bool File::WriteAllBytes(const char8_t* path, const std::span<std::byte>& bytes)
         return false;
     }
 
-    fs->Write(&bytes[0], bytes.size());
-
-    return true;
+    return fs->Write(bytes.data(), static_cast<int64_t>(bytes.size()));
 }
 
 }
\ No newline at end of file
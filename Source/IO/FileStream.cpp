@@ -7,7 +7,7 @@
 namespace tg
 {
 
-FileStream::FileStream(void* nativeFileHandle, const char8_t* path, FileAccess access, int32_t bufferSize) :
+FileStream::FileStream(NativeFileHandle nativeFileHandle, const char8_t* path, FileAccess access, int32_t bufferSize) :
     m_nativeFileHandle(nativeFileHandle),
     m_bufferSize(bufferSize),
     m_readPos(0),
@@ -30,7 +30,7 @@ FileStream::FileStream(FileStream&& rhs) noexcept :
     m_access(rhs.m_access),
     m_fileName(std::move(rhs.m_fileName))
 {
-    rhs.m_nativeFileHandle = nullptr;
+    rhs.m_nativeFileHandle = InvalidNativeFileHandle;
     rhs.m_bufferSize = 0;
     rhs.m_readPos = 0;
     rhs.m_readLen = 0;
@@ -133,7 +133,8 @@ bool FileStream::SetLength(int64_t value)
 
 int64_t FileStream::Position() const
 {
-    return m_filePos + m_writePos;
+    // The file position is at the end of the read buffer, so the bytes which weren't consumed yet are excluded.
+    return m_filePos - (m_readLen - m_readPos) + m_writePos;
 }
 
 int64_t FileStream::Seek(int64_t offset, SeekOrigin origin)
@@ -179,44 +180,40 @@ std::vector<std::byte>& FileStream::GetBuffer()
     return m_buffer;
 }
 
-int32_t FileStream::Read(std::byte* buffer, int32_t count)
+int64_t FileStream::Read(std::byte* buffer, int64_t count)
 {
-    if (this->CanRead() == false || m_bufferSize < count)
+    if (this->CanRead() == false || count < 0)
     {
         return -1;
     }
 
-    int32_t leftReadBufferSpace = m_readLen - m_readPos;
-    if (leftReadBufferSpace == 0)
+    int64_t copiedBytes = std::min<int64_t>(m_readLen - m_readPos, count);
+    if (copiedBytes > 0)
     {
-        this->FlushWriteBuffer();
-    
-        const auto readBytes = this->InternalRead(&this->GetBuffer()[0], m_bufferSize);
-        m_readPos = 0;
-        m_readLen = leftReadBufferSpace = readBytes;
-
-        if (readBytes == 0)
+        std::memcpy(buffer, &m_buffer[m_readPos], static_cast<size_t>(copiedBytes));
+        m_readPos += static_cast<int32_t>(copiedBytes);
+        if (copiedBytes == count)
         {
-            return -1;
+            return copiedBytes;
         }
     }
-    
-    int32_t copiedBytes = std::min(leftReadBufferSpace, count);
-    std::memcpy(buffer, &m_buffer[0] + m_readPos, copiedBytes);
 
-    // Copied less than the required bytes?
-    if (copiedBytes < count)
-    {
-        const int32_t moreReadBytes = this->InternalRead(buffer + m_readPos + copiedBytes, count - copiedBytes);
-        copiedBytes += moreReadBytes;
+    this->FlushWriteBuffer();
+    m_readPos = m_readLen = 0;
 
-        m_readLen = 0;
-        m_readPos = 0;
+    // Staging the large request in the read buffer would copy every byte twice, so it's read into the buffer directly.
+    if (count - copiedBytes >= m_bufferSize)
+    {
+        return copiedBytes + this->InternalRead(buffer + copiedBytes, count - copiedBytes);
     }
 
-    m_readPos += copiedBytes;
+    m_readLen = static_cast<int32_t>(this->InternalRead(&this->GetBuffer()[0], m_bufferSize));
+
+    const auto bufferedBytes = std::min<int64_t>(m_readLen, count - copiedBytes);
+    std::memcpy(buffer + copiedBytes, &m_buffer[0], static_cast<size_t>(bufferedBytes));
+    m_readPos = static_cast<int32_t>(bufferedBytes);
 
-    return copiedBytes;
+    return copiedBytes + bufferedBytes;
 }
 
 int32_t FileStream::ReadByte()
@@ -233,7 +230,7 @@ int32_t FileStream::ReadByte()
 
         const auto readBytes = this->InternalRead(&this->GetBuffer()[0], m_bufferSize);
         m_readPos = 0;
-        m_readLen = readBytes;
+        m_readLen = static_cast<int32_t>(readBytes);
 
         if (readBytes == 0)
         {
@@ -244,9 +241,9 @@ int32_t FileStream::ReadByte()
     return static_cast<int32_t>(m_buffer[m_readPos++]);
 }
 
-bool FileStream::Write(const std::byte* buffer, int32_t count)
+bool FileStream::Write(const std::byte* buffer, int64_t count)
 {
-    if (this->CanWrite() == false)
+    if (this->CanWrite() == false || count < 0)
     {
         return false;
     }
@@ -255,19 +252,19 @@ bool FileStream::Write(const std::byte* buffer, int32_t count)
 
     if (m_writePos > 0)
     {
-        const int32_t numBytes = m_bufferSize - m_writePos;
+        const int64_t numBytes = m_bufferSize - m_writePos;
         if (numBytes > 0)
         {
             // If the specified buffer can be stored into the m_buffer directly
             if (count <= numBytes)
             {
-                std::memcpy(&GetBuffer()[m_writePos], buffer, count);
-                m_writePos += count;
+                std::memcpy(&GetBuffer()[m_writePos], buffer, static_cast<size_t>(count));
+                m_writePos += static_cast<int32_t>(count);
                 return true;
             }
 
             std::memcpy(&GetBuffer()[m_writePos], buffer, static_cast<size_t>(numBytes));
-            m_writePos += numBytes;
+            m_writePos += static_cast<int32_t>(numBytes);
             buffer += numBytes;
             count -= numBytes;
         }
@@ -275,14 +272,14 @@ bool FileStream::Write(const std::byte* buffer, int32_t count)
         this->FlushWriteBuffer();
     }
 
-    if (m_bufferSize < count)
+    // Staging the large request in the write buffer would copy every byte twice, so it's written from the buffer directly.
+    if (m_bufferSize <= count)
     {
-        this->InternalWrite(buffer, count);
-        return true;
+        return this->InternalWrite(buffer, count) == count;
     }
 
-    std::memcpy(&GetBuffer()[m_writePos], buffer, count);
-    m_writePos += count;
+    std::memcpy(&GetBuffer()[m_writePos], buffer, static_cast<size_t>(count));
+    m_writePos += static_cast<int32_t>(count);
 
     return true;
 }
@@ -1,7 +1,10 @@
 #pragma once
 
-#include <vector>
+#include <cstdint>
+#include <limits>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "Stream.h"
 
@@ -49,9 +52,17 @@ enum class FileOptions
 class FileStream :
     public Stream
 {
+/**@section Type */
+public:
+#if TGON_PLATFORM_WINDOWS
+    using NativeFileHandle = void*;
+#else
+    using NativeFileHandle = int;
+#endif
+
 /**@section Constructor */
 protected:
-    FileStream(void* nativeFileHandle, const char8_t* path, FileAccess access, int32_t bufferSize);
+    FileStream(NativeFileHandle nativeFileHandle, const char8_t* path, FileAccess access, int32_t bufferSize);
 
 public:
     FileStream(const FileStream& rhs) = delete;
@@ -81,9 +92,21 @@ public:
     bool SetLength(int64_t value) override;
     [[nodiscard]] int64_t Length() const override;
     [[nodiscard]] int64_t Position() const override;
-    int32_t Read(std::byte* buffer, int32_t count) override;
+    using Stream::Read;
+    using Stream::Write;
+
+    /**
+     * @brief   Reads the bytes from the current position.
+     * @remark  The request which isn't smaller than the buffer size is read into the specified buffer directly.
+     */
+    int64_t Read(std::byte* buffer, int64_t count) override;
     int32_t ReadByte() override;
-    bool Write(const std::byte* buffer, int32_t count) override;
+
+    /**
+     * @brief   Writes the bytes at the current position.
+     * @remark  The request which isn't smaller than the buffer size is written from the specified buffer directly.
+     */
+    bool Write(const std::byte* buffer, int64_t count) override;
     bool WriteByte(std::byte value) override;
     int64_t Seek(int64_t offset, SeekOrigin origin) override;
     void Close() override;
@@ -96,8 +119,8 @@ protected:
     [[nodiscard]] std::vector<std::byte>& GetBuffer();
     void FlushWriteBuffer();
     void FlushReadBuffer();
-    int32_t InternalRead(std::byte* buffer, int32_t count);
-    int32_t InternalWrite(const std::byte* buffer, int32_t count);
+    int64_t InternalRead(std::byte* buffer, int64_t count);
+    int64_t InternalWrite(const std::byte* buffer, int64_t count);
     int64_t InternalSeek(int64_t offset, SeekOrigin origin);
     void InternalFlush();
     bool InternalSetLength(int64_t value);
@@ -107,8 +130,13 @@ protected:
     static constexpr FileShare DefaultShare = FileShare::Read;
     static constexpr FileOptions DefaultFileOption = FileOptions::None;
     static constexpr int DefaultBufferSize = 4096;
+#if TGON_PLATFORM_WINDOWS
+    static inline const NativeFileHandle InvalidNativeFileHandle = reinterpret_cast<void*>(static_cast<intptr_t>(-1));
+#else
+    static constexpr NativeFileHandle InvalidNativeFileHandle = -1;
+#endif
 
-    void* m_nativeFileHandle;
+    NativeFileHandle m_nativeFileHandle;
     std::vector<std::byte> m_buffer;
     int32_t m_bufferSize;
     int32_t m_readPos;
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "Core/Algorithm.h"
+
+namespace tg
+{
+
+enum class MemoryAdvice : uint32_t
+{
+    Normal = 0x0,
+    Sequential = 0x1, // The pages will be read in order, so they are read ahead more aggressively.
+    Random = 0x2,     // The pages will be read in random order, so they aren't read ahead.
+    WillNeed = 0x4,   // The pages will be read soon, so they are started to be read in the background.
+    DontNeed = 0x8,   // The pages won't be read soon, so they can be dropped from the page cache.
+};
+
+constexpr MemoryAdvice operator|(MemoryAdvice lhs, MemoryAdvice rhs) noexcept;
+constexpr MemoryAdvice operator&(MemoryAdvice lhs, MemoryAdvice rhs) noexcept;
+
+/**
+ * @brief   Maps a file into the address space as read-only, so the content can be read straight out of the page cache
+ *          without being copied into a buffer.
+ * @remark  The views are valid until the file is closed. The pages are loaded on first access, so a view of a large file
+ *          is cheap to get but the first read of each page can block on the disk. Give MemoryAdvice to hide that latency.
+ */
+class MemoryMappedFile final
+{
+/**@section Constructor */
+public:
+    constexpr MemoryMappedFile() noexcept = default;
+    MemoryMappedFile(const MemoryMappedFile& rhs) = delete;
+    MemoryMappedFile(MemoryMappedFile&& rhs) noexcept;
+
+private:
+    MemoryMappedFile(const std::byte* data, size_t size) noexcept;
+
+/**@section Destructor */
+public:
+    ~MemoryMappedFile();
+
+/**@section Operator */
+public:
+    MemoryMappedFile& operator=(const MemoryMappedFile& rhs) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile&& rhs) noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Maps the whole file.
+     * @param path      The path of the file.
+     * @param advice    The expected access pattern of the whole file.
+     * @return  The mapped file, or std::nullopt if the file couldn't be opened or mapped. An empty file is mapped to an
+     *          empty view.
+     */
+    [[nodiscard]] static std::optional<MemoryMappedFile> Open(const char8_t* path, MemoryAdvice advice = MemoryAdvice::Normal);
+
+    /**
+     * @brief   Gives the expected access pattern of the range to the operating system.
+     * @param offset    The byte offset of the range, which is rounded down to the page boundary.
+     * @param size      The size of the range, which is clamped to the end of the file.
+     * @param advice    The expected access pattern.
+     * @remark  It's only a hint, so it may be ignored on some platforms.
+     */
+    void Advise(size_t offset, size_t size, MemoryAdvice advice) const noexcept;
+    void Advise(MemoryAdvice advice) const noexcept;
+
+    /**
+     * @brief   Unmaps the file. Every view of the file becomes invalid.
+     */
+    void Close() noexcept;
+
+    [[nodiscard]] std::span<const std::byte> GetView() const noexcept;
+
+    /**
+     * @brief   Gets the view of the range.
+     * @param offset    The byte offset of the range.
+     * @param size      The size of the range, which is clamped to the end of the file.
+     * @return  The view of the range, or an empty view if the offset is out of the file.
+     */
+    [[nodiscard]] std::span<const std::byte> GetView(size_t offset, size_t size) const noexcept;
+    [[nodiscard]] const std::byte* GetData() const noexcept;
+    [[nodiscard]] size_t GetSize() const noexcept;
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+/**@section Variable */
+private:
+    const std::byte* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+constexpr MemoryAdvice operator|(MemoryAdvice lhs, MemoryAdvice rhs) noexcept
+{
+    return static_cast<MemoryAdvice>(UnderlyingCast(lhs) | UnderlyingCast(rhs));
+}
+
+constexpr MemoryAdvice operator&(MemoryAdvice lhs, MemoryAdvice rhs) noexcept
+{
+    return static_cast<MemoryAdvice>(UnderlyingCast(lhs) & UnderlyingCast(rhs));
+}
+
+inline MemoryMappedFile::MemoryMappedFile(const std::byte* data, size_t size) noexcept :
+    m_data(data),
+    m_size(size)
+{
+}
+
+inline MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& rhs) noexcept :
+    m_data(rhs.m_data),
+    m_size(rhs.m_size)
+{
+    rhs.m_data = nullptr;
+    rhs.m_size = 0;
+}
+
+inline MemoryMappedFile::~MemoryMappedFile()
+{
+    this->Close();
+}
+
+inline MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        this->Close();
+
+        m_data = rhs.m_data;
+        m_size = rhs.m_size;
+
+        rhs.m_data = nullptr;
+        rhs.m_size = 0;
+    }
+
+    return *this;
+}
+
+inline void MemoryMappedFile::Advise(MemoryAdvice advice) const noexcept
+{
+    this->Advise(0, m_size, advice);
+}
+
+inline std::span<const std::byte> MemoryMappedFile::GetView() const noexcept
+{
+    return {m_data, m_size};
+}
+
+inline std::span<const std::byte> MemoryMappedFile::GetView(size_t offset, size_t size) const noexcept
+{
+    if (offset >= m_size)
+    {
+        return {};
+    }
+
+    return {m_data + offset, std::min(size, m_size - offset)};
+}
+
+inline const std::byte* MemoryMappedFile::GetData() const noexcept
+{
+    return m_data;
+}
+
+inline size_t MemoryMappedFile::GetSize() const noexcept
+{
+    return m_size;
+}
+
+inline bool MemoryMappedFile::IsEmpty() const noexcept
+{
+    return m_size == 0;
+}
+
+}
@@ -0,0 +1,464 @@
+#include "PrecompiledHeader.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#   include <atomic>
+#   include <mutex>
+#   include <linux/io_uring.h>
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#endif
+
+#include "Core/Algorithm.h"
+#include "Core/RingBuffer.h"
+#include "Threading/Thread.h"
+
+#include "../AsyncFileIO.h"
+
+namespace tg
+{
+namespace
+{
+
+#if defined(__linux__) && defined(__NR_io_uring_setup)
+/**
+ * @brief   Queues the reads to the kernel through io_uring, so a single thread waits for the completions of all of them.
+ * @remark  The ring is driven by the raw system calls, so it doesn't depend on liburing.
+ */
+class IoUringAsyncFileReader final :
+    public detail::AsyncFileReader
+{
+/**@section Constructor */
+private:
+    IoUringAsyncFileReader() noexcept = default;
+
+/**@section Destructor */
+public:
+    ~IoUringAsyncFileReader() override;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Creates the ring.
+     * @return  The reader, or nullptr if the kernel doesn't support io_uring or IORING_OP_READ.
+     */
+    [[nodiscard]] static std::unique_ptr<IoUringAsyncFileReader> Create(uint32_t queueDepth);
+    void Submit(std::span<const Ref<detail::AsyncReadTask>> tasks) override;
+    [[nodiscard]] AsyncFileIOBackend GetBackend() const noexcept override;
+
+private:
+    bool Initialize(uint32_t queueDepth);
+
+    /**
+     * @brief   Pushes the read of the remaining bytes of the task to the submission queue. The mutex must be locked by the caller.
+     */
+    void PushReadEntry(detail::AsyncReadTask* task) noexcept;
+
+    /**
+     * @brief   Pushes the entry which only wakes up the completion thread. The mutex must be locked by the caller.
+     */
+    void PushNopEntry() noexcept;
+    [[nodiscard]] io_uring_sqe& PushEntry() noexcept;
+
+    /**
+     * @brief   Submits the pushed entries to the kernel. The mutex must be locked by the caller.
+     */
+    void SubmitEntries() noexcept;
+    void CompletionThreadHandler();
+
+/**@section Variable */
+private:
+    static constexpr size_t InitialPendingTaskCapacity = 64;
+
+    // io_uring_sqe::len is 32 bits, so the large read is split into the entries of this size.
+    static constexpr int64_t MaxEntryReadSize = 1 << 30;
+
+    int m_ringFileDescriptor = -1;
+    void* m_sqRing = MAP_FAILED;
+    size_t m_sqRingSize = 0;
+    void* m_cqRing = MAP_FAILED;
+    size_t m_cqRingSize = 0;
+    io_uring_sqe* m_sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t m_sqesSize = 0;
+    uint32_t* m_sqTail = nullptr;
+    uint32_t m_sqMask = 0;
+    uint32_t* m_sqArray = nullptr;
+    uint32_t* m_cqHead = nullptr;
+    uint32_t* m_cqTail = nullptr;
+    uint32_t m_cqMask = 0;
+    io_uring_cqe* m_cqes = nullptr;
+
+    // The number of the reads in flight is bounded by the submission queue, so the completion queue, which is twice as
+    // large, never overflows. One entry is left for the wake-up entry.
+    uint32_t m_maxInflightCount = 0;
+    uint32_t m_inflightCount = 0;
+    uint32_t m_unsubmittedCount = 0;
+
+    std::mutex m_mutex;
+    RingBuffer<Ref<detail::AsyncReadTask>> m_pendingTasks;
+    std::vector<io_uring_cqe> m_completions;
+    Thread m_completionThread;
+    bool m_needToDestroy = false;
+};
+
+IoUringAsyncFileReader::~IoUringAsyncFileReader()
+{
+    if (m_completionThread.Joinable())
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_needToDestroy = true;
+            this->PushNopEntry();
+            this->SubmitEntries();
+        }
+
+        m_completionThread.Join();
+    }
+
+    if (m_sqes != MAP_FAILED)
+    {
+        munmap(m_sqes, m_sqesSize);
+    }
+    if (m_cqRing != MAP_FAILED && m_cqRing != m_sqRing)
+    {
+        munmap(m_cqRing, m_cqRingSize);
+    }
+    if (m_sqRing != MAP_FAILED)
+    {
+        munmap(m_sqRing, m_sqRingSize);
+    }
+    if (m_ringFileDescriptor != -1)
+    {
+        close(m_ringFileDescriptor);
+    }
+}
+
+std::unique_ptr<IoUringAsyncFileReader> IoUringAsyncFileReader::Create(uint32_t queueDepth)
+{
+    std::unique_ptr<IoUringAsyncFileReader> reader(new IoUringAsyncFileReader());
+    if (reader->Initialize(queueDepth) == false)
+    {
+        return nullptr;
+    }
+
+    reader->m_completionThread = Thread(&IoUringAsyncFileReader::CompletionThreadHandler, reader.get());
+    return reader;
+}
+
+bool IoUringAsyncFileReader::Initialize(uint32_t queueDepth)
+{
+    // The kernel may forbid io_uring through seccomp or sysctl, so the failure is an expected case.
+    io_uring_params params{};
+    m_ringFileDescriptor = static_cast<int>(syscall(__NR_io_uring_setup, std::max(queueDepth, 2u), &params));
+    if (m_ringFileDescriptor == -1)
+    {
+        return false;
+    }
+
+    m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+    }
+
+    m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFileDescriptor, IORING_OFF_SQ_RING);
+    if (m_sqRing == MAP_FAILED)
+    {
+        return false;
+    }
+
+    m_cqRing = (params.features & IORING_FEAT_SINGLE_MMAP) ? m_sqRing : mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFileDescriptor, IORING_OFF_CQ_RING);
+    if (m_cqRing == MAP_FAILED)
+    {
+        return false;
+    }
+
+    m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    m_sqes = static_cast<io_uring_sqe*>(mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFileDescriptor, IORING_OFF_SQES));
+    if (m_sqes == MAP_FAILED)
+    {
+        return false;
+    }
+
+    auto* sqRing = static_cast<std::byte*>(m_sqRing);
+    m_sqTail = reinterpret_cast<uint32_t*>(sqRing + params.sq_off.tail);
+    m_sqMask = *reinterpret_cast<uint32_t*>(sqRing + params.sq_off.ring_mask);
+    m_sqArray = reinterpret_cast<uint32_t*>(sqRing + params.sq_off.array);
+
+    auto* cqRing = static_cast<std::byte*>(m_cqRing);
+    m_cqHead = reinterpret_cast<uint32_t*>(cqRing + params.cq_off.head);
+    m_cqTail = reinterpret_cast<uint32_t*>(cqRing + params.cq_off.tail);
+    m_cqMask = *reinterpret_cast<uint32_t*>(cqRing + params.cq_off.ring_mask);
+    m_cqes = reinterpret_cast<io_uring_cqe*>(cqRing + params.cq_off.cqes);
+
+    m_maxInflightCount = params.sq_entries - 1;
+    m_completions.reserve(params.cq_entries);
+
+    // IORING_OP_READ was added after io_uring itself, so the older kernels fall back to the thread pool.
+    constexpr uint32_t probeOpCount = 256;
+    std::vector<std::byte> probeStorage(sizeof(io_uring_probe) + probeOpCount * sizeof(io_uring_probe_op));
+    auto* probe = reinterpret_cast<io_uring_probe*>(probeStorage.data());
+    if (syscall(__NR_io_uring_register, m_ringFileDescriptor, IORING_REGISTER_PROBE, probe, probeOpCount) != 0)
+    {
+        return false;
+    }
+
+    return probe->last_op >= IORING_OP_READ && (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) != 0;
+}
+
+void IoUringAsyncFileReader::Submit(std::span<const Ref<detail::AsyncReadTask>> tasks)
+{
+    std::lock_guard lock(m_mutex);
+
+    for (const auto& task : tasks)
+    {
+        if (m_inflightCount < m_maxInflightCount)
+        {
+            // The ring refers to the task by the raw pointer, so it holds a reference until the task is completed.
+            task->AddRef();
+            this->PushReadEntry(task.Get());
+        }
+        else
+        {
+            if (m_pendingTasks.IsFull())
+            {
+                m_pendingTasks.Reserve(std::max(m_pendingTasks.GetCapacity() * 2, InitialPendingTaskCapacity));
+            }
+
+            m_pendingTasks.PushBack(task);
+        }
+    }
+
+    this->SubmitEntries();
+}
+
+AsyncFileIOBackend IoUringAsyncFileReader::GetBackend() const noexcept
+{
+    return AsyncFileIOBackend::IoUring;
+}
+
+void IoUringAsyncFileReader::PushReadEntry(detail::AsyncReadTask* task) noexcept
+{
+    auto& sqe = this->PushEntry();
+    sqe.opcode = IORING_OP_READ;
+    sqe.fd = task->m_nativeFileHandle;
+    sqe.off = static_cast<uint64_t>(task->m_offset + task->m_transferredBytes);
+    sqe.addr = reinterpret_cast<uint64_t>(task->m_buffer.data() + task->m_transferredBytes);
+    sqe.len = static_cast<uint32_t>(std::min<int64_t>(static_cast<int64_t>(task->m_buffer.size()) - task->m_transferredBytes, MaxEntryReadSize));
+    sqe.user_data = reinterpret_cast<uint64_t>(task);
+
+    ++m_inflightCount;
+}
+
+void IoUringAsyncFileReader::PushNopEntry() noexcept
+{
+    auto& sqe = this->PushEntry();
+    sqe.opcode = IORING_OP_NOP;
+    sqe.user_data = 0;
+}
+
+io_uring_sqe& IoUringAsyncFileReader::PushEntry() noexcept
+{
+    // The tail is only written by this side, so it can be read without synchronization.
+    const uint32_t tail = *m_sqTail;
+    const uint32_t index = tail & m_sqMask;
+
+    auto& sqe = m_sqes[index];
+    sqe = {};
+    m_sqArray[index] = index;
+
+    // The entry must be visible to the kernel before the tail is.
+    std::atomic_ref(*m_sqTail).store(tail + 1, std::memory_order_release);
+    ++m_unsubmittedCount;
+
+    return sqe;
+}
+
+void IoUringAsyncFileReader::SubmitEntries() noexcept
+{
+    while (m_unsubmittedCount > 0)
+    {
+        const auto submittedCount = syscall(__NR_io_uring_enter, m_ringFileDescriptor, m_unsubmittedCount, 0, 0, nullptr, 0);
+        if (submittedCount == -1)
+        {
+            // The entries which couldn't be submitted for the lack of the resources are submitted again with the next ones.
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            break;
+        }
+
+        m_unsubmittedCount -= static_cast<uint32_t>(submittedCount);
+    }
+}
+
+void IoUringAsyncFileReader::CompletionThreadHandler()
+{
+    std::vector<std::pair<detail::AsyncReadTask*, int64_t>> completedTasks;
+    completedTasks.reserve(m_completions.capacity());
+
+    while (true)
+    {
+        syscall(__NR_io_uring_enter, m_ringFileDescriptor, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+
+        // The entries are copied out first, so their slots can be reused by the kernel while the tasks are processed.
+        uint32_t head = *m_cqHead;
+        const uint32_t tail = std::atomic_ref(*m_cqTail).load(std::memory_order_acquire);
+        m_completions.clear();
+        for (; head != tail; ++head)
+        {
+            m_completions.push_back(m_cqes[head & m_cqMask]);
+        }
+        std::atomic_ref(*m_cqHead).store(head, std::memory_order_release);
+
+        bool needToExit = false;
+        {
+            std::lock_guard lock(m_mutex);
+
+            for (const auto& cqe : m_completions)
+            {
+                auto* task = reinterpret_cast<detail::AsyncReadTask*>(cqe.user_data);
+                if (task == nullptr)
+                {
+                    continue;
+                }
+
+                --m_inflightCount;
+
+                if (cqe.res > 0)
+                {
+                    task->m_transferredBytes += cqe.res;
+                }
+
+                // The read can be short, so the rest is read again until the end of the file.
+                const bool needToRetry = (cqe.res == -EINTR || cqe.res == -EAGAIN) || (cqe.res > 0 && task->m_transferredBytes < static_cast<int64_t>(task->m_buffer.size()));
+                if (needToRetry)
+                {
+                    this->PushReadEntry(task);
+                    continue;
+                }
+
+                completedTasks.emplace_back(task, (cqe.res < 0) ? -1 : task->m_transferredBytes);
+            }
+
+            while (m_pendingTasks.IsEmpty() == false && m_inflightCount < m_maxInflightCount)
+            {
+                auto& task = m_pendingTasks.Front();
+                task->AddRef();
+                this->PushReadEntry(task.Get());
+                m_pendingTasks.PopFront();
+            }
+
+            this->SubmitEntries();
+
+            needToExit = m_needToDestroy && m_inflightCount == 0 && m_pendingTasks.IsEmpty();
+        }
+
+        // The handlers can take a while, so they are called without blocking the submissions.
+        for (auto [task, readBytes] : completedTasks)
+        {
+            task->Complete(readBytes);
+            task->Release();
+        }
+        completedTasks.clear();
+
+        if (needToExit)
+        {
+            return;
+        }
+    }
+}
+#endif
+
+}
+
+std::optional<AsyncFile> AsyncFile::Open(const char8_t* path, FileOptions options)
+{
+    const int fileDescriptor = open(reinterpret_cast<const char*>(path), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor == -1)
+    {
+        return {};
+    }
+
+#if defined(POSIX_FADV_SEQUENTIAL)
+    if ((UnderlyingCast(options) & UnderlyingCast(FileOptions::SequentialScan)) != 0)
+    {
+        posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+    else if ((UnderlyingCast(options) & UnderlyingCast(FileOptions::RandomAccess)) != 0)
+    {
+        posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_RANDOM);
+    }
+#endif
+
+    return AsyncFile(fileDescriptor);
+}
+
+void AsyncFile::Close() noexcept
+{
+    if (m_nativeFileHandle != InvalidNativeFileHandle)
+    {
+        close(m_nativeFileHandle);
+        m_nativeFileHandle = InvalidNativeFileHandle;
+    }
+}
+
+int64_t AsyncFile::Length() const
+{
+    struct stat fileStat;
+    if (fstat(m_nativeFileHandle, &fileStat) != 0)
+    {
+        return -1;
+    }
+
+    return static_cast<int64_t>(fileStat.st_size);
+}
+
+namespace detail
+{
+
+std::unique_ptr<AsyncFileReader> CreateNativeAsyncFileReader([[maybe_unused]] uint32_t queueDepth)
+{
+#if defined(__linux__) && defined(__NR_io_uring_setup)
+    return IoUringAsyncFileReader::Create(queueDepth);
+#else
+    return nullptr;
+#endif
+}
+
+int64_t ReadFileAt(AsyncFile::NativeFileHandle nativeFileHandle, int64_t offset, std::byte* buffer, int64_t count)
+{
+    int64_t readBytes = 0;
+    while (readBytes < count)
+    {
+        const auto result = pread(nativeFileHandle, buffer + readBytes, static_cast<size_t>(count - readBytes), static_cast<off_t>(offset + readBytes));
+        if (result == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return -1;
+        }
+
+        if (result == 0)
+        {
+            break;
+        }
+
+        readBytes += result;
+    }
+
+    return readBytes;
+}
+
+}
+
+}
@@ -1,10 +1,12 @@
 #include "PrecompiledHeader.h"
 
-#include <cstdio>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-#include "Diagnostics/Debug.h"
+#include "Core/Algorithm.h"
 
-#include "../File.h"
 #include "../FileStream.h"
 
 namespace tg
@@ -12,68 +14,131 @@ namespace tg
 namespace
 {
 
-constexpr const char* ConvertFileModeAccessToNative(FileMode mode, FileAccess access)
+int ConvertFileModeToNative(FileMode mode)
 {
-    constexpr const char* fileModeTable[][3] = {
-        {nullptr, "wb", "wb+"},
-        {nullptr, "wb", "wb+"},
-        {"rb", "wb", "rb+"},
-        {"rb", "wb", "rb+"},
-        {nullptr, "wb", "wb+"},
-        {nullptr, "ab", "ab+"},
+    constexpr int fileModeTable[] = {
+        O_CREAT | O_EXCL,
+        O_CREAT | O_TRUNC,
+        0,
+        O_CREAT,
+        O_TRUNC,
+        // The file is not opened with O_APPEND since pwrite ignores the offset on it. The stream starts at the end of the
+        // file instead.
+        O_CREAT,
     };
 
-    return fileModeTable[static_cast<int32_t>(mode) - 1][static_cast<int32_t>(access) - 1];
+    return fileModeTable[UnderlyingCast(mode) - 1];
 }
 
-FILE* CreateFileOpenHandle(const char8_t* path, FileMode mode, FileAccess access)
+int ConvertFileAccessToNative(FileAccess access)
 {
-    if (mode == FileMode::OpenOrCreate && File::Exists(path) == false)
+    constexpr int fileAccessTable[] = {O_RDONLY, O_WRONLY, O_RDWR};
+    return fileAccessTable[UnderlyingCast(access) - 1];
+}
+
+bool HasFileOption(FileOptions options, FileOptions option)
+{
+    return (UnderlyingCast(options) & UnderlyingCast(option)) != 0;
+}
+
+int CreateFileOpenHandle(const char8_t* path, FileMode mode, FileAccess access, FileOptions options)
+{
+    // These modes discard or append to the content, so they can't be used without the write access.
+    if (access == FileAccess::Read && (mode == FileMode::CreateNew || mode == FileMode::Create || mode == FileMode::Truncate || mode == FileMode::Append))
     {
-        FileStream::Create(path, FileMode::CreateNew);
+        return -1;
     }
 
-    return fopen(reinterpret_cast<const char*>(path), ConvertFileModeAccessToNative(mode, access));
+    int flags = ConvertFileModeToNative(mode) | ConvertFileAccessToNative(access) | O_CLOEXEC;
+    if (HasFileOption(options, FileOptions::WriteThrough))
+    {
+        flags |= O_DSYNC;
+    }
+
+    int fd;
+    do
+    {
+        fd = open(reinterpret_cast<const char*>(path), flags, 0666);
+    } while (fd == -1 && errno == EINTR);
+
+    return fd;
+}
+
+void AdviseFileAccess(int fd, FileOptions options)
+{
+#if defined(POSIX_FADV_SEQUENTIAL)
+    if (HasFileOption(options, FileOptions::SequentialScan))
+    {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+    else if (HasFileOption(options, FileOptions::RandomAccess))
+    {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_RANDOM);
+    }
+#elif defined(F_RDAHEAD)
+    // Darwin has no posix_fadvise, but the read ahead which is wasted on the random access can be turned off.
+    if (HasFileOption(options, FileOptions::RandomAccess))
+    {
+        fcntl(fd, F_RDAHEAD, 0);
+    }
+#endif
+}
+
+int64_t GetFileSize(int fd)
+{
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0)
+    {
+        return -1;
+    }
+
+    return static_cast<int64_t>(fileStat.st_size);
 }
 
 }
 
 std::optional<FileStream> FileStream::Create(const char8_t* path, FileMode mode, FileAccess access, FileShare share, int32_t bufferSize, FileOptions options)
 {
-    auto* nativeFileHandle = CreateFileOpenHandle(path, mode, access);
-    if (nativeFileHandle == nullptr)
+    const auto nativeFileHandle = CreateFileOpenHandle(path, mode, access, options);
+    if (nativeFileHandle == InvalidNativeFileHandle)
     {
         return {};
     }
-    
-    return FileStream(nativeFileHandle, path, access, bufferSize);
+
+    AdviseFileAccess(nativeFileHandle, options);
+
+    FileStream fileStream(nativeFileHandle, path, access, bufferSize);
+    if (mode == FileMode::Append)
+    {
+        fileStream.m_filePos = GetFileSize(nativeFileHandle);
+    }
+
+    return fileStream;
 }
 
 void FileStream::Close()
 {
     this->FlushWriteBuffer();
 
-    if (m_nativeFileHandle != nullptr)
+    if (m_nativeFileHandle != InvalidNativeFileHandle)
     {
-        fclose(reinterpret_cast<FILE*>(m_nativeFileHandle));
-        m_nativeFileHandle = nullptr;
+        close(m_nativeFileHandle);
+        m_nativeFileHandle = InvalidNativeFileHandle;
     }
 }
 
 bool FileStream::IsClosed() const noexcept
 {
-    return m_nativeFileHandle == nullptr;
+    return m_nativeFileHandle == InvalidNativeFileHandle;
 }
 
 int64_t FileStream::Length() const
 {
-    FILE* nativeFileHandle = reinterpret_cast<FILE*>(m_nativeFileHandle);
-
-    const auto prevSeekOffset = ftell(nativeFileHandle);
-    fseek(nativeFileHandle, 0, SEEK_END);
-
-    auto length = ftell(nativeFileHandle);
-    fseek(nativeFileHandle, prevSeekOffset, SEEK_SET);
+    auto length = GetFileSize(m_nativeFileHandle);
+    if (length == -1)
+    {
+        return -1;
+    }
 
     if (m_filePos + m_writePos > length)
     {
@@ -92,63 +157,102 @@ void FileStream::FlushWriteBuffer()
 
     this->InternalWrite(&m_buffer[0], m_writePos);
 
-    fflush(reinterpret_cast<FILE*>(m_nativeFileHandle));
-
     m_writePos = 0;
 }
 
-int32_t FileStream::InternalRead(std::byte* buffer, int32_t count)
+int64_t FileStream::InternalRead(std::byte* buffer, int64_t count)
 {
-    auto readBytes = fread(buffer, 1, count, reinterpret_cast<FILE*>(m_nativeFileHandle));
-    if (readBytes == static_cast<decltype(readBytes)>(-1))
+    // The position is tracked by the stream, so the file offset of the descriptor is never used.
+    int64_t readBytes = 0;
+    while (readBytes < count)
     {
-        return 0;
+        const auto result = pread(m_nativeFileHandle, buffer + readBytes, static_cast<size_t>(count - readBytes), static_cast<off_t>(m_filePos + readBytes));
+        if (result == -1 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (result <= 0)
+        {
+            break;
+        }
+
+        readBytes += result;
     }
 
     m_filePos += readBytes;
-    return static_cast<int32_t>(readBytes);
+    return readBytes;
 }
 
-int32_t FileStream::InternalWrite(const std::byte* buffer, int32_t count)
+int64_t FileStream::InternalWrite(const std::byte* buffer, int64_t count)
 {
-    auto writtenBytes = fwrite(buffer, 1, count, reinterpret_cast<FILE*>(m_nativeFileHandle));
-    if (writtenBytes == static_cast<decltype(writtenBytes)>(-1))
+    int64_t writtenBytes = 0;
+    while (writtenBytes < count)
     {
-        return 0;
+        const auto result = pwrite(m_nativeFileHandle, buffer + writtenBytes, static_cast<size_t>(count - writtenBytes), static_cast<off_t>(m_filePos + writtenBytes));
+        if (result == -1 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (result <= 0)
+        {
+            break;
+        }
+
+        writtenBytes += result;
     }
 
     m_filePos += writtenBytes;
-    return static_cast<int32_t>(writtenBytes);
+    return writtenBytes;
 }
 
 int64_t FileStream::InternalSeek(int64_t offset, SeekOrigin origin)
 {
-    auto nativeFileHandle = reinterpret_cast<FILE*>(m_nativeFileHandle);
-    auto result = fseek(nativeFileHandle, offset, static_cast<int>(origin));
-    if (result != 0)
+    int64_t newFilePos = offset;
+    if (origin == SeekOrigin::Current)
+    {
+        newFilePos += m_filePos;
+    }
+    else if (origin == SeekOrigin::End)
     {
-        return 0;
+        const auto fileSize = GetFileSize(m_nativeFileHandle);
+        if (fileSize == -1)
+        {
+            return -1;
+        }
+
+        newFilePos += fileSize;
     }
 
-    int64_t newFilePos = ftell(nativeFileHandle);
-    if (newFilePos == -1)
+    if (newFilePos < 0)
     {
-        return 0;
+        return -1;
     }
 
     m_filePos = newFilePos;
 
-    return static_cast<int32_t>(newFilePos);
+    return newFilePos;
 }
 
 bool FileStream::InternalSetLength(int64_t value)
 {
-    return false;
+    if (value < 0 || ftruncate(m_nativeFileHandle, static_cast<off_t>(value)) != 0)
+    {
+        return false;
+    }
+
+    if (m_filePos > value)
+    {
+        m_filePos = value;
+    }
+
+    return true;
 }
 
 void FileStream::InternalFlush()
 {
-    fflush(reinterpret_cast<FILE*>(m_nativeFileHandle));
+    fsync(m_nativeFileHandle);
 }
 
 }
@@ -0,0 +1,112 @@
+#include "PrecompiledHeader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../MemoryMappedFile.h"
+
+namespace tg
+{
+namespace
+{
+
+[[nodiscard]] size_t GetPageSize() noexcept
+{
+    static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+
+}
+
+std::optional<MemoryMappedFile> MemoryMappedFile::Open(const char8_t* path, MemoryAdvice advice)
+{
+    const int fileDescriptor = open(reinterpret_cast<const char*>(path), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor == -1)
+    {
+        return {};
+    }
+
+    struct stat s;
+    if (fstat(fileDescriptor, &s) != 0 || S_ISREG(s.st_mode) == false || static_cast<uint64_t>(s.st_size) > SIZE_MAX)
+    {
+        close(fileDescriptor);
+        return {};
+    }
+
+    // mmap rejects the zero length, so the empty file is represented by the empty view.
+    const auto size = static_cast<size_t>(s.st_size);
+    if (size == 0)
+    {
+        close(fileDescriptor);
+        return MemoryMappedFile();
+    }
+
+    auto* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+    // The mapping keeps its own reference to the file, so the descriptor isn't needed anymore.
+    close(fileDescriptor);
+    if (data == MAP_FAILED)
+    {
+        return {};
+    }
+
+    MemoryMappedFile mappedFile(static_cast<const std::byte*>(data), size);
+    if (advice != MemoryAdvice::Normal)
+    {
+        mappedFile.Advise(advice);
+    }
+
+    return mappedFile;
+}
+
+void MemoryMappedFile::Advise(size_t offset, size_t size, MemoryAdvice advice) const noexcept
+{
+    if (offset >= m_size)
+    {
+        return;
+    }
+
+    // madvise requires the page aligned address.
+    const auto begin = offset & ~(GetPageSize() - 1);
+    const auto end = offset + std::min(size, m_size - offset);
+    auto* address = const_cast<std::byte*>(m_data) + begin;
+    const auto length = end - begin;
+
+    if (advice == MemoryAdvice::Normal)
+    {
+        madvise(address, length, MADV_NORMAL);
+        return;
+    }
+
+    // The access pattern is given before WillNeed, so the read ahead which WillNeed starts follows it.
+    if ((advice & MemoryAdvice::Sequential) == MemoryAdvice::Sequential)
+    {
+        madvise(address, length, MADV_SEQUENTIAL);
+    }
+    if ((advice & MemoryAdvice::Random) == MemoryAdvice::Random)
+    {
+        madvise(address, length, MADV_RANDOM);
+    }
+    if ((advice & MemoryAdvice::WillNeed) == MemoryAdvice::WillNeed)
+    {
+        madvise(address, length, MADV_WILLNEED);
+    }
+    if ((advice & MemoryAdvice::DontNeed) == MemoryAdvice::DontNeed)
+    {
+        madvise(address, length, MADV_DONTNEED);
+    }
+}
+
+void MemoryMappedFile::Close() noexcept
+{
+    if (m_data != nullptr)
+    {
+        munmap(const_cast<std::byte*>(m_data), m_size);
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <span>
 
 namespace tg
@@ -37,25 +38,33 @@ public:
     virtual bool SetLength(int64_t value) = 0;
     [[nodiscard]] virtual int64_t Length() const = 0;
     [[nodiscard]] virtual int64_t Position() const = 0;
-    int32_t Read(const std::span<std::byte>& buffer);
-    virtual int32_t Read(std::byte* buffer, int32_t count) = 0;
+    int64_t Read(const std::span<std::byte>& buffer);
+
+    /**
+     * @brief   Reads the bytes from the current position.
+     * @param [out] buffer  The buffer to read into.
+     * @param count         The number of the bytes to read.
+     * @return  The number of the read bytes, which is less than count only at the end of the stream, or -1 if the
+     *          stream can't be read.
+     */
+    virtual int64_t Read(std::byte* buffer, int64_t count) = 0;
     virtual int32_t ReadByte() = 0;
     bool Write(const std::span<const std::byte>& buffer);
-    virtual bool Write(const std::byte* buffer, int32_t count) = 0;
+    virtual bool Write(const std::byte* buffer, int64_t count) = 0;
     virtual bool WriteByte(std::byte value) = 0;
     virtual int64_t Seek(int64_t offset, SeekOrigin origin) = 0;
     virtual void Close() = 0;
     virtual void Flush() = 0;
 };
     
-inline int32_t Stream::Read(const std::span<std::byte>& buffer)
+inline int64_t Stream::Read(const std::span<std::byte>& buffer)
 {
-    return this->Read(&buffer[0], static_cast<int32_t>(buffer.size()));
+    return this->Read(buffer.data(), static_cast<int64_t>(buffer.size()));
 }
 
 inline bool Stream::Write(const std::span<const std::byte>& buffer)
 {
-    return this->Write(&buffer[0], static_cast<int32_t>(buffer.size()));
+    return this->Write(buffer.data(), static_cast<int64_t>(buffer.size()));
 }
 
 }
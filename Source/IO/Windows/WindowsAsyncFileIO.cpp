@@ -0,0 +1,104 @@
+#include "PrecompiledHeader.h"
+
+#include "Core/Algorithm.h"
+#include "Platform/Windows/Windows.h"
+#include "Text/Encoding.h"
+
+#include "../AsyncFileIO.h"
+
+namespace tg
+{
+
+extern thread_local std::array<wchar_t, 32768> g_tempUtf16StrBuffer;
+
+namespace
+{
+
+// ReadFile takes a DWORD count, so the large request is split into chunks.
+constexpr int64_t MaxTransferChunkSize = 1 << 30;
+
+}
+
+std::optional<AsyncFile> AsyncFile::Open(const char8_t* path, FileOptions options)
+{
+    if (Encoding::Convert(Encoding::UTF8(), Encoding::Unicode(), reinterpret_cast<const std::byte*>(path), static_cast<int32_t>(std::char_traits<char8_t>::length(path)), reinterpret_cast<std::byte*>(g_tempUtf16StrBuffer.data()), static_cast<int32_t>(g_tempUtf16StrBuffer.size())).has_value() == false)
+    {
+        return {};
+    }
+
+    const DWORD accessPatternFlags = UnderlyingCast(options) & (UnderlyingCast(FileOptions::SequentialScan) | UnderlyingCast(FileOptions::RandomAccess));
+    HANDLE nativeFileHandle = CreateFileW(reinterpret_cast<LPCWSTR>(g_tempUtf16StrBuffer.data()), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | accessPatternFlags, nullptr);
+    if (nativeFileHandle == INVALID_HANDLE_VALUE)
+    {
+        return {};
+    }
+
+    return AsyncFile(nativeFileHandle);
+}
+
+void AsyncFile::Close() noexcept
+{
+    if (m_nativeFileHandle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(m_nativeFileHandle);
+        m_nativeFileHandle = INVALID_HANDLE_VALUE;
+    }
+}
+
+int64_t AsyncFile::Length() const
+{
+    LARGE_INTEGER li;
+    if (GetFileSizeEx(m_nativeFileHandle, &li) == FALSE)
+    {
+        return -1;
+    }
+
+    return li.QuadPart;
+}
+
+namespace detail
+{
+
+std::unique_ptr<AsyncFileReader> CreateNativeAsyncFileReader([[maybe_unused]] uint32_t queueDepth)
+{
+    // The reads are served by the thread pool until the overlapped I/O backend is written.
+    return nullptr;
+}
+
+int64_t ReadFileAt(AsyncFile::NativeFileHandle nativeFileHandle, int64_t offset, std::byte* buffer, int64_t count)
+{
+    // The offset of the synchronous handle is given by OVERLAPPED, so the concurrent reads don't share the file pointer.
+    int64_t readBytes = 0;
+    while (readBytes < count)
+    {
+        OVERLAPPED overlapped{};
+        const auto chunkOffset = static_cast<uint64_t>(offset + readBytes);
+        overlapped.Offset = static_cast<DWORD>(chunkOffset);
+        overlapped.OffsetHigh = static_cast<DWORD>(chunkOffset >> 32);
+
+        DWORD chunkReadBytes = 0;
+        const auto chunkSize = static_cast<DWORD>(std::min<int64_t>(count - readBytes, MaxTransferChunkSize));
+        if (ReadFile(nativeFileHandle, buffer + readBytes, chunkSize, &chunkReadBytes, &overlapped) == FALSE)
+        {
+            if (GetLastError() == ERROR_HANDLE_EOF)
+            {
+                break;
+            }
+
+            return -1;
+        }
+
+        if (chunkReadBytes == 0)
+        {
+            break;
+        }
+
+        readBytes += chunkReadBytes;
+    }
+
+    return readBytes;
+}
+
+}
+
+}
@@ -14,6 +14,8 @@ extern thread_local std::array<wchar_t, 32768> g_tempUtf16StrBuffer;
 namespace
 {
 
+constexpr int64_t MaxTransferChunkSize = 1 << 30;
+
 HANDLE CreateFileOpenHandle(const char8_t* path, FileMode mode, FileAccess access, FileShare share, FileOptions options)
 {
     if (Encoding::Convert(Encoding::UTF8(), Encoding::Unicode(), reinterpret_cast<const std::byte*>(path), static_cast<int32_t>(std::char_traits<char8_t>::length(path)), reinterpret_cast<std::byte*>(g_tempUtf16StrBuffer.data()), static_cast<int32_t>(g_tempUtf16StrBuffer.size())).has_value() == false)
@@ -104,24 +106,39 @@ void FileStream::FlushWriteBuffer()
     m_writePos = 0;
 }
 
-int32_t FileStream::InternalRead(std::byte* buffer, int32_t count)
+int64_t FileStream::InternalRead(std::byte* buffer, int64_t count)
 {
-    DWORD readBytes = 0;
-    if (ReadFile(m_nativeFileHandle, buffer, count, &readBytes, nullptr) == FALSE)
+    // ReadFile takes a DWORD count, so the large request is split into chunks.
+    int64_t readBytes = 0;
+    while (readBytes < count)
     {
-        return 0;
+        DWORD chunkReadBytes = 0;
+        const auto chunkSize = static_cast<DWORD>(std::min<int64_t>(count - readBytes, MaxTransferChunkSize));
+        if (ReadFile(m_nativeFileHandle, buffer + readBytes, chunkSize, &chunkReadBytes, nullptr) == FALSE || chunkReadBytes == 0)
+        {
+            break;
+        }
+
+        readBytes += chunkReadBytes;
     }
 
     m_filePos += readBytes;
     return readBytes;
 }
 
-int32_t FileStream::InternalWrite(const std::byte* buffer, int32_t bufferBytes)
+int64_t FileStream::InternalWrite(const std::byte* buffer, int64_t count)
 {
-    DWORD writtenBytes = 0;
-    if (WriteFile(m_nativeFileHandle, buffer, bufferBytes, &writtenBytes, nullptr) == FALSE)
+    int64_t writtenBytes = 0;
+    while (writtenBytes < count)
     {
-        return 0;
+        DWORD chunkWrittenBytes = 0;
+        const auto chunkSize = static_cast<DWORD>(std::min<int64_t>(count - writtenBytes, MaxTransferChunkSize));
+        if (WriteFile(m_nativeFileHandle, buffer + writtenBytes, chunkSize, &chunkWrittenBytes, nullptr) == FALSE || chunkWrittenBytes == 0)
+        {
+            break;
+        }
+
+        writtenBytes += chunkWrittenBytes;
     }
 
     m_filePos += writtenBytes;
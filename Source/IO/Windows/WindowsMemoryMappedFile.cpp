@@ -0,0 +1,97 @@
+#include "PrecompiledHeader.h"
+
+#include "Platform/Windows/SafeHandle.h"
+#include "Platform/Windows/Windows.h"
+#include "Text/Encoding.h"
+
+#include "../MemoryMappedFile.h"
+
+namespace tg
+{
+
+extern thread_local std::array<wchar_t, 32768> g_tempUtf16StrBuffer;
+
+std::optional<MemoryMappedFile> MemoryMappedFile::Open(const char8_t* path, MemoryAdvice advice)
+{
+    if (Encoding::Convert(Encoding::UTF8(), Encoding::Unicode(), reinterpret_cast<const std::byte*>(path), static_cast<int32_t>(std::char_traits<char8_t>::length(path)), reinterpret_cast<std::byte*>(g_tempUtf16StrBuffer.data()), static_cast<int32_t>(g_tempUtf16StrBuffer.size())).has_value() == false)
+    {
+        return {};
+    }
+
+    // Windows takes the access pattern only when the file is opened, and applies it to the cache manager of the file.
+    DWORD flagsAndAttributes = FILE_ATTRIBUTE_NORMAL;
+    if ((advice & MemoryAdvice::Sequential) == MemoryAdvice::Sequential)
+    {
+        flagsAndAttributes |= FILE_FLAG_SEQUENTIAL_SCAN;
+    }
+    else if ((advice & MemoryAdvice::Random) == MemoryAdvice::Random)
+    {
+        flagsAndAttributes |= FILE_FLAG_RANDOM_ACCESS;
+    }
+
+    const SafeHandle fileHandle(CreateFileW(reinterpret_cast<LPCWSTR>(g_tempUtf16StrBuffer.data()), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flagsAndAttributes, nullptr));
+    if (static_cast<HANDLE>(fileHandle) == INVALID_HANDLE_VALUE)
+    {
+        return {};
+    }
+
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(fileHandle, &fileSize) == FALSE || static_cast<uint64_t>(fileSize.QuadPart) > SIZE_MAX)
+    {
+        return {};
+    }
+
+    // CreateFileMapping rejects the empty file, so it's represented by the empty view.
+    const auto size = static_cast<size_t>(fileSize.QuadPart);
+    if (size == 0)
+    {
+        return MemoryMappedFile();
+    }
+
+    const SafeHandle mappingHandle(CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr));
+    if (mappingHandle == nullptr)
+    {
+        return {};
+    }
+
+    // The view keeps its own reference to the mapping, so the handles are closed when this returns.
+    auto* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr)
+    {
+        return {};
+    }
+
+    MemoryMappedFile mappedFile(static_cast<const std::byte*>(data), size);
+    if ((advice & MemoryAdvice::WillNeed) == MemoryAdvice::WillNeed)
+    {
+        mappedFile.Advise(MemoryAdvice::WillNeed);
+    }
+
+    return mappedFile;
+}
+
+void MemoryMappedFile::Advise(size_t offset, size_t size, MemoryAdvice advice) const noexcept
+{
+    // The other advices have no counterpart for the mapped view.
+    if (offset >= m_size || (advice & MemoryAdvice::WillNeed) != MemoryAdvice::WillNeed)
+    {
+        return;
+    }
+
+    WIN32_MEMORY_RANGE_ENTRY rangeEntry;
+    rangeEntry.VirtualAddress = const_cast<std::byte*>(m_data) + offset;
+    rangeEntry.NumberOfBytes = std::min(size, m_size - offset);
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &rangeEntry, 0);
+}
+
+void MemoryMappedFile::Close() noexcept
+{
+    if (m_data != nullptr)
+    {
+        UnmapViewOfFile(m_data);
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
+
+}
@@ -140,26 +140,26 @@ int32_t TextBlock::TryAddTextLine(const std::span<const char32_t>& characters, c
     {
         const auto ch = characters[i];
         
-        const auto& glyphData = fontAtlas->GetGlyphData(ch, fontSize);
-        if (glyphData == nullptr)
+        const auto glyphMetrics = fontAtlas->GetGlyphMetrics(ch, fontSize);
+        if (glyphMetrics.has_value() == false)
         {
             continue;
         }
         
-        if (rect.width < xAdvance + glyphData->metrics.size.width)
+        if (rect.width < xAdvance + glyphMetrics->size.width)
         {
             insertedTextLen = static_cast<int32_t>(i);
             break;
         }
 
-        I32Vector2 characterPos{rect.x + xAdvance + glyphData->metrics.bearing.x, rect.y + glyphData->metrics.bearing.y - m_contentRect.height};
-        m_characterInfos.push_back({glyphData->ch, {characterPos.x, characterPos.y, glyphData->metrics.size.width, glyphData->metrics.size.height}});
+        I32Vector2 characterPos{rect.x + xAdvance + glyphMetrics->bearing.x, rect.y + glyphMetrics->bearing.y - m_contentRect.height};
+        m_characterInfos.push_back({ch, {characterPos.x, characterPos.y, glyphMetrics->size.width, glyphMetrics->size.height}});
         
-        yMin = std::min(yMin, characterPos.y - glyphData->metrics.size.height);
+        yMin = std::min(yMin, characterPos.y - glyphMetrics->size.height);
         yMax = std::max(yMax, characterPos.y);
-        yMaxBearing = std::max(yMaxBearing, glyphData->metrics.bearing.y);
+        yMaxBearing = std::max(yMaxBearing, glyphMetrics->bearing.y);
         
-        xAdvance += glyphData->metrics.advance.x;
+        xAdvance += glyphMetrics->advance.x;
         m_characterStartIndex += 1;
     }
 
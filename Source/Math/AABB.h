@@ -0,0 +1,142 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include "Core/Simd.h"
+
+#include "Matrix4x4.h"
+#include "Vector3.h"
+
+namespace tg
+{
+
+/**
+ * @brief   The axis aligned bounding box.
+ */
+struct AABB final
+{
+/**@section Constructor */
+public:
+    constexpr AABB() noexcept = default;
+    constexpr AABB(const Vector3& min, const Vector3& max) noexcept;
+
+/**@section Operator */
+public:
+    constexpr bool operator==(const AABB& rhs) const noexcept;
+    constexpr bool operator!=(const AABB& rhs) const noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Creates the box from the center and the half size.
+     */
+    [[nodiscard]] static constexpr AABB FromCenterExtent(const Vector3& center, const Vector3& extent) noexcept;
+    [[nodiscard]] constexpr Vector3 GetCenter() const noexcept;
+
+    /**
+     * @brief   Gets the half size of the box.
+     */
+    [[nodiscard]] constexpr Vector3 GetExtent() const noexcept;
+    [[nodiscard]] constexpr Vector3 GetSize() const noexcept;
+    [[nodiscard]] bool Contains(const Vector3& point) const noexcept;
+    [[nodiscard]] bool Contains(const AABB& rhs) const noexcept;
+    [[nodiscard]] bool Intersect(const AABB& rhs) const noexcept;
+
+    /**
+     * @brief   Grows the box to contain the point.
+     */
+    void Encapsulate(const Vector3& point) noexcept;
+
+    /**
+     * @brief   Gets the smallest box which contains this box transformed by the matrix.
+     * @param matrix    The affine transform matrix.
+     */
+    [[nodiscard]] AABB Transformed(const Matrix4x4& matrix) const noexcept;
+
+/**@section Variable */
+public:
+    Vector3 min;
+    Vector3 max;
+};
+
+constexpr AABB::AABB(const Vector3& min, const Vector3& max) noexcept :
+    min(min),
+    max(max)
+{
+}
+
+constexpr bool AABB::operator==(const AABB& rhs) const noexcept
+{
+    return min == rhs.min && max == rhs.max;
+}
+
+constexpr bool AABB::operator!=(const AABB& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+constexpr AABB AABB::FromCenterExtent(const Vector3& center, const Vector3& extent) noexcept
+{
+    return AABB(center - extent, center + extent);
+}
+
+constexpr Vector3 AABB::GetCenter() const noexcept
+{
+    return (min + max) * 0.5f;
+}
+
+constexpr Vector3 AABB::GetExtent() const noexcept
+{
+    return (max - min) * 0.5f;
+}
+
+constexpr Vector3 AABB::GetSize() const noexcept
+{
+    return max - min;
+}
+
+inline bool AABB::Contains(const Vector3& point) const noexcept
+{
+    const auto p = Float4::Set(point.x, point.y, point.z, 0.0f);
+    const auto outside = Float4::CompareLess(p, Float4::Set(min.x, min.y, min.z, 0.0f)) | Float4::CompareLess(Float4::Set(max.x, max.y, max.z, 0.0f), p);
+    return outside.GetSignMask() == 0;
+}
+
+inline bool AABB::Contains(const AABB& rhs) const noexcept
+{
+    const auto outside = Float4::CompareLess(Float4::Set(rhs.min.x, rhs.min.y, rhs.min.z, 0.0f), Float4::Set(min.x, min.y, min.z, 0.0f)) |
+                         Float4::CompareLess(Float4::Set(max.x, max.y, max.z, 0.0f), Float4::Set(rhs.max.x, rhs.max.y, rhs.max.z, 0.0f));
+    return outside.GetSignMask() == 0;
+}
+
+inline bool AABB::Intersect(const AABB& rhs) const noexcept
+{
+    const auto separated = Float4::CompareLess(Float4::Set(max.x, max.y, max.z, 0.0f), Float4::Set(rhs.min.x, rhs.min.y, rhs.min.z, 0.0f)) |
+                           Float4::CompareLess(Float4::Set(rhs.max.x, rhs.max.y, rhs.max.z, 0.0f), Float4::Set(min.x, min.y, min.z, 0.0f));
+    return separated.GetSignMask() == 0;
+}
+
+inline void AABB::Encapsulate(const Vector3& point) noexcept
+{
+    min = Vector3(std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z));
+    max = Vector3(std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z));
+}
+
+inline AABB AABB::Transformed(const Matrix4x4& matrix) const noexcept
+{
+    // Transform the center, and project the extent onto the axes with the absolute rotation.
+    const auto center = GetCenter();
+    const auto extent = GetExtent();
+    const Vector3 transformedCenter(
+        center.x * matrix.m00 + center.y * matrix.m10 + center.z * matrix.m20 + matrix.m30,
+        center.x * matrix.m01 + center.y * matrix.m11 + center.z * matrix.m21 + matrix.m31,
+        center.x * matrix.m02 + center.y * matrix.m12 + center.z * matrix.m22 + matrix.m32);
+    const Vector3 transformedExtent(
+        extent.x * std::abs(matrix.m00) + extent.y * std::abs(matrix.m10) + extent.z * std::abs(matrix.m20),
+        extent.x * std::abs(matrix.m01) + extent.y * std::abs(matrix.m11) + extent.z * std::abs(matrix.m21),
+        extent.x * std::abs(matrix.m02) + extent.y * std::abs(matrix.m12) + extent.z * std::abs(matrix.m22));
+    return FromCenterExtent(transformedCenter, transformedExtent);
+}
+
+}
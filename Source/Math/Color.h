@@ -5,7 +5,9 @@
 #include <span>
 
 #include "Core/ExpressionTemplates.h"
+#include "Core/Simd.h"
 
+#include "Color32.h"
 #include "Mathf.h"
 
 namespace tg
@@ -51,6 +53,11 @@ public:
     [[nodiscard]] static constexpr Color Yellow() noexcept;
     [[nodiscard]] constexpr float Grayscale() const noexcept;
     [[nodiscard]] constexpr float GetMaxColorComponent() const noexcept;
+
+    /**
+     * @brief   Converts the components to UNORM8, which are clamped to [0, 1] and rounded to the nearest even.
+     */
+    [[nodiscard]] Color32 ToColor32() const noexcept;
     int32_t ToString(const std::span<char8_t>& destStr) const;
     int32_t ToString(char8_t* destStr, size_t destStrBufferLen) const;
     [[nodiscard]] std::u8string ToString() const;
@@ -191,52 +198,43 @@ constexpr float Color::GetMaxColorComponent() const noexcept
     return Mathf::Max(r, g, b, a);
 }
 
+inline Color32 Color::ToColor32() const noexcept
+{
+    auto toUnorm8 = [](float value) { return static_cast<uint8_t>(std::nearbyint(std::clamp(value, 0.0f, 1.0f) * 255.0f)); };
+    return Color32(toUnorm8(r), toUnorm8(g), toUnorm8(b), toUnorm8(a));
+}
+
 inline Color& Color::operator+=(const Color& rhs) noexcept
 {
-    r += rhs.r;
-    g += rhs.g;
-    b += rhs.b;
-    a += rhs.a;
+    (Float4::Load(&r) + Float4::Load(&rhs.r)).Store(&r);
 
     return *this;
 }
 
 inline Color& Color::operator-=(const Color& rhs) noexcept
 {
-    r -= rhs.r;
-    g -= rhs.g;
-    b -= rhs.b;
-    a -= rhs.a;
+    (Float4::Load(&r) - Float4::Load(&rhs.r)).Store(&r);
 
     return *this;
 }
 
 inline Color& Color::operator*=(const Color& rhs) noexcept
 {
-    r *= rhs.r;
-    g *= rhs.g;
-    b *= rhs.b;
-    a *= rhs.a;
+    (Float4::Load(&r) * Float4::Load(&rhs.r)).Store(&r);
 
     return *this;
 }
 
 inline Color& Color::operator*=(float rhs) noexcept
 {
-    r *= rhs;
-    g *= rhs;
-    b *= rhs;
-    a *= rhs;
+    (Float4::Load(&r) * Float4::Splat(rhs)).Store(&r);
 
     return *this;
 }
 
 inline Color& Color::operator/=(float rhs)
 {
-    r /= rhs;
-    g /= rhs;
-    b /= rhs;
-    a /= rhs;
+    (Float4::Load(&r) / Float4::Splat(rhs)).Store(&r);
 
     return *this;
 }
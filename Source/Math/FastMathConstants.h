@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+
+namespace tg
+{
+
+/**
+ * @brief   The coefficients which are shared by the scalar and the vectorized approximations of Mathf.
+ * @remark  The polynomials are minimax fits by the Remez algorithm. It only holds the constant data, so the translation
+ *          units which are built with the extended instruction sets can include it.
+ */
+struct FastMathConstants final
+{
+/**@section Constructor */
+public:
+    FastMathConstants() = delete;
+
+/**@section Variable */
+public:
+    /**
+     * @brief   Adding it rounds the floats whose magnitude is below 2^22 to the integer, which is left in the low bits.
+     */
+    static constexpr float RoundingMagic = 12582912.0f;
+    static constexpr int32_t RoundingMagicBits = 0x4B400000;
+    static constexpr float InversePi = 0.318309886f;
+
+    /**
+     * @brief   PI and half PI split into three parts. The first parts have only eight significant bits, so multiplying
+     *          them by the quadrant is exact for the quadrants below 2^16.
+     */
+    static constexpr float PiParts[3] = {3.140625f, 9.67502593994140625e-4f, 1.509957990978376432e-7f};
+    static constexpr float HalfPiParts[3] = {1.5703125f, 4.837512969970703125e-4f, 7.54978995489188216e-8f};
+
+    /**
+     * @brief   sin(r) = r + r^3 * P(r^2) on [-PI/2, PI/2].
+     */
+    static constexpr float Sin[4] = {-1.66666596e-1f, 8.33306625e-3f, -1.98096029e-4f, 2.60578064e-6f};
+
+    /**
+     * @brief   atan(a) = a * P(a^2) on [0, 1].
+     */
+    static constexpr float Atan[6] = {9.99977219e-1f, -3.32622828e-1f, 1.93540376e-1f, -1.16426481e-1f, 5.26473507e-2f, -1.17191355e-2f};
+
+    /**
+     * @brief   2^f = P(f) on [-0.5, 0.5]. The constant term is exactly 1, so the integral powers are exact.
+     */
+    static constexpr float Exp2[6] = {1.0f, 6.93146978e-1f, 2.40222421e-1f, 5.55073372e-2f, 9.67151305e-3f, 1.32647406e-3f};
+
+    /**
+     * @brief   log2(1 + t) = t * P(t) on [sqrt(0.5) - 1, sqrt(2) - 1].
+     */
+    static constexpr float Log2[7] = {1.44269973f, -7.21375871e-1f, 4.80465034e-1f, -3.58961851e-1f, 2.97262587e-1f, -2.72697926e-1f, 1.70634504e-1f};
+
+    /**
+     * @brief   The bits of sqrt(0.5). Subtracting it from the bits of a float splits the float into the exponent and the
+     *          mantissa in [sqrt(0.5), sqrt(2)).
+     */
+    static constexpr int32_t HalfSqrt2Bits = 0x3F3504F3;
+    static constexpr float Log2E = 1.44269504f;
+    static constexpr float Ln2 = 0.693147181f;
+};
+
+}
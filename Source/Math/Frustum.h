@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+
+#include "Core/Simd.h"
+
+#include "AABB.h"
+#include "Matrix4x4.h"
+#include "Plane.h"
+#include "Sphere.h"
+
+namespace tg
+{
+
+/**
+ * @brief   The volume which is bounded by six planes whose normals face inward.
+ */
+struct Frustum final
+{
+/**@section Method */
+public:
+    /**
+     * @brief   Extracts the planes from the view projection matrix.
+     * @param viewProjection    The matrix which transforms the row vectors from the world space to the clip space.
+     * @remark  The near plane is taken at z = -w, so the frustum is exact for the [-1, 1] depth range and slightly
+     *          conservative for the [0, 1] depth range.
+     */
+    [[nodiscard]] static Frustum FromMatrix(const Matrix4x4& viewProjection) noexcept;
+    [[nodiscard]] bool Contains(const Vector3& point) const noexcept;
+
+    /**
+     * @brief   Tests whether the sphere is possibly visible.
+     * @remark  It's conservative, so a few spheres around the corners pass even though they are outside.
+     */
+    [[nodiscard]] bool Intersect(const Sphere& sphere) const noexcept;
+
+    /**
+     * @brief   Tests whether the box is possibly visible.
+     * @remark  It's conservative, so a few boxes around the corners pass even though they are outside.
+     */
+    [[nodiscard]] bool Intersect(const AABB& box) const noexcept;
+
+private:
+    /**
+     * @brief   Computes the signed distances of the point to the planes plus the offset.
+     * @param firstDistances    The distances to the left, right, bottom and top planes.
+     * @param secondDistances   The distances to the near, far, near and far planes.
+     */
+    void GetDistances(const Vector3& point, const Vector3& offset, Float4& firstDistances, Float4& secondDistances) const noexcept;
+
+/**@section Variable */
+public:
+    /**
+     * @brief   The left, right, bottom, top, near and far planes.
+     */
+    std::array<Plane, 6> planes;
+};
+
+inline Frustum Frustum::FromMatrix(const Matrix4x4& viewProjection) noexcept
+{
+    // The clip coordinates are the dot products with the columns, and every plane bounds one of them by w.
+    const auto& m = viewProjection;
+    const Vector3 xs(m.m00, m.m10, m.m20), ys(m.m01, m.m11, m.m21), zs(m.m02, m.m12, m.m22), ws(m.m03, m.m13, m.m23);
+
+    Frustum ret;
+    ret.planes[0] = Plane(ws + xs, m.m33 + m.m30);
+    ret.planes[1] = Plane(ws - xs, m.m33 - m.m30);
+    ret.planes[2] = Plane(ws + ys, m.m33 + m.m31);
+    ret.planes[3] = Plane(ws - ys, m.m33 - m.m31);
+    ret.planes[4] = Plane(ws + zs, m.m33 + m.m32);
+    ret.planes[5] = Plane(ws - zs, m.m33 - m.m32);
+    for (auto& plane : ret.planes)
+    {
+        plane.Normalize();
+    }
+    return ret;
+}
+
+inline void Frustum::GetDistances(const Vector3& point, const Vector3& offset, Float4& firstDistances, Float4& secondDistances) const noexcept
+{
+    const auto& p = planes;
+    const auto x = Float4::Splat(point.x), y = Float4::Splat(point.y), z = Float4::Splat(point.z);
+
+    // The offset is dotted with the absolute normals, which moves the point toward the inside of every plane.
+    auto computeDistances = [&](const Plane& a, const Plane& b, const Plane& c, const Plane& d)
+    {
+        const auto nx = Float4::Set(a.normal.x, b.normal.x, c.normal.x, d.normal.x);
+        const auto ny = Float4::Set(a.normal.y, b.normal.y, c.normal.y, d.normal.y);
+        const auto nz = Float4::Set(a.normal.z, b.normal.z, c.normal.z, d.normal.z);
+        auto ret = Float4::MultiplyAdd(x, nx, Float4::Set(a.distance, b.distance, c.distance, d.distance));
+        ret = Float4::MultiplyAdd(y, ny, ret);
+        ret = Float4::MultiplyAdd(z, nz, ret);
+        ret = Float4::MultiplyAdd(Float4::Splat(offset.x), Float4::Abs(nx), ret);
+        ret = Float4::MultiplyAdd(Float4::Splat(offset.y), Float4::Abs(ny), ret);
+        return Float4::MultiplyAdd(Float4::Splat(offset.z), Float4::Abs(nz), ret);
+    };
+    firstDistances = computeDistances(p[0], p[1], p[2], p[3]);
+    secondDistances = computeDistances(p[4], p[5], p[4], p[5]);
+}
+
+inline bool Frustum::Contains(const Vector3& point) const noexcept
+{
+    Float4 firstDistances, secondDistances;
+    this->GetDistances(point, Vector3(), firstDistances, secondDistances);
+    return Float4::CompareLess(Float4::Min(firstDistances, secondDistances), Float4::Zero()).GetSignMask() == 0;
+}
+
+inline bool Frustum::Intersect(const Sphere& sphere) const noexcept
+{
+    Float4 firstDistances, secondDistances;
+    this->GetDistances(sphere.center, Vector3(), firstDistances, secondDistances);
+    return Float4::CompareLess(Float4::Min(firstDistances, secondDistances), Float4::Splat(-sphere.radius)).GetSignMask() == 0;
+}
+
+inline bool Frustum::Intersect(const AABB& box) const noexcept
+{
+    Float4 firstDistances, secondDistances;
+    this->GetDistances(box.GetCenter(), box.GetExtent(), firstDistances, secondDistances);
+    return Float4::CompareLess(Float4::Min(firstDistances, secondDistances), Float4::Zero()).GetSignMask() == 0;
+}
+
+}
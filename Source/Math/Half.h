@@ -0,0 +1,190 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+#include "Vector2.h"
+#include "Vector4.h"
+
+namespace tg
+{
+
+/**
+ * @brief   The IEEE 754 binary16 float, which keeps 11 significant bits in the range of about [-65504, 65504].
+ * @remark  It's meant for storage such as the vertex attributes and the animation curves. Convert it to float for arithmetic.
+ */
+struct Half final
+{
+/**@section Constructor */
+public:
+    constexpr Half() noexcept = default;
+
+    /**
+     * @brief   Rounds the value to the nearest half. The values which are too large become infinity.
+     */
+    explicit constexpr Half(float value) noexcept;
+
+/**@section Operator */
+public:
+    constexpr operator float() const noexcept;
+    constexpr bool operator==(const Half& rhs) const noexcept;
+    constexpr bool operator!=(const Half& rhs) const noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] static constexpr Half FromBits(uint16_t bits) noexcept;
+    [[nodiscard]] static constexpr uint16_t ConvertFromFloat(float value) noexcept;
+    [[nodiscard]] static constexpr float ConvertToFloat(uint16_t bits) noexcept;
+
+/**@section Variable */
+public:
+    uint16_t bits{};
+};
+
+struct Half2 final
+{
+/**@section Constructor */
+public:
+    constexpr Half2() noexcept = default;
+    constexpr Half2(float x, float y) noexcept;
+    explicit constexpr Half2(const Vector2& value) noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] constexpr Vector2 ToVector2() const noexcept;
+
+/**@section Variable */
+public:
+    Half x;
+    Half y;
+};
+
+struct Half4 final
+{
+/**@section Constructor */
+public:
+    constexpr Half4() noexcept = default;
+    constexpr Half4(float x, float y, float z, float w) noexcept;
+    explicit constexpr Half4(const Vector4& value) noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] constexpr Vector4 ToVector4() const noexcept;
+
+/**@section Variable */
+public:
+    Half x;
+    Half y;
+    Half z;
+    Half w;
+};
+
+constexpr Half::Half(float value) noexcept :
+    bits(ConvertFromFloat(value))
+{
+}
+
+constexpr Half::operator float() const noexcept
+{
+    return ConvertToFloat(bits);
+}
+
+constexpr bool Half::operator==(const Half& rhs) const noexcept
+{
+    return static_cast<float>(*this) == static_cast<float>(rhs);
+}
+
+constexpr bool Half::operator!=(const Half& rhs) const noexcept
+{
+    return !this->operator==(rhs);
+}
+
+constexpr Half Half::FromBits(uint16_t bits) noexcept
+{
+    Half ret;
+    ret.bits = bits;
+    return ret;
+}
+
+constexpr uint16_t Half::ConvertFromFloat(float value) noexcept
+{
+    const auto bits = std::bit_cast<uint32_t>(value);
+    const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    const auto absBits = bits & 0x7FFFFFFFu;
+
+    // The floats of 2^16 or more overflow, and NaN stays a quiet NaN.
+    if (absBits >= (127u + 16u) << 23)
+    {
+        return sign | (absBits > 0x7F800000u ? 0x7E00u : 0x7C00u);
+    }
+
+    // Adding the magic number aligns the mantissa to the subnormal half, and the float addition rounds it to the
+    // nearest even.
+    if (absBits < 113u << 23)
+    {
+        constexpr uint32_t denormalMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+        const auto alignedBits = std::bit_cast<uint32_t>(std::bit_cast<float>(absBits) + std::bit_cast<float>(denormalMagic));
+        return sign | static_cast<uint16_t>(alignedBits - denormalMagic);
+    }
+
+    // Rebias the exponent and round the dropped 13 bits to the nearest even.
+    const auto mantissaOdd = (absBits >> 13) & 1u;
+    return sign | static_cast<uint16_t>((absBits - ((127u - 15u) << 23) + 0xFFFu + mantissaOdd) >> 13);
+}
+
+constexpr float Half::ConvertToFloat(uint16_t bits) noexcept
+{
+    constexpr uint32_t shiftedExponent = 0x7C00u << 13;
+    auto ret = (bits & 0x7FFFu) << 13;
+    const auto exponent = ret & shiftedExponent;
+    ret += (127u - 15u) << 23;
+
+    if (exponent == shiftedExponent)
+    {
+        // Infinity and NaN keep the maximum exponent.
+        ret += (128u - 16u) << 23;
+    }
+    else if (exponent == 0)
+    {
+        // Renormalize the subnormal half by the float subtraction.
+        ret = std::bit_cast<uint32_t>(std::bit_cast<float>(ret + (1u << 23)) - std::bit_cast<float>(113u << 23));
+    }
+
+    return std::bit_cast<float>(ret | ((bits & 0x8000u) << 16));
+}
+
+constexpr Half2::Half2(float x, float y) noexcept :
+    x(x),
+    y(y)
+{
+}
+
+constexpr Half2::Half2(const Vector2& value) noexcept :
+    Half2(value.x, value.y)
+{
+}
+
+constexpr Vector2 Half2::ToVector2() const noexcept
+{
+    return Vector2(x, y);
+}
+
+constexpr Half4::Half4(float x, float y, float z, float w) noexcept :
+    x(x),
+    y(y),
+    z(z),
+    w(w)
+{
+}
+
+constexpr Half4::Half4(const Vector4& value) noexcept :
+    Half4(value.x, value.y, value.z, value.w)
+{
+}
+
+constexpr Vector4 Half4::ToVector4() const noexcept
+{
+    return Vector4(x, y, z, w);
+}
+
+}
@@ -1,9 +1,14 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
+#include <cfloat>
 #include <cmath>
 #include <numeric>
 
+#include "Core/Simd.h"
+
+#include "FastMathConstants.h"
 #include "Vector3.h"
 
 namespace tg
@@ -60,6 +65,73 @@ public:
     static constexpr _Value LerpUnclamped(const _Value& from, const _Value& to, float time) noexcept;
     static constexpr float SmoothStep(float from, float to, float time) noexcept;
 
+    /**
+     * @brief   Approximates sin by a minimax polynomial after reducing the angle to [-PI/2, PI/2].
+     * @remark  The absolute error is below 1.5e-7 for |value| < 8192. The error grows with the magnitude after that, and
+     *          the angles of 2^22 or more give meaningless results.
+     */
+    static float FastSin(float value) noexcept;
+
+    /**
+     * @brief   Approximates cos in the same way as FastSin, with the same error bounds.
+     */
+    static float FastCos(float value) noexcept;
+
+    /**
+     * @brief   Approximates atan2 by a minimax polynomial on [0, 1] and the octant symmetries.
+     * @remark  The absolute error is below 2.5e-6 radians for the finite inputs. atan2(0, 0) is 0 and the sign of the zero x
+     *          isn't taken into account.
+     */
+    static float FastAtan2(float y, float x) noexcept;
+
+    /**
+     * @brief   Approximates 1 / sqrt(value) by the hardware estimate refined with one Newton-Raphson step.
+     * @remark  The relative error is below 5e-7 on x86 and 3e-5 on ARM, whose estimate is coarser. The value must be a
+     *          positive normal float.
+     */
+    static float FastInverseSqrt(float value) noexcept;
+
+    /**
+     * @brief   Approximates sqrt(value) by value * FastInverseSqrt(value). The error bound is the same as FastInverseSqrt.
+     * @remark  It returns 0 for the values below FLT_MIN. A single sqrt instruction is about as fast, so it mostly pays off
+     *          in VectorKernels::FastSqrt.
+     */
+    static float FastSqrt(float value) noexcept;
+
+    /**
+     * @brief   Approximates 2^value by a minimax polynomial on [-0.5, 0.5] scaled by the power of two in the exponent bits.
+     * @remark  The relative error is below 3e-7. It returns 0 below -126 and saturates to a finite value above 127.
+     */
+    static float FastExp2(float value) noexcept;
+
+    /**
+     * @brief   Approximates log2 by a minimax polynomial on the mantissa in [sqrt(0.5), sqrt(2)).
+     * @remark  The error is below 5e-7 * max(1, |log2(value)|). The value must be a positive normal float.
+     */
+    static float FastLog2(float value) noexcept;
+
+    /**
+     * @brief   Approximates e^value by FastExp2.
+     * @remark  The relative error is below 4e-7 + |value| * 8e-8, because the rounding of the scaled power is magnified
+     *          by the exponent.
+     */
+    static float FastExp(float value) noexcept;
+
+    /**
+     * @brief   Approximates the natural logarithm by FastLog2. The error is below 4e-7 * max(1, |log(value)|).
+     */
+    static float FastLog(float value) noexcept;
+
+    /**
+     * @brief   Approximates value^p by FastExp2(p * FastLog2(value)).
+     * @remark  The relative error is below 3e-7 + |p| * 3.5e-7 * max(1, |log2(value)|). The value must be a positive normal
+     *          float.
+     */
+    static float FastPow(float value, float p) noexcept;
+
+private:
+    static float EvaluateSinPolynomial(float value) noexcept;
+
 /**@section Variable */
 public:
     static constexpr float PI = 3.14159274f;
@@ -245,4 +317,106 @@ constexpr float Mathf::SmoothStep(float from, float to, float time) noexcept
     return t * t * (3.0f - (2.0f * t));
 }
 
+inline float Mathf::EvaluateSinPolynomial(float value) noexcept
+{
+    const auto& c = FastMathConstants::Sin;
+    const float s = value * value;
+    const float p = ((c[3] * s + c[2]) * s + c[1]) * s + c[0];
+    return (value * s) * p + value;
+}
+
+inline float Mathf::FastSin(float value) noexcept
+{
+    // Subtract the nearest multiple of PI. Its parity is left in the lowest bit, which flips the sign.
+    const float biased = value * FastMathConstants::InversePi + FastMathConstants::RoundingMagic;
+    const float k = biased - FastMathConstants::RoundingMagic;
+    float r = value - k * FastMathConstants::PiParts[0];
+    r = r - k * FastMathConstants::PiParts[1];
+    r = r - k * FastMathConstants::PiParts[2];
+
+    const auto sign = std::bit_cast<uint32_t>(biased) << 31;
+    return std::bit_cast<float>(std::bit_cast<uint32_t>(EvaluateSinPolynomial(r)) ^ sign);
+}
+
+inline float Mathf::FastCos(float value) noexcept
+{
+    // cos(x) = -(-1)^k * sin(x - (k + 0.5) * PI), where k is the nearest integer of x / PI - 0.5.
+    const float biased = (value * FastMathConstants::InversePi - 0.5f) + FastMathConstants::RoundingMagic;
+    const float k = (biased - FastMathConstants::RoundingMagic) * 2.0f + 1.0f;
+    float r = value - k * FastMathConstants::HalfPiParts[0];
+    r = r - k * FastMathConstants::HalfPiParts[1];
+    r = r - k * FastMathConstants::HalfPiParts[2];
+
+    const auto sign = (std::bit_cast<uint32_t>(biased) << 31) ^ 0x80000000u;
+    return std::bit_cast<float>(std::bit_cast<uint32_t>(EvaluateSinPolynomial(r)) ^ sign);
+}
+
+inline float Mathf::FastAtan2(float y, float x) noexcept
+{
+    const float absY = std::abs(y), absX = std::abs(x);
+    const float a = std::min(absX, absY) / std::max(std::max(absX, absY), FLT_MIN);
+    const float s = a * a;
+
+    const auto& c = FastMathConstants::Atan;
+    float ret = a * (((((c[5] * s + c[4]) * s + c[3]) * s + c[2]) * s + c[1]) * s + c[0]);
+    ret = absY > absX ? (PI * 0.5f) - ret : ret;
+    ret = x < 0.0f ? PI - ret : ret;
+    return std::copysign(ret, y);
+}
+
+inline float Mathf::FastInverseSqrt(float value) noexcept
+{
+    const float estimate = Float4::ReciprocalSqrtEstimate(Float4::Splat(value)).GetX();
+    return estimate * (1.5f - (0.5f * value) * (estimate * estimate));
+}
+
+inline float Mathf::FastSqrt(float value) noexcept
+{
+    return value < FLT_MIN ? 0.0f : value * FastInverseSqrt(value);
+}
+
+inline float Mathf::FastExp2(float value) noexcept
+{
+    if (value < -126.0f)
+    {
+        return 0.0f;
+    }
+
+    // The upper bound keeps the rounded exponent at 127, which is the largest one of the finite floats.
+    const float clampedValue = std::min(value, 127.4999f);
+    const float biased = clampedValue + FastMathConstants::RoundingMagic;
+    const float f = clampedValue - (biased - FastMathConstants::RoundingMagic);
+
+    const auto& c = FastMathConstants::Exp2;
+    const float p = ((((c[5] * f + c[4]) * f + c[3]) * f + c[2]) * f + c[1]) * f + c[0];
+    const auto scale = std::bit_cast<float>((std::bit_cast<int32_t>(biased) - FastMathConstants::RoundingMagicBits + 127) << 23);
+    return p * scale;
+}
+
+inline float Mathf::FastLog2(float value) noexcept
+{
+    const auto bits = std::bit_cast<int32_t>(value);
+    const int32_t exponent = (bits - FastMathConstants::HalfSqrt2Bits) >> 23;
+    const float t = std::bit_cast<float>(bits - (exponent << 23)) - 1.0f;
+
+    const auto& c = FastMathConstants::Log2;
+    const float p = (((((c[6] * t + c[5]) * t + c[4]) * t + c[3]) * t + c[2]) * t + c[1]) * t + c[0];
+    return t * p + static_cast<float>(exponent);
+}
+
+inline float Mathf::FastExp(float value) noexcept
+{
+    return FastExp2(value * FastMathConstants::Log2E);
+}
+
+inline float Mathf::FastLog(float value) noexcept
+{
+    return FastLog2(value) * FastMathConstants::Ln2;
+}
+
+inline float Mathf::FastPow(float value, float p) noexcept
+{
+    return FastExp2(FastLog2(value) * p);
+}
+
 }
@@ -1,36 +1,57 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
-#include <cassert>
 #include <cmath>
+#include <span>
 
+#include "Core/Simd.h"
+
+#include "Matrix3x4Kernels.h"
+#include "Matrix4x4.h"
 #include "Vector3.h"
 
 namespace tg
 {
 
+/**
+ * @brief   The affine matrix which takes 48 bytes instead of the 64 bytes of Matrix4x4.
+ * @remark  The rows are the first three columns of the equivalent Matrix4x4, so each row fits in a Float4 and m03, m13
+ *          and m23 hold the translation. It still follows the row vector convention of Matrix4x4: a * b applies a first,
+ *          and its product costs 36 multiplications instead of 64. Expand it to Matrix4x4 only when it's combined with a
+ *          projection.
+ */
 struct alignas(16) Matrix3x4
 {
 /**@section Constructor */
 public:
     constexpr Matrix3x4() noexcept;
-    constexpr Matrix3x4(float m00, float m01, float m02,
-                        float m10, float m11, float m12,
-                        float m20, float m21, float m22,
-                        float m30, float m31, float m32) noexcept;
+    constexpr Matrix3x4(float m00, float m01, float m02, float m03,
+                        float m10, float m11, float m12, float m13,
+                        float m20, float m21, float m22, float m23) noexcept;
+
+    /**
+     * @brief   Drops the last column of the matrix, which must be (0, 0, 0, 1).
+     */
+    explicit Matrix3x4(const Matrix4x4& matrix) noexcept;
 
 /**@section Operator */
 public:
-    Matrix3x4 operator+(const Matrix3x4&) const noexcept;
-    Matrix3x4 operator-(const Matrix3x4&) const noexcept;
-    Matrix3x4 operator*(const Matrix3x4&) const noexcept;
-    Matrix3x4& operator+=(const Matrix3x4&) noexcept;
-    Matrix3x4& operator-=(const Matrix3x4&) noexcept;
-    Matrix3x4& operator*=(const Matrix3x4&) noexcept;
-    constexpr bool operator==(const Matrix3x4&) const noexcept;
-    constexpr bool operator!=(const Matrix3x4&) const noexcept;
-    float& operator[](std::size_t index);
-    float operator[](std::size_t index) const;
+    Matrix3x4 operator+(const Matrix3x4& rhs) const noexcept;
+    Matrix3x4 operator-(const Matrix3x4& rhs) const noexcept;
+    Matrix3x4 operator*(const Matrix3x4& rhs) const noexcept;
+
+    /**
+     * @brief   Combines the matrix with the matrix which may not be affine, such as the view projection matrix.
+     */
+    Matrix4x4 operator*(const Matrix4x4& rhs) const noexcept;
+    Matrix3x4& operator+=(const Matrix3x4& rhs) noexcept;
+    Matrix3x4& operator-=(const Matrix3x4& rhs) noexcept;
+    Matrix3x4& operator*=(const Matrix3x4& rhs) noexcept;
+    constexpr bool operator==(const Matrix3x4& rhs) const noexcept;
+    constexpr bool operator!=(const Matrix3x4& rhs) const noexcept;
+    float& operator[](int32_t index);
+    float operator[](int32_t index) const;
 
 /**@section Method */
 public:
@@ -41,348 +62,293 @@ public:
     [[nodiscard]] static Matrix3x4 RotateX(float radian) noexcept;
     [[nodiscard]] static Matrix3x4 RotateY(float radian) noexcept;
     [[nodiscard]] static Matrix3x4 RotateZ(float radian) noexcept;
-    [[nodiscard]] static constexpr  Matrix3x4 Scale(float x, float y, float z) noexcept;
-    //static constexpr const Matrix4x3 Transposed(const Matrix3x4& matrix) noexcept;
-    [[nodiscard]] static constexpr Matrix3x4 Inverse();
+    [[nodiscard]] static constexpr Matrix3x4 Scale(float x, float y, float z) noexcept;
+
+    /**
+     * @brief   Inverts the matrix.
+     * @param matrix    The matrix to invert.
+     * @return  The inverted matrix. It's undefined if the matrix is singular.
+     */
+    [[nodiscard]] static Matrix3x4 Inverse(const Matrix3x4& matrix) noexcept;
     [[nodiscard]] static Matrix3x4 LookAtLH(const Vector3& eyePt, const Vector3& lookAt, const Vector3& up) noexcept;
     [[nodiscard]] static Matrix3x4 LookAtRH(const Vector3& eyePt, const Vector3& lookAt, const Vector3& up) noexcept;
-    [[nodiscard]] static Matrix3x4 PerspectiveLH(float fovy, float aspect, float nearZ, float farZ) noexcept;
-    [[nodiscard]] static Matrix3x4 PerspectiveRH(float fovy, float aspect, float nearZ, float farZ) noexcept;
-    [[nodiscard]] static constexpr Matrix3x4 OrthographicRH(float left, float right, float top, float bottom, float nearZ, float farZ) noexcept;
-    [[nodiscard]] static constexpr Matrix3x4 Viewport(float x, float y, float width, float height, float minZ, float maxZ) noexcept;
-    int32_t ToString(const std::span<char>& destStr) const;
-    int32_t ToString(char* destStr, std::size_t destStrBufferLen) const;
-    [[nodiscard]] std::string ToString() const;
+    [[nodiscard]] static Matrix3x4 OrthographicRH(float left, float right, float top, float bottom, float nearZ, float farZ) noexcept;
+    [[nodiscard]] static Matrix3x4 Viewport(float x, float y, float width, float height, float minZ, float maxZ) noexcept;
+    [[nodiscard]] Vector3 TransformPoint(const Vector3& point) const noexcept;
+
+    /**
+     * @brief   Transforms the direction, which ignores the translation.
+     */
+    [[nodiscard]] Vector3 TransformDirection(const Vector3& direction) const noexcept;
+    [[nodiscard]] Vector3 GetTranslation() const noexcept;
+    [[nodiscard]] Matrix4x4 ToMatrix4x4() const noexcept;
+    int32_t ToString(const std::span<char8_t>& destStr) const;
+    int32_t ToString(char8_t* destStr, size_t destStrBufferLen) const;
+    [[nodiscard]] std::u8string ToString() const;
 
 /**@section Variable */
 public:
-    float m00, m01, m02,
-          m10, m11, m12,
-          m20, m21, m22,
-          m30, m31, m32;
+    float m00, m01, m02, m03,
+          m10, m11, m12, m13,
+          m20, m21, m22, m23;
 };
 
 constexpr Matrix3x4::Matrix3x4() noexcept :
-    m00(1.0f), m01(0.0f), m02(0.0f),
-    m10(0.0f), m11(1.0f), m12(0.0f),
-    m20(0.0f), m21(0.0f), m22(1.0f),
-    m30(0.0f), m31(0.0f), m32(0.0f)
+    m00(1.0f), m01(0.0f), m02(0.0f), m03(0.0f),
+    m10(0.0f), m11(1.0f), m12(0.0f), m13(0.0f),
+    m20(0.0f), m21(0.0f), m22(1.0f), m23(0.0f)
 {
 }
 
-constexpr Matrix3x4::Matrix3x4(float m00, float m01, float m02,
-                               float m10, float m11, float m12,
-                               float m20, float m21, float m22,
-                               float m30, float m31, float m32) noexcept :
-    m00(m00), m01(m01), m02(m02),
-    m10(m10), m11(m11), m12(m12),
-    m20(m20), m21(m21), m22(m22),
-    m30(m30), m31(m31), m32(m32)
+constexpr Matrix3x4::Matrix3x4(float m00, float m01, float m02, float m03,
+                               float m10, float m11, float m12, float m13,
+                               float m20, float m21, float m22, float m23) noexcept :
+    m00(m00), m01(m01), m02(m02), m03(m03),
+    m10(m10), m11(m11), m12(m12), m13(m13),
+    m20(m20), m21(m21), m22(m22), m23(m23)
 {
 }
 
-inline Matrix3x4 Matrix3x4::operator-(const Matrix3x4& rhs) const noexcept
+inline Matrix3x4::Matrix3x4(const Matrix4x4& matrix) noexcept
 {
-    return Matrix3x4(
-        m00 - rhs.m00, m01 - rhs.m01, m02 - rhs.m02,
-        m10 - rhs.m10, m11 - rhs.m11, m12 - rhs.m12,
-        m20 - rhs.m20, m21 - rhs.m21, m22 - rhs.m22,
-        m30 - rhs.m30, m31 - rhs.m31, m32 - rhs.m32
-    );
+    auto row0 = Float4::Load(&matrix.m00);
+    auto row1 = Float4::Load(&matrix.m10);
+    auto row2 = Float4::Load(&matrix.m20);
+    auto row3 = Float4::Load(&matrix.m30);
+    Float4::Transpose(row0, row1, row2, row3);
+
+    row0.Store(&m00);
+    row1.Store(&m10);
+    row2.Store(&m20);
 }
 
-inline Matrix3x4 Matrix3x4::operator*(const Matrix3x4& rhs) const noexcept
+inline Matrix3x4 Matrix3x4::operator+(const Matrix3x4& rhs) const noexcept
 {
-    return Matrix3x4(
-        (m00 * rhs.m00) + (m01 * rhs.m10) + (m02 * rhs.m20),
-        (m00 * rhs.m01) + (m01 * rhs.m11) + (m02 * rhs.m21),
-        (m00 * rhs.m02) + (m01 * rhs.m12) + (m02 * rhs.m22),
+    Matrix3x4 ret;
+    (Float4::Load(&m00) + Float4::Load(&rhs.m00)).Store(&ret.m00);
+    (Float4::Load(&m10) + Float4::Load(&rhs.m10)).Store(&ret.m10);
+    (Float4::Load(&m20) + Float4::Load(&rhs.m20)).Store(&ret.m20);
+    return ret;
+}
 
-        (m10 * rhs.m00) + (m11 * rhs.m10) + (m12 * rhs.m20),
-        (m10 * rhs.m01) + (m11 * rhs.m11) + (m12 * rhs.m21),
-        (m10 * rhs.m02) + (m11 * rhs.m12) + (m12 * rhs.m22),
+inline Matrix3x4 Matrix3x4::operator-(const Matrix3x4& rhs) const noexcept
+{
+    Matrix3x4 ret;
+    (Float4::Load(&m00) - Float4::Load(&rhs.m00)).Store(&ret.m00);
+    (Float4::Load(&m10) - Float4::Load(&rhs.m10)).Store(&ret.m10);
+    (Float4::Load(&m20) - Float4::Load(&rhs.m20)).Store(&ret.m20);
+    return ret;
+}
 
-        (m20 * rhs.m00) + (m21 * rhs.m10) + (m22 * rhs.m20),
-        (m20 * rhs.m01) + (m21 * rhs.m11) + (m22 * rhs.m21),
-        (m20 * rhs.m02) + (m21 * rhs.m12) + (m22 * rhs.m22),
+inline Matrix3x4 Matrix3x4::operator*(const Matrix3x4& rhs) const noexcept
+{
+    Matrix3x4 ret;
+    MultiplyMatrix3x4(&m00, &rhs.m00, &ret.m00);
+    return ret;
+}
 
-        (m30 * rhs.m00) + (m31 * rhs.m10) + (m32 * rhs.m20),
-        (m30 * rhs.m01) + (m31 * rhs.m11) + (m32 * rhs.m21),
-        (m30 * rhs.m02) + (m31 * rhs.m12) + (m32 * rhs.m22)
-    );
+inline Matrix4x4 Matrix3x4::operator*(const Matrix4x4& rhs) const noexcept
+{
+    const auto rhs0 = Float4::Load(&rhs.m00);
+    const auto rhs1 = Float4::Load(&rhs.m10);
+    const auto rhs2 = Float4::Load(&rhs.m20);
+    const auto rhs3 = Float4::Load(&rhs.m30);
+    const auto row0 = Float4::Load(&m00);
+    const auto row1 = Float4::Load(&m10);
+    const auto row2 = Float4::Load(&m20);
+
+    // The row N of the expanded matrix is the lane N of the rows, and the last row also has the implicit 1.
+    Matrix4x4 ret;
+    auto combineRows = [&](const Float4& x, const Float4& y, const Float4& z, const Float4& w)
+    {
+        auto row = Float4::MultiplyAdd(x, rhs0, w);
+        row = Float4::MultiplyAdd(y, rhs1, row);
+        return Float4::MultiplyAdd(z, rhs2, row);
+    };
+    combineRows(row0.Broadcast<0>(), row1.Broadcast<0>(), row2.Broadcast<0>(), Float4::Zero()).Store(&ret.m00);
+    combineRows(row0.Broadcast<1>(), row1.Broadcast<1>(), row2.Broadcast<1>(), Float4::Zero()).Store(&ret.m10);
+    combineRows(row0.Broadcast<2>(), row1.Broadcast<2>(), row2.Broadcast<2>(), Float4::Zero()).Store(&ret.m20);
+    combineRows(row0.Broadcast<3>(), row1.Broadcast<3>(), row2.Broadcast<3>(), rhs3).Store(&ret.m30);
+    return ret;
 }
 
 inline Matrix3x4& Matrix3x4::operator+=(const Matrix3x4& rhs) noexcept
 {
-    m00 += rhs.m00; m01 += rhs.m01; m02 += rhs.m02;
-    m10 += rhs.m10; m11 += rhs.m11; m12 += rhs.m12;
-    m20 += rhs.m20; m21 += rhs.m21; m22 += rhs.m22;
-    m30 += rhs.m30; m31 += rhs.m31; m32 += rhs.m32;
-
+    *this = *this + rhs;
     return *this;
 }
 
 inline Matrix3x4& Matrix3x4::operator-=(const Matrix3x4& rhs) noexcept
 {
-    m00 -= rhs.m00; m01 -= rhs.m01; m02 -= rhs.m02;
-    m10 -= rhs.m10; m11 -= rhs.m11; m12 -= rhs.m12;
-    m20 -= rhs.m20; m21 -= rhs.m21; m22 -= rhs.m22;
-    m30 -= rhs.m30; m31 -= rhs.m31; m32 -= rhs.m32;
-
+    *this = *this - rhs;
     return *this;
 }
 
-inline Matrix3x4 Matrix3x4::LookAtLH(const Vector3& eyePt, const Vector3& lookAt, const Vector3& up) noexcept
+inline Matrix3x4& Matrix3x4::operator*=(const Matrix3x4& rhs) noexcept
 {
-    Vector3 l = lookAt - eyePt;
-    l.Normalize();
-    
-    Vector3 r = Vector3::Cross(up, l);
-    r.Normalize();
-
-    Vector3 u = Vector3::Cross(l, r);
-    u.Normalize();
-
-    return Matrix3x4(
-        r.x, u.x, l.x,
-        r.y, u.y, l.y,
-        r.z, u.z, l.z,
-        -Vector3::Dot(r, eyePt), -Vector3::Dot(u, eyePt), -Vector3::Dot(l, eyePt)
-    );
+    MultiplyMatrix3x4(&m00, &rhs.m00, &m00);
+    return *this;
 }
 
-inline Matrix3x4 Matrix3x4::LookAtRH(const Vector3& eyePt, const Vector3& lookAt, const Vector3& up) noexcept
+constexpr bool Matrix3x4::operator==(const Matrix3x4& rhs) const noexcept
 {
-    Vector3 l = lookAt - eyePt;
-    l.Normalize();
-
-    Vector3 r = Vector3::Cross(l, up);
-    r.Normalize();
-
-    Vector3 u = Vector3::Cross(r, l);
-    u.Normalize();
-    
-    return Matrix3x4(
-        r.x, u.x, -l.x,
-        r.y, u.y, -l.y,
-        r.z, u.z, -l.z,
-        -Vector3::Dot(r, eyePt), -Vector3::Dot(u, eyePt), Vector3::Dot(l, eyePt)
-    );
+    return m00 == rhs.m00 && m01 == rhs.m01 && m02 == rhs.m02 && m03 == rhs.m03 &&
+           m10 == rhs.m10 && m11 == rhs.m11 && m12 == rhs.m12 && m13 == rhs.m13 &&
+           m20 == rhs.m20 && m21 == rhs.m21 && m22 == rhs.m22 && m23 == rhs.m23;
 }
 
-inline Matrix3x4 Matrix3x4::PerspectiveLH(float fovy, float aspect, float nearZ, float farZ) noexcept
+constexpr bool Matrix3x4::operator!=(const Matrix3x4& rhs) const noexcept
 {
-    const auto scaleY = 1.0f / std::tan(fovy * 0.5f);
-    const auto scaleX = scaleY / aspect;
-
-    return Matrix3x4(
-        scaleX, 0.0f,   0.0f,
-        0.0f,   scaleY, 0.0f,
-        0.0f,   0.0f,   farZ / (farZ - nearZ),
-        0.0f,   0.0f,   -(farZ * nearZ) / (farZ - nearZ)
-    );
+    return !this->operator==(rhs);
 }
 
-inline Matrix3x4 Matrix3x4::PerspectiveRH(float fovy, float aspect, float nearZ, float farZ) noexcept
+inline float& Matrix3x4::operator[](int32_t index)
 {
-    const auto scaleY = 1.0f / std::tan(fovy * 0.5f);
-    const auto scaleX = scaleY / aspect;
-
-    return Matrix3x4(
-        scaleX, 0.0f,   0.0f,
-        0.0f,   scaleY, 0.0f,
-        0.0f,   0.0f,   farZ / (nearZ - farZ),
-        0.0f,   0.0f,   -(farZ * nearZ) / (farZ - nearZ)
-    );
+    return *(&m00 + index);
 }
-    
-constexpr Matrix3x4 Matrix3x4::OrthographicRH(float left, float right, float top, float bottom, float nearZ, float farZ) noexcept
+
+inline float Matrix3x4::operator[](int32_t index) const
 {
-    const auto width = right - left;
-    const auto height = bottom - top;
-    const auto depth = farZ - nearZ;
-    
-    return Matrix3x4(
-        2 / width,  0.0f,           0.0f,
-        0.0f,       2 / height,     0.0f,
-        0.0f,       0.0f,           -2.0f / depth,
-        -(right + left) / width,    -(top + bottom) / height,   -(farZ + nearZ) / depth
-    );
+    return *(&m00 + index);
 }
 
-constexpr Matrix3x4 Matrix3x4::Viewport(float x, float y, float width, float height, float minZ, float maxZ) noexcept
+constexpr Matrix3x4 Matrix3x4::Identity() noexcept
 {
-    const auto halfWidth = width * 0.5f;
-    const auto halfHeight = height * 0.5f;
+    return Matrix3x4();
+}
 
+constexpr Matrix3x4 Matrix3x4::Zero() noexcept
+{
     return Matrix3x4(
-        halfWidth,      0.0f,           0.0f,
-        0.0f,           -halfHeight,    0.0f,
-        0.0f,           0.0f,           maxZ - minZ,
-        x + halfWidth,  y + halfHeight, minZ
+        0.0f,   0.0f,   0.0f,   0.0f,
+        0.0f,   0.0f,   0.0f,   0.0f,
+        0.0f,   0.0f,   0.0f,   0.0f
     );
 }
 
-inline Matrix3x4 Matrix3x4::operator+(const Matrix3x4& rhs) const noexcept
+constexpr Matrix3x4 Matrix3x4::Translate(float x, float y, float z) noexcept
 {
     return Matrix3x4(
-        m00 + rhs.m00, m01 + rhs.m01, m02 + rhs.m02,
-        m10 + rhs.m10, m11 + rhs.m11, m12 + rhs.m12,
-        m20 + rhs.m20, m21 + rhs.m21, m22 + rhs.m22,
-        m30 + rhs.m30, m31 + rhs.m31, m32 + rhs.m32
+        1.0f,   0.0f,   0.0f,   x,
+        0.0f,   1.0f,   0.0f,   y,
+        0.0f,   0.0f,   1.0f,   z
     );
 }
 
-inline Matrix3x4& Matrix3x4::operator*=(const Matrix3x4& rhs) noexcept
+inline Matrix3x4 Matrix3x4::Rotate(float yaw, float pitch, float roll) noexcept
 {
-    *this = (*this) * rhs;
-    return *this;
+    return Matrix3x4(Matrix4x4::Rotate(yaw, pitch, roll));
 }
 
-constexpr bool Matrix3x4::operator==(const Matrix3x4& rhs) const noexcept
+inline Matrix3x4 Matrix3x4::RotateX(float radian) noexcept
 {
-    for (int32_t i = 0; i < 12; ++i)
-    {
-        if ((&(m00))[i] != (&(rhs.m00))[i])
-        {
-            return false;
-        }
-    }
-    return true;
+    return Matrix3x4(Matrix4x4::RotateX(radian));
 }
 
-constexpr bool Matrix3x4::operator!=(const Matrix3x4& rhs) const noexcept
+inline Matrix3x4 Matrix3x4::RotateY(float radian) noexcept
 {
-    return !this->operator==(rhs);
+    return Matrix3x4(Matrix4x4::RotateY(radian));
 }
 
-inline float& Matrix3x4::operator[](std::size_t index)
+inline Matrix3x4 Matrix3x4::RotateZ(float radian) noexcept
 {
-    return *(&m00 + index);
+    return Matrix3x4(Matrix4x4::RotateZ(radian));
 }
 
-inline float Matrix3x4::operator[](std::size_t index) const
+constexpr Matrix3x4 Matrix3x4::Scale(float x, float y, float z) noexcept
 {
-    return const_cast<decltype(this)>(this)->operator[](index);
+    return Matrix3x4(
+        x,      0.0f,   0.0f,   0.0f,
+        0.0f,   y,      0.0f,   0.0f,
+        0.0f,   0.0f,   z,      0.0f
+    );
 }
 
-constexpr Matrix3x4 Matrix3x4::Translate(float x, float y, float z) noexcept
+inline Matrix3x4 Matrix3x4::Inverse(const Matrix3x4& matrix) noexcept
 {
-    return Matrix3x4(
-        1.0f,   0.0f,   0.0f,
-        0.0f,   1.0f,   0.0f,
-        0.0f,   0.0f,   1.0f,
-        x,      y,      z
-    );
+    Matrix3x4 ret;
+    InverseMatrix3x4(&matrix.m00, &ret.m00);
+    return ret;
 }
 
-constexpr Matrix3x4 Matrix3x4::Identity() noexcept
+inline Matrix3x4 Matrix3x4::LookAtLH(const Vector3& eyePt, const Vector3& lookAt, const Vector3& up) noexcept
 {
-    return Matrix3x4(
-        1.0f,   0.0f,   0.0f,
-        0.0f,   1.0f,   0.0f,
-        0.0f,   0.0f,   1.0f,
-        0.0f,   0.0f,   0.0f
-    );
+    return Matrix3x4(Matrix4x4::LookAtLH(eyePt, lookAt, up));
 }
 
-constexpr Matrix3x4 Matrix3x4::Zero() noexcept
+inline Matrix3x4 Matrix3x4::LookAtRH(const Vector3& eyePt, const Vector3& lookAt, const Vector3& up) noexcept
 {
-    return Matrix3x4(
-        0.0f,   0.0f,   0.0f,
-        0.0f,   0.0f,   0.0f,
-        0.0f,   0.0f,   0.0f,
-        0.0f,   0.0f,   0.0f
-    );
+    return Matrix3x4(Matrix4x4::LookAtRH(eyePt, lookAt, up));
 }
 
-inline Matrix3x4 Matrix3x4::Rotate(float yaw, float pitch, float roll) noexcept
+inline Matrix3x4 Matrix3x4::OrthographicRH(float left, float right, float top, float bottom, float nearZ, float farZ) noexcept
 {
-    const auto cosA = std::cos(yaw);
-    const auto sinA = std::sin(yaw);
-    
-    const auto cosB = std::cos(pitch);
-    const auto sinB = std::sin(pitch);
-    
-    const auto cosC = std::cos(roll);
-    const auto sinC = std::sin(roll);
-    
-    return Matrix3x4(
-        cosB * cosC,                            cosB * -sinC,                           sinB,
-        (sinA * sinB * cosC) + (cosA * sinC),   (sinA * sinB * -sinC) + (cosA * cosC),  -sinA * cosB,
-        (cosA * -sinB * cosC) + (sinA * sinC),  (cosA * sinB * sinC) + (sinA * cosC),   cosA * cosB,
-        0.0f,   0.0f,   0.0f
-    );
+    return Matrix3x4(Matrix4x4::OrthographicRH(left, right, top, bottom, nearZ, farZ));
 }
 
-inline Matrix3x4 Matrix3x4::RotateX(float radian) noexcept
+inline Matrix3x4 Matrix3x4::Viewport(float x, float y, float width, float height, float minZ, float maxZ) noexcept
 {
-    const auto cosA = std::cos(radian);
-    const auto sinA = std::sin(radian);
+    return Matrix3x4(Matrix4x4::Viewport(x, y, width, height, minZ, maxZ));
+}
 
-    return Matrix3x4(
-        1.0f,   0.0f,   0.0f,
-        0.0f,   cosA,   -sinA,
-        0.0f,   sinA,   cosA,
-        0.0f,   0.0f,   0.0f
+inline Vector3 Matrix3x4::TransformPoint(const Vector3& point) const noexcept
+{
+    return Vector3(
+        m00 * point.x + m01 * point.y + m02 * point.z + m03,
+        m10 * point.x + m11 * point.y + m12 * point.z + m13,
+        m20 * point.x + m21 * point.y + m22 * point.z + m23
     );
 }
 
-inline Matrix3x4 Matrix3x4::RotateY(float radian) noexcept
+inline Vector3 Matrix3x4::TransformDirection(const Vector3& direction) const noexcept
 {
-    const auto cosA = std::cos(radian);
-    const auto sinA = std::sin(radian);
-
-    return Matrix3x4(
-        cosA,   0.0f,   sinA,
-        0.0f,   1.0f,   0.0f,
-        -sinA,  0.0f,   cosA,
-        0.0f,   0.0f,   0.0f
+    return Vector3(
+        m00 * direction.x + m01 * direction.y + m02 * direction.z,
+        m10 * direction.x + m11 * direction.y + m12 * direction.z,
+        m20 * direction.x + m21 * direction.y + m22 * direction.z
     );
 }
 
-inline Matrix3x4 Matrix3x4::RotateZ(float radian) noexcept
+inline Vector3 Matrix3x4::GetTranslation() const noexcept
 {
-    const auto cosA = std::cos(radian);
-    const auto sinA = std::sin(radian);
-
-    return Matrix3x4(
-        cosA,   -sinA,   0.0f,
-        sinA,   cosA,   0.0f,
-        0.0f,   0.0f,   1.0f,
-        0.0f,   0.0f,   0.0f
-    );
+    return Vector3(m03, m13, m23);
 }
 
-constexpr Matrix3x4 Matrix3x4::Scale(float x, float y, float z) noexcept
+inline Matrix4x4 Matrix3x4::ToMatrix4x4() const noexcept
 {
-    return Matrix3x4(
-        x,      0.0f,   0.0f,
-        0.0f,   y,      0.0f,
-        0.0f,   0.0f,   z,
-        0.0f,   0.0f,   0.0f
-    );
+    auto row0 = Float4::Load(&m00);
+    auto row1 = Float4::Load(&m10);
+    auto row2 = Float4::Load(&m20);
+    auto row3 = Float4::Set(0.0f, 0.0f, 0.0f, 1.0f);
+    Float4::Transpose(row0, row1, row2, row3);
+
+    Matrix4x4 ret;
+    row0.Store(&ret.m00);
+    row1.Store(&ret.m10);
+    row2.Store(&ret.m20);
+    row3.Store(&ret.m30);
+    return ret;
 }
 
-inline int32_t Matrix3x4::ToString(const std::span<char>& destStr) const
+inline int32_t Matrix3x4::ToString(const std::span<char8_t>& destStr) const
 {
     return this->ToString(&destStr[0], destStr.size());
 }
 
-inline int32_t Matrix3x4::ToString(char* destStr, std::size_t destStrBufferLen) const
+inline int32_t Matrix3x4::ToString(char8_t* destStr, size_t destStrBufferLen) const
 {
-    const auto destStrLen = fmt::format_to_n(destStr, sizeof(destStr[0]) * (destStrBufferLen - 1), "{}\t\t{}\t\t{}\n{}\t\t{}\t\t{}\n{}\t\t{}\t\t{}\n{}\t\t{}\t\t{}", m00, m01, m02, m10, m11, m12, m20, m21, m22, m30, m31, m32).size;
+    const auto destStrLen = fmt::format_to_n(destStr, sizeof(destStr[0]) * (destStrBufferLen - 1), "{}\t\t{}\t\t{}\t\t{}\n{}\t\t{}\t\t{}\t\t{}\n{}\t\t{}\t\t{}\t\t{}", m00, m01, m02, m03, m10, m11, m12, m13, m20, m21, m22, m23).size;
     destStr[destStrLen] = u8'\0';
 
     return static_cast<int32_t>(destStrLen);
 }
 
-inline std::string Matrix3x4::ToString() const
+inline std::u8string Matrix3x4::ToString() const
 {
-    std::array<char, 2048> str{};
-    const auto strLen = this->ToString(str);
+    std::array<char8_t, 2048> str{};
+    const int32_t strLen = this->ToString(str);
 
     return {&str[0], static_cast<size_t>(strLen)};
 }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Core/Simd.h"
+
+// The kernels only depend on Simd.h, so they can also be built into the translation units which are selected at runtime.
+namespace tg
+{
+inline namespace TGON_SIMD_NAMESPACE
+{
+
+/**
+ * @brief   Concatenates the affine matrices, so the result applies lhs first and rhs next.
+ * @param lhs   The first matrix whose rows are the transposed columns of the equivalent Matrix4x4.
+ * @param rhs   The second matrix.
+ * @param dest  The concatenated matrix. It can be the same as lhs or rhs.
+ */
+inline void MultiplyMatrix3x4(const float* lhs, const float* rhs, float* dest) noexcept
+{
+    const auto lhs0 = Float4::Load(&lhs[0]);
+    const auto lhs1 = Float4::Load(&lhs[4]);
+    const auto lhs2 = Float4::Load(&lhs[8]);
+    const auto rhs0 = Float4::Load(&rhs[0]);
+    const auto rhs1 = Float4::Load(&rhs[4]);
+    const auto rhs2 = Float4::Load(&rhs[8]);
+
+    // Each row of rhs combines the rows of lhs, and keeps its own translation in the w lane.
+    const auto translationMask = Int4::Set(0, 0, 0, -1).AsFloat4();
+    auto multiplyRow = [&](const Float4& row)
+    {
+        auto ret = Float4::MultiplyAdd(row.Broadcast<0>(), lhs0, row & translationMask);
+        ret = Float4::MultiplyAdd(row.Broadcast<1>(), lhs1, ret);
+        return Float4::MultiplyAdd(row.Broadcast<2>(), lhs2, ret);
+    };
+
+    multiplyRow(rhs0).Store(&dest[0]);
+    multiplyRow(rhs1).Store(&dest[4]);
+    multiplyRow(rhs2).Store(&dest[8]);
+}
+
+/**
+ * @brief   Inverts the affine matrix.
+ * @param src   The matrix to invert.
+ * @param dest  The inverted matrix. It can be the same as src.
+ * @remark  The result is undefined if the matrix is singular.
+ */
+inline void InverseMatrix3x4(const float* src, float* dest) noexcept
+{
+    const auto row0 = Float4::Load(&src[0]);
+    const auto row1 = Float4::Load(&src[4]);
+    const auto row2 = Float4::Load(&src[8]);
+
+    // The columns of the inverted 3x3 part are the cross products of the other two rows divided by the determinant. The w
+    // lane of the cross product isn't exactly zero once the compiler contracts it into an FMA, so the determinant only sums
+    // the xyz lanes to keep the translation out of it.
+    const auto cofactor0 = Float4::Cross3(row1, row2);
+    const auto xyzMask = Int4::Set(-1, -1, -1, 0).AsFloat4();
+    const auto reciprocal = Float4::Splat(1.0f) / Float4::Splat(((row0 * cofactor0) & xyzMask).HorizontalSum());
+
+    auto column0 = cofactor0 * reciprocal;
+    auto column1 = Float4::Cross3(row2, row0) * reciprocal;
+    auto column2 = Float4::Cross3(row0, row1) * reciprocal;
+
+    // The translation is moved back by the inverted 3x3 part.
+    auto translation = row0.Broadcast<3>() * column0;
+    translation = Float4::MultiplyAdd(row1.Broadcast<3>(), column1, translation);
+    translation = Float4::MultiplyAdd(row2.Broadcast<3>(), column2, translation);
+    translation = Float4::Zero() - translation;
+
+    Float4::Transpose(column0, column1, column2, translation);
+    column0.Store(&dest[0]);
+    column1.Store(&dest[4]);
+    column2.Store(&dest[8]);
+}
+
+}
+}
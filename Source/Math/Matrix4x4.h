@@ -7,6 +7,7 @@
 
 #include "Core/Simd.h"
 
+#include "Matrix4x4Kernels.h"
 #include "Vector3.h"
 
 namespace tg
@@ -50,7 +51,37 @@ public:
     [[nodiscard]] static Matrix4x4 Scale(float x, float y, float z) noexcept;
     [[nodiscard]] static Matrix4x4 Transposed(const Matrix4x4& matrix) noexcept;
     void Transpose() noexcept;
-    [[nodiscard]] static Matrix4x4 Inverse();
+
+    /**
+     * @brief   Inverts the matrix.
+     * @param matrix    The matrix to invert.
+     * @return  The inverted matrix. It's undefined if the matrix is singular.
+     */
+    [[nodiscard]] static Matrix4x4 Inverse(const Matrix4x4& matrix) noexcept;
+
+    /**
+     * @brief   Inverts the affine matrix such as a translation, rotation and scale matrix.
+     * @param matrix    The matrix whose last column is (0, 0, 0, 1).
+     * @return  The inverted matrix. It's undefined if the matrix is singular.
+     */
+    [[nodiscard]] static Matrix4x4 AffineInverse(const Matrix4x4& matrix) noexcept;
+
+    /**
+     * @brief   Computes the inverse transpose of the upper 3x3 part, which transforms the normals.
+     * @param matrix    The matrix whose last column is (0, 0, 0, 1).
+     * @return  The inverse transpose matrix without translation.
+     */
+    [[nodiscard]] static Matrix4x4 InverseTranspose(const Matrix4x4& matrix) noexcept;
+
+    /**
+     * @brief   Decomposes the matrix into translation, rotation and scale.
+     * @param matrix        The matrix which is composed as scale * rotation * translation.
+     * @param translation   The translation of the matrix.
+     * @param rotation      The rotation matrix.
+     * @param scale         The scale of the matrix. The x is negative if the matrix mirrors.
+     * @return  False if the matrix has a zero scale.
+     */
+    static bool Decompose(const Matrix4x4& matrix, Vector3& translation, Matrix4x4& rotation, Vector3& scale) noexcept;
     [[nodiscard]] static Matrix4x4 LookAtLH(const Vector3& eyePt, const Vector3& lookAt, const Vector3& up) noexcept;
     [[nodiscard]] static Matrix4x4 LookAtRH(const Vector3& eyePt, const Vector3& lookAt, const Vector3& up) noexcept;
     [[nodiscard]] static Matrix4x4 PerspectiveLH(float fovy, float aspect, float nearZ, float farZ) noexcept;
@@ -130,41 +161,28 @@ constexpr ExpressionTemplates<Subtract, Matrix4x4, Matrix4x4> Matrix4x4::operato
 inline Matrix4x4 Matrix4x4::operator*(const Matrix4x4& rhs) const noexcept
 {
 #if TGON_SIMD_SSE2
-    Matrix4x4 ret;
-    auto r0 = _mm_loadu_ps(&rhs.m00);
-    auto r1 = _mm_loadu_ps(&rhs.m10);
-    auto r2 = _mm_loadu_ps(&rhs.m20);
-    auto r3 = _mm_loadu_ps(&rhs.m30);
-
-    auto l = _mm_loadu_ps(&m00);
-    r0 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(0, 0, 0, 0)), r0);
-    r1 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(1, 1, 1, 1)), r1);
-    r2 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(2, 2, 2, 2)), r2);
-    r3 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(3, 3, 3, 3)), r3);
-    _mm_storeu_ps(&ret.m00, _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
-
-    l = _mm_loadu_ps(&m10);
-    r0 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(0, 0, 0, 0)), r0);
-    r1 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(1, 1, 1, 1)), r1);
-    r2 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(2, 2, 2, 2)), r2);
-    r3 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(3, 3, 3, 3)), r3);
-    _mm_storeu_ps(&ret.m10, _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
-
-    l = _mm_loadu_ps(&m20);
-    r0 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(0, 0, 0, 0)), r0);
-    r1 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(1, 1, 1, 1)), r1);
-    r2 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(2, 2, 2, 2)), r2);
-    r3 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(3, 3, 3, 3)), r3);
-    _mm_storeu_ps(&ret.m20, _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
-
-    l = _mm_loadu_ps(&m30);
-    r0 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(0, 0, 0, 0)), r0);
-    r1 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(1, 1, 1, 1)), r1);
-    r2 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(2, 2, 2, 2)), r2);
-    r3 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(3, 3, 3, 3)), r3);
-    _mm_storeu_ps(&ret.m30, _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
+    const auto r0 = _mm_loadu_ps(&rhs.m00);
+    const auto r1 = _mm_loadu_ps(&rhs.m10);
+    const auto r2 = _mm_loadu_ps(&rhs.m20);
+    const auto r3 = _mm_loadu_ps(&rhs.m30);
 
-    return *this;
+    // Each row of the product combines the rows of rhs by the elements of the same row, so the rows of rhs must be kept.
+    auto multiplyRow = [&](const float* row, float* dest)
+    {
+        const auto l = _mm_loadu_ps(row);
+        const auto p0 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+        const auto p1 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(1, 1, 1, 1)), r1);
+        const auto p2 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(2, 2, 2, 2)), r2);
+        const auto p3 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(3, 3, 3, 3)), r3);
+        _mm_storeu_ps(dest, _mm_add_ps(_mm_add_ps(p0, p1), _mm_add_ps(p2, p3)));
+    };
+
+    Matrix4x4 ret;
+    multiplyRow(&m00, &ret.m00);
+    multiplyRow(&m10, &ret.m10);
+    multiplyRow(&m20, &ret.m20);
+    multiplyRow(&m30, &ret.m30);
+    return ret;
 #else
     return Matrix4x4(
         (m00 * rhs.m00) + (m01 * rhs.m10) + (m02 * rhs.m20) + (m03 * rhs.m30),
@@ -370,62 +388,8 @@ inline void Matrix4x4::Transpose() noexcept
 
 inline Matrix4x4& Matrix4x4::operator*=(const Matrix4x4& rhs) noexcept
 {
-#if TGON_SIMD_SSE2
-    auto r0 = _mm_loadu_ps(&rhs.m00);
-    auto r1 = _mm_loadu_ps(&rhs.m10);
-    auto r2 = _mm_loadu_ps(&rhs.m20);
-    auto r3 = _mm_loadu_ps(&rhs.m30);
-
-    auto l = _mm_loadu_ps(&m00);
-    r0 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(0, 0, 0, 0)), r0);
-    r1 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(1, 1, 1, 1)), r1);
-    r2 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(2, 2, 2, 2)), r2);
-    r3 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(3, 3, 3, 3)), r3);
-    _mm_storeu_ps(&m00, _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
-
-    l = _mm_loadu_ps(&m10);
-    r0 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(0, 0, 0, 0)), r0);
-    r1 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(1, 1, 1, 1)), r1);
-    r2 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(2, 2, 2, 2)), r2);
-    r3 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(3, 3, 3, 3)), r3);
-    _mm_storeu_ps(&m10, _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
-
-    l = _mm_loadu_ps(&m20);
-    r0 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(0, 0, 0, 0)), r0);
-    r1 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(1, 1, 1, 1)), r1);
-    r2 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(2, 2, 2, 2)), r2);
-    r3 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(3, 3, 3, 3)), r3);
-    _mm_storeu_ps(&m20, _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
-
-    l = _mm_loadu_ps(&m30);
-    r0 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(0, 0, 0, 0)), r0);
-    r1 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(1, 1, 1, 1)), r1);
-    r2 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(2, 2, 2, 2)), r2);
-    r3 = _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(3, 3, 3, 3)), r3);
-    _mm_storeu_ps(&m30, _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
-#else
-    *this = Matrix4x4(
-        (m00 * rhs.m00) + (m01 * rhs.m10) + (m02 * rhs.m20) + (m03 * rhs.m30),
-        (m00 * rhs.m01) + (m01 * rhs.m11) + (m02 * rhs.m21) + (m03 * rhs.m31),
-        (m00 * rhs.m02) + (m01 * rhs.m12) + (m02 * rhs.m22) + (m03 * rhs.m32),
-        (m00 * rhs.m03) + (m01 * rhs.m13) + (m02 * rhs.m23) + (m03 * rhs.m33),
-
-        (m10 * rhs.m00) + (m11 * rhs.m10) + (m12 * rhs.m20) + (m13 * rhs.m30),
-        (m10 * rhs.m01) + (m11 * rhs.m11) + (m12 * rhs.m21) + (m13 * rhs.m31),
-        (m10 * rhs.m02) + (m11 * rhs.m12) + (m12 * rhs.m22) + (m13 * rhs.m32),
-        (m10 * rhs.m03) + (m11 * rhs.m13) + (m12 * rhs.m23) + (m13 * rhs.m33),
-
-        (m20 * rhs.m00) + (m21 * rhs.m10) + (m22 * rhs.m20) + (m23 * rhs.m30),
-        (m20 * rhs.m01) + (m21 * rhs.m11) + (m22 * rhs.m21) + (m23 * rhs.m31),
-        (m20 * rhs.m02) + (m21 * rhs.m12) + (m22 * rhs.m22) + (m23 * rhs.m32),
-        (m20 * rhs.m03) + (m21 * rhs.m13) + (m22 * rhs.m23) + (m23 * rhs.m33),
-
-        (m30 * rhs.m00) + (m31 * rhs.m10) + (m32 * rhs.m20) + (m33 * rhs.m30),
-        (m30 * rhs.m01) + (m31 * rhs.m11) + (m32 * rhs.m21) + (m33 * rhs.m31),
-        (m30 * rhs.m02) + (m31 * rhs.m12) + (m32 * rhs.m22) + (m33 * rhs.m32),
-        (m30 * rhs.m03) + (m31 * rhs.m13) + (m32 * rhs.m23) + (m33 * rhs.m33)
-    );
-#endif
+    // The product reads the whole matrix before it's stored, so it's safe even if rhs is this matrix.
+    *this = *this * rhs;
     return *this;
 }
 
@@ -453,7 +417,7 @@ inline float& Matrix4x4::operator[](int32_t index)
 
 inline float Matrix4x4::operator[](int32_t index) const
 {
-    return const_cast<decltype(this)>(this)->operator[](index);
+    return *(&m00 + index);
 }
 
 inline Matrix4x4 Matrix4x4::Translate(float x, float y, float z) noexcept
@@ -554,6 +518,66 @@ inline Matrix4x4 Matrix4x4::Scale(float x, float y, float z) noexcept
     );
 }
 
+inline Matrix4x4 Matrix4x4::Inverse(const Matrix4x4& matrix) noexcept
+{
+    Matrix4x4 ret;
+    InverseMatrix4x4(&matrix.m00, &ret.m00);
+    return ret;
+}
+
+inline Matrix4x4 Matrix4x4::AffineInverse(const Matrix4x4& matrix) noexcept
+{
+    Matrix4x4 ret;
+    AffineInverseMatrix4x4(&matrix.m00, &ret.m00);
+    return ret;
+}
+
+inline Matrix4x4 Matrix4x4::InverseTranspose(const Matrix4x4& matrix) noexcept
+{
+    Matrix4x4 ret;
+    InverseTransposeMatrix4x4(&matrix.m00, &ret.m00);
+    return ret;
+}
+
+inline bool Matrix4x4::Decompose(const Matrix4x4& matrix, Vector3& translation, Matrix4x4& rotation, Vector3& scale) noexcept
+{
+    const auto row0 = Float4::Load(&matrix.m00);
+    const auto row1 = Float4::Load(&matrix.m10);
+    const auto row2 = Float4::Load(&matrix.m20);
+
+    // Every row is an axis which is scaled, so the scale is the length of the row.
+    auto lengthSq0 = row0 * row0;
+    auto lengthSq1 = row1 * row1;
+    auto lengthSq2 = row2 * row2;
+    auto lengthSq3 = Float4::Zero();
+    Float4::Transpose(lengthSq0, lengthSq1, lengthSq2, lengthSq3);
+
+    auto scales = Float4::Sqrt(lengthSq0 + lengthSq1 + lengthSq2);
+    if (Float4::CompareLessEqual(scales, Float4::Splat(1e-6f)).GetSignMask() & 0x7)
+    {
+        return false;
+    }
+
+    // A negative determinant means that the matrix mirrors, which is assigned to the x axis.
+    if ((row0 * Float4::Cross3(row1, row2)).HorizontalSum() < 0.0f)
+    {
+        scales = scales * Float4::Set(-1.0f, 1.0f, 1.0f, 1.0f);
+    }
+
+    float scaleLanes[4];
+    scales.Store(scaleLanes);
+    scale = Vector3(scaleLanes[0], scaleLanes[1], scaleLanes[2]);
+    translation = Vector3(matrix.m30, matrix.m31, matrix.m32);
+
+    const auto reciprocal = Float4::Splat(1.0f) / scales;
+    (row0 * reciprocal.Broadcast<0>()).Store(&rotation.m00);
+    (row1 * reciprocal.Broadcast<1>()).Store(&rotation.m10);
+    (row2 * reciprocal.Broadcast<2>()).Store(&rotation.m20);
+    Float4::Set(0.0f, 0.0f, 0.0f, 1.0f).Store(&rotation.m30);
+
+    return true;
+}
+
 inline int32_t Matrix4x4::ToString(const std::span<char8_t>& destStr) const
 {
     return this->ToString(&destStr[0], destStr.size());
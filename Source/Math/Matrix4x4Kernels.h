@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Core/Simd.h"
+
+// The kernels only depend on Simd.h, so they can also be built into the translation units which are selected at runtime.
+namespace tg
+{
+inline namespace TGON_SIMD_NAMESPACE
+{
+
+/**
+ * @brief   Inverts the row-major 4x4 matrix by the block-wise inversion of its 2x2 sub-matrices.
+ * @param src   The matrix to invert.
+ * @param dest  The inverted matrix. It can be the same as src.
+ * @remark  The result is undefined if the matrix is singular.
+ */
+inline void InverseMatrix4x4(const float* src, float* dest) noexcept
+{
+    // The 2x2 matrices are packed as (m00, m01, m10, m11).
+    auto multiply = [](const Float4& lhs, const Float4& rhs)
+    {
+        return lhs * rhs.Shuffle<0, 3, 0, 3>() + lhs.Shuffle<1, 0, 3, 2>() * rhs.Shuffle<2, 1, 2, 1>();
+    };
+    auto adjugateMultiply = [](const Float4& lhs, const Float4& rhs)
+    {
+        return lhs.Shuffle<3, 3, 0, 0>() * rhs - lhs.Shuffle<1, 1, 2, 2>() * rhs.Shuffle<2, 3, 0, 1>();
+    };
+    auto multiplyAdjugate = [](const Float4& lhs, const Float4& rhs)
+    {
+        return lhs * rhs.Shuffle<3, 0, 3, 0>() - lhs.Shuffle<1, 0, 3, 2>() * rhs.Shuffle<2, 1, 2, 1>();
+    };
+
+    const auto row0 = Float4::Load(&src[0]);
+    const auto row1 = Float4::Load(&src[4]);
+    const auto row2 = Float4::Load(&src[8]);
+    const auto row3 = Float4::Load(&src[12]);
+
+    // Split the matrix into | A B |
+    //                       | C D |
+    const auto a = Float4::Shuffle<0, 1, 0, 1>(row0, row1);
+    const auto b = Float4::Shuffle<2, 3, 2, 3>(row0, row1);
+    const auto c = Float4::Shuffle<0, 1, 0, 1>(row2, row3);
+    const auto d = Float4::Shuffle<2, 3, 2, 3>(row2, row3);
+
+    const auto subDeterminants = Float4::Shuffle<0, 2, 0, 2>(row0, row2) * Float4::Shuffle<1, 3, 1, 3>(row1, row3) -
+                                 Float4::Shuffle<1, 3, 1, 3>(row0, row2) * Float4::Shuffle<0, 2, 0, 2>(row1, row3);
+    const auto determinantA = subDeterminants.Broadcast<0>();
+    const auto determinantB = subDeterminants.Broadcast<1>();
+    const auto determinantC = subDeterminants.Broadcast<2>();
+    const auto determinantD = subDeterminants.Broadcast<3>();
+
+    const auto adjugateDC = adjugateMultiply(d, c);
+    const auto adjugateAB = adjugateMultiply(a, b);
+    auto x = determinantD * a - multiply(b, adjugateDC);
+    auto y = determinantB * c - multiplyAdjugate(d, adjugateAB);
+    auto z = determinantC * b - multiplyAdjugate(a, adjugateDC);
+    auto w = determinantA * d - multiply(c, adjugateAB);
+
+    auto trace = adjugateAB * adjugateDC.Shuffle<0, 2, 1, 3>();
+    trace = trace + trace.Shuffle<1, 0, 3, 2>();
+    trace = trace + trace.Shuffle<2, 3, 0, 1>();
+    const auto determinant = determinantA * determinantD + determinantB * determinantC - trace;
+
+    // The signs of the adjugate are folded into the reciprocal of the determinant.
+    const auto reciprocal = Float4::Set(1.0f, -1.0f, -1.0f, 1.0f) / determinant;
+    x = x * reciprocal;
+    y = y * reciprocal;
+    z = z * reciprocal;
+    w = w * reciprocal;
+
+    Float4::Shuffle<3, 1, 3, 1>(x, y).Store(&dest[0]);
+    Float4::Shuffle<2, 0, 2, 0>(x, y).Store(&dest[4]);
+    Float4::Shuffle<3, 1, 3, 1>(z, w).Store(&dest[8]);
+    Float4::Shuffle<2, 0, 2, 0>(z, w).Store(&dest[12]);
+}
+
+/**
+ * @brief   Computes the inverse transpose of the upper 3x3 part, which transforms the normals.
+ * @param src   The affine matrix whose last column is (0, 0, 0, 1).
+ * @param dest  The inverse transpose matrix which has no translation. It can be the same as src.
+ */
+inline void InverseTransposeMatrix4x4(const float* src, float* dest) noexcept
+{
+    const auto row0 = Float4::Load(&src[0]);
+    const auto row1 = Float4::Load(&src[4]);
+    const auto row2 = Float4::Load(&src[8]);
+
+    // The rows of the inverse transpose are the cross products of the other two rows divided by the determinant.
+    const auto cofactor0 = Float4::Cross3(row1, row2);
+    const auto reciprocal = Float4::Splat(1.0f) / Float4::Splat((row0 * cofactor0).HorizontalSum());
+
+    (cofactor0 * reciprocal).Store(&dest[0]);
+    (Float4::Cross3(row2, row0) * reciprocal).Store(&dest[4]);
+    (Float4::Cross3(row0, row1) * reciprocal).Store(&dest[8]);
+    Float4::Set(0.0f, 0.0f, 0.0f, 1.0f).Store(&dest[12]);
+}
+
+/**
+ * @brief   Inverts the affine matrix, which is cheaper than the general inversion.
+ * @param src   The affine matrix whose last column is (0, 0, 0, 1).
+ * @param dest  The inverted matrix. It can be the same as src.
+ */
+inline void AffineInverseMatrix4x4(const float* src, float* dest) noexcept
+{
+    const auto row0 = Float4::Load(&src[0]);
+    const auto row1 = Float4::Load(&src[4]);
+    const auto row2 = Float4::Load(&src[8]);
+    const auto translation = Float4::Load(&src[12]);
+
+    const auto cofactor0 = Float4::Cross3(row1, row2);
+    const auto reciprocal = Float4::Splat(1.0f) / Float4::Splat((row0 * cofactor0).HorizontalSum());
+
+    auto inverse0 = cofactor0 * reciprocal;
+    auto inverse1 = Float4::Cross3(row2, row0) * reciprocal;
+    auto inverse2 = Float4::Cross3(row0, row1) * reciprocal;
+    auto inverse3 = Float4::Zero();
+    Float4::Transpose(inverse0, inverse1, inverse2, inverse3);
+
+    auto inverseTranslation = translation.Broadcast<0>() * inverse0;
+    inverseTranslation = Float4::MultiplyAdd(translation.Broadcast<1>(), inverse1, inverseTranslation);
+    inverseTranslation = Float4::MultiplyAdd(translation.Broadcast<2>(), inverse2, inverseTranslation);
+
+    inverse0.Store(&dest[0]);
+    inverse1.Store(&dest[4]);
+    inverse2.Store(&dest[8]);
+    (Float4::Set(0.0f, 0.0f, 0.0f, 1.0f) - inverseTranslation).Store(&dest[12]);
+}
+
+}
+}
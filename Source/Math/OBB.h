@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cmath>
+
+#include "AABB.h"
+#include "Quaternion.h"
+
+namespace tg
+{
+
+/**
+ * @brief   The oriented bounding box.
+ */
+struct OBB final
+{
+/**@section Constructor */
+public:
+    constexpr OBB() noexcept = default;
+    constexpr OBB(const Vector3& center, const Vector3& extent, const Quaternion& rotation) noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] bool Contains(const Vector3& point) const noexcept;
+
+    /**
+     * @brief   Tests the overlap by the separating axis theorem.
+     */
+    [[nodiscard]] bool Intersect(const OBB& rhs) const noexcept;
+
+    /**
+     * @brief   Gets the smallest axis aligned box which contains this box.
+     */
+    [[nodiscard]] AABB GetBounds() const noexcept;
+
+/**@section Variable */
+public:
+    Vector3 center;
+
+    /**
+     * @brief   The half size of the box along its local axes.
+     */
+    Vector3 extent;
+    Quaternion rotation;
+};
+
+constexpr OBB::OBB(const Vector3& center, const Vector3& extent, const Quaternion& rotation) noexcept :
+    center(center),
+    extent(extent),
+    rotation(rotation)
+{
+}
+
+inline bool OBB::Contains(const Vector3& point) const noexcept
+{
+    const auto localPoint = rotation.Conjugate().Rotate(point - center);
+    return std::abs(localPoint.x) <= extent.x && std::abs(localPoint.y) <= extent.y && std::abs(localPoint.z) <= extent.z;
+}
+
+inline bool OBB::Intersect(const OBB& rhs) const noexcept
+{
+    // The rows of the rotation matrices are the local axes.
+    const auto lhsMatrix = rotation.ToMatrix();
+    const auto rhsMatrix = rhs.rotation.ToMatrix();
+    const Vector3 lhsAxes[3] = {{lhsMatrix.m00, lhsMatrix.m01, lhsMatrix.m02}, {lhsMatrix.m10, lhsMatrix.m11, lhsMatrix.m12}, {lhsMatrix.m20, lhsMatrix.m21, lhsMatrix.m22}};
+    const Vector3 rhsAxes[3] = {{rhsMatrix.m00, rhsMatrix.m01, rhsMatrix.m02}, {rhsMatrix.m10, rhsMatrix.m11, rhsMatrix.m12}, {rhsMatrix.m20, rhsMatrix.m21, rhsMatrix.m22}};
+
+    // Express rhs in the frame of this box. The epsilon keeps the cross axes robust when the edges are nearly parallel.
+    float r[3][3], absR[3][3];
+    for (int32_t i = 0; i < 3; ++i)
+    {
+        for (int32_t j = 0; j < 3; ++j)
+        {
+            r[i][j] = lhsAxes[i].Dot(rhsAxes[j]);
+            absR[i][j] = std::abs(r[i][j]) + 1e-6f;
+        }
+    }
+
+    const Vector3 offset = rhs.center - center;
+    const float t[3] = {offset.Dot(lhsAxes[0]), offset.Dot(lhsAxes[1]), offset.Dot(lhsAxes[2])};
+
+    for (int32_t i = 0; i < 3; ++i)
+    {
+        const float rhsRadius = rhs.extent[0] * absR[i][0] + rhs.extent[1] * absR[i][1] + rhs.extent[2] * absR[i][2];
+        if (std::abs(t[i]) > extent[i] + rhsRadius)
+        {
+            return false;
+        }
+    }
+
+    for (int32_t j = 0; j < 3; ++j)
+    {
+        const float lhsRadius = extent[0] * absR[0][j] + extent[1] * absR[1][j] + extent[2] * absR[2][j];
+        if (std::abs(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) > lhsRadius + rhs.extent[j])
+        {
+            return false;
+        }
+    }
+
+    for (int32_t i = 0; i < 3; ++i)
+    {
+        const int32_t i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+        for (int32_t j = 0; j < 3; ++j)
+        {
+            const int32_t j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+            const float lhsRadius = extent[i1] * absR[i2][j] + extent[i2] * absR[i1][j];
+            const float rhsRadius = rhs.extent[j1] * absR[i][j2] + rhs.extent[j2] * absR[i][j1];
+            if (std::abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > lhsRadius + rhsRadius)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+inline AABB OBB::GetBounds() const noexcept
+{
+    const auto matrix = rotation.ToMatrix();
+    const Vector3 boundsExtent(
+        extent.x * std::abs(matrix.m00) + extent.y * std::abs(matrix.m10) + extent.z * std::abs(matrix.m20),
+        extent.x * std::abs(matrix.m01) + extent.y * std::abs(matrix.m11) + extent.z * std::abs(matrix.m21),
+        extent.x * std::abs(matrix.m02) + extent.y * std::abs(matrix.m12) + extent.z * std::abs(matrix.m22));
+    return AABB::FromCenterExtent(center, boundsExtent);
+}
+
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "AABB.h"
+#include "Matrix4x4.h"
+#include "Vector2.h"
+#include "Vector3.h"
+
+namespace tg
+{
+
+/**
+ * @brief   The unit vector which is encoded in two SNORM16 components by the octahedral mapping.
+ * @remark  The unit sphere is projected onto the octahedron, whose lower half is folded over the upper half. It takes 4
+ *          bytes instead of 12, and the angular error is below 0.005 degrees.
+ */
+struct OctahedralNormal final
+{
+/**@section Constructor */
+public:
+    constexpr OctahedralNormal() noexcept = default;
+
+    /**
+     * @brief   Encodes the normal, which doesn't have to be normalized but must not be zero.
+     */
+    explicit OctahedralNormal(const Vector3& normal) noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] Vector3 Decode() const noexcept;
+
+/**@section Variable */
+public:
+    static constexpr float SnormScale = 32767.0f;
+
+    int16_t x{};
+    int16_t y{};
+};
+
+/**
+ * @brief   The position which is quantized to SNORM16 components relative to the bounding box of the mesh.
+ * @remark  Bind it as three normalized shorts and multiply GetDequantizationMatrix into the world matrix, so the shader
+ *          doesn't change. The error is below 1 / 65534 of the box size along each axis. The fourth component pads the
+ *          vertex to four bytes.
+ */
+struct QuantizedPosition final
+{
+/**@section Constructor */
+public:
+    constexpr QuantizedPosition() noexcept = default;
+
+    /**
+     * @brief   Quantizes the position. The positions outside of the bounds are clamped onto the box.
+     */
+    QuantizedPosition(const Vector3& position, const AABB& bounds) noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] Vector3 Dequantize(const AABB& bounds) const noexcept;
+
+    /**
+     * @brief   Gets the matrix which transforms the normalized components to the positions in the bounds.
+     * @remark  It assumes the SNORM conversion of OpenGL 4.2 and OpenGL ES 3.0, which maps 32767 to 1 exactly.
+     */
+    [[nodiscard]] static Matrix4x4 GetDequantizationMatrix(const AABB& bounds) noexcept;
+
+    /**
+     * @brief   Gets the factors which map the offsets from the center of the bounds to the SNORM16 components.
+     */
+    [[nodiscard]] static Vector3 GetQuantizationScale(const AABB& bounds) noexcept;
+
+/**@section Variable */
+public:
+    int16_t x{};
+    int16_t y{};
+    int16_t z{};
+    int16_t w{};
+};
+
+inline OctahedralNormal::OctahedralNormal(const Vector3& normal) noexcept
+{
+    const Vector3 projected = normal / (std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z));
+    Vector2 encoded(projected.x, projected.y);
+    if (projected.z < 0.0f)
+    {
+        encoded = Vector2(std::copysign(1.0f - std::abs(projected.y), projected.x), std::copysign(1.0f - std::abs(projected.x), projected.y));
+    }
+
+    // Round to the nearest even like the batch kernels of VectorKernels, so both produce the same bits.
+    x = static_cast<int16_t>(std::nearbyint(encoded.x * SnormScale));
+    y = static_cast<int16_t>(std::nearbyint(encoded.y * SnormScale));
+}
+
+inline Vector3 OctahedralNormal::Decode() const noexcept
+{
+    Vector3 ret(x / SnormScale, y / SnormScale, 0.0f);
+    ret.z = 1.0f - std::abs(ret.x) - std::abs(ret.y);
+
+    // Unfold the lower half of the octahedron.
+    const float fold = std::max(-ret.z, 0.0f);
+    ret.x += ret.x < 0.0f ? fold : -fold;
+    ret.y += ret.y < 0.0f ? fold : -fold;
+    return ret.Normalized();
+}
+
+inline QuantizedPosition::QuantizedPosition(const Vector3& position, const AABB& bounds) noexcept
+{
+    const Vector3 scale = GetQuantizationScale(bounds);
+    const Vector3 offset = position - bounds.GetCenter();
+    auto quantize = [](float value)
+    {
+        return static_cast<int16_t>(std::nearbyint(std::clamp(value, -OctahedralNormal::SnormScale, OctahedralNormal::SnormScale)));
+    };
+
+    x = quantize(offset.x * scale.x);
+    y = quantize(offset.y * scale.y);
+    z = quantize(offset.z * scale.z);
+}
+
+inline Vector3 QuantizedPosition::Dequantize(const AABB& bounds) const noexcept
+{
+    const Vector3 extent = bounds.GetExtent();
+    const Vector3 center = bounds.GetCenter();
+    return Vector3(center.x + x * extent.x / OctahedralNormal::SnormScale, center.y + y * extent.y / OctahedralNormal::SnormScale, center.z + z * extent.z / OctahedralNormal::SnormScale);
+}
+
+inline Matrix4x4 QuantizedPosition::GetDequantizationMatrix(const AABB& bounds) noexcept
+{
+    const Vector3 extent = bounds.GetExtent();
+    const Vector3 center = bounds.GetCenter();
+    // It's Scale(extent) * Translate(center) in the row vector convention.
+    return Matrix4x4(
+        extent.x, 0.0f, 0.0f, 0.0f,
+        0.0f, extent.y, 0.0f, 0.0f,
+        0.0f, 0.0f, extent.z, 0.0f,
+        center.x, center.y, center.z, 1.0f
+    );
+}
+
+inline Vector3 QuantizedPosition::GetQuantizationScale(const AABB& bounds) noexcept
+{
+    // The flat axes have no extent, and every position on them is quantized to 0.
+    const Vector3 extent = bounds.GetExtent();
+    auto getScale = [](float extent) { return extent > 0.0f ? OctahedralNormal::SnormScale / extent : 0.0f; };
+    return Vector3(getScale(extent.x), getScale(extent.y), getScale(extent.z));
+}
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Vector3.h"
+
+namespace tg
+{
+
+/**
+ * @brief   The plane which consists of the points p where Dot(normal, p) + distance = 0.
+ * @remark  The normal points to the positive half space.
+ */
+struct Plane final
+{
+/**@section Constructor */
+public:
+    constexpr Plane() noexcept = default;
+    constexpr Plane(const Vector3& normal, float distance) noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Creates the plane which passes through the point.
+     * @param point     The point on the plane.
+     * @param normal    The normalized normal of the plane.
+     */
+    [[nodiscard]] static constexpr Plane FromPointNormal(const Vector3& point, const Vector3& normal) noexcept;
+
+    /**
+     * @brief   Creates the plane which passes through the points of the triangle.
+     * @remark  The normal faces the side from which the points are seen in the clockwise order.
+     */
+    [[nodiscard]] static Plane FromPoints(const Vector3& a, const Vector3& b, const Vector3& c) noexcept;
+
+    /**
+     * @brief   Gets the signed distance to the point, which is positive in front of the plane.
+     * @remark  It's the actual distance only if the plane is normalized.
+     */
+    [[nodiscard]] constexpr float GetDistance(const Vector3& point) const noexcept;
+    void Normalize() noexcept;
+    [[nodiscard]] Plane Normalized() const noexcept;
+
+/**@section Variable */
+public:
+    Vector3 normal{0.0f, 1.0f, 0.0f};
+    float distance{};
+};
+
+constexpr Plane::Plane(const Vector3& normal, float distance) noexcept :
+    normal(normal),
+    distance(distance)
+{
+}
+
+constexpr Plane Plane::FromPointNormal(const Vector3& point, const Vector3& normal) noexcept
+{
+    return Plane(normal, -Vector3::Dot(normal, point));
+}
+
+inline Plane Plane::FromPoints(const Vector3& a, const Vector3& b, const Vector3& c) noexcept
+{
+    const Vector3 normal = Vector3::Cross(b - a, c - a);
+    return FromPointNormal(a, normal.Normalized());
+}
+
+constexpr float Plane::GetDistance(const Vector3& point) const noexcept
+{
+    return Vector3::Dot(normal, point) + distance;
+}
+
+inline void Plane::Normalize() noexcept
+{
+    const float reciprocalLength = 1.0f / normal.Length();
+    normal *= reciprocalLength;
+    distance *= reciprocalLength;
+}
+
+inline Plane Plane::Normalized() const noexcept
+{
+    Plane ret = *this;
+    ret.Normalize();
+    return ret;
+}
+
+}
@@ -0,0 +1,346 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fmt/format.h>
+#include <span>
+
+#include "Core/Simd.h"
+
+#include "Matrix4x4.h"
+#include "Vector3.h"
+
+namespace tg
+{
+
+/**
+ * @brief   The rotation which is represented as a unit quaternion.
+ * @remark  The product lhs * rhs rotates by rhs first and then by lhs. The matrices which are converted from quaternions
+ *          use the row vector convention of Matrix4x4, so v * q.ToMatrix() equals q * v.
+ */
+struct Quaternion final
+{
+/**@section Constructor */
+public:
+    constexpr Quaternion() noexcept = default;
+    constexpr Quaternion(float x, float y, float z, float w) noexcept;
+
+/**@section Operator */
+public:
+    Quaternion operator*(const Quaternion& rhs) const noexcept;
+    Vector3 operator*(const Vector3& rhs) const noexcept;
+    Quaternion& operator*=(const Quaternion& rhs) noexcept;
+    constexpr Quaternion operator-() const noexcept;
+    constexpr bool operator==(const Quaternion& rhs) const noexcept;
+    constexpr bool operator!=(const Quaternion& rhs) const noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] static constexpr Quaternion Identity() noexcept;
+
+    /**
+     * @brief   Creates the rotation around the axis.
+     * @param axis      The normalized rotation axis.
+     * @param radian    The rotation angle in radians.
+     */
+    [[nodiscard]] static Quaternion AxisAngle(const Vector3& axis, float radian) noexcept;
+
+    /**
+     * @brief   Creates the rotation which equals Matrix4x4::Rotate(yaw, pitch, roll).
+     */
+    [[nodiscard]] static Quaternion Euler(float yaw, float pitch, float roll) noexcept;
+
+    /**
+     * @brief   Extracts the rotation from the upper 3x3 part of the matrix.
+     * @param matrix    The rotation matrix which has neither scale nor shear.
+     */
+    [[nodiscard]] static Quaternion FromMatrix(const Matrix4x4& matrix) noexcept;
+    [[nodiscard]] Matrix4x4 ToMatrix() const noexcept;
+
+    /**
+     * @brief   Gets the yaw, pitch and roll in radians which are accepted by Euler.
+     */
+    [[nodiscard]] Vector3 ToEulerAngles() const noexcept;
+    [[nodiscard]] static float Dot(const Quaternion& lhs, const Quaternion& rhs) noexcept;
+    [[nodiscard]] float Length() const noexcept;
+    [[nodiscard]] float LengthSq() const noexcept;
+    void Normalize() noexcept;
+    [[nodiscard]] Quaternion Normalized() const noexcept;
+    [[nodiscard]] constexpr Quaternion Conjugate() const noexcept;
+    [[nodiscard]] Quaternion Inverse() const noexcept;
+
+    /**
+     * @brief   Rotates the vector.
+     * @param v     The vector to rotate.
+     */
+    [[nodiscard]] Vector3 Rotate(const Vector3& v) const noexcept;
+
+    /**
+     * @brief   Interpolates linearly and normalizes the result, which is much cheaper than SLerp.
+     * @param from  The rotation at t = 0.
+     * @param to    The rotation at t = 1.
+     * @param t     The interpolation factor.
+     * @remark  It takes the shortest path. The angular velocity isn't constant, but the error is tiny for the small angles
+     *          between the keyframes of animations.
+     */
+    [[nodiscard]] static Quaternion NLerp(const Quaternion& from, const Quaternion& to, float t) noexcept;
+
+    /**
+     * @brief   Interpolates along the shortest arc with a constant angular velocity.
+     * @param from  The rotation at t = 0.
+     * @param to    The rotation at t = 1.
+     * @param t     The interpolation factor.
+     */
+    [[nodiscard]] static Quaternion SLerp(const Quaternion& from, const Quaternion& to, float t) noexcept;
+    int32_t ToString(const std::span<char8_t>& destStr) const;
+    int32_t ToString(char8_t* destStr, size_t destStrBufferLen) const;
+    [[nodiscard]] std::u8string ToString() const;
+
+/**@section Variable */
+public:
+    float x{}, y{}, z{}, w{1.0f};
+};
+
+constexpr Quaternion::Quaternion(float x, float y, float z, float w) noexcept :
+    x(x),
+    y(y),
+    z(z),
+    w(w)
+{
+}
+
+inline Quaternion Quaternion::operator*(const Quaternion& rhs) const noexcept
+{
+    const auto q = Float4::Load(&rhs.x);
+
+    auto ret = Float4::Splat(w) * q;
+    ret = Float4::MultiplyAdd(Float4::Splat(x), q.Shuffle<3, 2, 1, 0>() * Float4::Set(1.0f, -1.0f, 1.0f, -1.0f), ret);
+    ret = Float4::MultiplyAdd(Float4::Splat(y), q.Shuffle<2, 3, 0, 1>() * Float4::Set(1.0f, 1.0f, -1.0f, -1.0f), ret);
+    ret = Float4::MultiplyAdd(Float4::Splat(z), q.Shuffle<1, 0, 3, 2>() * Float4::Set(-1.0f, 1.0f, 1.0f, -1.0f), ret);
+
+    Quaternion product;
+    ret.Store(&product.x);
+    return product;
+}
+
+inline Vector3 Quaternion::operator*(const Vector3& rhs) const noexcept
+{
+    return this->Rotate(rhs);
+}
+
+inline Quaternion& Quaternion::operator*=(const Quaternion& rhs) noexcept
+{
+    *this = *this * rhs;
+    return *this;
+}
+
+constexpr Quaternion Quaternion::operator-() const noexcept
+{
+    return Quaternion(-x, -y, -z, -w);
+}
+
+constexpr bool Quaternion::operator==(const Quaternion& rhs) const noexcept
+{
+    return x == rhs.x && y == rhs.y && z == rhs.z && w == rhs.w;
+}
+
+constexpr bool Quaternion::operator!=(const Quaternion& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+constexpr Quaternion Quaternion::Identity() noexcept
+{
+    return Quaternion(0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+inline Quaternion Quaternion::AxisAngle(const Vector3& axis, float radian) noexcept
+{
+    const float halfSin = std::sin(radian * 0.5f);
+    return Quaternion(axis.x * halfSin, axis.y * halfSin, axis.z * halfSin, std::cos(radian * 0.5f));
+}
+
+inline Quaternion Quaternion::Euler(float yaw, float pitch, float roll) noexcept
+{
+    // Matrix4x4::Rotate is Rx(yaw) * Ry(pitch) * Rz(roll) in the column vector form, so the transposed rotation is
+    // Rz(-roll) * Ry(-pitch) * Rx(-yaw).
+    const float sinX = std::sin(yaw * -0.5f), cosX = std::cos(yaw * -0.5f);
+    const float sinY = std::sin(pitch * -0.5f), cosY = std::cos(pitch * -0.5f);
+    const float sinZ = std::sin(roll * -0.5f), cosZ = std::cos(roll * -0.5f);
+
+    return Quaternion(0.0f, 0.0f, sinZ, cosZ) * Quaternion(0.0f, sinY, 0.0f, cosY) * Quaternion(sinX, 0.0f, 0.0f, cosX);
+}
+
+inline Quaternion Quaternion::FromMatrix(const Matrix4x4& matrix) noexcept
+{
+    const float trace = matrix.m00 + matrix.m11 + matrix.m22;
+    if (trace > 0.0f)
+    {
+        const float s = std::sqrt(trace + 1.0f) * 2.0f;
+        return Quaternion((matrix.m12 - matrix.m21) / s, (matrix.m20 - matrix.m02) / s, (matrix.m01 - matrix.m10) / s, s * 0.25f);
+    }
+
+    // Pick the largest diagonal element to keep the square root away from zero.
+    if (matrix.m00 > matrix.m11 && matrix.m00 > matrix.m22)
+    {
+        const float s = std::sqrt(1.0f + matrix.m00 - matrix.m11 - matrix.m22) * 2.0f;
+        return Quaternion(s * 0.25f, (matrix.m10 + matrix.m01) / s, (matrix.m20 + matrix.m02) / s, (matrix.m12 - matrix.m21) / s);
+    }
+
+    if (matrix.m11 > matrix.m22)
+    {
+        const float s = std::sqrt(1.0f + matrix.m11 - matrix.m00 - matrix.m22) * 2.0f;
+        return Quaternion((matrix.m10 + matrix.m01) / s, s * 0.25f, (matrix.m21 + matrix.m12) / s, (matrix.m20 - matrix.m02) / s);
+    }
+
+    const float s = std::sqrt(1.0f + matrix.m22 - matrix.m00 - matrix.m11) * 2.0f;
+    return Quaternion((matrix.m20 + matrix.m02) / s, (matrix.m21 + matrix.m12) / s, s * 0.25f, (matrix.m01 - matrix.m10) / s);
+}
+
+inline Matrix4x4 Quaternion::ToMatrix() const noexcept
+{
+    const float xx = x * x, yy = y * y, zz = z * z;
+    const float xy = x * y, xz = x * z, yz = y * z;
+    const float wx = w * x, wy = w * y, wz = w * z;
+
+    return Matrix4x4(
+        1.0f - 2.0f * (yy + zz),    2.0f * (xy + wz),           2.0f * (xz - wy),           0.0f,
+        2.0f * (xy - wz),           1.0f - 2.0f * (xx + zz),    2.0f * (yz + wx),           0.0f,
+        2.0f * (xz + wy),           2.0f * (yz - wx),           1.0f - 2.0f * (xx + yy),    0.0f,
+        0.0f,                       0.0f,                       0.0f,                       1.0f
+    );
+}
+
+inline Vector3 Quaternion::ToEulerAngles() const noexcept
+{
+    const auto matrix = this->ToMatrix();
+    const float pitch = std::asin(std::clamp(matrix.m02, -1.0f, 1.0f));
+
+    // The roll is undefined in the gimbal lock, so it's folded into the yaw.
+    if (std::abs(matrix.m02) > 0.99999f)
+    {
+        return Vector3(std::atan2(matrix.m21, matrix.m11), pitch, 0.0f);
+    }
+
+    return Vector3(std::atan2(-matrix.m12, matrix.m22), pitch, std::atan2(-matrix.m01, matrix.m00));
+}
+
+inline float Quaternion::Dot(const Quaternion& lhs, const Quaternion& rhs) noexcept
+{
+    return Float4::Dot(Float4::Load(&lhs.x), Float4::Load(&rhs.x));
+}
+
+inline float Quaternion::Length() const noexcept
+{
+    return std::sqrt(this->LengthSq());
+}
+
+inline float Quaternion::LengthSq() const noexcept
+{
+    return Dot(*this, *this);
+}
+
+inline void Quaternion::Normalize() noexcept
+{
+    const auto q = Float4::Load(&x);
+    (q / Float4::Sqrt(Float4::Splat(Float4::Dot(q, q)))).Store(&x);
+}
+
+inline Quaternion Quaternion::Normalized() const noexcept
+{
+    Quaternion ret(*this);
+    ret.Normalize();
+    return ret;
+}
+
+constexpr Quaternion Quaternion::Conjugate() const noexcept
+{
+    return Quaternion(-x, -y, -z, w);
+}
+
+inline Quaternion Quaternion::Inverse() const noexcept
+{
+    Quaternion ret;
+    (Float4::Load(&x) * Float4::Set(-1.0f, -1.0f, -1.0f, 1.0f) / Float4::Splat(this->LengthSq())).Store(&ret.x);
+    return ret;
+}
+
+inline Vector3 Quaternion::Rotate(const Vector3& v) const noexcept
+{
+    // v' = v + 2w(q x v) + 2q x (q x v), which needs two cross products instead of the full sandwich product.
+    const auto q = Float4::Load(&x);
+    const auto vector = Float4::Set(v.x, v.y, v.z, 0.0f);
+    const auto t = Float4::Cross3(q, vector) * Float4::Splat(2.0f);
+    const auto ret = Float4::MultiplyAdd(q.Broadcast<3>(), t, vector) + Float4::Cross3(q, t);
+
+    float lanes[4];
+    ret.Store(lanes);
+    return Vector3(lanes[0], lanes[1], lanes[2]);
+}
+
+inline Quaternion Quaternion::NLerp(const Quaternion& from, const Quaternion& to, float t) noexcept
+{
+    const auto q0 = Float4::Load(&from.x);
+    auto q1 = Float4::Load(&to.x);
+    if (Float4::Dot(q0, q1) < 0.0f)
+    {
+        q1 = -q1;
+    }
+
+    const auto q = Float4::MultiplyAdd(q1 - q0, Float4::Splat(t), q0);
+
+    Quaternion ret;
+    (q / Float4::Sqrt(Float4::Splat(Float4::Dot(q, q)))).Store(&ret.x);
+    return ret;
+}
+
+inline Quaternion Quaternion::SLerp(const Quaternion& from, const Quaternion& to, float t) noexcept
+{
+    const auto q0 = Float4::Load(&from.x);
+    auto q1 = Float4::Load(&to.x);
+    float cosTheta = Float4::Dot(q0, q1);
+    if (cosTheta < 0.0f)
+    {
+        q1 = -q1;
+        cosTheta = -cosTheta;
+    }
+
+    // The arc is nearly straight, so NLerp avoids the division by the tiny sine.
+    if (cosTheta > 0.9995f)
+    {
+        return NLerp(from, to, t);
+    }
+
+    const float theta = std::acos(cosTheta);
+    const float sinTheta = std::sqrt(1.0f - cosTheta * cosTheta);
+    const float weight0 = std::sin((1.0f - t) * theta) / sinTheta;
+    const float weight1 = std::sin(t * theta) / sinTheta;
+
+    Quaternion ret;
+    Float4::MultiplyAdd(q1, Float4::Splat(weight1), q0 * Float4::Splat(weight0)).Store(&ret.x);
+    return ret;
+}
+
+inline int32_t Quaternion::ToString(const std::span<char8_t>& destStr) const
+{
+    return this->ToString(&destStr[0], destStr.size());
+}
+
+inline int32_t Quaternion::ToString(char8_t* destStr, size_t destStrBufferLen) const
+{
+    const auto destStrLen = fmt::format_to_n(destStr, sizeof(destStr[0]) * (destStrBufferLen - 1), u8"{} {} {} {}", x, y, z, w).size;
+    destStr[destStrLen] = u8'\0';
+
+    return static_cast<int32_t>(destStrLen);
+}
+
+inline std::u8string Quaternion::ToString() const
+{
+    std::array<char8_t, 1024> str{};
+    const int32_t strLen = this->ToString(str);
+
+    return {&str[0], static_cast<size_t>(strLen)};
+}
+
+}
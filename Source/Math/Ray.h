@@ -0,0 +1,155 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+#include "AABB.h"
+#include "Plane.h"
+#include "Sphere.h"
+
+namespace tg
+{
+
+struct Ray final
+{
+/**@section Constructor */
+public:
+    constexpr Ray() noexcept = default;
+    constexpr Ray(const Vector3& origin, const Vector3& direction) noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] constexpr Vector3 GetPoint(float distance) const noexcept;
+
+    /**
+     * @brief   Finds the first intersection with the box by the slab test.
+     * @return  The distance along the direction or std::nullopt if the ray misses. It's 0 if the origin is inside the box.
+     */
+    [[nodiscard]] std::optional<float> Raycast(const AABB& box) const noexcept;
+    [[nodiscard]] std::optional<float> Raycast(const Sphere& sphere) const noexcept;
+    [[nodiscard]] std::optional<float> Raycast(const Plane& plane) const noexcept;
+
+    /**
+     * @brief   Finds the intersection with the triangle by the Moller-Trumbore algorithm.
+     * @return  The distance along the direction or std::nullopt if the ray misses. Both faces are hit.
+     */
+    [[nodiscard]] std::optional<float> Raycast(const Vector3& v0, const Vector3& v1, const Vector3& v2) const noexcept;
+
+/**@section Variable */
+public:
+    Vector3 origin;
+
+    /**
+     * @brief   The direction of the ray. The distances are measured in its length, so it's usually normalized.
+     */
+    Vector3 direction{0.0f, 0.0f, 1.0f};
+};
+
+constexpr Ray::Ray(const Vector3& origin, const Vector3& direction) noexcept :
+    origin(origin),
+    direction(direction)
+{
+}
+
+constexpr Vector3 Ray::GetPoint(float distance) const noexcept
+{
+    return origin + direction * distance;
+}
+
+inline std::optional<float> Ray::Raycast(const AABB& box) const noexcept
+{
+    // The division by zero makes the infinity of the proper sign, which keeps the slabs of the parallel axes correct.
+    const auto o = Float4::Set(origin.x, origin.y, origin.z, 0.0f);
+    const auto reciprocalDirection = Float4::Splat(1.0f) / Float4::Set(direction.x, direction.y, direction.z, 1.0f);
+    const auto t0 = (Float4::Set(box.min.x, box.min.y, box.min.z, 0.0f) - o) * reciprocalDirection;
+    const auto t1 = (Float4::Set(box.max.x, box.max.y, box.max.z, 0.0f) - o) * reciprocalDirection;
+    const auto nears = Float4::Min(t0, t1);
+    const auto fars = Float4::Max(t0, t1);
+
+    // The w lanes are 0, which clamps the entry distance to the origin.
+    const auto nearPairs = Float4::Max(nears, nears.Shuffle<1, 0, 3, 2>());
+    const auto nearDistance = Float4::Max(nearPairs, nearPairs.Shuffle<2, 3, 0, 1>()).GetX();
+    const auto farDistance = std::min(std::min(fars.GetX(), fars.Shuffle<1, 1, 1, 1>().GetX()), fars.Shuffle<2, 2, 2, 2>().GetX());
+    if (nearDistance > farDistance)
+    {
+        return std::nullopt;
+    }
+
+    return nearDistance;
+}
+
+inline std::optional<float> Ray::Raycast(const Sphere& sphere) const noexcept
+{
+    const Vector3 offset = origin - sphere.center;
+    const float a = direction.Dot(direction);
+    const float b = offset.Dot(direction);
+    const float c = offset.Dot(offset) - sphere.radius * sphere.radius;
+    const float discriminant = b * b - a * c;
+    if (discriminant < 0.0f)
+    {
+        return std::nullopt;
+    }
+
+    const float farDistance = (-b + std::sqrt(discriminant)) / a;
+    if (farDistance < 0.0f)
+    {
+        return std::nullopt;
+    }
+
+    return std::max((-b - std::sqrt(discriminant)) / a, 0.0f);
+}
+
+inline std::optional<float> Ray::Raycast(const Plane& plane) const noexcept
+{
+    const float denominator = plane.normal.Dot(direction);
+    if (std::abs(denominator) < 1e-8f)
+    {
+        return std::nullopt;
+    }
+
+    const float distance = -plane.GetDistance(origin) / denominator;
+    if (distance < 0.0f)
+    {
+        return std::nullopt;
+    }
+
+    return distance;
+}
+
+inline std::optional<float> Ray::Raycast(const Vector3& v0, const Vector3& v1, const Vector3& v2) const noexcept
+{
+    const Vector3 edge1 = v1 - v0;
+    const Vector3 edge2 = v2 - v0;
+    const Vector3 p = Vector3::Cross(direction, edge2);
+    const float determinant = edge1.Dot(p);
+    if (std::abs(determinant) < 1e-8f)
+    {
+        return std::nullopt;
+    }
+
+    const float reciprocalDeterminant = 1.0f / determinant;
+    const Vector3 s = origin - v0;
+    const float u = s.Dot(p) * reciprocalDeterminant;
+    if (u < 0.0f || u > 1.0f)
+    {
+        return std::nullopt;
+    }
+
+    const Vector3 q = Vector3::Cross(s, edge1);
+    const float v = direction.Dot(q) * reciprocalDeterminant;
+    if (v < 0.0f || u + v > 1.0f)
+    {
+        return std::nullopt;
+    }
+
+    const float distance = edge2.Dot(q) * reciprocalDeterminant;
+    if (distance < 0.0f)
+    {
+        return std::nullopt;
+    }
+
+    return distance;
+}
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <algorithm>
+
+#include "AABB.h"
+
+namespace tg
+{
+
+struct Sphere final
+{
+/**@section Constructor */
+public:
+    constexpr Sphere() noexcept = default;
+    constexpr Sphere(const Vector3& center, float radius) noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] constexpr bool Contains(const Vector3& point) const noexcept;
+    [[nodiscard]] constexpr bool Intersect(const Sphere& rhs) const noexcept;
+    [[nodiscard]] constexpr bool Intersect(const AABB& rhs) const noexcept;
+
+/**@section Variable */
+public:
+    Vector3 center;
+    float radius{};
+};
+
+constexpr Sphere::Sphere(const Vector3& center, float radius) noexcept :
+    center(center),
+    radius(radius)
+{
+}
+
+constexpr bool Sphere::Contains(const Vector3& point) const noexcept
+{
+    const Vector3 offset = point - center;
+    return offset.Dot(offset) <= radius * radius;
+}
+
+constexpr bool Sphere::Intersect(const Sphere& rhs) const noexcept
+{
+    const Vector3 offset = rhs.center - center;
+    const float radiusSum = radius + rhs.radius;
+    return offset.Dot(offset) <= radiusSum * radiusSum;
+}
+
+constexpr bool Sphere::Intersect(const AABB& rhs) const noexcept
+{
+    // Measure the distance to the closest point of the box.
+    const Vector3 closestPoint(std::clamp(center.x, rhs.min.x, rhs.max.x), std::clamp(center.y, rhs.min.y, rhs.max.y), std::clamp(center.z, rhs.min.z, rhs.max.z));
+    return this->Contains(closestPoint);
+}
+
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cassert>
+#include <span>
+#include <type_traits>
+
+namespace tg
+{
+
+/**
+ * @brief   The view of the vectors whose x, y and z are stored in separate arrays.
+ * @remark  Every lane of a SIMD register holds the same component of a different vector in this layout, so the kernels
+ *          need no shuffles and run at full width. Prefer it over packed Vector3 for large point sets.
+ */
+template <typename _Value> requires std::is_same_v<std::remove_const_t<_Value>, float>
+struct BasicVector3SoA
+{
+/**@section Constructor */
+public:
+    constexpr BasicVector3SoA() noexcept = default;
+    constexpr BasicVector3SoA(std::span<_Value> xs, std::span<_Value> ys, std::span<_Value> zs) noexcept;
+    template <typename _Value2> requires std::is_convertible_v<_Value2(*)[], _Value(*)[]>
+    constexpr BasicVector3SoA(const BasicVector3SoA<_Value2>& rhs) noexcept;
+
+/**@section Method */
+public:
+    [[nodiscard]] constexpr size_t GetSize() const noexcept;
+    [[nodiscard]] constexpr BasicVector3SoA Subspan(size_t offset, size_t count) const noexcept;
+
+/**@section Variable */
+public:
+    std::span<_Value> xs;
+    std::span<_Value> ys;
+    std::span<_Value> zs;
+};
+
+using Vector3SoA = BasicVector3SoA<float>;
+using ConstVector3SoA = BasicVector3SoA<const float>;
+
+/**
+ * @brief   The view of the axis aligned boxes whose corners are stored in the SoA layout.
+ */
+struct AABBSoA
+{
+    ConstVector3SoA mins;
+    ConstVector3SoA maxs;
+};
+
+struct SphereSoA
+{
+    ConstVector3SoA centers;
+    std::span<const float> radii;
+};
+
+struct TriangleSoA
+{
+    ConstVector3SoA v0s;
+    ConstVector3SoA v1s;
+    ConstVector3SoA v2s;
+};
+
+template <typename _Value> requires std::is_same_v<std::remove_const_t<_Value>, float>
+constexpr BasicVector3SoA<_Value>::BasicVector3SoA(std::span<_Value> xs, std::span<_Value> ys, std::span<_Value> zs) noexcept :
+    xs(xs),
+    ys(ys),
+    zs(zs)
+{
+    assert(xs.size() == ys.size() && xs.size() == zs.size());
+}
+
+template <typename _Value> requires std::is_same_v<std::remove_const_t<_Value>, float>
+template <typename _Value2> requires std::is_convertible_v<_Value2(*)[], _Value(*)[]>
+constexpr BasicVector3SoA<_Value>::BasicVector3SoA(const BasicVector3SoA<_Value2>& rhs) noexcept :
+    xs(rhs.xs),
+    ys(rhs.ys),
+    zs(rhs.zs)
+{
+}
+
+template <typename _Value> requires std::is_same_v<std::remove_const_t<_Value>, float>
+constexpr size_t BasicVector3SoA<_Value>::GetSize() const noexcept
+{
+    return xs.size();
+}
+
+template <typename _Value> requires std::is_same_v<std::remove_const_t<_Value>, float>
+constexpr BasicVector3SoA<_Value> BasicVector3SoA<_Value>::Subspan(size_t offset, size_t count) const noexcept
+{
+    return BasicVector3SoA(xs.subspan(offset, count), ys.subspan(offset, count), zs.subspan(offset, count));
+}
+
+}
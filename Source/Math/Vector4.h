@@ -1,5 +1,9 @@
 #pragma once
 
+#include <type_traits>
+
+#include "Core/Simd.h"
+
 #include "Matrix4x4.h"
 #include "Vector3.h"
 
@@ -57,6 +61,9 @@ public:
     int32_t ToString(char8_t* destStr, size_t destStrBufferLen) const;
     [[nodiscard]] std::u8string ToString() const;
 
+private:
+    [[nodiscard]] static Float4 MultiplyRows(const Float4& v, const Matrix4x4& matrix) noexcept;
+
 /**@section Variable */
 public:
     _Value x{}, y{}, z{}, w{};
@@ -125,6 +132,16 @@ constexpr ExpressionTemplates<Multiply, BasicVector4<_Value>, _Value> operator*(
 template <typename _Value> requires Arithmetic<_Value>
 constexpr BasicVector4<_Value> BasicVector4<_Value>::operator*(const Matrix4x4& rhs) const noexcept
 {
+    if constexpr (std::is_same_v<_Value, float>)
+    {
+        if (std::is_constant_evaluated() == false)
+        {
+            BasicVector4 ret;
+            MultiplyRows(Float4::Load(&x), rhs).Store(&ret.x);
+            return ret;
+        }
+    }
+
     return Vector4(
         (x * rhs.m00) + (y * rhs.m10) + (z * rhs.m20) + (w * rhs.m30),
         (x * rhs.m01) + (y * rhs.m11) + (z * rhs.m21) + (w * rhs.m31),
@@ -142,6 +159,12 @@ constexpr BasicVector4<_Value> BasicVector4<_Value>::operator-() const noexcept
 template <typename _Value> requires Arithmetic<_Value>
 BasicVector4<_Value>& BasicVector4<_Value>::operator+=(const BasicVector4& rhs) noexcept
 {
+    if constexpr (std::is_same_v<_Value, float>)
+    {
+        (Float4::Load(&x) + Float4::Load(&rhs.x)).Store(&x);
+        return *this;
+    }
+
     x += rhs.x;
     y += rhs.y;
     z += rhs.z;
@@ -153,6 +176,12 @@ BasicVector4<_Value>& BasicVector4<_Value>::operator+=(const BasicVector4& rhs)
 template <typename _Value> requires Arithmetic<_Value>
 BasicVector4<_Value>& BasicVector4<_Value>::operator-=(const BasicVector4& rhs) noexcept
 {
+    if constexpr (std::is_same_v<_Value, float>)
+    {
+        (Float4::Load(&x) - Float4::Load(&rhs.x)).Store(&x);
+        return *this;
+    }
+
     x -= rhs.x;
     y -= rhs.y;
     z -= rhs.z;
@@ -164,6 +193,12 @@ BasicVector4<_Value>& BasicVector4<_Value>::operator-=(const BasicVector4& rhs)
 template <typename _Value> requires Arithmetic<_Value>
 BasicVector4<_Value>& BasicVector4<_Value>::operator*=(const BasicVector4& rhs) noexcept
 {
+    if constexpr (std::is_same_v<_Value, float>)
+    {
+        (Float4::Load(&x) * Float4::Load(&rhs.x)).Store(&x);
+        return *this;
+    }
+
     x *= rhs.x;
     y *= rhs.y;
     z *= rhs.z;
@@ -175,6 +210,12 @@ BasicVector4<_Value>& BasicVector4<_Value>::operator*=(const BasicVector4& rhs)
 template <typename _Value> requires Arithmetic<_Value>
 BasicVector4<_Value>& BasicVector4<_Value>::operator*=(_Value rhs) noexcept
 {
+    if constexpr (std::is_same_v<_Value, float>)
+    {
+        (Float4::Load(&x) * Float4::Splat(rhs)).Store(&x);
+        return *this;
+    }
+
     x *= rhs;
     y *= rhs;
     z *= rhs;
@@ -186,6 +227,12 @@ BasicVector4<_Value>& BasicVector4<_Value>::operator*=(_Value rhs) noexcept
 template <typename _Value> requires Arithmetic<_Value>
 BasicVector4<_Value>& BasicVector4<_Value>::operator*=(const Matrix4x4& rhs) noexcept
 {
+    if constexpr (std::is_same_v<_Value, float>)
+    {
+        MultiplyRows(Float4::Load(&x), rhs).Store(&x);
+        return *this;
+    }
+
     *this = Vector4(
         (x * rhs.m00) + (y * rhs.m10) + (z * rhs.m20) + (w * rhs.m30),
         (x * rhs.m01) + (y * rhs.m11) + (z * rhs.m21) + (w * rhs.m31),
@@ -199,6 +246,12 @@ BasicVector4<_Value>& BasicVector4<_Value>::operator*=(const Matrix4x4& rhs) noe
 template <typename _Value> requires Arithmetic<_Value>
 BasicVector4<_Value>& BasicVector4<_Value>::operator/=(_Value rhs)
 {
+    if constexpr (std::is_same_v<_Value, float>)
+    {
+        (Float4::Load(&x) / Float4::Splat(rhs)).Store(&x);
+        return *this;
+    }
+
     x /= rhs;
     y /= rhs;
     z /= rhs;
@@ -290,6 +343,13 @@ _Value BasicVector4<_Value>::LengthSq() const noexcept
 template <typename _Value> requires Arithmetic<_Value>
 void BasicVector4<_Value>::Normalize()
 {
+    if constexpr (std::is_same_v<_Value, float>)
+    {
+        const auto v = Float4::Load(&x);
+        (v / Float4::Sqrt(Float4::Splat(Float4::Dot(v, v)))).Store(&x);
+        return;
+    }
+
     _Value length = this->Length();
     
     x = x / length;
@@ -301,11 +361,27 @@ void BasicVector4<_Value>::Normalize()
 template <typename _Value> requires Arithmetic<_Value>
 BasicVector4<_Value> BasicVector4<_Value>::Normalized() const
 {
+    if constexpr (std::is_same_v<_Value, float>)
+    {
+        BasicVector4 ret(*this);
+        ret.Normalize();
+        return ret;
+    }
+
     _Value length = this->Length();
     
     return BasicVector4(x / length, y / length, z / length, w / length);
 }
 
+template <typename _Value> requires Arithmetic<_Value>
+Float4 BasicVector4<_Value>::MultiplyRows(const Float4& v, const Matrix4x4& matrix) noexcept
+{
+    auto ret = v.Broadcast<0>() * Float4::Load(&matrix.m00);
+    ret = Float4::MultiplyAdd(v.Broadcast<1>(), Float4::Load(&matrix.m10), ret);
+    ret = Float4::MultiplyAdd(v.Broadcast<2>(), Float4::Load(&matrix.m20), ret);
+    return Float4::MultiplyAdd(v.Broadcast<3>(), Float4::Load(&matrix.m30), ret);
+}
+
 template <typename _Value> requires Arithmetic<_Value>
 int32_t BasicVector4<_Value>::ToString(const std::span<char8_t>& destStr) const
 {
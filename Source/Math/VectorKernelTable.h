@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Core/CpuFeature.h"
+
+namespace tg
+{
+
+/**
+ * @brief   The component arrays of the vectors which are stored in the SoA layout.
+ */
+struct ConstFloat3Arrays
+{
+    const float* xs;
+    const float* ys;
+    const float* zs;
+};
+
+struct Float3Arrays
+{
+    float* xs;
+    float* ys;
+    float* zs;
+};
+
+/**
+ * @brief   The batch kernels which are built for one instruction set.
+ * @remark  The kernels work on raw floats, so the translation units which are built with the extended instruction sets
+ *          don't have to include the math types.
+ */
+struct VectorKernelTable
+{
+    SimdLevel level;
+    void(*transformVector4s)(const float* matrix, const float* srcVectors, float* destVectors, size_t count) noexcept;
+    void(*normalizeVector4s)(const float* srcVectors, float* destVectors, size_t count) noexcept;
+    void(*lerpVector4s)(const float* from, const float* to, float t, float* destVectors, size_t count) noexcept;
+    void(*inverseMatrix4x4s)(const float* srcMatrices, float* destMatrices, size_t count) noexcept;
+    void(*affineInverseMatrix4x4s)(const float* srcMatrices, float* destMatrices, size_t count) noexcept;
+    void(*inverseTransposeMatrix4x4s)(const float* srcMatrices, float* destMatrices, size_t count) noexcept;
+    void(*rotateVector3s)(const float* quaternion, const float* srcVectors, float* destVectors, size_t count) noexcept;
+    void(*transformPointVector3s)(const float* matrix, const float* srcVectors, float* destVectors, size_t count) noexcept;
+    void(*transformDirectionVector3s)(const float* matrix, const float* srcVectors, float* destVectors, size_t count) noexcept;
+    void(*minMaxVector3s)(const float* srcVectors, size_t count, float* destMin, float* destMax) noexcept;
+    void(*splitVector3s)(const float* srcVectors, Float3Arrays destVectors, size_t count) noexcept;
+    void(*mergeVector3s)(ConstFloat3Arrays srcVectors, float* destVectors, size_t count) noexcept;
+    void(*transformPoints)(const float* matrix, ConstFloat3Arrays srcVectors, Float3Arrays destVectors, size_t count) noexcept;
+    void(*transformDirections)(const float* matrix, ConstFloat3Arrays srcVectors, Float3Arrays destVectors, size_t count) noexcept;
+    void(*dotVector3s)(ConstFloat3Arrays lhs, ConstFloat3Arrays rhs, float* dest, size_t count) noexcept;
+    void(*crossVector3s)(ConstFloat3Arrays lhs, ConstFloat3Arrays rhs, Float3Arrays dest, size_t count) noexcept;
+    void(*normalizeVector3s)(ConstFloat3Arrays srcVectors, Float3Arrays destVectors, size_t count) noexcept;
+    void(*minMaxFloats)(const float* src, size_t count, float* destMin, float* destMax) noexcept;
+    void(*lerpFloats)(const float* from, const float* to, float t, float* dest, size_t count) noexcept;
+    void(*raycastAABBs)(const float* ray, ConstFloat3Arrays mins, ConstFloat3Arrays maxs, float* destDistances, size_t count) noexcept;
+    void(*raycastTriangles)(const float* ray, ConstFloat3Arrays v0s, ConstFloat3Arrays v1s, ConstFloat3Arrays v2s, float* destDistances, size_t count) noexcept;
+    size_t(*overlapAABBs)(const float* box, ConstFloat3Arrays mins, ConstFloat3Arrays maxs, uint32_t* destIndices, size_t count) noexcept;
+    size_t(*cullSpheres)(const float* planes, ConstFloat3Arrays centers, const float* radii, uint32_t* destIndices, size_t count) noexcept;
+    size_t(*cullAABBs)(const float* planes, ConstFloat3Arrays mins, ConstFloat3Arrays maxs, uint32_t* destIndices, size_t count) noexcept;
+    void(*sinFloats)(const float* src, float* dest, size_t count) noexcept;
+    void(*cosFloats)(const float* src, float* dest, size_t count) noexcept;
+    void(*atan2Floats)(const float* ys, const float* xs, float* dest, size_t count) noexcept;
+    void(*inverseSqrtFloats)(const float* src, float* dest, size_t count) noexcept;
+    void(*sqrtFloats)(const float* src, float* dest, size_t count) noexcept;
+    void(*exp2Floats)(const float* src, float* dest, size_t count) noexcept;
+    void(*log2Floats)(const float* src, float* dest, size_t count) noexcept;
+    void(*expFloats)(const float* src, float* dest, size_t count) noexcept;
+    void(*logFloats)(const float* src, float* dest, size_t count) noexcept;
+    void(*powFloats)(const float* src, float p, float* dest, size_t count) noexcept;
+    void(*floatsToHalves)(const float* src, uint16_t* dest, size_t count) noexcept;
+    void(*halvesToFloats)(const uint16_t* src, float* dest, size_t count) noexcept;
+    void(*encodeOctahedralNormals)(const float* srcNormals, int16_t* destNormals, size_t count) noexcept;
+
+    /**
+     * @brief   The transform holds the center of the bounds and the scale of QuantizedPosition::GetQuantizationScale.
+     */
+    void(*quantizePositions)(const float* transform, const float* srcPositions, int16_t* destPositions, size_t count) noexcept;
+    void(*floatsToUnorm8s)(const float* src, uint8_t* dest, size_t count) noexcept;
+    void(*multiplyMatrix3x4s)(const float* lhsMatrices, const float* rhsMatrices, float* destMatrices, size_t count) noexcept;
+    void(*inverseMatrix3x4s)(const float* srcMatrices, float* destMatrices, size_t count) noexcept;
+};
+
+/**
+ * @brief   Gets the kernels which are built for the specified level.
+ * @param level     The SIMD level.
+ * @return  The kernels or nullptr if they aren't built into this binary.
+ * @remark  It doesn't check whether the processor supports the level.
+ */
+[[nodiscard]] const VectorKernelTable* GetVectorKernelTable(SimdLevel level) noexcept;
+[[nodiscard]] const VectorKernelTable* GetSse41VectorKernelTable() noexcept;
+[[nodiscard]] const VectorKernelTable* GetAvx2VectorKernelTable() noexcept;
+
+}
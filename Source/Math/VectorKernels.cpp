@@ -0,0 +1,915 @@
+#include "PrecompiledHeader.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cfloat>
+
+#include "Core/Simd.h"
+
+#include "FastMathConstants.h"
+#include "Mathf.h"
+#include "VectorKernels.h"
+#include "VectorKernelTable.h"
+
+#if TGON_SIMD_SSE2 || TGON_SIMD_NEON
+#include "VectorKernels.inl"
+#endif
+
+namespace tg
+{
+namespace
+{
+
+void TransformVector4sScalar(const float* matrix, const float* srcVectors, float* destVectors, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 4; i += 4)
+    {
+        const float x = srcVectors[i], y = srcVectors[i + 1], z = srcVectors[i + 2], w = srcVectors[i + 3];
+        for (size_t j = 0; j < 4; ++j)
+        {
+            destVectors[i + j] = (x * matrix[j]) + (y * matrix[4 + j]) + (z * matrix[8 + j]) + (w * matrix[12 + j]);
+        }
+    }
+}
+
+void NormalizeVector4sScalar(const float* srcVectors, float* destVectors, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 4; i += 4)
+    {
+        const float x = srcVectors[i], y = srcVectors[i + 1], z = srcVectors[i + 2], w = srcVectors[i + 3];
+        const float length = std::sqrt((x * x) + (y * y) + (z * z) + (w * w));
+        destVectors[i] = x / length;
+        destVectors[i + 1] = y / length;
+        destVectors[i + 2] = z / length;
+        destVectors[i + 3] = w / length;
+    }
+}
+
+void LerpVector4sScalar(const float* from, const float* to, float t, float* destVectors, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 4; ++i)
+    {
+        destVectors[i] = from[i] + ((to[i] - from[i]) * t);
+    }
+}
+
+void InverseMatrix4x4sScalar(const float* srcMatrices, float* destMatrices, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 16; i += 16)
+    {
+        const float* m = &srcMatrices[i];
+
+        // Expand the determinant by the 2x2 minors of the upper and the lower two rows.
+        const float s0 = m[0] * m[5] - m[4] * m[1];
+        const float s1 = m[0] * m[6] - m[4] * m[2];
+        const float s2 = m[0] * m[7] - m[4] * m[3];
+        const float s3 = m[1] * m[6] - m[5] * m[2];
+        const float s4 = m[1] * m[7] - m[5] * m[3];
+        const float s5 = m[2] * m[7] - m[6] * m[3];
+        const float c5 = m[10] * m[15] - m[14] * m[11];
+        const float c4 = m[9] * m[15] - m[13] * m[11];
+        const float c3 = m[9] * m[14] - m[13] * m[10];
+        const float c2 = m[8] * m[15] - m[12] * m[11];
+        const float c1 = m[8] * m[14] - m[12] * m[10];
+        const float c0 = m[8] * m[13] - m[12] * m[9];
+        const float reciprocal = 1.0f / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+        const float inverse[16] = {
+            (m[5] * c5 - m[6] * c4 + m[7] * c3) * reciprocal,
+            (-m[1] * c5 + m[2] * c4 - m[3] * c3) * reciprocal,
+            (m[13] * s5 - m[14] * s4 + m[15] * s3) * reciprocal,
+            (-m[9] * s5 + m[10] * s4 - m[11] * s3) * reciprocal,
+
+            (-m[4] * c5 + m[6] * c2 - m[7] * c1) * reciprocal,
+            (m[0] * c5 - m[2] * c2 + m[3] * c1) * reciprocal,
+            (-m[12] * s5 + m[14] * s2 - m[15] * s1) * reciprocal,
+            (m[8] * s5 - m[10] * s2 + m[11] * s1) * reciprocal,
+
+            (m[4] * c4 - m[5] * c2 + m[7] * c0) * reciprocal,
+            (-m[0] * c4 + m[1] * c2 - m[3] * c0) * reciprocal,
+            (m[12] * s4 - m[13] * s2 + m[15] * s0) * reciprocal,
+            (-m[8] * s4 + m[9] * s2 - m[11] * s0) * reciprocal,
+
+            (-m[4] * c3 + m[5] * c1 - m[6] * c0) * reciprocal,
+            (m[0] * c3 - m[1] * c1 + m[2] * c0) * reciprocal,
+            (-m[12] * s3 + m[13] * s1 - m[14] * s0) * reciprocal,
+            (m[8] * s3 - m[9] * s1 + m[10] * s0) * reciprocal,
+        };
+        std::copy(std::begin(inverse), std::end(inverse), &destMatrices[i]);
+    }
+}
+
+void InverseTransposeMatrix4x4sScalar(const float* srcMatrices, float* destMatrices, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 16; i += 16)
+    {
+        const float* m = &srcMatrices[i];
+        const float cofactors[9] = {
+            m[5] * m[10] - m[6] * m[9], m[6] * m[8] - m[4] * m[10], m[4] * m[9] - m[5] * m[8],
+            m[9] * m[2] - m[10] * m[1], m[10] * m[0] - m[8] * m[2], m[8] * m[1] - m[9] * m[0],
+            m[1] * m[6] - m[2] * m[5], m[2] * m[4] - m[0] * m[6], m[0] * m[5] - m[1] * m[4],
+        };
+        const float reciprocal = 1.0f / (m[0] * cofactors[0] + m[1] * cofactors[1] + m[2] * cofactors[2]);
+
+        float* dest = &destMatrices[i];
+        for (size_t row = 0; row < 3; ++row)
+        {
+            dest[row * 4] = cofactors[row * 3] * reciprocal;
+            dest[row * 4 + 1] = cofactors[row * 3 + 1] * reciprocal;
+            dest[row * 4 + 2] = cofactors[row * 3 + 2] * reciprocal;
+            dest[row * 4 + 3] = 0.0f;
+        }
+        dest[12] = 0.0f;
+        dest[13] = 0.0f;
+        dest[14] = 0.0f;
+        dest[15] = 1.0f;
+    }
+}
+
+void AffineInverseMatrix4x4sScalar(const float* srcMatrices, float* destMatrices, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 16; i += 16)
+    {
+        const float translation[3] = {srcMatrices[i + 12], srcMatrices[i + 13], srcMatrices[i + 14]};
+
+        // The inverse of the 3x3 part is the transpose of its inverse transpose.
+        float inverseTranspose[16];
+        InverseTransposeMatrix4x4sScalar(&srcMatrices[i], inverseTranspose, 1);
+
+        float* dest = &destMatrices[i];
+        for (size_t row = 0; row < 4; ++row)
+        {
+            for (size_t column = 0; column < 4; ++column)
+            {
+                dest[row * 4 + column] = inverseTranspose[column * 4 + row];
+            }
+        }
+        for (size_t column = 0; column < 3; ++column)
+        {
+            dest[12 + column] = -((translation[0] * dest[column]) + (translation[1] * dest[4 + column]) + (translation[2] * dest[8 + column]));
+        }
+    }
+}
+
+void RotateVector3sScalar(const float* quaternion, const float* srcVectors, float* destVectors, size_t count) noexcept
+{
+    const auto rotation = Quaternion(quaternion[0], quaternion[1], quaternion[2], quaternion[3]).ToMatrix();
+    for (size_t i = 0; i < count * 3; i += 3)
+    {
+        const float x = srcVectors[i], y = srcVectors[i + 1], z = srcVectors[i + 2];
+        destVectors[i] = (x * rotation.m00) + (y * rotation.m10) + (z * rotation.m20);
+        destVectors[i + 1] = (x * rotation.m01) + (y * rotation.m11) + (z * rotation.m21);
+        destVectors[i + 2] = (x * rotation.m02) + (y * rotation.m12) + (z * rotation.m22);
+    }
+}
+
+template <bool _IsPoint>
+void TransformVector3sScalar(const float* matrix, const float* srcVectors, float* destVectors, size_t count) noexcept
+{
+    const float w = _IsPoint ? 1.0f : 0.0f;
+    for (size_t i = 0; i < count * 3; i += 3)
+    {
+        const float x = srcVectors[i], y = srcVectors[i + 1], z = srcVectors[i + 2];
+        for (size_t j = 0; j < 3; ++j)
+        {
+            destVectors[i + j] = (x * matrix[j]) + (y * matrix[4 + j]) + (z * matrix[8 + j]) + (w * matrix[12 + j]);
+        }
+    }
+}
+
+void MinMaxVector3sScalar(const float* srcVectors, size_t count, float* destMin, float* destMax) noexcept
+{
+    for (size_t j = 0; j < 3; ++j)
+    {
+        destMin[j] = INFINITY;
+        destMax[j] = -INFINITY;
+    }
+
+    for (size_t i = 0; i < count * 3; i += 3)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            destMin[j] = std::min(destMin[j], srcVectors[i + j]);
+            destMax[j] = std::max(destMax[j], srcVectors[i + j]);
+        }
+    }
+}
+
+void SplitVector3sScalar(const float* srcVectors, Float3Arrays destVectors, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        destVectors.xs[i] = srcVectors[i * 3];
+        destVectors.ys[i] = srcVectors[i * 3 + 1];
+        destVectors.zs[i] = srcVectors[i * 3 + 2];
+    }
+}
+
+void MergeVector3sScalar(ConstFloat3Arrays srcVectors, float* destVectors, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        destVectors[i * 3] = srcVectors.xs[i];
+        destVectors[i * 3 + 1] = srcVectors.ys[i];
+        destVectors[i * 3 + 2] = srcVectors.zs[i];
+    }
+}
+
+template <bool _IsPoint>
+void TransformFloat3ArraysScalar(const float* matrix, ConstFloat3Arrays srcVectors, Float3Arrays destVectors, size_t count) noexcept
+{
+    const float w = _IsPoint ? 1.0f : 0.0f;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float x = srcVectors.xs[i], y = srcVectors.ys[i], z = srcVectors.zs[i];
+        destVectors.xs[i] = (x * matrix[0]) + (y * matrix[4]) + (z * matrix[8]) + (w * matrix[12]);
+        destVectors.ys[i] = (x * matrix[1]) + (y * matrix[5]) + (z * matrix[9]) + (w * matrix[13]);
+        destVectors.zs[i] = (x * matrix[2]) + (y * matrix[6]) + (z * matrix[10]) + (w * matrix[14]);
+    }
+}
+
+void DotVector3sScalar(ConstFloat3Arrays lhs, ConstFloat3Arrays rhs, float* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = (lhs.xs[i] * rhs.xs[i]) + (lhs.ys[i] * rhs.ys[i]) + (lhs.zs[i] * rhs.zs[i]);
+    }
+}
+
+void CrossVector3sScalar(ConstFloat3Arrays lhs, ConstFloat3Arrays rhs, Float3Arrays dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto cross = Vector3::Cross({lhs.xs[i], lhs.ys[i], lhs.zs[i]}, {rhs.xs[i], rhs.ys[i], rhs.zs[i]});
+        dest.xs[i] = cross.x;
+        dest.ys[i] = cross.y;
+        dest.zs[i] = cross.z;
+    }
+}
+
+void NormalizeVector3sScalar(ConstFloat3Arrays srcVectors, Float3Arrays destVectors, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float x = srcVectors.xs[i], y = srcVectors.ys[i], z = srcVectors.zs[i];
+        const float length = std::sqrt((x * x) + (y * y) + (z * z));
+        destVectors.xs[i] = x / length;
+        destVectors.ys[i] = y / length;
+        destVectors.zs[i] = z / length;
+    }
+}
+
+void MinMaxFloatsScalar(const float* src, size_t count, float* destMin, float* destMax) noexcept
+{
+    *destMin = INFINITY;
+    *destMax = -INFINITY;
+    for (size_t i = 0; i < count; ++i)
+    {
+        *destMin = std::min(*destMin, src[i]);
+        *destMax = std::max(*destMax, src[i]);
+    }
+}
+
+void LerpFloatsScalar(const float* from, const float* to, float t, float* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = from[i] + ((to[i] - from[i]) * t);
+    }
+}
+
+void RaycastAABBsScalar(const float* ray, ConstFloat3Arrays mins, ConstFloat3Arrays maxs, float* destDistances, size_t count) noexcept
+{
+    const Ray r({ray[0], ray[1], ray[2]}, {ray[3], ray[4], ray[5]});
+    for (size_t i = 0; i < count; ++i)
+    {
+        destDistances[i] = r.Raycast(AABB({mins.xs[i], mins.ys[i], mins.zs[i]}, {maxs.xs[i], maxs.ys[i], maxs.zs[i]})).value_or(INFINITY);
+    }
+}
+
+void RaycastTrianglesScalar(const float* ray, ConstFloat3Arrays v0s, ConstFloat3Arrays v1s, ConstFloat3Arrays v2s, float* destDistances, size_t count) noexcept
+{
+    const Ray r({ray[0], ray[1], ray[2]}, {ray[3], ray[4], ray[5]});
+    for (size_t i = 0; i < count; ++i)
+    {
+        destDistances[i] = r.Raycast({v0s.xs[i], v0s.ys[i], v0s.zs[i]}, {v1s.xs[i], v1s.ys[i], v1s.zs[i]}, {v2s.xs[i], v2s.ys[i], v2s.zs[i]}).value_or(INFINITY);
+    }
+}
+
+size_t OverlapAABBsScalar(const float* box, ConstFloat3Arrays mins, ConstFloat3Arrays maxs, uint32_t* destIndices, size_t count) noexcept
+{
+    const AABB b({box[0], box[1], box[2]}, {box[3], box[4], box[5]});
+    size_t overlapCount = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (b.Intersect(AABB({mins.xs[i], mins.ys[i], mins.zs[i]}, {maxs.xs[i], maxs.ys[i], maxs.zs[i]})))
+        {
+            destIndices[overlapCount++] = static_cast<uint32_t>(i);
+        }
+    }
+    return overlapCount;
+}
+
+Frustum MakeFrustum(const float* planes) noexcept
+{
+    Frustum frustum;
+    for (size_t i = 0; i < frustum.planes.size(); ++i)
+    {
+        frustum.planes[i] = Plane({planes[i * 4], planes[i * 4 + 1], planes[i * 4 + 2]}, planes[i * 4 + 3]);
+    }
+    return frustum;
+}
+
+size_t CullSpheresScalar(const float* planes, ConstFloat3Arrays centers, const float* radii, uint32_t* destIndices, size_t count) noexcept
+{
+    const auto frustum = MakeFrustum(planes);
+
+    size_t visibleCount = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (frustum.Intersect(Sphere({centers.xs[i], centers.ys[i], centers.zs[i]}, radii[i])))
+        {
+            destIndices[visibleCount++] = static_cast<uint32_t>(i);
+        }
+    }
+    return visibleCount;
+}
+
+size_t CullAABBsScalar(const float* planes, ConstFloat3Arrays mins, ConstFloat3Arrays maxs, uint32_t* destIndices, size_t count) noexcept
+{
+    const auto frustum = MakeFrustum(planes);
+
+    size_t visibleCount = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (frustum.Intersect(AABB({mins.xs[i], mins.ys[i], mins.zs[i]}, {maxs.xs[i], maxs.ys[i], maxs.zs[i]})))
+        {
+            destIndices[visibleCount++] = static_cast<uint32_t>(i);
+        }
+    }
+    return visibleCount;
+}
+
+void SinFloatsScalar(const float* src, float* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = Mathf::FastSin(src[i]);
+    }
+}
+
+void CosFloatsScalar(const float* src, float* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = Mathf::FastCos(src[i]);
+    }
+}
+
+void Atan2FloatsScalar(const float* ys, const float* xs, float* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = Mathf::FastAtan2(ys[i], xs[i]);
+    }
+}
+
+void InverseSqrtFloatsScalar(const float* src, float* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = Mathf::FastInverseSqrt(src[i]);
+    }
+}
+
+void SqrtFloatsScalar(const float* src, float* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = Mathf::FastSqrt(src[i]);
+    }
+}
+
+void Exp2FloatsScalar(const float* src, float* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = Mathf::FastExp2(src[i]);
+    }
+}
+
+void Log2FloatsScalar(const float* src, float* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = Mathf::FastLog2(src[i]);
+    }
+}
+
+void ExpFloatsScalar(const float* src, float* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = Mathf::FastExp(src[i]);
+    }
+}
+
+void LogFloatsScalar(const float* src, float* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = Mathf::FastLog(src[i]);
+    }
+}
+
+void PowFloatsScalar(const float* src, float p, float* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = Mathf::FastPow(src[i], p);
+    }
+}
+
+void FloatsToHalvesScalar(const float* src, uint16_t* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = Half::ConvertFromFloat(src[i]);
+    }
+}
+
+void HalvesToFloatsScalar(const uint16_t* src, float* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = Half::ConvertToFloat(src[i]);
+    }
+}
+
+void EncodeOctahedralNormalsScalar(const float* srcNormals, int16_t* destNormals, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const OctahedralNormal normal(Vector3(srcNormals[i * 3], srcNormals[i * 3 + 1], srcNormals[i * 3 + 2]));
+        destNormals[i * 2] = normal.x;
+        destNormals[i * 2 + 1] = normal.y;
+    }
+}
+
+void QuantizePositionsScalar(const float* transform, const float* srcPositions, int16_t* destPositions, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 3; ++i)
+    {
+        const auto scaled = (srcPositions[i] - transform[i % 3]) * transform[3 + i % 3];
+        destPositions[i / 3 * 4 + i % 3] = static_cast<int16_t>(std::nearbyint(std::clamp(scaled, -32767.0f, 32767.0f)));
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        destPositions[i * 4 + 3] = 0;
+    }
+}
+
+void FloatsToUnorm8sScalar(const float* src, uint8_t* dest, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dest[i] = static_cast<uint8_t>(std::nearbyint(std::clamp(src[i], 0.0f, 1.0f) * 255.0f));
+    }
+}
+
+void MultiplyMatrix3x4sScalar(const float* lhsMatrices, const float* rhsMatrices, float* destMatrices, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 12; i += 12)
+    {
+        const float* a = &lhsMatrices[i];
+        const float* b = &rhsMatrices[i];
+        float m[12];
+        for (size_t row = 0; row < 12; row += 4)
+        {
+            for (size_t column = 0; column < 4; ++column)
+            {
+                m[row + column] = b[row] * a[column] + b[row + 1] * a[4 + column] + b[row + 2] * a[8 + column] + (column == 3 ? b[row + 3] : 0.0f);
+            }
+        }
+        std::copy(m, m + 12, &destMatrices[i]);
+    }
+}
+
+void InverseMatrix3x4sScalar(const float* srcMatrices, float* destMatrices, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 12; i += 12)
+    {
+        const float* m = &srcMatrices[i];
+
+        // The rows of the inverted 3x3 part are the transposed cross products of the rows.
+        const float c00 = m[5] * m[10] - m[6] * m[9], c01 = m[6] * m[8] - m[4] * m[10], c02 = m[4] * m[9] - m[5] * m[8];
+        const float c10 = m[9] * m[2] - m[10] * m[1], c11 = m[10] * m[0] - m[8] * m[2], c12 = m[8] * m[1] - m[9] * m[0];
+        const float c20 = m[1] * m[6] - m[2] * m[5], c21 = m[2] * m[4] - m[0] * m[6], c22 = m[0] * m[5] - m[1] * m[4];
+        const float reciprocal = 1.0f / (m[0] * c00 + m[1] * c01 + m[2] * c02);
+
+        const float inverse[9] = {
+            c00 * reciprocal, c10 * reciprocal, c20 * reciprocal,
+            c01 * reciprocal, c11 * reciprocal, c21 * reciprocal,
+            c02 * reciprocal, c12 * reciprocal, c22 * reciprocal,
+        };
+        const float translation[3] = {m[3], m[7], m[11]};
+
+        float* dest = &destMatrices[i];
+        for (size_t row = 0; row < 3; ++row)
+        {
+            const float* r = &inverse[row * 3];
+            dest[row * 4] = r[0];
+            dest[row * 4 + 1] = r[1];
+            dest[row * 4 + 2] = r[2];
+            dest[row * 4 + 3] = -(r[0] * translation[0] + r[1] * translation[1] + r[2] * translation[2]);
+        }
+    }
+}
+
+constexpr VectorKernelTable g_scalarVectorKernelTable{
+    SimdLevel::Scalar,
+    TransformVector4sScalar,
+    NormalizeVector4sScalar,
+    LerpVector4sScalar,
+    InverseMatrix4x4sScalar,
+    AffineInverseMatrix4x4sScalar,
+    InverseTransposeMatrix4x4sScalar,
+    RotateVector3sScalar,
+    TransformVector3sScalar<true>,
+    TransformVector3sScalar<false>,
+    MinMaxVector3sScalar,
+    SplitVector3sScalar,
+    MergeVector3sScalar,
+    TransformFloat3ArraysScalar<true>,
+    TransformFloat3ArraysScalar<false>,
+    DotVector3sScalar,
+    CrossVector3sScalar,
+    NormalizeVector3sScalar,
+    MinMaxFloatsScalar,
+    LerpFloatsScalar,
+    RaycastAABBsScalar,
+    RaycastTrianglesScalar,
+    OverlapAABBsScalar,
+    CullSpheresScalar,
+    CullAABBsScalar,
+    SinFloatsScalar,
+    CosFloatsScalar,
+    Atan2FloatsScalar,
+    InverseSqrtFloatsScalar,
+    SqrtFloatsScalar,
+    Exp2FloatsScalar,
+    Log2FloatsScalar,
+    ExpFloatsScalar,
+    LogFloatsScalar,
+    PowFloatsScalar,
+    FloatsToHalvesScalar,
+    HalvesToFloatsScalar,
+    EncodeOctahedralNormalsScalar,
+    QuantizePositionsScalar,
+    FloatsToUnorm8sScalar,
+    MultiplyMatrix3x4sScalar,
+    InverseMatrix3x4sScalar
+};
+
+// The kernels read the planes, the rays and the boxes as packed floats.
+static_assert(sizeof(Plane) == sizeof(float) * 4 && sizeof(Ray) == sizeof(float) * 6 && sizeof(AABB) == sizeof(float) * 6);
+
+// The kernels write the packed types as the arrays of their components.
+static_assert(sizeof(Half) == sizeof(uint16_t) && sizeof(Color32) == sizeof(uint8_t) * 4);
+static_assert(sizeof(OctahedralNormal) == sizeof(int16_t) * 2 && sizeof(QuantizedPosition) == sizeof(int16_t) * 4);
+static_assert(sizeof(Matrix3x4) == sizeof(float) * 12);
+
+const VectorKernelTable& SelectVectorKernelTable() noexcept
+{
+    for (auto level : {SimdLevel::Avx2, SimdLevel::Sse41, SimdLevel::Sse2, SimdLevel::Neon})
+    {
+        if (CpuFeature::IsSupported(level) == false)
+        {
+            continue;
+        }
+
+        if (const auto* kernelTable = GetVectorKernelTable(level); kernelTable != nullptr)
+        {
+            return *kernelTable;
+        }
+    }
+
+    return g_scalarVectorKernelTable;
+}
+
+ConstFloat3Arrays ToFloat3Arrays(ConstVector3SoA vectors) noexcept
+{
+    return {vectors.xs.data(), vectors.ys.data(), vectors.zs.data()};
+}
+
+Float3Arrays ToFloat3Arrays(Vector3SoA vectors) noexcept
+{
+    return {vectors.xs.data(), vectors.ys.data(), vectors.zs.data()};
+}
+
+const VectorKernelTable& GetSelectedVectorKernelTable() noexcept
+{
+    static const VectorKernelTable& kernelTable = SelectVectorKernelTable();
+    return kernelTable;
+}
+
+}
+
+const VectorKernelTable* GetVectorKernelTable(SimdLevel level) noexcept
+{
+    switch (level)
+    {
+    case SimdLevel::Scalar:
+        return &g_scalarVectorKernelTable;
+    case SimdLevel::Sse2:
+    case SimdLevel::Neon:
+#if TGON_SIMD_SSE2 || TGON_SIMD_NEON
+        return g_simdVectorKernelTable.level == level ? &g_simdVectorKernelTable : nullptr;
+#else
+        return nullptr;
+#endif
+    case SimdLevel::Sse41:
+        return GetSse41VectorKernelTable();
+    case SimdLevel::Avx2:
+        return GetAvx2VectorKernelTable();
+    }
+
+    return nullptr;
+}
+
+void VectorKernels::Transform(const Matrix4x4& matrix, std::span<const Vector4> srcVectors, std::span<Vector4> destVectors) noexcept
+{
+    assert(destVectors.size() >= srcVectors.size());
+    GetSelectedVectorKernelTable().transformVector4s(&matrix.m00, reinterpret_cast<const float*>(srcVectors.data()), reinterpret_cast<float*>(destVectors.data()), srcVectors.size());
+}
+
+void VectorKernels::Normalize(std::span<const Vector4> srcVectors, std::span<Vector4> destVectors) noexcept
+{
+    assert(destVectors.size() >= srcVectors.size());
+    GetSelectedVectorKernelTable().normalizeVector4s(reinterpret_cast<const float*>(srcVectors.data()), reinterpret_cast<float*>(destVectors.data()), srcVectors.size());
+}
+
+void VectorKernels::Lerp(std::span<const Vector4> from, std::span<const Vector4> to, float t, std::span<Vector4> destVectors) noexcept
+{
+    assert(to.size() >= from.size() && destVectors.size() >= from.size());
+    GetSelectedVectorKernelTable().lerpVector4s(reinterpret_cast<const float*>(from.data()), reinterpret_cast<const float*>(to.data()), std::clamp(t, 0.0f, 1.0f), reinterpret_cast<float*>(destVectors.data()), from.size());
+}
+
+void VectorKernels::Lerp(std::span<const Color> from, std::span<const Color> to, float t, std::span<Color> destColors) noexcept
+{
+    assert(to.size() >= from.size() && destColors.size() >= from.size());
+    GetSelectedVectorKernelTable().lerpVector4s(reinterpret_cast<const float*>(from.data()), reinterpret_cast<const float*>(to.data()), std::clamp(t, 0.0f, 1.0f), reinterpret_cast<float*>(destColors.data()), from.size());
+}
+
+void VectorKernels::Inverse(std::span<const Matrix4x4> srcMatrices, std::span<Matrix4x4> destMatrices) noexcept
+{
+    assert(destMatrices.size() >= srcMatrices.size());
+    GetSelectedVectorKernelTable().inverseMatrix4x4s(reinterpret_cast<const float*>(srcMatrices.data()), reinterpret_cast<float*>(destMatrices.data()), srcMatrices.size());
+}
+
+void VectorKernels::AffineInverse(std::span<const Matrix4x4> srcMatrices, std::span<Matrix4x4> destMatrices) noexcept
+{
+    assert(destMatrices.size() >= srcMatrices.size());
+    GetSelectedVectorKernelTable().affineInverseMatrix4x4s(reinterpret_cast<const float*>(srcMatrices.data()), reinterpret_cast<float*>(destMatrices.data()), srcMatrices.size());
+}
+
+void VectorKernels::InverseTranspose(std::span<const Matrix4x4> srcMatrices, std::span<Matrix4x4> destMatrices) noexcept
+{
+    assert(destMatrices.size() >= srcMatrices.size());
+    GetSelectedVectorKernelTable().inverseTransposeMatrix4x4s(reinterpret_cast<const float*>(srcMatrices.data()), reinterpret_cast<float*>(destMatrices.data()), srcMatrices.size());
+}
+
+void VectorKernels::Multiply(std::span<const Matrix3x4> lhs, std::span<const Matrix3x4> rhs, std::span<Matrix3x4> destMatrices) noexcept
+{
+    assert(rhs.size() >= lhs.size() && destMatrices.size() >= lhs.size());
+    GetSelectedVectorKernelTable().multiplyMatrix3x4s(reinterpret_cast<const float*>(lhs.data()), reinterpret_cast<const float*>(rhs.data()), reinterpret_cast<float*>(destMatrices.data()), lhs.size());
+}
+
+void VectorKernels::Inverse(std::span<const Matrix3x4> srcMatrices, std::span<Matrix3x4> destMatrices) noexcept
+{
+    assert(destMatrices.size() >= srcMatrices.size());
+    GetSelectedVectorKernelTable().inverseMatrix3x4s(reinterpret_cast<const float*>(srcMatrices.data()), reinterpret_cast<float*>(destMatrices.data()), srcMatrices.size());
+}
+
+void VectorKernels::Rotate(const Quaternion& rotation, std::span<const Vector3> srcVectors, std::span<Vector3> destVectors) noexcept
+{
+    assert(destVectors.size() >= srcVectors.size());
+    GetSelectedVectorKernelTable().rotateVector3s(&rotation.x, reinterpret_cast<const float*>(srcVectors.data()), reinterpret_cast<float*>(destVectors.data()), srcVectors.size());
+}
+
+void VectorKernels::TransformPoints(const Matrix4x4& matrix, std::span<const Vector3> srcVectors, std::span<Vector3> destVectors) noexcept
+{
+    assert(destVectors.size() >= srcVectors.size());
+    GetSelectedVectorKernelTable().transformPointVector3s(&matrix.m00, &srcVectors.data()->x, &destVectors.data()->x, srcVectors.size());
+}
+
+void VectorKernels::TransformPoints(const Matrix4x4& matrix, ConstVector3SoA srcVectors, Vector3SoA destVectors) noexcept
+{
+    assert(destVectors.GetSize() >= srcVectors.GetSize());
+    GetSelectedVectorKernelTable().transformPoints(&matrix.m00, ToFloat3Arrays(srcVectors), ToFloat3Arrays(destVectors), srcVectors.GetSize());
+}
+
+void VectorKernels::TransformDirections(const Matrix4x4& matrix, std::span<const Vector3> srcVectors, std::span<Vector3> destVectors) noexcept
+{
+    assert(destVectors.size() >= srcVectors.size());
+    GetSelectedVectorKernelTable().transformDirectionVector3s(&matrix.m00, &srcVectors.data()->x, &destVectors.data()->x, srcVectors.size());
+}
+
+void VectorKernels::TransformDirections(const Matrix4x4& matrix, ConstVector3SoA srcVectors, Vector3SoA destVectors) noexcept
+{
+    assert(destVectors.GetSize() >= srcVectors.GetSize());
+    GetSelectedVectorKernelTable().transformDirections(&matrix.m00, ToFloat3Arrays(srcVectors), ToFloat3Arrays(destVectors), srcVectors.GetSize());
+}
+
+void VectorKernels::Dot(ConstVector3SoA lhs, ConstVector3SoA rhs, std::span<float> dest) noexcept
+{
+    assert(rhs.GetSize() >= lhs.GetSize() && dest.size() >= lhs.GetSize());
+    GetSelectedVectorKernelTable().dotVector3s(ToFloat3Arrays(lhs), ToFloat3Arrays(rhs), dest.data(), lhs.GetSize());
+}
+
+void VectorKernels::Cross(ConstVector3SoA lhs, ConstVector3SoA rhs, Vector3SoA dest) noexcept
+{
+    assert(rhs.GetSize() >= lhs.GetSize() && dest.GetSize() >= lhs.GetSize());
+    GetSelectedVectorKernelTable().crossVector3s(ToFloat3Arrays(lhs), ToFloat3Arrays(rhs), ToFloat3Arrays(dest), lhs.GetSize());
+}
+
+void VectorKernels::Normalize(ConstVector3SoA srcVectors, Vector3SoA destVectors) noexcept
+{
+    assert(destVectors.GetSize() >= srcVectors.GetSize());
+    GetSelectedVectorKernelTable().normalizeVector3s(ToFloat3Arrays(srcVectors), ToFloat3Arrays(destVectors), srcVectors.GetSize());
+}
+
+void VectorKernels::MinMax(std::span<const Vector3> vectors, Vector3& min, Vector3& max) noexcept
+{
+    GetSelectedVectorKernelTable().minMaxVector3s(&vectors.data()->x, vectors.size(), &min.x, &max.x);
+}
+
+void VectorKernels::MinMax(ConstVector3SoA vectors, Vector3& min, Vector3& max) noexcept
+{
+    const auto& kernelTable = GetSelectedVectorKernelTable();
+    kernelTable.minMaxFloats(vectors.xs.data(), vectors.GetSize(), &min.x, &max.x);
+    kernelTable.minMaxFloats(vectors.ys.data(), vectors.GetSize(), &min.y, &max.y);
+    kernelTable.minMaxFloats(vectors.zs.data(), vectors.GetSize(), &min.z, &max.z);
+}
+
+void VectorKernels::MinMax(std::span<const float> values, float& min, float& max) noexcept
+{
+    GetSelectedVectorKernelTable().minMaxFloats(values.data(), values.size(), &min, &max);
+}
+
+void VectorKernels::Lerp(std::span<const float> from, std::span<const float> to, float t, std::span<float> dest) noexcept
+{
+    assert(to.size() >= from.size() && dest.size() >= from.size());
+    GetSelectedVectorKernelTable().lerpFloats(from.data(), to.data(), std::clamp(t, 0.0f, 1.0f), dest.data(), from.size());
+}
+
+void VectorKernels::Lerp(ConstVector3SoA from, ConstVector3SoA to, float t, Vector3SoA destVectors) noexcept
+{
+    Lerp(from.xs, to.xs, t, destVectors.xs);
+    Lerp(from.ys, to.ys, t, destVectors.ys);
+    Lerp(from.zs, to.zs, t, destVectors.zs);
+}
+
+void VectorKernels::Split(std::span<const Vector3> srcVectors, Vector3SoA destVectors) noexcept
+{
+    assert(destVectors.GetSize() >= srcVectors.size());
+    GetSelectedVectorKernelTable().splitVector3s(&srcVectors.data()->x, ToFloat3Arrays(destVectors), srcVectors.size());
+}
+
+void VectorKernels::Merge(ConstVector3SoA srcVectors, std::span<Vector3> destVectors) noexcept
+{
+    assert(destVectors.size() >= srcVectors.GetSize());
+    GetSelectedVectorKernelTable().mergeVector3s(ToFloat3Arrays(srcVectors), &destVectors.data()->x, srcVectors.GetSize());
+}
+
+void VectorKernels::Raycast(const Ray& ray, const AABBSoA& boxes, std::span<float> destDistances) noexcept
+{
+    assert(boxes.maxs.GetSize() >= boxes.mins.GetSize() && destDistances.size() >= boxes.mins.GetSize());
+    GetSelectedVectorKernelTable().raycastAABBs(&ray.origin.x, ToFloat3Arrays(boxes.mins), ToFloat3Arrays(boxes.maxs), destDistances.data(), boxes.mins.GetSize());
+}
+
+void VectorKernels::Raycast(const Ray& ray, const TriangleSoA& triangles, std::span<float> destDistances) noexcept
+{
+    assert(triangles.v1s.GetSize() >= triangles.v0s.GetSize() && triangles.v2s.GetSize() >= triangles.v0s.GetSize() && destDistances.size() >= triangles.v0s.GetSize());
+    GetSelectedVectorKernelTable().raycastTriangles(&ray.origin.x, ToFloat3Arrays(triangles.v0s), ToFloat3Arrays(triangles.v1s), ToFloat3Arrays(triangles.v2s), destDistances.data(), triangles.v0s.GetSize());
+}
+
+size_t VectorKernels::Overlap(const AABB& box, const AABBSoA& boxes, std::span<uint32_t> destIndices) noexcept
+{
+    assert(boxes.maxs.GetSize() >= boxes.mins.GetSize() && destIndices.size() >= boxes.mins.GetSize());
+    return GetSelectedVectorKernelTable().overlapAABBs(&box.min.x, ToFloat3Arrays(boxes.mins), ToFloat3Arrays(boxes.maxs), destIndices.data(), boxes.mins.GetSize());
+}
+
+size_t VectorKernels::Cull(const Frustum& frustum, const SphereSoA& spheres, std::span<uint32_t> destIndices) noexcept
+{
+    assert(spheres.radii.size() >= spheres.centers.GetSize() && destIndices.size() >= spheres.centers.GetSize());
+    return GetSelectedVectorKernelTable().cullSpheres(&frustum.planes[0].normal.x, ToFloat3Arrays(spheres.centers), spheres.radii.data(), destIndices.data(), spheres.centers.GetSize());
+}
+
+size_t VectorKernels::Cull(const Frustum& frustum, const AABBSoA& boxes, std::span<uint32_t> destIndices) noexcept
+{
+    assert(boxes.maxs.GetSize() >= boxes.mins.GetSize() && destIndices.size() >= boxes.mins.GetSize());
+    return GetSelectedVectorKernelTable().cullAABBs(&frustum.planes[0].normal.x, ToFloat3Arrays(boxes.mins), ToFloat3Arrays(boxes.maxs), destIndices.data(), boxes.mins.GetSize());
+}
+
+void VectorKernels::FastSin(std::span<const float> src, std::span<float> dest) noexcept
+{
+    assert(dest.size() >= src.size());
+    GetSelectedVectorKernelTable().sinFloats(src.data(), dest.data(), src.size());
+}
+
+void VectorKernels::FastCos(std::span<const float> src, std::span<float> dest) noexcept
+{
+    assert(dest.size() >= src.size());
+    GetSelectedVectorKernelTable().cosFloats(src.data(), dest.data(), src.size());
+}
+
+void VectorKernels::FastAtan2(std::span<const float> ys, std::span<const float> xs, std::span<float> dest) noexcept
+{
+    assert(xs.size() >= ys.size() && dest.size() >= ys.size());
+    GetSelectedVectorKernelTable().atan2Floats(ys.data(), xs.data(), dest.data(), ys.size());
+}
+
+void VectorKernels::FastInverseSqrt(std::span<const float> src, std::span<float> dest) noexcept
+{
+    assert(dest.size() >= src.size());
+    GetSelectedVectorKernelTable().inverseSqrtFloats(src.data(), dest.data(), src.size());
+}
+
+void VectorKernels::FastSqrt(std::span<const float> src, std::span<float> dest) noexcept
+{
+    assert(dest.size() >= src.size());
+    GetSelectedVectorKernelTable().sqrtFloats(src.data(), dest.data(), src.size());
+}
+
+void VectorKernels::FastExp2(std::span<const float> src, std::span<float> dest) noexcept
+{
+    assert(dest.size() >= src.size());
+    GetSelectedVectorKernelTable().exp2Floats(src.data(), dest.data(), src.size());
+}
+
+void VectorKernels::FastLog2(std::span<const float> src, std::span<float> dest) noexcept
+{
+    assert(dest.size() >= src.size());
+    GetSelectedVectorKernelTable().log2Floats(src.data(), dest.data(), src.size());
+}
+
+void VectorKernels::FastExp(std::span<const float> src, std::span<float> dest) noexcept
+{
+    assert(dest.size() >= src.size());
+    GetSelectedVectorKernelTable().expFloats(src.data(), dest.data(), src.size());
+}
+
+void VectorKernels::FastLog(std::span<const float> src, std::span<float> dest) noexcept
+{
+    assert(dest.size() >= src.size());
+    GetSelectedVectorKernelTable().logFloats(src.data(), dest.data(), src.size());
+}
+
+void VectorKernels::FastPow(std::span<const float> src, float p, std::span<float> dest) noexcept
+{
+    assert(dest.size() >= src.size());
+    GetSelectedVectorKernelTable().powFloats(src.data(), p, dest.data(), src.size());
+}
+
+void VectorKernels::Convert(std::span<const float> src, std::span<Half> dest) noexcept
+{
+    assert(dest.size() >= src.size());
+    GetSelectedVectorKernelTable().floatsToHalves(src.data(), reinterpret_cast<uint16_t*>(dest.data()), src.size());
+}
+
+void VectorKernels::Convert(std::span<const Half> src, std::span<float> dest) noexcept
+{
+    assert(dest.size() >= src.size());
+    GetSelectedVectorKernelTable().halvesToFloats(reinterpret_cast<const uint16_t*>(src.data()), dest.data(), src.size());
+}
+
+void VectorKernels::Convert(std::span<const Color> srcColors, std::span<Color32> destColors) noexcept
+{
+    assert(destColors.size() >= srcColors.size());
+    GetSelectedVectorKernelTable().floatsToUnorm8s(reinterpret_cast<const float*>(srcColors.data()), reinterpret_cast<uint8_t*>(destColors.data()), srcColors.size() * 4);
+}
+
+void VectorKernels::Encode(std::span<const Vector3> srcNormals, std::span<OctahedralNormal> destNormals) noexcept
+{
+    assert(destNormals.size() >= srcNormals.size());
+    GetSelectedVectorKernelTable().encodeOctahedralNormals(reinterpret_cast<const float*>(srcNormals.data()), reinterpret_cast<int16_t*>(destNormals.data()), srcNormals.size());
+}
+
+void VectorKernels::Quantize(const AABB& bounds, std::span<const Vector3> srcPositions, std::span<QuantizedPosition> destPositions) noexcept
+{
+    assert(destPositions.size() >= srcPositions.size());
+
+    const auto center = bounds.GetCenter();
+    const auto scale = QuantizedPosition::GetQuantizationScale(bounds);
+    const float transform[] = {center.x, center.y, center.z, scale.x, scale.y, scale.z};
+    GetSelectedVectorKernelTable().quantizePositions(transform, reinterpret_cast<const float*>(srcPositions.data()), reinterpret_cast<int16_t*>(destPositions.data()), srcPositions.size());
+}
+
+SimdLevel VectorKernels::GetSimdLevel() noexcept
+{
+    return GetSelectedVectorKernelTable().level;
+}
+
+}
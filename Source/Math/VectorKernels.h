@@ -0,0 +1,267 @@
+#pragma once
+
+#include <span>
+
+#include "Core/CpuFeature.h"
+
+#include "Color.h"
+#include "Frustum.h"
+#include "Half.h"
+#include "Matrix3x4.h"
+#include "PackedVector.h"
+#include "Quaternion.h"
+#include "Ray.h"
+#include "Vector3SoA.h"
+#include "Vector4.h"
+
+namespace tg
+{
+
+/**
+ * @brief   Processes arrays of vectors with the widest instruction set which is supported by the running processor.
+ * @remark  The kernels are selected once on the first call, so a single binary runs the best code path on every host.
+ *          The destination can be the same array as the source.
+ */
+class VectorKernels final
+{
+/**@section Constructor */
+public:
+    VectorKernels() = delete;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Multiplies the vectors by the matrix.
+     * @param matrix        The transform matrix.
+     * @param srcVectors    The vectors to transform.
+     * @param destVectors   The transformed vectors. It must be at least as long as srcVectors.
+     */
+    static void Transform(const Matrix4x4& matrix, std::span<const Vector4> srcVectors, std::span<Vector4> destVectors) noexcept;
+
+    /**
+     * @brief   Normalizes the vectors.
+     * @param srcVectors    The vectors to normalize.
+     * @param destVectors   The normalized vectors. It must be at least as long as srcVectors.
+     */
+    static void Normalize(std::span<const Vector4> srcVectors, std::span<Vector4> destVectors) noexcept;
+
+    /**
+     * @brief   Linearly interpolates the pairs of vectors.
+     * @param from          The vectors at t = 0.
+     * @param to            The vectors at t = 1. It must be at least as long as from.
+     * @param t             The interpolation factor which is clamped to [0, 1].
+     * @param destVectors   The interpolated vectors. It must be at least as long as from.
+     */
+    static void Lerp(std::span<const Vector4> from, std::span<const Vector4> to, float t, std::span<Vector4> destVectors) noexcept;
+    static void Lerp(std::span<const Color> from, std::span<const Color> to, float t, std::span<Color> destColors) noexcept;
+
+    /**
+     * @brief   Inverts the matrices. The result is undefined for the singular matrices.
+     * @param srcMatrices   The matrices to invert.
+     * @param destMatrices  The inverted matrices. It must be at least as long as srcMatrices.
+     */
+    static void Inverse(std::span<const Matrix4x4> srcMatrices, std::span<Matrix4x4> destMatrices) noexcept;
+
+    /**
+     * @brief   Inverts the affine matrices whose last column is (0, 0, 0, 1).
+     * @param srcMatrices   The matrices to invert.
+     * @param destMatrices  The inverted matrices. It must be at least as long as srcMatrices.
+     */
+    static void AffineInverse(std::span<const Matrix4x4> srcMatrices, std::span<Matrix4x4> destMatrices) noexcept;
+
+    /**
+     * @brief   Computes the inverse transpose of the upper 3x3 part of the affine matrices, which transforms the normals.
+     * @param srcMatrices   The matrices whose last column is (0, 0, 0, 1).
+     * @param destMatrices  The inverse transpose matrices. It must be at least as long as srcMatrices.
+     */
+    static void InverseTranspose(std::span<const Matrix4x4> srcMatrices, std::span<Matrix4x4> destMatrices) noexcept;
+
+    /**
+     * @brief   Concatenates the affine matrices pairwise, such as the local matrices with the world matrices of their parents.
+     * @param lhs           The matrices which are applied first.
+     * @param rhs           The matrices which are applied next. It must be at least as long as lhs.
+     * @param destMatrices  The concatenated matrices. It must be at least as long as lhs, and it can alias either input.
+     */
+    static void Multiply(std::span<const Matrix3x4> lhs, std::span<const Matrix3x4> rhs, std::span<Matrix3x4> destMatrices) noexcept;
+
+    /**
+     * @brief   Inverts the affine matrices. The result is undefined for the singular matrices.
+     * @param srcMatrices   The matrices to invert.
+     * @param destMatrices  The inverted matrices. It must be at least as long as srcMatrices.
+     */
+    static void Inverse(std::span<const Matrix3x4> srcMatrices, std::span<Matrix3x4> destMatrices) noexcept;
+
+    /**
+     * @brief   Rotates the vectors by the quaternion.
+     * @param rotation      The normalized rotation.
+     * @param srcVectors    The vectors to rotate.
+     * @param destVectors   The rotated vectors. It must be at least as long as srcVectors.
+     */
+    static void Rotate(const Quaternion& rotation, std::span<const Vector3> srcVectors, std::span<Vector3> destVectors) noexcept;
+
+    /**
+     * @brief   Transforms the points by the matrix as if their w were 1.
+     * @param matrix        The affine transform matrix. Its last column is ignored, so there is no perspective divide.
+     * @param srcVectors    The points to transform.
+     * @param destVectors   The transformed points. It must be at least as long as srcVectors.
+     */
+    static void TransformPoints(const Matrix4x4& matrix, std::span<const Vector3> srcVectors, std::span<Vector3> destVectors) noexcept;
+    static void TransformPoints(const Matrix4x4& matrix, ConstVector3SoA srcVectors, Vector3SoA destVectors) noexcept;
+
+    /**
+     * @brief   Transforms the directions by the matrix as if their w were 0, so the translation isn't applied.
+     * @param matrix        The transform matrix.
+     * @param srcVectors    The directions to transform.
+     * @param destVectors   The transformed directions. It must be at least as long as srcVectors.
+     */
+    static void TransformDirections(const Matrix4x4& matrix, std::span<const Vector3> srcVectors, std::span<Vector3> destVectors) noexcept;
+    static void TransformDirections(const Matrix4x4& matrix, ConstVector3SoA srcVectors, Vector3SoA destVectors) noexcept;
+
+    /**
+     * @brief   Computes the dot products of the pairs of vectors.
+     * @param lhs   The left-hand side vectors.
+     * @param rhs   The right-hand side vectors. It must be at least as long as lhs.
+     * @param dest  The dot products. It must be at least as long as lhs.
+     */
+    static void Dot(ConstVector3SoA lhs, ConstVector3SoA rhs, std::span<float> dest) noexcept;
+
+    /**
+     * @brief   Computes the cross products of the pairs of vectors.
+     * @param lhs   The left-hand side vectors.
+     * @param rhs   The right-hand side vectors. It must be at least as long as lhs.
+     * @param dest  The cross products. It must be at least as long as lhs, and it can be the same arrays as lhs or rhs.
+     */
+    static void Cross(ConstVector3SoA lhs, ConstVector3SoA rhs, Vector3SoA dest) noexcept;
+
+    /**
+     * @brief   Normalizes the vectors.
+     * @param srcVectors    The vectors to normalize.
+     * @param destVectors   The normalized vectors. It must be at least as long as srcVectors.
+     */
+    static void Normalize(ConstVector3SoA srcVectors, Vector3SoA destVectors) noexcept;
+
+    /**
+     * @brief   Computes the bounds of the vectors.
+     * @param vectors   The vectors to bound.
+     * @param min       The componentwise minimum, which is +infinity if vectors is empty.
+     * @param max       The componentwise maximum, which is -infinity if vectors is empty.
+     */
+    static void MinMax(std::span<const Vector3> vectors, Vector3& min, Vector3& max) noexcept;
+    static void MinMax(ConstVector3SoA vectors, Vector3& min, Vector3& max) noexcept;
+    static void MinMax(std::span<const float> values, float& min, float& max) noexcept;
+
+    /**
+     * @brief   Linearly interpolates the pairs of values.
+     * @param from  The values at t = 0.
+     * @param to    The values at t = 1. It must be at least as long as from.
+     * @param t     The interpolation factor which is clamped to [0, 1].
+     * @param dest  The interpolated values. It must be at least as long as from.
+     */
+    static void Lerp(std::span<const float> from, std::span<const float> to, float t, std::span<float> dest) noexcept;
+    static void Lerp(ConstVector3SoA from, ConstVector3SoA to, float t, Vector3SoA destVectors) noexcept;
+
+    /**
+     * @brief   Converts the packed vectors into the SoA layout.
+     * @param srcVectors    The packed vectors.
+     * @param destVectors   The arrays to write. They must be at least as long as srcVectors.
+     */
+    static void Split(std::span<const Vector3> srcVectors, Vector3SoA destVectors) noexcept;
+
+    /**
+     * @brief   Converts the vectors in the SoA layout into the packed vectors.
+     * @param srcVectors    The vectors in the SoA layout.
+     * @param destVectors   The packed vectors. It must be at least as long as srcVectors.
+     */
+    static void Merge(ConstVector3SoA srcVectors, std::span<Vector3> destVectors) noexcept;
+
+    /**
+     * @brief   Raycasts against every box by the slab test.
+     * @param ray               The ray to cast.
+     * @param boxes             The boxes to test.
+     * @param destDistances     The distances to the boxes along the ray, which are infinity for the missed boxes.
+     *                          It must be at least as long as boxes.
+     */
+    static void Raycast(const Ray& ray, const AABBSoA& boxes, std::span<float> destDistances) noexcept;
+
+    /**
+     * @brief   Raycasts against every triangle by the Moller-Trumbore algorithm.
+     * @param ray               The ray to cast.
+     * @param triangles         The triangles to test. Both faces are hit.
+     * @param destDistances     The distances to the triangles along the ray, which are infinity for the missed
+     *                          triangles. It must be at least as long as triangles.
+     */
+    static void Raycast(const Ray& ray, const TriangleSoA& triangles, std::span<float> destDistances) noexcept;
+
+    /**
+     * @brief   Finds the boxes which overlap the box.
+     * @param box           The box to test.
+     * @param boxes         The boxes to test against.
+     * @param destIndices   The indices of the overlapping boxes in ascending order. It must be at least as long as boxes.
+     * @return  The number of the overlapping boxes.
+     */
+    static size_t Overlap(const AABB& box, const AABBSoA& boxes, std::span<uint32_t> destIndices) noexcept;
+
+    /**
+     * @brief   Finds the spheres which are possibly visible in the frustum.
+     * @param frustum       The frustum to test.
+     * @param spheres       The spheres to cull.
+     * @param destIndices   The indices of the visible spheres in ascending order. It must be at least as long as spheres.
+     * @return  The number of the visible spheres.
+     */
+    static size_t Cull(const Frustum& frustum, const SphereSoA& spheres, std::span<uint32_t> destIndices) noexcept;
+    static size_t Cull(const Frustum& frustum, const AABBSoA& boxes, std::span<uint32_t> destIndices) noexcept;
+
+    /**
+     * @brief   Computes the approximations of Mathf for every value. They have the same error bounds as the scalar versions.
+     * @param src   The values to compute.
+     * @param dest  The results. It must be at least as long as src.
+     */
+    static void FastSin(std::span<const float> src, std::span<float> dest) noexcept;
+    static void FastCos(std::span<const float> src, std::span<float> dest) noexcept;
+    static void FastInverseSqrt(std::span<const float> src, std::span<float> dest) noexcept;
+    static void FastSqrt(std::span<const float> src, std::span<float> dest) noexcept;
+    static void FastExp2(std::span<const float> src, std::span<float> dest) noexcept;
+    static void FastLog2(std::span<const float> src, std::span<float> dest) noexcept;
+    static void FastExp(std::span<const float> src, std::span<float> dest) noexcept;
+    static void FastLog(std::span<const float> src, std::span<float> dest) noexcept;
+    static void FastPow(std::span<const float> src, float p, std::span<float> dest) noexcept;
+
+    /**
+     * @brief   Computes Mathf::FastAtan2 for every pair of the values.
+     * @param ys    The y coordinates.
+     * @param xs    The x coordinates. It must be at least as long as ys.
+     * @param dest  The angles in radians. It must be at least as long as ys.
+     */
+    static void FastAtan2(std::span<const float> ys, std::span<const float> xs, std::span<float> dest) noexcept;
+
+    /**
+     * @brief   Converts the floats to the halves, or the halves to the floats. It uses F16C on the processors with AVX2.
+     * @param src   The values to convert.
+     * @param dest  The converted values. It must be at least as long as src.
+     */
+    static void Convert(std::span<const float> src, std::span<Half> dest) noexcept;
+    static void Convert(std::span<const Half> src, std::span<float> dest) noexcept;
+    static void Convert(std::span<const Color> srcColors, std::span<Color32> destColors) noexcept;
+
+    /**
+     * @brief   Encodes the normals by the octahedral mapping.
+     * @param srcNormals    The normals to encode, which must not be zero.
+     * @param destNormals   The encoded normals. It must be at least as long as srcNormals.
+     */
+    static void Encode(std::span<const Vector3> srcNormals, std::span<OctahedralNormal> destNormals) noexcept;
+
+    /**
+     * @brief   Quantizes the positions relative to the bounds.
+     * @param bounds            The bounds of the positions, which are usually the bounds of the mesh.
+     * @param srcPositions      The positions to quantize.
+     * @param destPositions     The quantized positions. It must be at least as long as srcPositions.
+     */
+    static void Quantize(const AABB& bounds, std::span<const Vector3> srcPositions, std::span<QuantizedPosition> destPositions) noexcept;
+
+    /**
+     * @brief   Gets the SIMD level of the selected kernels.
+     */
+    [[nodiscard]] static SimdLevel GetSimdLevel() noexcept;
+};
+
+}
@@ -0,0 +1,1072 @@
+// The kernels are compiled once per instruction set, so they must have internal linkage.
+namespace tg
+{
+namespace
+{
+
+void TransformVector4s(const float* matrix, const float* srcVectors, float* destVectors, size_t count) noexcept
+{
+    const auto row0 = Float4::Load(&matrix[0]);
+    const auto row1 = Float4::Load(&matrix[4]);
+    const auto row2 = Float4::Load(&matrix[8]);
+    const auto row3 = Float4::Load(&matrix[12]);
+
+    for (size_t i = 0; i < count * 4; i += 4)
+    {
+        const auto v = Float4::Load(&srcVectors[i]);
+        auto ret = v.Broadcast<0>() * row0;
+        ret = Float4::MultiplyAdd(v.Broadcast<1>(), row1, ret);
+        ret = Float4::MultiplyAdd(v.Broadcast<2>(), row2, ret);
+        ret = Float4::MultiplyAdd(v.Broadcast<3>(), row3, ret);
+        ret.Store(&destVectors[i]);
+    }
+}
+
+void NormalizeVector4s(const float* srcVectors, float* destVectors, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 4; i += 4)
+    {
+        const auto v = Float4::Load(&srcVectors[i]);
+        auto lengthSq = v * v;
+        lengthSq = lengthSq + lengthSq.Shuffle<1, 0, 3, 2>();
+        lengthSq = lengthSq + lengthSq.Shuffle<2, 3, 0, 1>();
+        (v / Float4::Sqrt(lengthSq)).Store(&destVectors[i]);
+    }
+}
+
+void LerpVector4s(const float* from, const float* to, float t, float* destVectors, size_t count) noexcept
+{
+    const auto floatCount = count * 4;
+    const auto t8 = Float8::Splat(t);
+
+    size_t i = 0;
+    for (; i + 8 <= floatCount; i += 8)
+    {
+        const auto v = Float8::Load(&from[i]);
+        Float8::MultiplyAdd(Float8::Load(&to[i]) - v, t8, v).Store(&destVectors[i]);
+    }
+
+    if (i < floatCount)
+    {
+        const auto v = Float4::Load(&from[i]);
+        Float4::MultiplyAdd(Float4::Load(&to[i]) - v, Float4::Splat(t), v).Store(&destVectors[i]);
+    }
+}
+
+void InverseMatrix4x4s(const float* srcMatrices, float* destMatrices, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 16; i += 16)
+    {
+        InverseMatrix4x4(&srcMatrices[i], &destMatrices[i]);
+    }
+}
+
+void AffineInverseMatrix4x4s(const float* srcMatrices, float* destMatrices, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 16; i += 16)
+    {
+        AffineInverseMatrix4x4(&srcMatrices[i], &destMatrices[i]);
+    }
+}
+
+void InverseTransposeMatrix4x4s(const float* srcMatrices, float* destMatrices, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 16; i += 16)
+    {
+        InverseTransposeMatrix4x4(&srcMatrices[i], &destMatrices[i]);
+    }
+}
+
+void MultiplyMatrix3x4s(const float* lhsMatrices, const float* rhsMatrices, float* destMatrices, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 12; i += 12)
+    {
+        MultiplyMatrix3x4(&lhsMatrices[i], &rhsMatrices[i], &destMatrices[i]);
+    }
+}
+
+void InverseMatrix3x4s(const float* srcMatrices, float* destMatrices, size_t count) noexcept
+{
+    for (size_t i = 0; i < count * 12; i += 12)
+    {
+        InverseMatrix3x4(&srcMatrices[i], &destMatrices[i]);
+    }
+}
+
+/**
+ * @brief   Loads four packed Vector3 and transposes them into the x, y and z lanes.
+ */
+void LoadVector3x4(const float* src, Float4& xs, Float4& ys, Float4& zs) noexcept
+{
+    // a = (x0 y0 z0 x1), b = (y1 z1 x2 y2), c = (z2 x3 y3 z3)
+    const auto a = Float4::Load(&src[0]);
+    const auto b = Float4::Load(&src[4]);
+    const auto c = Float4::Load(&src[8]);
+
+    xs = Float4::Shuffle<0, 3, 0, 3>(a, Float4::Shuffle<2, 3, 0, 1>(b, c));
+    ys = Float4::Shuffle<0, 2, 0, 2>(Float4::Shuffle<1, 1, 0, 0>(a, b), Float4::Shuffle<3, 3, 2, 2>(b, c));
+    zs = Float4::Shuffle<0, 2, 0, 2>(Float4::Shuffle<2, 2, 1, 1>(a, b), Float4::Shuffle<0, 0, 3, 3>(c, c));
+}
+
+void StoreVector3x4(const Float4& xs, const Float4& ys, const Float4& zs, float* dest) noexcept
+{
+    Float4::Shuffle<0, 2, 0, 2>(Float4::Shuffle<0, 1, 0, 1>(xs, ys), Float4::Shuffle<0, 0, 1, 1>(zs, xs)).Store(&dest[0]);
+    Float4::Shuffle<0, 2, 0, 2>(Float4::Shuffle<1, 1, 1, 1>(ys, zs), Float4::Shuffle<2, 2, 2, 2>(xs, ys)).Store(&dest[4]);
+    Float4::Shuffle<0, 2, 0, 2>(Float4::Shuffle<2, 2, 3, 3>(zs, xs), Float4::Shuffle<3, 3, 3, 3>(ys, zs)).Store(&dest[8]);
+}
+
+/**
+ * @brief   A single float with the interface of Float4, so the lane kernels can process the tail elements too.
+ */
+struct Float1
+{
+    Float1 operator+(const Float1& rhs) const noexcept { return {value + rhs.value}; }
+    Float1 operator-(const Float1& rhs) const noexcept { return {value - rhs.value}; }
+    Float1 operator*(const Float1& rhs) const noexcept { return {value * rhs.value}; }
+    Float1 operator/(const Float1& rhs) const noexcept { return {value / rhs.value}; }
+    Float1 operator&(const Float1& rhs) const noexcept { return FromBits(this->GetBits() & rhs.GetBits()); }
+    Float1 operator|(const Float1& rhs) const noexcept { return FromBits(this->GetBits() | rhs.GetBits()); }
+
+    static Float1 Load(const float* src) noexcept { return {*src}; }
+    static Float1 Splat(float value) noexcept { return {value}; }
+    static Float1 Zero() noexcept { return {0.0f}; }
+    void Store(float* dest) const noexcept { *dest = value; }
+    static Float1 Min(const Float1& lhs, const Float1& rhs) noexcept { return {lhs.value < rhs.value ? lhs.value : rhs.value}; }
+    static Float1 Max(const Float1& lhs, const Float1& rhs) noexcept { return {lhs.value < rhs.value ? rhs.value : lhs.value}; }
+    static Float1 MultiplyAdd(const Float1& a, const Float1& b, const Float1& c) noexcept { return {a.value * b.value + c.value}; }
+    static Float1 Sqrt(const Float1& value) noexcept { return {std::sqrt(value.value)}; }
+    static Float1 ReciprocalSqrtEstimate(const Float1& value) noexcept { return {Float4::ReciprocalSqrtEstimate(Float4::Splat(value.value)).GetX()}; }
+    static Float1 Abs(const Float1& value) noexcept { return FromBits(value.GetBits() & 0x7FFFFFFFu); }
+    static Float1 CompareLess(const Float1& lhs, const Float1& rhs) noexcept { return FromBits(lhs.value < rhs.value ? 0xFFFFFFFFu : 0u); }
+    static Float1 Select(const Float1& mask, const Float1& a, const Float1& b) noexcept { return mask.GetSignMask() != 0 ? a : b; }
+    int32_t GetSignMask() const noexcept { return static_cast<int32_t>(this->GetBits() >> 31); }
+
+    static Float1 FromBits(uint32_t bits) noexcept
+    {
+        Float1 ret;
+        std::memcpy(&ret.value, &bits, sizeof(bits));
+        return ret;
+    }
+
+    uint32_t GetBits() const noexcept
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    float value;
+};
+
+/**
+ * @brief   A single integer with the interface of Int4, which holds the bits of Float1.
+ */
+struct Int1
+{
+    Int1 operator+(const Int1& rhs) const noexcept { return {static_cast<int32_t>(static_cast<uint32_t>(value) + static_cast<uint32_t>(rhs.value))}; }
+    Int1 operator-(const Int1& rhs) const noexcept { return {static_cast<int32_t>(static_cast<uint32_t>(value) - static_cast<uint32_t>(rhs.value))}; }
+    Int1 operator&(const Int1& rhs) const noexcept { return {value & rhs.value}; }
+    Int1 operator|(const Int1& rhs) const noexcept { return {value | rhs.value}; }
+    Int1 operator^(const Int1& rhs) const noexcept { return {value ^ rhs.value}; }
+
+    static Int1 Load(const int32_t* src) noexcept { return {*src}; }
+    static Int1 Splat(int32_t value) noexcept { return {value}; }
+    void Store(int32_t* dest) const noexcept { *dest = value; }
+    static Int1 CompareEqual(const Int1& lhs, const Int1& rhs) noexcept { return {lhs.value == rhs.value ? -1 : 0}; }
+    static Int1 CompareLess(const Int1& lhs, const Int1& rhs) noexcept { return {lhs.value < rhs.value ? -1 : 0}; }
+    static Int1 Select(const Int1& mask, const Int1& a, const Int1& b) noexcept { return mask.value != 0 ? a : b; }
+    template <int32_t _Count>
+    Int1 ShiftLeft() const noexcept { return {static_cast<int32_t>(static_cast<uint32_t>(value) << _Count)}; }
+    template <int32_t _Count>
+    Int1 ShiftRightLogical() const noexcept { return {static_cast<int32_t>(static_cast<uint32_t>(value) >> _Count)}; }
+    template <int32_t _Count>
+    Int1 ShiftRightArithmetic() const noexcept { return {value >> _Count}; }
+
+    int32_t value;
+};
+
+Int1 AsInt(const Float1& value) noexcept { return {static_cast<int32_t>(value.GetBits())}; }
+Int4 AsInt(const Float4& value) noexcept { return value.AsInt4(); }
+Int8 AsInt(const Float8& value) noexcept { return value.AsInt8(); }
+Float1 AsFloat(const Int1& value) noexcept { return Float1::FromBits(static_cast<uint32_t>(value.value)); }
+Float4 AsFloat(const Int4& value) noexcept { return value.AsFloat4(); }
+Float8 AsFloat(const Int8& value) noexcept { return value.AsFloat8(); }
+Float1 ToFloat(const Int1& value) noexcept { return {static_cast<float>(value.value)}; }
+Float4 ToFloat(const Int4& value) noexcept { return value.ToFloat4(); }
+Float8 ToFloat(const Int8& value) noexcept { return value.ToFloat8(); }
+
+// The rounding is done by the conversion, so it can't be fused into an FMA with the scaling of the caller.
+Int1 RoundToInt(const Float1& value) noexcept { return {static_cast<int32_t>(std::nearbyint(value.value))}; }
+Int4 RoundToInt(const Float4& value) noexcept { return value.RoundToInt4(); }
+Int8 RoundToInt(const Float8& value) noexcept { return value.RoundToInt8(); }
+
+template <typename _Float, size_t _LaneCount>
+struct LaneTag
+{
+    using Type = _Float;
+    static constexpr size_t LaneCount = _LaneCount;
+};
+
+/**
+ * @brief   Calls the kernel with eight lanes first, then four lanes, then one lane for the remaining elements.
+ * @param count     The number of the elements.
+ * @param kernel    The callable which takes a LaneTag and the index of the first element to process.
+ */
+template <typename _Kernel>
+void ForEachLane(size_t count, const _Kernel& kernel) noexcept
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        kernel(LaneTag<Float8, 8>{}, i);
+    }
+
+    if (i + 4 <= count)
+    {
+        kernel(LaneTag<Float4, 4>{}, i);
+        i += 4;
+    }
+
+    for (; i < count; ++i)
+    {
+        kernel(LaneTag<Float1, 1>{}, i);
+    }
+}
+
+/**
+ * @brief   Computes one component of the transformed vectors in the row vector convention.
+ * @param m         The matrix, which must be a local copy so the compiler can hoist the splats out of the loops.
+ * @param column    The index of the component.
+ */
+template <bool _IsPoint, typename _Float>
+_Float TransformColumn(const float* m, size_t column, const _Float& xs, const _Float& ys, const _Float& zs) noexcept
+{
+    auto ret = _Float::MultiplyAdd(xs, _Float::Splat(m[column]), _IsPoint ? _Float::Splat(m[12 + column]) : _Float::Zero());
+    ret = _Float::MultiplyAdd(ys, _Float::Splat(m[4 + column]), ret);
+    return _Float::MultiplyAdd(zs, _Float::Splat(m[8 + column]), ret);
+}
+
+template <bool _IsPoint>
+void TransformVector3s(const float* matrix, const float* srcVectors, float* destVectors, size_t count) noexcept
+{
+    float m[16];
+    std::memcpy(m, matrix, sizeof(m));
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        Float4 xs, ys, zs;
+        LoadVector3x4(&srcVectors[i * 3], xs, ys, zs);
+        StoreVector3x4(TransformColumn<_IsPoint>(m, 0, xs, ys, zs), TransformColumn<_IsPoint>(m, 1, xs, ys, zs), TransformColumn<_IsPoint>(m, 2, xs, ys, zs), &destVectors[i * 3]);
+    }
+
+    for (; i < count; ++i)
+    {
+        const auto xs = Float1::Load(&srcVectors[i * 3]);
+        const auto ys = Float1::Load(&srcVectors[i * 3 + 1]);
+        const auto zs = Float1::Load(&srcVectors[i * 3 + 2]);
+        const Float1 transformed[3] = {TransformColumn<_IsPoint>(m, 0, xs, ys, zs), TransformColumn<_IsPoint>(m, 1, xs, ys, zs), TransformColumn<_IsPoint>(m, 2, xs, ys, zs)};
+        std::memcpy(&destVectors[i * 3], transformed, sizeof(transformed));
+    }
+}
+
+void TransformPointVector3s(const float* matrix, const float* srcVectors, float* destVectors, size_t count) noexcept
+{
+    TransformVector3s<true>(matrix, srcVectors, destVectors, count);
+}
+
+void TransformDirectionVector3s(const float* matrix, const float* srcVectors, float* destVectors, size_t count) noexcept
+{
+    TransformVector3s<false>(matrix, srcVectors, destVectors, count);
+}
+
+void RotateVector3s(const float* quaternion, const float* srcVectors, float* destVectors, size_t count) noexcept
+{
+    const float x = quaternion[0], y = quaternion[1], z = quaternion[2], w = quaternion[3];
+    const float m[16] = {
+        1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + w * z), 2.0f * (x * z - w * y), 0.0f,
+        2.0f * (x * y - w * z), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + w * x), 0.0f,
+        2.0f * (x * z + w * y), 2.0f * (y * z - w * x), 1.0f - 2.0f * (x * x + y * y), 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f,
+    };
+    TransformVector3s<false>(m, srcVectors, destVectors, count);
+}
+
+void MinMaxVector3s(const float* srcVectors, size_t count, float* destMin, float* destMax) noexcept
+{
+    // Eight packed vectors fill three Float8, and every lane keeps meeting the same component, so the lanes can be
+    // reduced independently and grouped by component at the end.
+    Float8 mins[3] = {Float8::Splat(INFINITY), Float8::Splat(INFINITY), Float8::Splat(INFINITY)};
+    Float8 maxs[3] = {Float8::Splat(-INFINITY), Float8::Splat(-INFINITY), Float8::Splat(-INFINITY)};
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            const auto v = Float8::Load(&srcVectors[i * 3 + j * 8]);
+            mins[j] = Float8::Min(mins[j], v);
+            maxs[j] = Float8::Max(maxs[j], v);
+        }
+    }
+
+    float laneMins[24], laneMaxs[24];
+    for (size_t j = 0; j < 3; ++j)
+    {
+        mins[j].Store(&laneMins[j * 8]);
+        maxs[j].Store(&laneMaxs[j * 8]);
+    }
+
+    Float1 minValue[3] = {{INFINITY}, {INFINITY}, {INFINITY}};
+    Float1 maxValue[3] = {{-INFINITY}, {-INFINITY}, {-INFINITY}};
+    for (size_t j = 0; j < 24; ++j)
+    {
+        minValue[j % 3] = Float1::Min(minValue[j % 3], {laneMins[j]});
+        maxValue[j % 3] = Float1::Max(maxValue[j % 3], {laneMaxs[j]});
+    }
+
+    for (; i < count; ++i)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            minValue[j] = Float1::Min(minValue[j], Float1::Load(&srcVectors[i * 3 + j]));
+            maxValue[j] = Float1::Max(maxValue[j], Float1::Load(&srcVectors[i * 3 + j]));
+        }
+    }
+
+    std::memcpy(destMin, minValue, sizeof(minValue));
+    std::memcpy(destMax, maxValue, sizeof(maxValue));
+}
+
+void SplitVector3s(const float* srcVectors, Float3Arrays destVectors, size_t count) noexcept
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        Float4 xs, ys, zs;
+        LoadVector3x4(&srcVectors[i * 3], xs, ys, zs);
+        xs.Store(&destVectors.xs[i]);
+        ys.Store(&destVectors.ys[i]);
+        zs.Store(&destVectors.zs[i]);
+    }
+
+    for (; i < count; ++i)
+    {
+        destVectors.xs[i] = srcVectors[i * 3];
+        destVectors.ys[i] = srcVectors[i * 3 + 1];
+        destVectors.zs[i] = srcVectors[i * 3 + 2];
+    }
+}
+
+void MergeVector3s(ConstFloat3Arrays srcVectors, float* destVectors, size_t count) noexcept
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        StoreVector3x4(Float4::Load(&srcVectors.xs[i]), Float4::Load(&srcVectors.ys[i]), Float4::Load(&srcVectors.zs[i]), &destVectors[i * 3]);
+    }
+
+    for (; i < count; ++i)
+    {
+        destVectors[i * 3] = srcVectors.xs[i];
+        destVectors[i * 3 + 1] = srcVectors.ys[i];
+        destVectors[i * 3 + 2] = srcVectors.zs[i];
+    }
+}
+
+template <bool _IsPoint>
+void TransformFloat3Arrays(const float* matrix, ConstFloat3Arrays srcVectors, Float3Arrays destVectors, size_t count) noexcept
+{
+    float m[16];
+    std::memcpy(m, matrix, sizeof(m));
+
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        const auto xs = _Float::Load(&srcVectors.xs[i]);
+        const auto ys = _Float::Load(&srcVectors.ys[i]);
+        const auto zs = _Float::Load(&srcVectors.zs[i]);
+        TransformColumn<_IsPoint>(m, 0, xs, ys, zs).Store(&destVectors.xs[i]);
+        TransformColumn<_IsPoint>(m, 1, xs, ys, zs).Store(&destVectors.ys[i]);
+        TransformColumn<_IsPoint>(m, 2, xs, ys, zs).Store(&destVectors.zs[i]);
+    });
+}
+
+void TransformPoints(const float* matrix, ConstFloat3Arrays srcVectors, Float3Arrays destVectors, size_t count) noexcept
+{
+    TransformFloat3Arrays<true>(matrix, srcVectors, destVectors, count);
+}
+
+void TransformDirections(const float* matrix, ConstFloat3Arrays srcVectors, Float3Arrays destVectors, size_t count) noexcept
+{
+    TransformFloat3Arrays<false>(matrix, srcVectors, destVectors, count);
+}
+
+void DotVector3s(ConstFloat3Arrays lhs, ConstFloat3Arrays rhs, float* dest, size_t count) noexcept
+{
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        auto ret = _Float::Load(&lhs.xs[i]) * _Float::Load(&rhs.xs[i]);
+        ret = _Float::MultiplyAdd(_Float::Load(&lhs.ys[i]), _Float::Load(&rhs.ys[i]), ret);
+        ret = _Float::MultiplyAdd(_Float::Load(&lhs.zs[i]), _Float::Load(&rhs.zs[i]), ret);
+        ret.Store(&dest[i]);
+    });
+}
+
+void CrossVector3s(ConstFloat3Arrays lhs, ConstFloat3Arrays rhs, Float3Arrays dest, size_t count) noexcept
+{
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        const auto lhsXs = _Float::Load(&lhs.xs[i]), lhsYs = _Float::Load(&lhs.ys[i]), lhsZs = _Float::Load(&lhs.zs[i]);
+        const auto rhsXs = _Float::Load(&rhs.xs[i]), rhsYs = _Float::Load(&rhs.ys[i]), rhsZs = _Float::Load(&rhs.zs[i]);
+
+        // Every store comes after the loads, so the destination can be one of the sources.
+        const auto xs = lhsYs * rhsZs - lhsZs * rhsYs;
+        const auto ys = lhsZs * rhsXs - lhsXs * rhsZs;
+        const auto zs = lhsXs * rhsYs - lhsYs * rhsXs;
+        xs.Store(&dest.xs[i]);
+        ys.Store(&dest.ys[i]);
+        zs.Store(&dest.zs[i]);
+    });
+}
+
+void NormalizeVector3s(ConstFloat3Arrays srcVectors, Float3Arrays destVectors, size_t count) noexcept
+{
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        const auto xs = _Float::Load(&srcVectors.xs[i]);
+        const auto ys = _Float::Load(&srcVectors.ys[i]);
+        const auto zs = _Float::Load(&srcVectors.zs[i]);
+        const auto lengthSq = _Float::MultiplyAdd(zs, zs, _Float::MultiplyAdd(ys, ys, xs * xs));
+        const auto reciprocalLength = _Float::Splat(1.0f) / _Float::Sqrt(lengthSq);
+        (xs * reciprocalLength).Store(&destVectors.xs[i]);
+        (ys * reciprocalLength).Store(&destVectors.ys[i]);
+        (zs * reciprocalLength).Store(&destVectors.zs[i]);
+    });
+}
+
+void MinMaxFloats(const float* src, size_t count, float* destMin, float* destMax) noexcept
+{
+    // Two accumulators hide the latency of min and max.
+    Float8 mins[2] = {Float8::Splat(INFINITY), Float8::Splat(INFINITY)};
+    Float8 maxs[2] = {Float8::Splat(-INFINITY), Float8::Splat(-INFINITY)};
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const auto v0 = Float8::Load(&src[i]);
+        const auto v1 = Float8::Load(&src[i + 8]);
+        mins[0] = Float8::Min(mins[0], v0);
+        mins[1] = Float8::Min(mins[1], v1);
+        maxs[0] = Float8::Max(maxs[0], v0);
+        maxs[1] = Float8::Max(maxs[1], v1);
+    }
+
+    float laneMins[8], laneMaxs[8];
+    Float8::Min(mins[0], mins[1]).Store(laneMins);
+    Float8::Max(maxs[0], maxs[1]).Store(laneMaxs);
+
+    Float1 minValue{INFINITY}, maxValue{-INFINITY};
+    for (size_t j = 0; j < 8; ++j)
+    {
+        minValue = Float1::Min(minValue, {laneMins[j]});
+        maxValue = Float1::Max(maxValue, {laneMaxs[j]});
+    }
+
+    for (; i < count; ++i)
+    {
+        minValue = Float1::Min(minValue, Float1::Load(&src[i]));
+        maxValue = Float1::Max(maxValue, Float1::Load(&src[i]));
+    }
+
+    minValue.Store(destMin);
+    maxValue.Store(destMax);
+}
+
+void LerpFloats(const float* from, const float* to, float t, float* dest, size_t count) noexcept
+{
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        const auto v = _Float::Load(&from[i]);
+        _Float::MultiplyAdd(_Float::Load(&to[i]) - v, _Float::Splat(t), v).Store(&dest[i]);
+    });
+}
+
+/**
+ * @brief   Appends the indices of the lanes whose sign bit is cleared in the mask.
+ * @remark  Every lane is written without branches, and only the accepted ones advance the count.
+ */
+template <size_t _LaneCount>
+void AppendIndices(int32_t rejectMask, size_t firstIndex, uint32_t* destIndices, size_t& count) noexcept
+{
+    for (size_t lane = 0; lane < _LaneCount; ++lane)
+    {
+        destIndices[count] = static_cast<uint32_t>(firstIndex + lane);
+        count += ((rejectMask >> lane) & 1) ^ 1;
+    }
+}
+
+void RaycastAABBs(const float* ray, ConstFloat3Arrays mins, ConstFloat3Arrays maxs, float* destDistances, size_t count) noexcept
+{
+    // The division by zero makes the infinity of the proper sign, which keeps the slabs of the parallel axes correct.
+    const float origin[3] = {ray[0], ray[1], ray[2]};
+    const float reciprocalDirection[3] = {1.0f / ray[3], 1.0f / ray[4], 1.0f / ray[5]};
+
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        auto computeSlab = [&](const float* minValues, const float* maxValues, size_t axis, _Float& nearDistance, _Float& farDistance)
+        {
+            const auto o = _Float::Splat(origin[axis]);
+            const auto d = _Float::Splat(reciprocalDirection[axis]);
+            const auto t0 = (_Float::Load(&minValues[i]) - o) * d;
+            const auto t1 = (_Float::Load(&maxValues[i]) - o) * d;
+            nearDistance = _Float::Max(nearDistance, _Float::Min(t0, t1));
+            farDistance = _Float::Min(farDistance, _Float::Max(t0, t1));
+        };
+
+        auto nearDistance = _Float::Zero();
+        auto farDistance = _Float::Splat(INFINITY);
+        computeSlab(mins.xs, maxs.xs, 0, nearDistance, farDistance);
+        computeSlab(mins.ys, maxs.ys, 1, nearDistance, farDistance);
+        computeSlab(mins.zs, maxs.zs, 2, nearDistance, farDistance);
+        _Float::Select(_Float::CompareLess(farDistance, nearDistance), _Float::Splat(INFINITY), nearDistance).Store(&destDistances[i]);
+    });
+}
+
+void RaycastTriangles(const float* ray, ConstFloat3Arrays v0s, ConstFloat3Arrays v1s, ConstFloat3Arrays v2s, float* destDistances, size_t count) noexcept
+{
+    float r[6];
+    std::memcpy(r, ray, sizeof(r));
+
+    // Moller-Trumbore on eight triangles at once. Every rejection is folded into one mask instead of early outs.
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        const auto v0x = _Float::Load(&v0s.xs[i]), v0y = _Float::Load(&v0s.ys[i]), v0z = _Float::Load(&v0s.zs[i]);
+        const auto e1x = _Float::Load(&v1s.xs[i]) - v0x, e1y = _Float::Load(&v1s.ys[i]) - v0y, e1z = _Float::Load(&v1s.zs[i]) - v0z;
+        const auto e2x = _Float::Load(&v2s.xs[i]) - v0x, e2y = _Float::Load(&v2s.ys[i]) - v0y, e2z = _Float::Load(&v2s.zs[i]) - v0z;
+        const auto dx = _Float::Splat(r[3]), dy = _Float::Splat(r[4]), dz = _Float::Splat(r[5]);
+
+        const auto px = dy * e2z - dz * e2y, py = dz * e2x - dx * e2z, pz = dx * e2y - dy * e2x;
+        const auto determinant = _Float::MultiplyAdd(e1z, pz, _Float::MultiplyAdd(e1y, py, e1x * px));
+        const auto reciprocalDeterminant = _Float::Splat(1.0f) / determinant;
+
+        const auto sx = _Float::Splat(r[0]) - v0x, sy = _Float::Splat(r[1]) - v0y, sz = _Float::Splat(r[2]) - v0z;
+        const auto u = _Float::MultiplyAdd(sz, pz, _Float::MultiplyAdd(sy, py, sx * px)) * reciprocalDeterminant;
+
+        const auto qx = sy * e1z - sz * e1y, qy = sz * e1x - sx * e1z, qz = sx * e1y - sy * e1x;
+        const auto v = _Float::MultiplyAdd(dz, qz, _Float::MultiplyAdd(dy, qy, dx * qx)) * reciprocalDeterminant;
+        const auto distance = _Float::MultiplyAdd(e2z, qz, _Float::MultiplyAdd(e2y, qy, e2x * qx)) * reciprocalDeterminant;
+
+        const auto zero = _Float::Zero();
+        const auto miss = _Float::CompareLess(_Float::Abs(determinant), _Float::Splat(1e-8f)) | _Float::CompareLess(u, zero) | _Float::CompareLess(v, zero) |
+                          _Float::CompareLess(_Float::Splat(1.0f), u + v) | _Float::CompareLess(distance, zero);
+        _Float::Select(miss, _Float::Splat(INFINITY), distance).Store(&destDistances[i]);
+    });
+}
+
+size_t OverlapAABBs(const float* box, ConstFloat3Arrays mins, ConstFloat3Arrays maxs, uint32_t* destIndices, size_t count) noexcept
+{
+    float b[6];
+    std::memcpy(b, box, sizeof(b));
+
+    // The boxes overlap if no axis separates them, which means the largest gap is not positive.
+    size_t overlapCount = 0;
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        auto gap = _Float::Max(_Float::Load(&mins.xs[i]) - _Float::Splat(b[3]), _Float::Splat(b[0]) - _Float::Load(&maxs.xs[i]));
+        gap = _Float::Max(gap, _Float::Max(_Float::Load(&mins.ys[i]) - _Float::Splat(b[4]), _Float::Splat(b[1]) - _Float::Load(&maxs.ys[i])));
+        gap = _Float::Max(gap, _Float::Max(_Float::Load(&mins.zs[i]) - _Float::Splat(b[5]), _Float::Splat(b[2]) - _Float::Load(&maxs.zs[i])));
+        AppendIndices<decltype(tag)::LaneCount>(_Float::CompareLess(_Float::Zero(), gap).GetSignMask(), i, destIndices, overlapCount);
+    });
+    return overlapCount;
+}
+
+size_t CullSpheres(const float* planes, ConstFloat3Arrays centers, const float* radii, uint32_t* destIndices, size_t count) noexcept
+{
+    float p[24];
+    std::memcpy(p, planes, sizeof(p));
+
+    size_t visibleCount = 0;
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        const auto xs = _Float::Load(&centers.xs[i]), ys = _Float::Load(&centers.ys[i]), zs = _Float::Load(&centers.zs[i]);
+
+        // The sphere is culled if its center is farther than the radius behind any plane.
+        auto minDistance = _Float::Splat(INFINITY);
+        for (size_t j = 0; j < 24; j += 4)
+        {
+            auto distance = _Float::MultiplyAdd(xs, _Float::Splat(p[j]), _Float::Splat(p[j + 3]));
+            distance = _Float::MultiplyAdd(ys, _Float::Splat(p[j + 1]), distance);
+            distance = _Float::MultiplyAdd(zs, _Float::Splat(p[j + 2]), distance);
+            minDistance = _Float::Min(minDistance, distance);
+        }
+
+        const auto rejectMask = _Float::CompareLess(minDistance + _Float::Load(&radii[i]), _Float::Zero()).GetSignMask();
+        AppendIndices<decltype(tag)::LaneCount>(rejectMask, i, destIndices, visibleCount);
+    });
+    return visibleCount;
+}
+
+size_t CullAABBs(const float* planes, ConstFloat3Arrays mins, ConstFloat3Arrays maxs, uint32_t* destIndices, size_t count) noexcept
+{
+    float p[24], absPlanes[24];
+    std::memcpy(p, planes, sizeof(p));
+    for (size_t j = 0; j < 24; ++j)
+    {
+        absPlanes[j] = Float1::Abs({p[j]}).value;
+    }
+
+    size_t visibleCount = 0;
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        const auto half = _Float::Splat(0.5f);
+        const auto minXs = _Float::Load(&mins.xs[i]), minYs = _Float::Load(&mins.ys[i]), minZs = _Float::Load(&mins.zs[i]);
+        const auto maxXs = _Float::Load(&maxs.xs[i]), maxYs = _Float::Load(&maxs.ys[i]), maxZs = _Float::Load(&maxs.zs[i]);
+        const auto centerXs = (minXs + maxXs) * half, centerYs = (minYs + maxYs) * half, centerZs = (minZs + maxZs) * half;
+        const auto extentXs = (maxXs - minXs) * half, extentYs = (maxYs - minYs) * half, extentZs = (maxZs - minZs) * half;
+
+        // The box is culled if the corner which is the farthest along the normal is behind any plane.
+        auto minDistance = _Float::Splat(INFINITY);
+        for (size_t j = 0; j < 24; j += 4)
+        {
+            auto distance = _Float::MultiplyAdd(centerXs, _Float::Splat(p[j]), _Float::Splat(p[j + 3]));
+            distance = _Float::MultiplyAdd(centerYs, _Float::Splat(p[j + 1]), distance);
+            distance = _Float::MultiplyAdd(centerZs, _Float::Splat(p[j + 2]), distance);
+            distance = _Float::MultiplyAdd(extentXs, _Float::Splat(absPlanes[j]), distance);
+            distance = _Float::MultiplyAdd(extentYs, _Float::Splat(absPlanes[j + 1]), distance);
+            distance = _Float::MultiplyAdd(extentZs, _Float::Splat(absPlanes[j + 2]), distance);
+            minDistance = _Float::Min(minDistance, distance);
+        }
+
+        AppendIndices<decltype(tag)::LaneCount>(_Float::CompareLess(minDistance, _Float::Zero()).GetSignMask(), i, destIndices, visibleCount);
+    });
+    return visibleCount;
+}
+
+/**
+ * @brief   Evaluates the polynomial whose coefficients are ordered from the constant term by the Horner's method.
+ */
+template <size_t _Degree, typename _Float>
+_Float EvaluatePolynomial(const float(&coefficients)[_Degree + 1], const _Float& x) noexcept
+{
+    auto ret = _Float::Splat(coefficients[_Degree]);
+    for (size_t i = _Degree; i > 0; --i)
+    {
+        ret = _Float::MultiplyAdd(ret, x, _Float::Splat(coefficients[i - 1]));
+    }
+    return ret;
+}
+
+/**
+ * @brief   Computes sin of the angles in [-PI/2, PI/2].
+ */
+template <typename _Float>
+_Float ComputeReducedSin(const _Float& r) noexcept
+{
+    const auto s = r * r;
+    return _Float::MultiplyAdd(r * s, EvaluatePolynomial<3>(FastMathConstants::Sin, s), r);
+}
+
+/**
+ * @brief   Subtracts k * PI from the angle, where k is an integer which may be multiplied by the split parts exactly.
+ */
+template <typename _Float>
+_Float SubtractMultipleOfPi(const _Float& value, const _Float& k, const float(&piParts)[3]) noexcept
+{
+    auto ret = _Float::MultiplyAdd(k, _Float::Splat(-piParts[0]), value);
+    ret = _Float::MultiplyAdd(k, _Float::Splat(-piParts[1]), ret);
+    return _Float::MultiplyAdd(k, _Float::Splat(-piParts[2]), ret);
+}
+
+template <typename _Float>
+_Float ComputeFastSin(const _Float& value) noexcept
+{
+    const auto magic = _Float::Splat(FastMathConstants::RoundingMagic);
+    const auto biased = _Float::MultiplyAdd(value, _Float::Splat(FastMathConstants::InversePi), magic);
+    const auto r = SubtractMultipleOfPi(value, biased - magic, FastMathConstants::PiParts);
+    return AsFloat(AsInt(ComputeReducedSin(r)) ^ AsInt(biased).template ShiftLeft<31>());
+}
+
+template <typename _Float>
+_Float ComputeFastCos(const _Float& value) noexcept
+{
+    const auto magic = _Float::Splat(FastMathConstants::RoundingMagic);
+    const auto biased = _Float::MultiplyAdd(value, _Float::Splat(FastMathConstants::InversePi), _Float::Splat(-0.5f)) + magic;
+    const auto k = _Float::MultiplyAdd(biased - magic, _Float::Splat(2.0f), _Float::Splat(1.0f));
+    const auto r = SubtractMultipleOfPi(value, k, FastMathConstants::HalfPiParts);
+    const auto sign = AsInt(biased).template ShiftLeft<31>() ^ decltype(AsInt(biased))::Splat(INT32_MIN);
+    return AsFloat(AsInt(ComputeReducedSin(r)) ^ sign);
+}
+
+template <typename _Float>
+_Float ComputeFastAtan2(const _Float& y, const _Float& x) noexcept
+{
+    const auto absY = _Float::Abs(y), absX = _Float::Abs(x);
+    const auto a = _Float::Min(absX, absY) / _Float::Max(_Float::Max(absX, absY), _Float::Splat(FLT_MIN));
+    auto ret = a * EvaluatePolynomial<5>(FastMathConstants::Atan, a * a);
+    ret = _Float::Select(_Float::CompareLess(absX, absY), _Float::Splat(1.57079637f) - ret, ret);
+    ret = _Float::Select(_Float::CompareLess(x, _Float::Zero()), _Float::Splat(3.14159274f) - ret, ret);
+    return ret | (y & _Float::Splat(-0.0f));
+}
+
+template <typename _Float>
+_Float ComputeFastInverseSqrt(const _Float& value) noexcept
+{
+    const auto estimate = _Float::ReciprocalSqrtEstimate(value);
+    return estimate * (_Float::Splat(1.5f) - (value * _Float::Splat(0.5f)) * (estimate * estimate));
+}
+
+template <typename _Float>
+_Float ComputeFastExp2(const _Float& value) noexcept
+{
+    const auto magic = _Float::Splat(FastMathConstants::RoundingMagic);
+    const auto clampedValue = _Float::Max(_Float::Min(value, _Float::Splat(127.4999f)), _Float::Splat(-126.0f));
+    const auto biased = clampedValue + magic;
+    const auto p = EvaluatePolynomial<5>(FastMathConstants::Exp2, clampedValue - (biased - magic));
+
+    using _Int = decltype(AsInt(biased));
+    const auto scale = AsFloat((AsInt(biased) - _Int::Splat(FastMathConstants::RoundingMagicBits - 127)).template ShiftLeft<23>());
+    return _Float::Select(_Float::CompareLess(value, _Float::Splat(-126.0f)), _Float::Zero(), p * scale);
+}
+
+template <typename _Float>
+_Float ComputeFastLog2(const _Float& value) noexcept
+{
+    const auto bits = AsInt(value);
+    const auto exponent = (bits - decltype(bits)::Splat(FastMathConstants::HalfSqrt2Bits)).template ShiftRightArithmetic<23>();
+    const auto t = AsFloat(bits - exponent.template ShiftLeft<23>()) - _Float::Splat(1.0f);
+    return _Float::MultiplyAdd(t, EvaluatePolynomial<6>(FastMathConstants::Log2, t), ToFloat(exponent));
+}
+
+template <typename _Function>
+void TransformFloats(const float* src, float* dest, size_t count, const _Function& function) noexcept
+{
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        function(_Float::Load(&src[i])).Store(&dest[i]);
+    });
+}
+
+void SinFloats(const float* src, float* dest, size_t count) noexcept
+{
+    TransformFloats(src, dest, count, [](const auto& value) { return ComputeFastSin(value); });
+}
+
+void CosFloats(const float* src, float* dest, size_t count) noexcept
+{
+    TransformFloats(src, dest, count, [](const auto& value) { return ComputeFastCos(value); });
+}
+
+void Atan2Floats(const float* ys, const float* xs, float* dest, size_t count) noexcept
+{
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        ComputeFastAtan2(_Float::Load(&ys[i]), _Float::Load(&xs[i])).Store(&dest[i]);
+    });
+}
+
+void InverseSqrtFloats(const float* src, float* dest, size_t count) noexcept
+{
+    TransformFloats(src, dest, count, [](const auto& value) { return ComputeFastInverseSqrt(value); });
+}
+
+void SqrtFloats(const float* src, float* dest, size_t count) noexcept
+{
+    TransformFloats(src, dest, count, [](auto value)
+    {
+        using _Float = decltype(value);
+        return _Float::Select(_Float::CompareLess(value, _Float::Splat(FLT_MIN)), _Float::Zero(), value * ComputeFastInverseSqrt(value));
+    });
+}
+
+void Exp2Floats(const float* src, float* dest, size_t count) noexcept
+{
+    TransformFloats(src, dest, count, [](const auto& value) { return ComputeFastExp2(value); });
+}
+
+void Log2Floats(const float* src, float* dest, size_t count) noexcept
+{
+    TransformFloats(src, dest, count, [](const auto& value) { return ComputeFastLog2(value); });
+}
+
+void ExpFloats(const float* src, float* dest, size_t count) noexcept
+{
+    TransformFloats(src, dest, count, [](auto value)
+    {
+        using _Float = decltype(value);
+        return ComputeFastExp2(value * _Float::Splat(FastMathConstants::Log2E));
+    });
+}
+
+void LogFloats(const float* src, float* dest, size_t count) noexcept
+{
+    TransformFloats(src, dest, count, [](auto value)
+    {
+        using _Float = decltype(value);
+        return ComputeFastLog2(value) * _Float::Splat(FastMathConstants::Ln2);
+    });
+}
+
+void PowFloats(const float* src, float p, float* dest, size_t count) noexcept
+{
+    TransformFloats(src, dest, count, [p](auto value)
+    {
+        using _Float = decltype(value);
+        return ComputeFastExp2(ComputeFastLog2(value) * _Float::Splat(p));
+    });
+}
+
+/**
+ * @brief   Converts the floats to the bits of the halves, which are rounded to the nearest even.
+ * @remark  It's the same algorithm as Half::ConvertFromFloat, so both produce the same bits.
+ */
+template <typename _Float>
+auto ComputeHalfBits(const _Float& value) noexcept
+{
+    using _Int = decltype(AsInt(value));
+    const auto bits = AsInt(value);
+    const auto sign = bits.template ShiftRightLogical<16>() & _Int::Splat(0x8000);
+    const auto absBits = bits & _Int::Splat(0x7FFFFFFF);
+
+    const auto denormalMagic = _Int::Splat(((127 - 15) + (23 - 10) + 1) << 23);
+    const auto denormal = AsInt(AsFloat(absBits) + AsFloat(denormalMagic)) - denormalMagic;
+    const auto mantissaOdd = absBits.template ShiftRightLogical<13>() & _Int::Splat(1);
+    const auto normal = (absBits - _Int::Splat((127 - 15) << 23) + _Int::Splat(0xFFF) + mantissaOdd).template ShiftRightLogical<13>();
+    const auto overflow = _Int::Select(_Int::CompareLess(_Int::Splat(0x7F800000), absBits), _Int::Splat(0x7E00), _Int::Splat(0x7C00));
+
+    auto ret = _Int::Select(_Int::CompareLess(absBits, _Int::Splat(113 << 23)), denormal, normal);
+    ret = _Int::Select(_Int::CompareLess(absBits, _Int::Splat((127 + 16) << 23)), ret, overflow);
+    return ret | sign;
+}
+
+/**
+ * @brief   Converts the bits of the halves which are held in the integer lanes to the floats.
+ */
+template <typename _Int>
+auto ComputeHalfToFloat(const _Int& halfBits) noexcept
+{
+    const auto shiftedExponent = _Int::Splat(0x7C00 << 13);
+    const auto shifted = (halfBits & _Int::Splat(0x7FFF)).template ShiftLeft<13>();
+    const auto exponent = shifted & shiftedExponent;
+    const auto rebiased = shifted + _Int::Splat((127 - 15) << 23);
+
+    const auto infinity = rebiased + _Int::Splat((128 - 16) << 23);
+    const auto denormal = AsInt(AsFloat(rebiased + _Int::Splat(1 << 23)) - AsFloat(_Int::Splat(113 << 23)));
+    auto ret = _Int::Select(_Int::CompareEqual(exponent, shiftedExponent), infinity, rebiased);
+    ret = _Int::Select(_Int::CompareEqual(exponent, _Int::Splat(0)), denormal, ret);
+    return AsFloat(ret | (halfBits & _Int::Splat(0x8000)).template ShiftLeft<16>());
+}
+
+void FloatsToHalves(const float* src, uint16_t* dest, size_t count) noexcept
+{
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        const auto value = _Float::Load(&src[i]);
+#if TGON_SIMD_F16C
+        if constexpr (decltype(tag)::LaneCount == 8)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), _mm256_cvtps_ph(value.value, _MM_FROUND_TO_NEAREST_INT));
+            return;
+        }
+        if constexpr (decltype(tag)::LaneCount == 4)
+        {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(&dest[i]), _mm_cvtps_ph(value.value, _MM_FROUND_TO_NEAREST_INT));
+            return;
+        }
+#endif
+        int32_t halves[decltype(tag)::LaneCount];
+        ComputeHalfBits(value).Store(halves);
+        for (size_t j = 0; j < decltype(tag)::LaneCount; ++j)
+        {
+            dest[i + j] = static_cast<uint16_t>(halves[j]);
+        }
+    });
+}
+
+void HalvesToFloats(const uint16_t* src, float* dest, size_t count) noexcept
+{
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+#if TGON_SIMD_F16C
+        if constexpr (decltype(tag)::LaneCount == 8)
+        {
+            _Float(_mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i])))).Store(&dest[i]);
+            return;
+        }
+        if constexpr (decltype(tag)::LaneCount == 4)
+        {
+            _Float(_mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&src[i])))).Store(&dest[i]);
+            return;
+        }
+#endif
+        int32_t halves[decltype(tag)::LaneCount];
+        for (size_t j = 0; j < decltype(tag)::LaneCount; ++j)
+        {
+            halves[j] = src[i + j];
+        }
+
+        using _Int = decltype(AsInt(_Float::Zero()));
+        ComputeHalfToFloat(_Int::Load(halves)).Store(&dest[i]);
+    });
+}
+
+/**
+ * @brief   Calls the kernel with four vectors, then one vector for the remaining ones.
+ * @param kernel    The callable which takes a LaneTag, the x, y and z lanes and the index of the first vector.
+ */
+template <typename _Kernel>
+void ForEachVector3(const float* srcVectors, size_t count, const _Kernel& kernel) noexcept
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        Float4 xs, ys, zs;
+        LoadVector3x4(&srcVectors[i * 3], xs, ys, zs);
+        kernel(LaneTag<Float4, 4>{}, xs, ys, zs, i);
+    }
+
+    for (; i < count; ++i)
+    {
+        kernel(LaneTag<Float1, 1>{}, Float1::Load(&srcVectors[i * 3]), Float1::Load(&srcVectors[i * 3 + 1]), Float1::Load(&srcVectors[i * 3 + 2]), i);
+    }
+}
+
+void EncodeOctahedralNormals(const float* srcNormals, int16_t* destNormals, size_t count) noexcept
+{
+    ForEachVector3(srcNormals, count, [&](auto tag, const auto& xs, const auto& ys, const auto& zs, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        constexpr auto laneCount = decltype(tag)::LaneCount;
+        const auto signBit = _Float::Splat(-0.0f);
+        const auto lengthL1 = _Float::Abs(xs) + _Float::Abs(ys) + _Float::Abs(zs);
+        const auto px = xs / lengthL1, py = ys / lengthL1, pz = zs / lengthL1;
+
+        // Fold the lower half of the octahedron over the upper half.
+        const auto isLower = _Float::CompareLess(pz, _Float::Zero());
+        const auto foldedX = (_Float::Splat(1.0f) - _Float::Abs(py)) | (px & signBit);
+        const auto foldedY = (_Float::Splat(1.0f) - _Float::Abs(px)) | (py & signBit);
+
+        int32_t encodedXs[laneCount], encodedYs[laneCount];
+        RoundToInt(_Float::Select(isLower, foldedX, px) * _Float::Splat(32767.0f)).Store(encodedXs);
+        RoundToInt(_Float::Select(isLower, foldedY, py) * _Float::Splat(32767.0f)).Store(encodedYs);
+        for (size_t j = 0; j < laneCount; ++j)
+        {
+            destNormals[(i + j) * 2] = static_cast<int16_t>(encodedXs[j]);
+            destNormals[(i + j) * 2 + 1] = static_cast<int16_t>(encodedYs[j]);
+        }
+    });
+}
+
+void QuantizePositions(const float* transform, const float* srcPositions, int16_t* destPositions, size_t count) noexcept
+{
+    ForEachVector3(srcPositions, count, [&](auto tag, const auto& xs, const auto& ys, const auto& zs, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        constexpr auto laneCount = decltype(tag)::LaneCount;
+        auto quantize = [](const _Float& value, float center, float scale)
+        {
+            const auto scaled = (value - _Float::Splat(center)) * _Float::Splat(scale);
+            return RoundToInt(_Float::Max(_Float::Min(scaled, _Float::Splat(32767.0f)), _Float::Splat(-32767.0f)));
+        };
+
+        int32_t quantized[3][laneCount];
+        quantize(xs, transform[0], transform[3]).Store(quantized[0]);
+        quantize(ys, transform[1], transform[4]).Store(quantized[1]);
+        quantize(zs, transform[2], transform[5]).Store(quantized[2]);
+        for (size_t j = 0; j < laneCount; ++j)
+        {
+            int16_t* dest = &destPositions[(i + j) * 4];
+            dest[0] = static_cast<int16_t>(quantized[0][j]);
+            dest[1] = static_cast<int16_t>(quantized[1][j]);
+            dest[2] = static_cast<int16_t>(quantized[2][j]);
+            dest[3] = 0;
+        }
+    });
+}
+
+void FloatsToUnorm8s(const float* src, uint8_t* dest, size_t count) noexcept
+{
+    ForEachLane(count, [&](auto tag, size_t i)
+    {
+        using _Float = typename decltype(tag)::Type;
+        const auto clamped = _Float::Max(_Float::Min(_Float::Load(&src[i]), _Float::Splat(1.0f)), _Float::Zero());
+
+        int32_t values[decltype(tag)::LaneCount];
+        RoundToInt(clamped * _Float::Splat(255.0f)).Store(values);
+        for (size_t j = 0; j < decltype(tag)::LaneCount; ++j)
+        {
+            dest[i + j] = static_cast<uint8_t>(values[j]);
+        }
+    });
+}
+
+constexpr VectorKernelTable g_simdVectorKernelTable{
+#if TGON_SIMD_AVX2
+    SimdLevel::Avx2,
+#elif TGON_SIMD_SSE41
+    SimdLevel::Sse41,
+#elif TGON_SIMD_SSE2
+    SimdLevel::Sse2,
+#elif TGON_SIMD_NEON
+    SimdLevel::Neon,
+#else
+    SimdLevel::Scalar,
+#endif
+    TransformVector4s,
+    NormalizeVector4s,
+    LerpVector4s,
+    InverseMatrix4x4s,
+    AffineInverseMatrix4x4s,
+    InverseTransposeMatrix4x4s,
+    RotateVector3s,
+    TransformPointVector3s,
+    TransformDirectionVector3s,
+    MinMaxVector3s,
+    SplitVector3s,
+    MergeVector3s,
+    TransformPoints,
+    TransformDirections,
+    DotVector3s,
+    CrossVector3s,
+    NormalizeVector3s,
+    MinMaxFloats,
+    LerpFloats,
+    RaycastAABBs,
+    RaycastTriangles,
+    OverlapAABBs,
+    CullSpheres,
+    CullAABBs,
+    SinFloats,
+    CosFloats,
+    Atan2Floats,
+    InverseSqrtFloats,
+    SqrtFloats,
+    Exp2Floats,
+    Log2Floats,
+    ExpFloats,
+    LogFloats,
+    PowFloats,
+    FloatsToHalves,
+    HalvesToFloats,
+    EncodeOctahedralNormals,
+    QuantizePositions,
+    FloatsToUnorm8s,
+    MultiplyMatrix3x4s,
+    InverseMatrix3x4s
+};
+
+}
+}
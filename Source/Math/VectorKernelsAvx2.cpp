@@ -0,0 +1,28 @@
+// This file is built with AVX2 and selected at runtime, so it must only include the headers whose inline functions
+// live in the namespace of the instruction set. The linker could pick the AVX2 version of the others for the whole binary.
+#include <cfloat>
+
+#include "Core/Simd.h"
+
+#include "FastMathConstants.h"
+#include "Matrix3x4Kernels.h"
+#include "Matrix4x4Kernels.h"
+#include "VectorKernelTable.h"
+
+#if TGON_SIMD_AVX2
+#include "VectorKernels.inl"
+#endif
+
+namespace tg
+{
+
+const VectorKernelTable* GetAvx2VectorKernelTable() noexcept
+{
+#if TGON_SIMD_AVX2
+    return &g_simdVectorKernelTable;
+#else
+    return nullptr;
+#endif
+}
+
+}
@@ -30,52 +30,40 @@
 
 -(void)windowDidResize:(NSNotification*)notification
 {
-    if (_window->OnResize != nullptr)
+    if (_window->OnResize.GetSubscriberCount() > 0)
     {
         const auto extent = _window->GetClientSize();
-        _window->OnResize(extent.width, extent.height);
+        _window->OnResize.Publish({extent.width, extent.height});
     }
 }
 
 -(void)windowDidMove:(NSNotification*)notification
 {
-    if (_window->OnMove != nullptr)
+    if (_window->OnMove.GetSubscriberCount() > 0)
     {
         const auto pos = _window->GetPosition();
-        _window->OnMove(pos.x, pos.y);
+        _window->OnMove.Publish({pos.x, pos.y});
     }
 }
 
 -(void)windowWillMiniaturize:(NSNotification*)notification
 {
-    if (_window->OnMinimize != nullptr)
-    {
-        _window->OnMinimize();
-    }
+    _window->OnMinimize.Publish({});
 }
 
 -(void)windowDidDeminiaturize:(NSNotification*)notification
 {
-    if (_window->OnMaximize != nullptr)
-    {
-        _window->OnMaximize();
-    }
+    _window->OnMaximize.Publish({});
 }
 
 -(void)windowDidEnterFullScreen:(NSNotification *)notification
 {
-    if (_window->OnEnterFullScreen != nullptr)
-    {
-        _window->OnEnterFullScreen();
-    }
+    _window->OnEnterFullScreen.Publish({});
 }
 
 -(void)windowDidExitFullScreen:(NSNotification *)notification
 {
-    if (_window->OnExitFullScreen != nullptr)
-    {
-        _window->OnExitFullScreen();
-    }
+    _window->OnExitFullScreen.Publish({});
 }
 @end
 
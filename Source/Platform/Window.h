@@ -1,6 +1,6 @@
 #pragma once
 
-#include "Core/DelegateChain.h"
+#include "Core/EventBus.h"
 #include "Math/Extent.h"
 #include "Math/Vector2.h"
 
@@ -14,6 +14,7 @@
 #include "IOS/IOSWindow.h"
 #endif
 
+#include "WindowEvent.h"
 #include "WindowStyle.h"
 
 namespace tg
@@ -70,16 +71,16 @@ public:
 
 /**@section Variable */
 public:
-    DelegateChain<void(int32_t, int32_t)> OnMove;
-    DelegateChain<void(int32_t, int32_t)> OnResize;
-    DelegateChain<void()> OnMaximize;
-    DelegateChain<void()> OnMinimize;
-    DelegateChain<void()> OnEnterFullScreen;
-    DelegateChain<void()> OnExitFullScreen;
-    DelegateChain<void()> OnWillClose;
-    DelegateChain<void()> OnDidClose;
-    DelegateChain<void()> OnGetFocus;
-    DelegateChain<void()> OnLoseFocus;
+    EventChannel<WindowMoveEvent> OnMove;
+    EventChannel<WindowResizeEvent> OnResize;
+    EventChannel<WindowMaximizeEvent> OnMaximize;
+    EventChannel<WindowMinimizeEvent> OnMinimize;
+    EventChannel<WindowEnterFullScreenEvent> OnEnterFullScreen;
+    EventChannel<WindowExitFullScreenEvent> OnExitFullScreen;
+    EventChannel<WindowWillCloseEvent> OnWillClose;
+    EventChannel<WindowDidCloseEvent> OnDidClose;
+    EventChannel<WindowGetFocusEvent> OnGetFocus;
+    EventChannel<WindowLoseFocusEvent> OnLoseFocus;
 };
 
 }
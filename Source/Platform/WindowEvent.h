@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+namespace tg
+{
+
+struct WindowMoveEvent final
+{
+    int32_t x = 0;
+    int32_t y = 0;
+};
+
+struct WindowResizeEvent final
+{
+    int32_t width = 0;
+    int32_t height = 0;
+};
+
+struct WindowMaximizeEvent final {};
+struct WindowMinimizeEvent final {};
+struct WindowEnterFullScreenEvent final {};
+struct WindowExitFullScreenEvent final {};
+struct WindowWillCloseEvent final {};
+struct WindowDidCloseEvent final {};
+struct WindowGetFocusEvent final {};
+struct WindowLoseFocusEvent final {};
+
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include "BinaryTraits.h"
+
+namespace tg
+{
+
+/**
+ * @brief   Reads the values which were written by BinaryWriter.
+ * @remark  Every read is checked against the remaining bytes, so the malformed data is rejected instead of being read
+ *          out of the bounds. If a read fails, the value may be partially read.
+ */
+class BinaryReader final
+{
+/**@section Constructor */
+public:
+    explicit BinaryReader(std::span<const std::byte> bytes) noexcept;
+
+/**@section Method */
+public:
+    /**
+     * @brief   Reads the value.
+     * @param [out] value   The value to read into.
+     * @return  True if the value was read, false if the bytes were not enough.
+     */
+    template <BinarySerializable _Value>
+    [[nodiscard]] bool Read(_Value& value);
+
+    /**
+     * @brief   Reads the values which were written by BinaryWriter::WriteRange.
+     * @param [out] values  The values to read into. Its size must be the number of the written values.
+     * @return  True if every value was read, false if the bytes were not enough.
+     */
+    template <BinarySerializable _Value>
+    [[nodiscard]] bool ReadRange(std::span<_Value> values);
+
+    [[nodiscard]] size_t GetOffset() const noexcept;
+    [[nodiscard]] size_t GetRemainingSize() const noexcept;
+
+private:
+    template <typename _Value>
+    static const std::byte* ReadFixed(const std::byte* src, _Value& value) noexcept;
+
+/**@section Variable */
+private:
+    std::span<const std::byte> m_bytes;
+    size_t m_offset = 0;
+};
+
+inline BinaryReader::BinaryReader(std::span<const std::byte> bytes) noexcept :
+    m_bytes(bytes)
+{
+}
+
+template <BinarySerializable _Value>
+bool BinaryReader::Read(_Value& value)
+{
+    if constexpr (detail::FixedBinarySize<_Value> > 0)
+    {
+        if (this->GetRemainingSize() < detail::FixedBinarySize<_Value>)
+        {
+            return false;
+        }
+
+        ReadFixed(m_bytes.data() + m_offset, value);
+        m_offset += detail::FixedBinarySize<_Value>;
+        return true;
+    }
+    else if constexpr (detail::IsBinaryContainer<_Value>)
+    {
+        using ElementType = typename _Value::value_type;
+
+        // Every element takes a byte at least, so the count can't make a huge allocation from a few bytes.
+        uint32_t count = 0;
+        if (this->Read(count) == false || count > this->GetRemainingSize() / std::max<size_t>(detail::FixedBinarySize<ElementType>, 1))
+        {
+            return false;
+        }
+
+        value.resize(count);
+        return this->ReadRange(std::span<ElementType>(value.data(), value.size()));
+    }
+    else
+    {
+        bool isSucceeded = true;
+        detail::ForEachSerializedField<_Value>([&](const auto& field)
+        {
+            isSucceeded = isSucceeded && this->Read(field.Get(value));
+        });
+        return isSucceeded;
+    }
+}
+
+template <BinarySerializable _Value>
+bool BinaryReader::ReadRange(std::span<_Value> values)
+{
+    if constexpr (detail::FixedBinarySize<_Value> > 0)
+    {
+        if (this->GetRemainingSize() / detail::FixedBinarySize<_Value> < values.size())
+        {
+            return false;
+        }
+
+        const auto* src = m_bytes.data() + m_offset;
+        if constexpr (detail::IsBinaryTrivial<_Value>)
+        {
+            std::memcpy(values.data(), src, values.size_bytes());
+        }
+        else
+        {
+            for (auto& value : values)
+            {
+                src = ReadFixed(src, value);
+            }
+        }
+
+        m_offset += values.size() * detail::FixedBinarySize<_Value>;
+        return true;
+    }
+    else
+    {
+        for (auto& value : values)
+        {
+            if (this->Read(value) == false)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+inline size_t BinaryReader::GetOffset() const noexcept
+{
+    return m_offset;
+}
+
+inline size_t BinaryReader::GetRemainingSize() const noexcept
+{
+    return m_bytes.size() - m_offset;
+}
+
+template <typename _Value>
+const std::byte* BinaryReader::ReadFixed(const std::byte* src, _Value& value) noexcept
+{
+    if constexpr (detail::IsBinaryTrivial<_Value>)
+    {
+        std::memcpy(&value, src, sizeof(_Value));
+        return src + sizeof(_Value);
+    }
+    else
+    {
+        detail::ForEachSerializedField<_Value>([&](const auto& field)
+        {
+            src = ReadFixed(src, field.Get(value));
+        });
+        return src;
+    }
+}
+
+}
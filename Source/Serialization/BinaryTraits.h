@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Core/Reflection.h"
+
+namespace tg::detail
+{
+
+template <typename _Type>
+constexpr bool IsBinaryContainer = false;
+
+template <typename _Char, typename _Traits, typename _Allocator>
+constexpr bool IsBinaryContainer<std::basic_string<_Char, _Traits, _Allocator>> = true;
+
+template <typename _Value, typename _Allocator>
+constexpr bool IsBinaryContainer<std::vector<_Value, _Allocator>> = true;
+
+/**
+ * @brief   Checks whether the type is written as its object representation.
+ * @remark  The reflected types are written field by field even if they are trivially copyable, so the padding and the
+ *          transient fields aren't written.
+ */
+template <typename _Type>
+constexpr bool IsBinaryTrivial = std::is_trivially_copyable_v<_Type> && Reflectable<_Type> == false &&
+    std::is_pointer_v<_Type> == false && std::is_member_pointer_v<_Type> == false;
+
+/**
+ * @brief   Calls the function with every field of the type which isn't transient.
+ * @remark  The transient fields are skipped at compile time, so their types don't need to be serializable.
+ */
+template <Reflectable _Type, typename _Function>
+constexpr void ForEachSerializedField(_Function&& function)
+{
+    [&]<size_t... _Indices>(std::index_sequence<_Indices...>)
+    {
+        ([&]
+        {
+            constexpr auto& field = std::get<_Indices>(ReflectedFields<_Type>);
+            if constexpr (field.HasFlag(FieldFlags::Transient) == false)
+            {
+                function(field);
+            }
+        }(), ...);
+    }(std::make_index_sequence<GetFieldCount<_Type>()>());
+}
+
+/**
+ * @brief   Gets the number of the bytes which the type is always written to, or 0 if it depends on the value.
+ */
+template <typename _Type>
+consteval size_t GetFixedBinarySize() noexcept
+{
+    if constexpr (IsBinaryTrivial<_Type>)
+    {
+        return sizeof(_Type);
+    }
+    else if constexpr (Reflectable<_Type>)
+    {
+        size_t size = 0;
+        bool isFixed = true;
+        ForEachSerializedField<_Type>([&](const auto& field)
+        {
+            const auto fieldSize = GetFixedBinarySize<typename std::remove_cvref_t<decltype(field)>::FieldType>();
+            size += fieldSize;
+            isFixed = isFixed && fieldSize > 0;
+        });
+
+        return isFixed ? size : 0;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+template <typename _Type>
+constexpr size_t FixedBinarySize = GetFixedBinarySize<_Type>();
+
+}
+
+namespace tg
+{
+
+/**
+ * @brief   Checks whether BinaryWriter and BinaryReader can handle the type.
+ * @remark  The supported types are the trivially copyable types except pointers, the reflected types whose fields are
+ *          supported, std::basic_string and std::vector.
+ */
+template <typename _Type>
+concept BinarySerializable = detail::IsBinaryTrivial<_Type> || Reflectable<_Type> || detail::IsBinaryContainer<_Type>;
+
+}
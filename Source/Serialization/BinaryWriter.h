@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include "BinaryTraits.h"
+
+namespace tg
+{
+
+/**
+ * @brief   Appends the values to a byte array in the native byte order.
+ * @remark  The code to write a type is generated for the type, so there is no virtual call or lookup per field.
+ *          A reflected type is written as its fields which aren't transient in the declared order, and a container is
+ *          written as the uint32_t count followed by the elements.
+ */
+class BinaryWriter final
+{
+/**@section Constructor */
+public:
+    explicit BinaryWriter(std::vector<std::byte>& bytes) noexcept;
+
+/**@section Method */
+public:
+    template <BinarySerializable _Value>
+    void Write(const _Value& value);
+
+    /**
+     * @brief   Writes the values without their count.
+     * @remark  If the values are written to a fixed size, the bytes of every value are reserved at once and written
+     *          without any further check.
+     */
+    template <BinarySerializable _Value>
+    void WriteRange(std::span<const _Value> values);
+
+    [[nodiscard]] size_t GetSize() const noexcept;
+
+private:
+    template <typename _Value>
+    static std::byte* WriteFixed(std::byte* dest, const _Value& value) noexcept;
+
+/**@section Variable */
+private:
+    std::vector<std::byte>* m_bytes;
+};
+
+inline BinaryWriter::BinaryWriter(std::vector<std::byte>& bytes) noexcept :
+    m_bytes(&bytes)
+{
+}
+
+template <BinarySerializable _Value>
+void BinaryWriter::Write(const _Value& value)
+{
+    if constexpr (detail::FixedBinarySize<_Value> > 0)
+    {
+        const auto offset = m_bytes->size();
+        m_bytes->resize(offset + detail::FixedBinarySize<_Value>);
+        WriteFixed(m_bytes->data() + offset, value);
+    }
+    else if constexpr (detail::IsBinaryContainer<_Value>)
+    {
+        this->Write(static_cast<uint32_t>(value.size()));
+        this->WriteRange(std::span<const typename _Value::value_type>(value.data(), value.size()));
+    }
+    else
+    {
+        detail::ForEachSerializedField<_Value>([&](const auto& field)
+        {
+            this->Write(field.Get(value));
+        });
+    }
+}
+
+template <BinarySerializable _Value>
+void BinaryWriter::WriteRange(std::span<const _Value> values)
+{
+    if constexpr (detail::IsBinaryTrivial<_Value>)
+    {
+        const auto* src = reinterpret_cast<const std::byte*>(values.data());
+        m_bytes->insert(m_bytes->end(), src, src + values.size_bytes());
+    }
+    else if constexpr (detail::FixedBinarySize<_Value> > 0)
+    {
+        const auto offset = m_bytes->size();
+        m_bytes->resize(offset + values.size() * detail::FixedBinarySize<_Value>);
+
+        auto* dest = m_bytes->data() + offset;
+        for (const auto& value : values)
+        {
+            dest = WriteFixed(dest, value);
+        }
+    }
+    else
+    {
+        for (const auto& value : values)
+        {
+            this->Write(value);
+        }
+    }
+}
+
+inline size_t BinaryWriter::GetSize() const noexcept
+{
+    return m_bytes->size();
+}
+
+template <typename _Value>
+std::byte* BinaryWriter::WriteFixed(std::byte* dest, const _Value& value) noexcept
+{
+    if constexpr (detail::IsBinaryTrivial<_Value>)
+    {
+        std::memcpy(dest, &value, sizeof(_Value));
+        return dest + sizeof(_Value);
+    }
+    else
+    {
+        detail::ForEachSerializedField<_Value>([&](const auto& field)
+        {
+            dest = WriteFixed(dest, field.Get(value));
+        });
+        return dest;
+    }
+}
+
+}
@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <fmt/format.h>
+
+#include "Math/Matrix3x4.h"
+#include "Math/Quaternion.h"
+#include "Serialization/BinaryReader.h"
+#include "Serialization/BinaryWriter.h"
+
+namespace
+{
+
+constexpr size_t ComponentCount = 100000;
+constexpr int32_t RepeatCount = 20;
+
+/**
+ * @brief   Has the same fields as TransformComponent, so the cached matrix makes the serialized fields sparse.
+ */
+class Transform
+{
+public:
+    TGON_REFLECT(Transform,
+        TGON_REFLECT_FIELD(m_localPosition),
+        TGON_REFLECT_FIELD(m_localRotation),
+        TGON_REFLECT_FIELD(m_localScale),
+        TGON_REFLECT_FIELD(m_matWorld, tg::FieldFlags::Transient),
+        TGON_REFLECT_FIELD(m_isDirty, tg::FieldFlags::Transient))
+
+public:
+    tg::Vector3 m_localPosition;
+    tg::Quaternion m_localRotation;
+    tg::Vector3 m_localScale;
+    tg::Matrix3x4 m_matWorld;
+    bool m_isDirty = true;
+};
+
+template <typename _Function>
+double MeasureBest(_Function function)
+{
+    auto minTime = std::chrono::nanoseconds::max();
+    for (int32_t i = 0; i < RepeatCount; ++i)
+    {
+        const auto begin = std::chrono::steady_clock::now();
+        function();
+        minTime = std::min(minTime, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin));
+    }
+
+    return static_cast<double>(minTime.count()) / 1000000.0;
+}
+
+}
+
+/**
+ * @brief   Compares BinaryWriter and BinaryReader for the reflected components with memcpy of the same number of bytes,
+ *          which is the lower bound of any serializer.
+ */
+int main()
+{
+    std::vector<Transform> transforms(ComponentCount);
+    for (size_t i = 0; i < transforms.size(); ++i)
+    {
+        const auto value = static_cast<float>(i);
+        transforms[i].m_localPosition = {value, value + 1.0f, value + 2.0f};
+        transforms[i].m_localRotation = {0.0f, 0.0f, 0.0f, 1.0f};
+        transforms[i].m_localScale = {1.0f, 1.0f, 1.0f};
+    }
+
+    constexpr auto payloadSize = tg::detail::FixedBinarySize<Transform>;
+    std::vector<std::byte> packedBytes(ComponentCount * payloadSize);
+    std::vector<std::byte> copiedBytes(packedBytes.size());
+    std::vector<std::byte> bytes;
+    bytes.reserve(packedBytes.size());
+
+    const auto memcpyTime = MeasureBest([&]()
+    {
+        std::memcpy(copiedBytes.data(), packedBytes.data(), packedBytes.size());
+    });
+    const auto writeTime = MeasureBest([&]()
+    {
+        bytes.clear();
+        tg::BinaryWriter(bytes).WriteRange(std::span<const Transform>(transforms));
+    });
+
+    std::vector<Transform> readTransforms(ComponentCount);
+    bool isSucceeded = true;
+    const auto readTime = MeasureBest([&]()
+    {
+        isSucceeded = isSucceeded && tg::BinaryReader(bytes).ReadRange(std::span<Transform>(readTransforms));
+    });
+
+    fmt::print("{} components, {} bytes each\n", ComponentCount, payloadSize);
+    fmt::print("{:<10}{:>10.3f} ms\n", "memcpy", memcpyTime);
+    fmt::print("{:<10}{:>10.3f} ms\n", "Write", writeTime);
+    fmt::print("{:<10}{:>10.3f} ms   ({})\n", "Read", readTime, isSucceeded && readTransforms.back().m_localPosition == transforms.back().m_localPosition);
+
+    return 0;
+}
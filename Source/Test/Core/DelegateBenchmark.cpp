@@ -0,0 +1,150 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+#include <fmt/format.h>
+
+#include "Core/Delegate.h"
+#include "Core/InplaceDelegate.h"
+
+namespace
+{
+
+constexpr int32_t RepeatCount = 50;
+
+std::atomic<size_t> g_allocationCount;
+
+/**
+ * @brief   Keeps the results of the tasks alive, so the calls aren't optimized out.
+ */
+volatile int64_t g_sink;
+
+/**
+ * @brief   Gets the best time per iteration of the repeated runs, which filters out the interruptions.
+ */
+template <typename _Function>
+double Measure(size_t count, const _Function& function)
+{
+    auto minTime = std::chrono::nanoseconds::max();
+    for (int32_t i = 0; i < RepeatCount; ++i)
+    {
+        const auto begin = std::chrono::steady_clock::now();
+        function();
+        minTime = std::min(minTime, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin));
+    }
+    return static_cast<double>(minTime.count()) / count;
+}
+
+/**
+ * @brief   Schedules the tasks into a reserved queue and runs them, like DispatchQueue does.
+ */
+template <typename _Delegate, typename _MakeTask>
+void BenchmarkSchedule(const char* name, const _MakeTask& makeTask)
+{
+    constexpr size_t taskCount = 4096;
+    std::vector<_Delegate> queue;
+    queue.reserve(taskCount);
+
+    int64_t sum = 0;
+    const auto allocationCount = g_allocationCount.load();
+    const auto time = Measure(taskCount, [&]
+    {
+        for (size_t i = 0; i < taskCount; ++i)
+        {
+            queue.push_back(makeTask(sum, i));
+        }
+        for (auto& task : queue)
+        {
+            task();
+        }
+        queue.clear();
+    });
+    const auto allocationsPerTask = static_cast<double>(g_allocationCount.load() - allocationCount) / (taskCount * RepeatCount);
+    g_sink = sum;
+
+    fmt::print("{:<40}{:>10.2f}{:>14.2f}\n", name, time, allocationsPerTask);
+}
+
+template <typename _Delegate>
+void BenchmarkInvoke(const char* name)
+{
+    constexpr size_t callCount = 1 << 16;
+    int64_t sum = 0;
+    std::vector<_Delegate> delegates;
+    for (int32_t i = 0; i < 8; ++i)
+    {
+        delegates.push_back([&sum, i](int32_t value) { sum += value + i; });
+    }
+
+    const auto time = Measure(callCount, [&]
+    {
+        for (size_t i = 0; i < callCount; ++i)
+        {
+            delegates[i % delegates.size()](static_cast<int32_t>(i));
+        }
+    });
+    g_sink = sum;
+    fmt::print("{:<40}{:>10.2f}{:>14}\n", name, time, "-");
+}
+
+}
+
+void* operator new(size_t size)
+{
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* ret = std::malloc(size == 0 ? 1 : size))
+    {
+        return ret;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+/**
+ * @brief   Compares the call overhead and the allocations of Delegate with InplaceDelegate.
+ */
+int main()
+{
+    using namespace tg;
+
+    // The capacity of DispatchQueue::Task.
+    using Task = InplaceDelegate<void(), 64>;
+
+    fmt::print("{:<40}{:>10}{:>14}\n", "Benchmark", "ns/op", "allocs/op");
+    BenchmarkInvoke<Delegate<void(int32_t)>>("Invoke Delegate");
+    BenchmarkInvoke<InplaceDelegate<void(int32_t)>>("Invoke InplaceDelegate");
+
+    // The capture of the pointer and the index fits in both.
+    auto makeSmallTask = [](int64_t& sum, size_t i) { return [&sum, i]() { sum += static_cast<int64_t>(i); }; };
+    BenchmarkSchedule<Delegate<void()>>("Schedule 16 bytes Delegate", makeSmallTask);
+    BenchmarkSchedule<Task>("Schedule 16 bytes InplaceDelegate", makeSmallTask);
+
+    // The capture of SceneModule::LoadScene, which adds a std::shared_ptr and a short std::string.
+    auto shared = std::make_shared<int64_t>(1);
+    const std::string path = "Scene.scene";
+    auto makeMediumTask = [&](int64_t& sum, size_t i) { return [&sum, shared, path = path]() { sum += *shared + static_cast<int64_t>(path.size()); }; };
+    BenchmarkSchedule<Delegate<void()>>("Schedule 56 bytes Delegate", makeMediumTask);
+    BenchmarkSchedule<Task>("Schedule 56 bytes InplaceDelegate", makeMediumTask);
+
+    // The synchronous task which used to wrap a Delegate in another Delegate.
+    bool isTaskExecuted = false;
+    auto makeNestedTask = [&](int64_t& sum, size_t i) { return [&isTaskExecuted, task = Delegate<void()>([&sum, i]() { sum += static_cast<int64_t>(i); })]() { task(); isTaskExecuted = true; }; };
+    auto makeReferenceTask = [&](int64_t& sum, size_t i) { return [&isTaskExecuted, &sum, i]() { sum += static_cast<int64_t>(i); isTaskExecuted = true; }; };
+    BenchmarkSchedule<Delegate<void()>>("Schedule sync task Delegate", makeNestedTask);
+    BenchmarkSchedule<Task>("Schedule sync task InplaceDelegate", makeReferenceTask);
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file    EventBusTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Core/EventBus.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class EventBusTest :
+    public Test
+{
+/**@section Struct */
+private:
+    struct DamageEvent
+    {
+        int32_t amount;
+    };
+
+    struct LogEvent
+    {
+        std::string message;
+    };
+
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        this->EvaluateSubscription();
+        this->EvaluateMutationDuringPublish();
+        this->EvaluateQueuedEvents();
+        this->EvaluatePostedEvents();
+    }
+
+private:
+    void EvaluateSubscription()
+    {
+        EventBus eventBus;
+        int32_t total = 0;
+        auto handle = eventBus.Subscribe<DamageEvent>([&](const DamageEvent& event) { total += event.amount; });
+        eventBus.Subscribe<DamageEvent>([&](const DamageEvent& event) { total += event.amount * 10; });
+
+        eventBus.Publish(DamageEvent{1});
+        assert(total == 11 && eventBus.GetChannel<DamageEvent>().IsSubscribed(handle));
+
+        assert(eventBus.Unsubscribe(handle) && eventBus.Unsubscribe(handle) == false);
+        eventBus.Publish(DamageEvent{1});
+        assert(total == 21 && eventBus.GetChannel<DamageEvent>().GetSubscriberCount() == 1);
+
+        // The handle of another type or a stale handle doesn't remove anything.
+        auto logHandle = eventBus.Subscribe<LogEvent>([](const LogEvent&) {});
+        auto newHandle = eventBus.Subscribe<DamageEvent>([](const DamageEvent&) {});
+        assert(newHandle.index == handle.index && eventBus.Unsubscribe(handle) == false);
+        assert(eventBus.GetChannel<DamageEvent>().Unsubscribe(logHandle) == false && EventHandle().IsNull());
+    }
+
+    void EvaluateMutationDuringPublish()
+    {
+        EventChannel<DamageEvent> channel;
+        std::vector<int32_t> calls;
+        EventHandle selfHandle;
+        EventHandle otherHandle;
+
+        selfHandle = channel.Subscribe([&](const DamageEvent&)
+        {
+            calls.push_back(0);
+
+            // Unsubscribing itself and another handler, and subscribing enough handlers to grow the pool.
+            channel.Unsubscribe(selfHandle);
+            channel.Unsubscribe(otherHandle);
+            for (int32_t i = 0; i < 100; ++i)
+            {
+                channel.Subscribe([&](const DamageEvent&) { calls.push_back(2); });
+            }
+        });
+        otherHandle = channel.Subscribe([&](const DamageEvent&) { calls.push_back(1); });
+
+        channel.Publish(DamageEvent{});
+        assert(calls.size() == 1 && channel.GetSubscriberCount() == 100);
+
+        calls.clear();
+        channel.Publish(DamageEvent{});
+        assert(calls.size() == 100);
+
+        // The nested publish doesn't destroy the handler which is still running in the outer one.
+        EventChannel<DamageEvent> nestedChannel;
+        int32_t depth = 0;
+        EventHandle nestedHandle;
+        nestedHandle = nestedChannel.Subscribe([&](const DamageEvent&)
+        {
+            if (++depth == 1)
+            {
+                nestedChannel.Publish(DamageEvent{});
+                nestedChannel.Unsubscribe(nestedHandle);
+            }
+            assert(nestedChannel.GetSubscriberCount() <= 1);
+        });
+        nestedChannel.Publish(DamageEvent{});
+        assert(depth == 2 && nestedChannel.GetSubscriberCount() == 0);
+    }
+
+    void EvaluateQueuedEvents()
+    {
+        EventBus eventBus;
+        std::string order;
+        eventBus.Subscribe<DamageEvent>([&](const DamageEvent& event)
+        {
+            order += std::to_string(event.amount);
+
+            // Queued again by the handler, so it's dispatched in the next frame.
+            if (event.amount == 1)
+            {
+                eventBus.Enqueue(DamageEvent{9});
+            }
+        });
+        eventBus.Subscribe<LogEvent>([&](const LogEvent& event) { order += event.message; });
+
+        eventBus.Enqueue(DamageEvent{1});
+        eventBus.Enqueue(LogEvent{"a"});
+        eventBus.Enqueue(DamageEvent{2});
+        eventBus.Enqueue(LogEvent{"b"});
+        assert(order.empty());
+
+        // The events are grouped by the type.
+        eventBus.DispatchQueuedEvents();
+        assert(order == "12ab");
+
+        eventBus.DispatchQueuedEvents();
+        assert(order == "12ab9");
+    }
+
+    void EvaluatePostedEvents()
+    {
+        EventBus eventBus;
+        std::vector<int32_t> lastAmounts(4, -1);
+        int32_t count = 0;
+        eventBus.Subscribe<DamageEvent>([&](const DamageEvent& event)
+        {
+            // The events of a thread arrive in the order in which they were posted.
+            auto& lastAmount = lastAmounts[event.amount / 10000];
+            assert(lastAmount < event.amount);
+            lastAmount = event.amount;
+            ++count;
+        });
+
+        std::vector<std::thread> threads;
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([&eventBus, i]()
+            {
+                for (int32_t j = 0; j < 1000; ++j)
+                {
+                    eventBus.Post(DamageEvent{i * 10000 + j});
+                }
+            });
+        }
+        while (count < 4000)
+        {
+            eventBus.DispatchQueuedEvents();
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        assert(count == 4000);
+
+        // The posted events which are never dispatched are freed with the bus.
+        eventBus.Post(LogEvent{"leaked if not freed"});
+    }
+};
+
+} /* namespace tgon */
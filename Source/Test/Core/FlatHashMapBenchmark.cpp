@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include <fmt/format.h>
+
+#include "Core/FlatHashMap.h"
+
+namespace
+{
+
+constexpr size_t LookupCount = 1 << 22;
+constexpr int32_t RepeatCount = 5;
+
+/**
+ * @brief   Gets the best time of the repeated lookups divided by the lookup count.
+ * @remark  The keys are looked up in a shuffled order, so the hardware prefetcher can't follow the insertion order.
+ *          The number of keys must be a power of two.
+ */
+template <typename _Map, typename _Key>
+double MeasureLookup(const _Map& map, const std::vector<_Key>& keys, int64_t& checksum)
+{
+    auto minTime = std::chrono::nanoseconds::max();
+    for (int32_t i = 0; i < RepeatCount; ++i)
+    {
+        // The sum is kept in a local, because the stores through the reference can't be moved out of the loop.
+        int64_t sum = 0;
+        const auto begin = std::chrono::steady_clock::now();
+        for (size_t j = 0; j < LookupCount; ++j)
+        {
+            const auto it = map.Find(keys[j & (keys.size() - 1)]);
+            sum += (it != map.end()) ? static_cast<int64_t>(it->second) : 1;
+        }
+        checksum += sum;
+        minTime = std::min(minTime, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin));
+    }
+
+    return static_cast<double>(minTime.count()) / LookupCount;
+}
+
+/**
+ * @brief   Wraps std::unordered_map to measure it with the same code.
+ */
+template <typename _Key, typename _Value>
+struct StdUnorderedMap
+{
+    auto Find(const _Key& key) const { return map.find(key); }
+    auto end() const { return map.end(); }
+
+    std::unordered_map<_Key, _Value> map;
+};
+
+template <typename _Key>
+void Run(const char* keyName, size_t size, const std::vector<_Key>& allKeys)
+{
+    std::mt19937 random(static_cast<uint32_t>(size));
+    std::vector<_Key> keys(allKeys.begin(), allKeys.begin() + static_cast<std::ptrdiff_t>(size));
+    std::vector<_Key> missingKeys(allKeys.begin() + static_cast<std::ptrdiff_t>(size), allKeys.begin() + static_cast<std::ptrdiff_t>(size * 2));
+
+    tg::FlatHashMap<_Key, int32_t> flatMap;
+    StdUnorderedMap<_Key, int32_t> stdMap;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        flatMap.TryEmplace(keys[i], static_cast<int32_t>(i));
+        stdMap.map.emplace(keys[i], static_cast<int32_t>(i));
+    }
+    std::shuffle(keys.begin(), keys.end(), random);
+
+    int64_t checksum = 0;
+    const auto flatHitTime = MeasureLookup(flatMap, keys, checksum);
+    const auto stdHitTime = MeasureLookup(stdMap, keys, checksum);
+    const auto flatMissTime = MeasureLookup(flatMap, missingKeys, checksum);
+    const auto stdMissTime = MeasureLookup(stdMap, missingKeys, checksum);
+
+    fmt::print("{:<10}{:>10}{:>14.2f}{:>14.2f}{:>14.2f}{:>14.2f}   ({})\n", keyName, size, flatHitTime, stdHitTime, flatMissTime, stdMissTime, checksum);
+}
+
+}
+
+/**
+ * @brief   Compares the lookup of FlatHashMap with std::unordered_map for the key types of the glyph, font face and
+ *          atlas tables.
+ */
+int main()
+{
+    constexpr size_t sizes[] = {64, 1024, 16384, 262144};
+    constexpr size_t maxSize = 262144;
+
+    std::mt19937_64 random(0);
+    std::vector<char32_t> charKeys;
+    std::vector<int32_t> intKeys;
+    std::vector<uint64_t> uint64Keys;
+    for (size_t i = 0; i < maxSize * 2; ++i)
+    {
+        // The characters are dense like the code points of a script, and the atlas keys are scattered.
+        charKeys.push_back(static_cast<char32_t>(0xAC00 + i));
+        intKeys.push_back(static_cast<int32_t>(i * 2 + 8));
+        uint64Keys.push_back(random());
+    }
+
+    fmt::print("{:<10}{:>10}{:>14}{:>14}{:>14}{:>14}\n", "Key", "Size", "Flat hit", "Std hit", "Flat miss", "Std miss");
+    for (auto size : sizes)
+    {
+        Run("char32_t", size, charKeys);
+    }
+    for (auto size : sizes)
+    {
+        Run("int32_t", size, intKeys);
+    }
+    for (auto size : sizes)
+    {
+        Run("uint64_t", size, uint64Keys);
+    }
+
+    return 0;
+}
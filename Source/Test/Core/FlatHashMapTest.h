@@ -0,0 +1,166 @@
+/**
+ * @file    FlatHashMapTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+
+#include "Core/FlatHashMap.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class FlatHashMapTest :
+    public Test
+{
+/**@section Struct */
+private:
+    struct CollidingHash
+    {
+        size_t operator()(int32_t) const noexcept { return 0; }
+    };
+
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        this->EvaluateMap();
+        this->EvaluateErase();
+        this->EvaluateCollision();
+        this->EvaluateSet();
+        this->EvaluateAllocator();
+    }
+
+private:
+    void EvaluateMap()
+    {
+        FlatHashMap<int32_t, std::string> map;
+        assert(map.IsEmpty() && map.Find(1) == map.end() && map.GetCapacity() == 0);
+
+        for (int32_t i = 0; i < 1000; ++i)
+        {
+            assert(map.TryEmplace(i, std::to_string(i)).second);
+        }
+        assert(map.GetSize() == 1000 && map.GetSize() <= map.GetCapacity() - map.GetCapacity() / 8);
+        assert(map.TryEmplace(7, "seven").second == false && map.Find(7)->second == "7");
+
+        for (int32_t i = 0; i < 1000; ++i)
+        {
+            assert(map.Contains(i) && map[i] == std::to_string(i));
+        }
+        assert(map.Contains(1000) == false && map.Find(-1) == map.end());
+
+        map[1000] = "new";
+        map.InsertOrAssign(0, "zero");
+        assert(map.GetSize() == 1001 && map.Find(0)->second == "zero" && map.Find(1000)->second == "new");
+
+        size_t count = 0;
+        int64_t keySum = 0;
+        for (const auto& [key, value] : map)
+        {
+            ++count;
+            keySum += key;
+        }
+        assert(count == 1001 && keySum == 1000 * 1001 / 2);
+
+        // The copy owns its own values.
+        auto copied = map;
+        copied[1] = "one";
+        assert(copied.GetSize() == 1001 && map[1] == "1");
+
+        auto moved = std::move(copied);
+        assert(moved.GetSize() == 1001 && copied.IsEmpty() && moved[1] == "one");
+
+        map.Clear();
+        assert(map.IsEmpty() && map.begin() == map.end() && map.GetCapacity() > 0);
+    }
+
+    void EvaluateErase()
+    {
+        FlatHashMap<uint64_t, uint64_t> map;
+        std::unordered_map<uint64_t, uint64_t> expected;
+
+        // Inserting and erasing in turn leaves the tombstones, which must be reclaimed without growing the table forever.
+        uint64_t state = 1;
+        for (int32_t i = 0; i < 100000; ++i)
+        {
+            state = state * 6364136223846793005 + 1442695040888963407;
+            const auto key = (state >> 33) % 512;
+            if ((state >> 40) & 1)
+            {
+                assert(map.TryEmplace(key, key * 2).second == expected.emplace(key, key * 2).second);
+            }
+            else
+            {
+                assert(map.Erase(key) == (expected.erase(key) == 1));
+            }
+        }
+        assert(map.GetSize() == expected.size() && map.GetCapacity() <= 1024);
+        for (const auto& [key, value] : expected)
+        {
+            assert(map.Find(key)->second == value);
+        }
+
+        for (auto it = map.begin(); it != map.end(); ++it)
+        {
+            map.Erase(it);
+        }
+        assert(map.IsEmpty());
+    }
+
+    void EvaluateCollision()
+    {
+        // Every key has the same hash, so the probe has to go over the groups.
+        FlatHashMap<int32_t, int32_t, CollidingHash> map;
+        for (int32_t i = 0; i < 100; ++i)
+        {
+            map[i] = i;
+        }
+        map.Erase(50);
+        for (int32_t i = 0; i < 100; ++i)
+        {
+            assert(map.Contains(i) == (i != 50));
+        }
+    }
+
+    void EvaluateSet()
+    {
+        FlatHashSet<std::string> set;
+        assert(set.Insert("a").second && set.Insert("b").second && set.Insert("a").second == false);
+        assert(set.GetSize() == 2 && set.Contains("b") && set.Contains("c") == false);
+
+        set.Erase("a");
+        assert(set.GetSize() == 1 && *set.begin() == "b");
+    }
+
+    void EvaluateAllocator()
+    {
+        std::pmr::monotonic_buffer_resource resource;
+        pmr::FlatHashMap<char32_t, int32_t> map(&resource);
+        map.Reserve(100);
+        assert(map.GetAllocator().resource() == &resource && map.GetCapacity() >= 100);
+
+        const auto capacity = map.GetCapacity();
+        for (char32_t c = 0; c < 100; ++c)
+        {
+            map[c] = static_cast<int32_t>(c);
+        }
+        assert(map.GetCapacity() == capacity);
+
+        // The values can't be stolen from another resource.
+        pmr::FlatHashMap<char32_t, int32_t> other(std::pmr::new_delete_resource());
+        other = std::move(map);
+        assert(other.GetSize() == 100 && other.GetAllocator().resource() == std::pmr::new_delete_resource());
+    }
+};
+
+} /* namespace tgon */
@@ -0,0 +1,169 @@
+/**
+ * @file    FrameAllocatorTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "Core/FrameAllocator.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class FrameAllocatorTest :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        this->EvaluateLinearAllocator();
+        this->EvaluateAdapter();
+        this->EvaluateFrameAllocator();
+        this->EvaluateScratchScope();
+    }
+
+private:
+    void EvaluateLinearAllocator()
+    {
+        LinearAllocator allocator(256);
+        auto* a = allocator.Allocate(10, 1);
+        auto* b = allocator.Allocate(16, 64);
+        assert(reinterpret_cast<uintptr_t>(b) % 64 == 0 && static_cast<std::byte*>(b) >= static_cast<std::byte*>(a) + 10);
+        assert(allocator.GetOverflowCount() == 0);
+
+        // The last allocation can be given back, but the others stay until the allocator is rewound.
+        const auto usedSize = allocator.GetUsedSize();
+        allocator.Deallocate(b, 16);
+        assert(allocator.GetUsedSize() == usedSize - 16);
+        allocator.Deallocate(a, 10);
+        assert(allocator.GetUsedSize() == usedSize - 16);
+
+        const auto marker = allocator.GetMarker();
+        auto* overflow = allocator.Allocate<uint64_t>(100);
+        overflow[99] = 1;
+        assert(allocator.GetOverflowCount() == 1 && allocator.GetOverflowSize() == 800);
+        assert(allocator.GetHighWaterMark() == marker.offset + 800);
+
+        allocator.Rewind(marker);
+        assert(allocator.GetUsedSize() == marker.offset && allocator.GetOverflowSize() == 0 && allocator.GetOverflowCount() == 1);
+
+        // The reset grows the buffer, so the same workload fits in the next round.
+        const auto highWaterMark = allocator.GetHighWaterMark();
+        allocator.Reset();
+        assert(allocator.GetUsedSize() == 0 && allocator.GetOverflowCount() == 0 && allocator.GetCapacity() >= highWaterMark);
+        const auto* c = allocator.Allocate(10, 1);
+        const auto* d = allocator.Allocate(16, 64);
+        const auto* e = allocator.Allocate<uint64_t>(100);
+        assert(c != nullptr && d != nullptr && e != nullptr && allocator.GetOverflowCount() == 0);
+
+        LinearAllocator emptyAllocator;
+        assert(emptyAllocator.Allocate(4) != nullptr && emptyAllocator.GetOverflowCount() == 1);
+        emptyAllocator.Reset();
+        assert(emptyAllocator.GetCapacity() >= 4);
+    }
+
+    void EvaluateAdapter()
+    {
+        LinearAllocator allocator(4096);
+        {
+            std::vector<int32_t, LinearAllocatorAdapter<int32_t>> values(allocator);
+            for (int32_t i = 0; i < 100; ++i)
+            {
+                values.push_back(i);
+            }
+            assert(values[99] == 99 && allocator.GetOverflowCount() == 0);
+
+            std::vector<double, LinearAllocatorAdapter<double>> others(values.get_allocator());
+            assert(others.get_allocator() == values.get_allocator());
+        }
+
+        allocator.Reset();
+        assert(allocator.GetUsedSize() == 0 && allocator.GetHighWaterMark() > 400);
+    }
+
+    void EvaluateFrameAllocator()
+    {
+        FrameAllocator frameAllocator(1024);
+        auto* prevFrameData = frameAllocator.Allocate<int32_t>(4);
+        prevFrameData[3] = 7;
+        assert(&frameAllocator.GetCurrent() != &frameAllocator.GetPrevious());
+
+        // The memory of the previous frame survives the swap.
+        frameAllocator.SwapBuffers();
+        assert(frameAllocator.GetCurrent().GetUsedSize() == 0 && frameAllocator.GetPrevious().GetUsedSize() == 16);
+        const auto* overflowData = frameAllocator.Allocate(2048);
+        assert(overflowData != nullptr && prevFrameData[3] == 7 && frameAllocator.GetCurrent().GetOverflowCount() == 1);
+
+        // The overflowed buffer is grown when its turn comes again.
+        frameAllocator.SwapBuffers();
+        assert(frameAllocator.GetPrevious().GetOverflowCount() == 1);
+        frameAllocator.SwapBuffers();
+        assert(frameAllocator.GetCurrent().GetOverflowCount() == 0 && frameAllocator.GetCurrent().GetCapacity() >= 2048);
+        const auto* grownData = frameAllocator.Allocate(2048);
+        assert(grownData != nullptr && frameAllocator.GetCurrent().GetOverflowCount() == 0);
+
+        // The shared buffer can be allocated from the other threads at the same time.
+        FrameAllocator sharedFrameAllocator(0, 64 * 1024);
+        std::vector<std::thread> threads;
+        std::vector<int32_t*> sharedData(4);
+        for (size_t i = 0; i < sharedData.size(); ++i)
+        {
+            threads.emplace_back([&, i]()
+            {
+                for (int32_t j = 0; j < 100; ++j)
+                {
+                    sharedData[i] = static_cast<int32_t*>(sharedFrameAllocator.AllocateShared(sizeof(int32_t) * 16, alignof(int32_t)));
+                    sharedData[i][15] = static_cast<int32_t>(i);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        for (size_t i = 0; i < sharedData.size(); ++i)
+        {
+            assert(sharedData[i][15] == static_cast<int32_t>(i));
+        }
+        assert(sharedFrameAllocator.GetCurrentShared().GetUsedSize() == 4 * 100 * 64 && sharedFrameAllocator.GetCurrentShared().GetOverflowCount() == 0);
+        sharedFrameAllocator.SwapBuffers();
+        sharedFrameAllocator.SwapBuffers();
+        assert(sharedFrameAllocator.GetCurrentShared().GetUsedSize() == 0);
+    }
+
+    void EvaluateScratchScope()
+    {
+        auto& threadAllocator = ScratchScope::GetThreadAllocator();
+        {
+            ScratchScope outerScope;
+            auto* outer = outerScope.Allocate<int32_t>(8);
+            {
+                ScratchScope innerScope;
+                const auto* inner = innerScope.Allocate(ScratchScope::DefaultCapacity * 2);
+                assert(inner != nullptr && &innerScope.GetAllocator() == &threadAllocator && threadAllocator.GetOverflowCount() == 1);
+            }
+            assert(threadAllocator.GetUsedSize() == 32 && threadAllocator.GetOverflowSize() == 0);
+            assert(outerScope.Allocate<int32_t>(1) == outer + 8);
+        }
+        assert(threadAllocator.GetUsedSize() == 0 && threadAllocator.GetCapacity() > ScratchScope::DefaultCapacity * 2);
+
+        // Every thread has its own allocator.
+        LinearAllocator* otherAllocator = nullptr;
+        std::thread([&]()
+        {
+            ScratchScope scope;
+            otherAllocator = &scope.GetAllocator();
+        }).join();
+        assert(otherAllocator != &threadAllocator);
+    }
+};
+
+} /* namespace tgon */
@@ -0,0 +1,80 @@
+/**
+ * @file    InplaceDelegateTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <memory>
+#include <string>
+
+#include "Core/InplaceDelegate.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class InplaceDelegateTest :
+    public Test
+{
+/**@section Type */
+private:
+    struct Counter
+    {
+        int32_t Add(int32_t value) { return count += value; }
+
+        int32_t count = 0;
+    };
+
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        auto shared = std::make_shared<int32_t>(3);
+        {
+            InplaceDelegate<int32_t(int32_t)> d = [shared](int32_t value) { return *shared + value; };
+            assert(d(1) == 4 && shared.use_count() == 2);
+
+            // Moving relocates the capture instead of copying it.
+            auto d2 = std::move(d);
+            assert(d == nullptr && d2 != nullptr && d2(2) == 5 && shared.use_count() == 2);
+
+            d = std::move(d2);
+            assert(d2 == nullptr && d(3) == 6 && shared.use_count() == 2);
+
+            d = nullptr;
+            assert(d == nullptr && d(4) == 0 && shared.use_count() == 1);
+        }
+        assert(shared.use_count() == 1);
+
+        {
+            Counter counter;
+            InplaceDelegate<int32_t(int32_t)> d(&Counter::Add, &counter);
+            assert(d(2) == 2 && d(3) == 5 && counter.count == 5);
+
+            // The trivially copyable captures are moved by copying the storage.
+            InplaceDelegate<int32_t(int32_t)> d2 = [](int32_t value) { return value * 2; };
+            d = std::move(d2);
+            assert(d(21) == 42 && d2 == nullptr);
+        }
+
+        {
+            // The argument is forwarded without a copy, and the larger captures only need a larger capacity.
+            std::string text(100, 'a');
+            auto large = std::make_shared<std::string>("b");
+            InplaceDelegate<size_t(std::unique_ptr<std::string>), 96> d = [text, large](std::unique_ptr<std::string> value)
+            {
+                return text.size() + large->size() + value->size();
+            };
+            static_assert(decltype(d)::GetCapacity() == 96);
+            assert(d(std::make_unique<std::string>("cc")) == 103);
+
+            auto deduced = InplaceDelegate([](int32_t lhs, int32_t rhs) { return lhs - rhs; });
+            assert(deduced(5, 3) == 2);
+        }
+    }
+};
+
+} /* namespace tgon */
@@ -0,0 +1,109 @@
+/**
+ * @file    MemoryResourceTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+#include "Core/MemoryResource.h"
+#include "Core/ObjectPool.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class MemoryResourceTest :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        this->EvaluateTrackingMemoryResource();
+        this->EvaluateTaggedResources();
+        this->EvaluateLevelArena();
+    }
+
+private:
+    void EvaluateTrackingMemoryResource()
+    {
+        TrackingMemoryResource resource(std::pmr::new_delete_resource());
+        {
+            std::pmr::vector<int32_t> values(&resource);
+            values.reserve(100);
+            assert(resource.GetAllocatedSize() == 400 && resource.GetAllocationCount() == 1);
+
+            values.reserve(200);
+            assert(resource.GetAllocatedSize() == 800 && resource.GetPeakAllocatedSize() == 1200);
+        }
+        assert(resource.GetAllocatedSize() == 0 && resource.GetAllocationCount() == 0 && resource.GetTotalAllocationCount() == 2);
+
+        // The counters are shared by the threads.
+        std::vector<std::thread> threads;
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([&]()
+            {
+                for (int32_t j = 0; j < 1000; ++j)
+                {
+                    resource.deallocate(resource.allocate(64), 64);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        assert(resource.GetAllocatedSize() == 0 && resource.GetTotalAllocationCount() == 4002 && resource.GetPeakAllocatedSize() >= 1200);
+
+        assert(resource.is_equal(resource) && resource.is_equal(TrackingMemoryResource(std::pmr::new_delete_resource())) == false);
+    }
+
+    void EvaluateTaggedResources()
+    {
+        auto* sceneResource = TrackingMemoryResource::GetInstance(MemoryTag::Scene);
+        assert(sceneResource == TrackingMemoryResource::GetInstance(MemoryTag::Scene) && sceneResource != TrackingMemoryResource::GetInstance(MemoryTag::Asset));
+        assert(sceneResource->GetUpstream() == PoolMemoryResource::GetInstance());
+
+        // The memory of a subsystem is only accounted by its own resource.
+        const auto assetSize = TrackingMemoryResource::GetInstance(MemoryTag::Asset)->GetAllocatedSize();
+        const auto sceneSize = sceneResource->GetAllocatedSize();
+        {
+            ObjectPool<int64_t, 16> pool(sceneResource);
+            pool.Create(1);
+            assert(pool.GetMemoryResource() == sceneResource && sceneResource->GetAllocatedSize() >= sceneSize + sizeof(int64_t) * 16);
+            assert(TrackingMemoryResource::GetInstance(MemoryTag::Asset)->GetAllocatedSize() == assetSize);
+        }
+        assert(sceneResource->GetAllocatedSize() == sceneSize);
+    }
+
+    void EvaluateLevelArena()
+    {
+        // The arena of a level takes its memory from the tagged resource, and gives all of it back at once.
+        TrackingMemoryResource levelResource(std::pmr::new_delete_resource());
+        {
+            std::pmr::monotonic_buffer_resource levelArena(&levelResource);
+            ObjectPool<int32_t, 64> pool(&levelArena);
+            for (int32_t i = 0; i < 1000; ++i)
+            {
+                pool.Destroy(pool.Get(pool.Create(i)));
+                pool.Create(i);
+            }
+            assert(pool.GetSize() == 1000 && levelResource.GetAllocationCount() > 0);
+
+            const auto allocationCount = levelResource.GetTotalAllocationCount();
+            pool.Clear();
+            assert(levelResource.GetTotalAllocationCount() == allocationCount);
+        }
+        assert(levelResource.GetAllocatedSize() == 0 && levelResource.GetAllocationCount() == 0);
+    }
+};
+
+} /* namespace tgon */
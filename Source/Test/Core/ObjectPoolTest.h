@@ -0,0 +1,106 @@
+/**
+ * @file    ObjectPoolTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include "Core/ObjectPool.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class ObjectPoolTest :
+    public Test
+{
+/**@section Struct */
+private:
+    struct Object
+    {
+        explicit Object(int value) noexcept : value(value) { ++aliveCount; }
+        ~Object() { --aliveCount; }
+
+        inline static int aliveCount = 0;
+        int value;
+    };
+
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        {
+            ObjectPool<Object, 4> pool;
+            std::vector<PoolHandle<Object>> handles;
+            for (int i = 0; i < 10; ++i)
+            {
+                handles.push_back(pool.Create(i));
+            }
+            assert(Object::aliveCount == 10 && pool.GetSize() == 10 && pool.GetCapacity() == 12);
+            assert(pool.Get(handles[7])->value == 7);
+
+            // The stale handle must be rejected even after the slot is reused.
+            pool.Destroy(handles[3]);
+            assert(pool.IsValid(handles[3]) == false && pool.Get(handles[3]) == nullptr);
+            auto handle = pool.Create(42);
+            assert(handle.index == 3 && handle.generation == 1);
+            assert(pool.IsValid(handles[3]) == false && pool.Get(handle)->value == 42);
+            assert(pool.GetHandle(pool.Get(handle)) == handle);
+
+            assert(pool.Destroy(pool.Get(handles[0])) && pool.Destroy(handles[0]) == false);
+
+            int count = 0;
+            pool.ForEach([&](Object&) { ++count; });
+            assert(count == 9 && pool.GetSize() == 9);
+
+            // Clearing keeps the chunks, so refilling the pool doesn't change the capacity.
+            pool.Clear();
+            assert(Object::aliveCount == 0 && pool.GetCapacity() == 12);
+            for (int i = 0; i < 12; ++i)
+            {
+                pool.Create(i);
+            }
+            assert(pool.GetCapacity() == 12);
+        }
+        assert(Object::aliveCount == 0);
+        {
+            ObjectPool<Object, 4> srcPool;
+            const auto srcHandle = srcPool.Create(1);
+            srcPool.Create(2);
+
+            // The move leaves the source pool empty, so its destructor doesn't run the moved objects again.
+            ObjectPool<Object, 4> movedPool(std::move(srcPool));
+            assert(srcPool.GetSize() == 0 && movedPool.GetSize() == 2 && movedPool.Get(srcHandle)->value == 1);
+
+            // Assigning over a pool destroys the objects which it holds.
+            ObjectPool<Object, 4> destPool;
+            for (int i = 0; i < 3; ++i)
+            {
+                destPool.Create(i);
+            }
+            assert(Object::aliveCount == 5);
+            destPool = std::move(movedPool);
+            assert(Object::aliveCount == 2 && destPool.GetSize() == 2 && movedPool.GetSize() == 0);
+            assert(destPool.Get(srcHandle)->value == 1);
+
+            // The emptied pool can be used again.
+            movedPool.Create(3);
+            assert(Object::aliveCount == 3 && movedPool.GetSize() == 1);
+        }
+        assert(Object::aliveCount == 0);
+        {
+            PoolHandle<Object> handle;
+            assert(handle.IsNull());
+
+            ObjectPool<Object> pool;
+            assert(pool.IsValid(handle) == false && pool.Get(handle) == nullptr);
+        }
+    }
+};
+
+} /* namespace tgon */
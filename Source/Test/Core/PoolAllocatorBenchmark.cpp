@@ -0,0 +1,136 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+#include <fmt/format.h>
+
+#include "Core/PoolAllocator.h"
+
+namespace
+{
+
+constexpr int32_t ThreadCount = 8;
+constexpr size_t LiveCount = 1024;
+constexpr size_t OperationCount = 1 << 20;
+constexpr int32_t RepeatCount = 5;
+
+/**
+ * @brief   Runs the churn on every thread at once, and gets the best wall time of the repeated runs divided by the
+ *          operations of all threads.
+ * @remark  Each thread keeps a window of live allocations and replaces a random one in every operation, so the frees
+ *          don't come in the order of the allocations. A quarter of the replaced allocations are handed to the next
+ *          thread to be freed there, like the tasks which are created on one thread and destroyed on another.
+ */
+template <typename _Allocate, typename _Deallocate>
+double Measure(const _Allocate& allocate, const _Deallocate& deallocate)
+{
+    auto minTime = std::chrono::nanoseconds::max();
+    for (int32_t i = 0; i < RepeatCount; ++i)
+    {
+        std::vector<std::vector<std::pair<void*, size_t>>> handoffs(ThreadCount);
+        std::vector<std::thread> threads;
+        std::atomic<int32_t> readyCount = 0;
+        std::atomic<bool> isStarted = false;
+
+        for (int32_t j = 0; j < ThreadCount; ++j)
+        {
+            threads.emplace_back([&, j]()
+            {
+                std::mt19937 random(j);
+                std::uniform_int_distribution<size_t> sizeDistribution(16, 256);
+                std::vector<std::pair<void*, size_t>> live(LiveCount);
+                for (auto& [ptr, size] : live)
+                {
+                    size = sizeDistribution(random);
+                    ptr = allocate(size);
+                }
+
+                auto& handoff = handoffs[(j + 1) % ThreadCount];
+                handoff.reserve(OperationCount / 4);
+
+                readyCount.fetch_add(1);
+                while (isStarted.load() == false);
+
+                for (size_t k = 0; k < OperationCount; ++k)
+                {
+                    auto& [ptr, size] = live[random() % LiveCount];
+                    if (k % 4 == 0)
+                    {
+                        handoff.emplace_back(ptr, size);
+                    }
+                    else
+                    {
+                        deallocate(ptr, size);
+                    }
+
+                    size = sizeDistribution(random);
+                    ptr = allocate(size);
+                }
+
+                for (auto& [ptr, size] : live)
+                {
+                    deallocate(ptr, size);
+                }
+            });
+        }
+
+        while (readyCount.load() < ThreadCount);
+        const auto begin = std::chrono::steady_clock::now();
+        isStarted.store(true);
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        minTime = std::min(minTime, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin));
+
+        // The handed off allocations are freed by the thread which didn't allocate them.
+        threads.clear();
+        for (int32_t j = 0; j < ThreadCount; ++j)
+        {
+            threads.emplace_back([&, j]()
+            {
+                for (auto& [ptr, size] : handoffs[j])
+                {
+                    deallocate(ptr, size);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    return static_cast<double>(minTime.count()) / (OperationCount * ThreadCount);
+}
+
+}
+
+/**
+ * @brief   Compares the pool allocators with the system allocator under the churn of small objects on many threads.
+ */
+int main()
+{
+    using namespace tg;
+
+    fmt::print("{} threads, {} operations per thread\n", ThreadCount, OperationCount);
+    fmt::print("{:<40}{:>10}\n", "Benchmark", "ns/op");
+
+    const auto mallocTime = Measure([](size_t size) { return std::malloc(size); }, [](void* ptr, size_t) { std::free(ptr); });
+    fmt::print("{:<40}{:>10.2f}\n", "malloc", mallocTime);
+
+    const auto smallObjectTime = Measure([](size_t size) { return SmallObjectAllocator::Allocate(size); }, [](void* ptr, size_t size) { SmallObjectAllocator::Deallocate(ptr, size); });
+    fmt::print("{:<40}{:>10.2f}\n", "SmallObjectAllocator", smallObjectTime);
+
+    auto* resource = PoolMemoryResource::GetInstance();
+    const auto resourceTime = Measure([=](size_t size) { return resource->allocate(size); }, [=](void* ptr, size_t size) { resource->deallocate(ptr, size); });
+    fmt::print("{:<40}{:>10.2f}\n", "PoolMemoryResource", resourceTime);
+
+    std::pmr::synchronized_pool_resource synchronizedResource;
+    const auto synchronizedTime = Measure([&](size_t size) { return synchronizedResource.allocate(size); }, [&](void* ptr, size_t size) { synchronizedResource.deallocate(ptr, size); });
+    fmt::print("{:<40}{:>10.2f}\n", "std::pmr::synchronized_pool_resource", synchronizedTime);
+
+    return 0;
+}
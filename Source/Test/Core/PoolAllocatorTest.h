@@ -0,0 +1,187 @@
+/**
+ * @file    PoolAllocatorTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Core/Delegate.h"
+#include "Core/PoolAllocator.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class PoolAllocatorTest :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        this->EvaluatePoolAllocator();
+        this->EvaluateCrossThread();
+        this->EvaluateSmallObjectAllocator();
+        this->EvaluateMemoryResource();
+    }
+
+private:
+    void EvaluatePoolAllocator()
+    {
+        using Allocator = PoolAllocator<48>;
+
+        // The blocks don't overlap, and the freed ones are reused before the pool grows.
+        std::vector<std::byte*> blocks;
+        for (size_t i = 0; i < Allocator::BatchSize * 3; ++i)
+        {
+            auto* block = static_cast<std::byte*>(Allocator::Allocate());
+            assert(reinterpret_cast<uintptr_t>(block) % 16 == 0);
+            std::fill_n(block, Allocator::BlockSize, static_cast<std::byte>(i));
+            blocks.push_back(block);
+        }
+
+        std::sort(blocks.begin(), blocks.end());
+        for (size_t i = 1; i < blocks.size(); ++i)
+        {
+            assert(blocks[i - 1] + Allocator::BlockSize <= blocks[i]);
+        }
+
+        const auto capacity = Allocator::GetCapacity();
+        for (size_t j = 0; j < 4; ++j)
+        {
+            for (auto* block : blocks)
+            {
+                Allocator::Deallocate(block);
+            }
+            for (auto& block : blocks)
+            {
+                block = static_cast<std::byte*>(Allocator::Allocate());
+            }
+        }
+        assert(Allocator::GetCapacity() == capacity);
+
+        for (auto* block : blocks)
+        {
+            Allocator::Deallocate(block);
+        }
+        Allocator::Deallocate(nullptr);
+    }
+
+    void EvaluateCrossThread()
+    {
+        using Allocator = PoolAllocator<64>;
+
+        // The blocks which are freed by another thread, and the cache of the exited thread return to the central pool.
+        constexpr size_t blockCount = Allocator::BatchSize * 5 + 3;
+        std::vector<void*> blocks;
+        std::thread([&]()
+        {
+            for (size_t i = 0; i < blockCount; ++i)
+            {
+                blocks.push_back(Allocator::Allocate());
+            }
+        }).join();
+
+        std::thread([&]()
+        {
+            for (auto* block : blocks)
+            {
+                Allocator::Deallocate(block);
+            }
+        }).join();
+
+        std::vector<std::thread> threads;
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([]()
+            {
+                std::vector<void*> blocks;
+                for (int32_t j = 0; j < 1000; ++j)
+                {
+                    blocks.push_back(Allocator::Allocate());
+                    if (j % 3 == 0)
+                    {
+                        Allocator::Deallocate(blocks[j / 2]);
+                        blocks[j / 2] = Allocator::Allocate();
+                    }
+                }
+                for (auto* block : blocks)
+                {
+                    Allocator::Deallocate(block);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        const auto capacity = Allocator::GetCapacity();
+        std::thread([&]()
+        {
+            for (auto& block : blocks)
+            {
+                block = Allocator::Allocate();
+            }
+        }).join();
+        assert(Allocator::GetCapacity() == capacity);
+        for (auto* block : blocks)
+        {
+            Allocator::Deallocate(block);
+        }
+    }
+
+    void EvaluateSmallObjectAllocator()
+    {
+        for (size_t size : {0, 1, 16, 17, 100, 512, 513, 4096})
+        {
+            auto* memory = static_cast<std::byte*>(SmallObjectAllocator::Allocate(size));
+            assert(memory != nullptr && reinterpret_cast<uintptr_t>(memory) % alignof(std::max_align_t) == 0);
+            std::fill_n(memory, size, std::byte{0xCD});
+            SmallObjectAllocator::Deallocate(memory, size);
+        }
+
+        // The spilled callables of Delegate come from the pools.
+        const std::string text(100, 'a');
+        Delegate<size_t()> d = [text, padding = std::array<int64_t, 8>{}]() { return text.size() + padding.size(); };
+        Delegate<size_t()> copied = d;
+        d = nullptr;
+        assert(copied() == 108 && d == nullptr);
+    }
+
+    void EvaluateMemoryResource()
+    {
+        auto* resource = PoolMemoryResource::GetInstance();
+        assert(resource->is_equal(*resource) && resource->is_equal(PoolMemoryResource()));
+        assert(resource->is_equal(*std::pmr::new_delete_resource()) == false);
+
+        std::pmr::list<int32_t> values(resource);
+        std::pmr::map<int32_t, std::pmr::string> names(resource);
+        for (int32_t i = 0; i < 1000; ++i)
+        {
+            values.push_back(i);
+            names.emplace(i, std::to_string(i) + " is a string which is long enough to be allocated");
+        }
+        assert(values.back() == 999 && names[500].starts_with("500 "));
+
+        // The large and over-aligned allocations are forwarded to the upstream.
+        auto* aligned = resource->allocate(64, 64);
+        assert(reinterpret_cast<uintptr_t>(aligned) % 64 == 0);
+        resource->deallocate(aligned, 64, 64);
+
+        std::pmr::vector<std::byte> bytes(4096, std::byte{}, resource);
+        assert(bytes.size() == 4096);
+    }
+};
+
+} /* namespace tgon */
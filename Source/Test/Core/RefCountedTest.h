@@ -0,0 +1,135 @@
+/**
+ * @file    RefCountedTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "Core/RefCounted.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class RefCountedTest :
+    public Test
+{
+/**@section Struct */
+private:
+    struct Resource :
+        RefCounted<Resource>
+    {
+        explicit Resource(int32_t value) noexcept : value(value) { ++aliveCount; }
+        Resource(const Resource& rhs) noexcept : RefCounted(rhs), value(rhs.value) { ++aliveCount; }
+        virtual ~Resource() { --aliveCount; }
+        Resource& operator=(const Resource& rhs) noexcept = default;
+
+        inline static int32_t aliveCount = 0;
+        int32_t value;
+    };
+
+    struct DerivedResource final :
+        Resource
+    {
+        using Resource::Resource;
+    };
+
+    struct MainThreadResource final :
+        RefCounted<MainThreadResource, RefCountPolicy::NonAtomic>
+    {
+        int32_t value = 0;
+    };
+
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        this->EvaluateRef();
+        this->EvaluateConversion();
+        this->EvaluateCrossThread();
+    }
+
+private:
+    void EvaluateRef()
+    {
+        {
+            auto resource = MakeRef<Resource>(1);
+            assert(resource->GetRefCount() == 1 && Resource::aliveCount == 1);
+
+            // A reference can be taken again from the borrowed pointer.
+            Resource* borrowed = resource.Get();
+            Ref<Resource> copied(borrowed);
+            assert(copied == resource && borrowed->GetRefCount() == 2);
+
+            Ref<Resource> moved = std::move(copied);
+            assert(copied == nullptr && moved->GetRefCount() == 2);
+
+            moved = resource;
+            moved.Reset(moved.Get());
+            assert(resource->GetRefCount() == 2);
+
+            // Copying the object doesn't carry the count over.
+            auto clone = MakeRef<Resource>(*resource);
+            assert(clone->GetRefCount() == 1 && clone->value == 1 && Resource::aliveCount == 2);
+
+            *clone = *resource;
+            assert(clone->GetRefCount() == 1);
+
+            moved = nullptr;
+            assert(resource->GetRefCount() == 1 && !moved);
+        }
+        assert(Resource::aliveCount == 0);
+
+        auto mainThreadResource = MakeRef<MainThreadResource>();
+        auto other = mainThreadResource;
+        assert(other->GetRefCount() == 2 && MainThreadResource::Policy == RefCountPolicy::NonAtomic);
+    }
+
+    void EvaluateConversion()
+    {
+        {
+            Ref<DerivedResource> derived = MakeRef<DerivedResource>(2);
+            Ref<Resource> base = derived;
+            Ref<const Resource> constBase = std::move(base);
+            assert(constBase == derived && base == nullptr && derived->GetRefCount() == 2);
+
+            derived = nullptr;
+            assert(constBase->value == 2 && Resource::aliveCount == 1);
+        }
+        assert(Resource::aliveCount == 0);
+    }
+
+    void EvaluateCrossThread()
+    {
+        auto resource = MakeRef<Resource>(3);
+
+        std::vector<std::thread> threads;
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([resource]()
+            {
+                std::vector<Ref<Resource>> refs;
+                for (int32_t j = 0; j < 1000; ++j)
+                {
+                    refs.push_back(resource);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        assert(resource->GetRefCount() == 1);
+        resource = nullptr;
+        assert(Resource::aliveCount == 0);
+    }
+};
+
+} /* namespace tgon */
@@ -0,0 +1,195 @@
+/**
+ * @file    ReflectionTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Core/Reflection.h"
+#include "Serialization/BinaryReader.h"
+#include "Serialization/BinaryWriter.h"
+
+#include "../Test.h"
+
+namespace tg::reflection_test
+{
+
+struct Point
+{
+    float x;
+    float y;
+};
+
+class Base
+{
+/**@section Method */
+public:
+    [[nodiscard]] int32_t GetId() const noexcept { return m_id; }
+
+/**@section Variable */
+protected:
+    int32_t m_id = 0;
+};
+
+class Unit :
+    public Base
+{
+public:
+    TGON_REFLECT(Unit,
+        TGON_REFLECT_FIELD(m_id),
+        TGON_REFLECT_FIELD(m_position),
+        TGON_REFLECT_FIELD(m_isAlive),
+        TGON_REFLECT_FIELD(m_cache, FieldFlags::Transient),
+        TGON_REFLECT_METHOD(GetId),
+        TGON_REFLECT_METHOD(Move))
+
+/**@section Constructor */
+public:
+    Unit() = default;
+    Unit(int32_t id, Point position) noexcept : m_position(position) { m_id = id; }
+
+/**@section Method */
+public:
+    void Move(float dx, float dy) noexcept { m_position.x += dx; m_position.y += dy; }
+
+/**@section Variable */
+public:
+    Point m_position{};
+    bool m_isAlive = true;
+    const void* m_cache = nullptr;
+};
+
+struct Vertex
+{
+    Point position;
+    uint32_t color;
+    bool isVisible;
+};
+
+struct Squad
+{
+    std::string name;
+    std::vector<Unit> units;
+    std::vector<std::string> tags;
+};
+
+}
+
+TGON_REFLECT_EXTERNAL(tg::reflection_test::Point, TGON_REFLECT_FIELD(x), TGON_REFLECT_FIELD(y))
+TGON_REFLECT_EXTERNAL(tg::reflection_test::Vertex, TGON_REFLECT_FIELD(position), TGON_REFLECT_FIELD(color), TGON_REFLECT_FIELD(isVisible))
+TGON_REFLECT_EXTERNAL(tg::reflection_test::Squad, TGON_REFLECT_FIELD(name), TGON_REFLECT_FIELD(units), TGON_REFLECT_FIELD(tags))
+
+namespace tg
+{
+
+class ReflectionTest :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        this->EvaluateReflection();
+        this->EvaluateFixedSerialization();
+        this->EvaluateDynamicSerialization();
+    }
+
+private:
+    void EvaluateReflection()
+    {
+        using namespace reflection_test;
+
+        static_assert(GetFieldCount<Unit>() == 4 && GetMethodCount<Unit>() == 2);
+        static_assert(std::get<0>(ReflectedFields<Unit>).name == "id" && std::get<3>(ReflectedFields<Unit>).HasFlag(FieldFlags::Transient));
+        static_assert(Reflectable<Point> && Reflectable<int32_t> == false);
+
+        // The transient pointer and the padding after the bool aren't written.
+        static_assert(detail::FixedBinarySize<Unit> == sizeof(int32_t) + sizeof(Point) + sizeof(bool));
+        static_assert(detail::FixedBinarySize<Squad> == 0);
+
+        Unit unit(7, {1.0f, 2.0f});
+        std::get<1>(ReflectedMethods<Unit>).Invoke(unit, 1.0f, 1.0f);
+        assert(std::get<0>(ReflectedMethods<Unit>).Invoke(unit) == 7 && unit.m_position.x == 2.0f);
+
+        // The offsets are only described for the standard layout types, and Unit has the fields in both of its classes.
+        static_assert(std::is_standard_layout_v<Vertex> && std::is_standard_layout_v<Unit> == false);
+
+        const Vertex vertex{};
+        const auto fieldDescs = GetFieldDescs<Vertex>();
+        assert(fieldDescs.size() == 3 && fieldDescs[0].name == "position" && fieldDescs[0].size == sizeof(Point));
+        const auto* vertexBytes = reinterpret_cast<const std::byte*>(&vertex);
+        assert(fieldDescs[0].offset == 0 && vertexBytes + fieldDescs[2].offset == reinterpret_cast<const std::byte*>(&vertex.isVisible));
+        assert(fieldDescs[1].offset == offsetof(Vertex, color) && fieldDescs[2].offset == offsetof(Vertex, isVisible));
+        assert(fieldDescs[0].typeId == TypeId<ReflectedTypeFamily>::Get<Point>() && fieldDescs[1].typeId != fieldDescs[0].typeId);
+        assert(std::get<1>(ReflectedFields<Point>).GetOffset() == offsetof(Point, y));
+
+        int32_t fieldCount = 0;
+        ForEachField<Unit>([&](const auto& field) { fieldCount += field.HasFlag(FieldFlags::ReadOnly) ? 100 : 1; });
+        assert(fieldCount == 4);
+    }
+
+    void EvaluateFixedSerialization()
+    {
+        using namespace reflection_test;
+
+        std::vector<Unit> units;
+        for (int32_t i = 0; i < 1000; ++i)
+        {
+            units.emplace_back(i, Point{static_cast<float>(i), -static_cast<float>(i)});
+            units.back().m_isAlive = (i % 3) != 0;
+            units.back().m_cache = &units;
+        }
+
+        std::vector<std::byte> bytes;
+        BinaryWriter writer(bytes);
+        writer.Write(static_cast<uint32_t>(units.size()));
+        writer.WriteRange(std::span<const Unit>(units));
+        assert(bytes.size() == sizeof(uint32_t) + units.size() * detail::FixedBinarySize<Unit>);
+
+        BinaryReader reader(bytes);
+        uint32_t count = 0;
+        assert(reader.Read(count) && count == 1000);
+
+        std::vector<Unit> readUnits(count);
+        assert(reader.ReadRange(std::span<Unit>(readUnits)) && reader.GetRemainingSize() == 0);
+        for (size_t i = 0; i < units.size(); ++i)
+        {
+            assert(readUnits[i].GetId() == units[i].GetId() && readUnits[i].m_position.y == units[i].m_position.y);
+            assert(readUnits[i].m_isAlive == units[i].m_isAlive && readUnits[i].m_cache == nullptr);
+        }
+
+        // The truncated data must be rejected.
+        BinaryReader truncatedReader(std::span<const std::byte>(bytes).first(bytes.size() - 1));
+        assert(truncatedReader.Read(count) && truncatedReader.ReadRange(std::span<Unit>(readUnits)) == false);
+    }
+
+    void EvaluateDynamicSerialization()
+    {
+        using namespace reflection_test;
+
+        Squad squad{"alpha", {Unit(1, {3.0f, 4.0f}), Unit(2, {5.0f, 6.0f})}, {"melee", "", "ranged"}};
+
+        std::vector<std::byte> bytes;
+        BinaryWriter(bytes).Write(squad);
+
+        Squad readSquad;
+        BinaryReader reader(bytes);
+        assert(reader.Read(readSquad) && reader.GetRemainingSize() == 0);
+        assert(readSquad.name == "alpha" && readSquad.tags == squad.tags && readSquad.units.size() == 2);
+        assert(readSquad.units[1].GetId() == 2 && readSquad.units[1].m_position.y == 6.0f);
+
+        // The count which is larger than the remaining bytes must be rejected before the allocation.
+        std::vector<std::byte> malformedBytes;
+        BinaryWriter(malformedBytes).Write(uint32_t(0x7fffffff));
+        std::string name;
+        assert(BinaryReader(malformedBytes).Read(name) == false);
+    }
+};
+
+} /* namespace tgon */
@@ -0,0 +1,105 @@
+/**
+ * @file    SmallVectorTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "Core/RingBuffer.h"
+#include "Core/SmallVector.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class SmallVectorTest :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        this->EvaluateSmallVector();
+        this->EvaluateRingBuffer();
+    }
+
+private:
+    void EvaluateSmallVector()
+    {
+        SmallVector<std::string, 4> values;
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            values.PushBack(std::to_string(i));
+        }
+        assert(values.IsInline() && values.GetSize() == 4 && values.GetCapacity() == 4);
+
+        // The argument refers to an element which is moved by the growth.
+        values.PushBack(values[0]);
+        assert(values.IsInline() == false && values.GetSize() == 5 && values.Back() == "0");
+
+        values.Insert(values.begin() + 1, "a");
+        values.Erase(values.begin());
+        assert(values.GetSize() == 5 && values.Front() == "a" && values[1] == "1");
+
+        SmallVector<std::string, 4> inlineValues{"x", "y"};
+        auto moved = std::move(inlineValues);
+        assert(moved.IsInline() && moved.GetSize() == 2 && moved[1] == "y" && inlineValues.IsEmpty());
+
+        moved = std::move(values);
+        assert(moved.IsInline() == false && moved.GetSize() == 5 && values.IsEmpty() && values.IsInline());
+
+        auto copied = moved;
+        copied.Resize(2);
+        assert(copied.GetSize() == 2 && moved.GetSize() == 5 && copied[1] == "1");
+
+        SmallVector<std::unique_ptr<int32_t>, 2> pointers;
+        for (int32_t i = 0; i < 10; ++i)
+        {
+            pointers.EmplaceBack(std::make_unique<int32_t>(i));
+        }
+        pointers.PopBack();
+        assert(pointers.GetSize() == 9 && *pointers.Back() == 8);
+    }
+
+    void EvaluateRingBuffer()
+    {
+        RingBuffer<std::string> buffer(3);
+        assert(buffer.GetCapacity() == 4 && buffer.IsEmpty());
+
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            assert(buffer.PushBack(std::to_string(i)));
+        }
+        assert(buffer.IsFull() && buffer.PushBack("4") == false);
+
+        // The elements wrap around the end of the array.
+        buffer.PopFront();
+        buffer.PopFront();
+        buffer.PushBack("4");
+        assert(buffer.Front() == "2" && buffer.Back() == "4" && buffer[1] == "3");
+
+        // Growing keeps the order of the wrapped elements.
+        buffer.Reserve(8);
+        buffer.PushBack("5");
+        std::string joined;
+        for (const auto& value : buffer)
+        {
+            joined += value;
+        }
+        assert(joined == "2345" && buffer.GetCapacity() == 8);
+
+        auto moved = std::move(buffer);
+        assert(moved.GetSize() == 4 && buffer.GetCapacity() == 0);
+
+        moved.Clear();
+        assert(moved.IsEmpty() && moved.GetCapacity() == 8);
+    }
+};
+
+} /* namespace tgon */
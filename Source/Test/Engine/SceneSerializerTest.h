@@ -0,0 +1,88 @@
+/**
+ * @file    SceneSerializerTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <vector>
+
+#include "Engine/SceneModule.h"
+#include "Engine/SceneSerializer.h"
+#include "Game/TransformComponent.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class SceneSerializerTest :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        SceneSerializer::RegisterComponent<TransformComponent>("TransformComponent");
+
+        FrameAllocator frameAllocator;
+        Scene srcScene(frameAllocator);
+        auto* parent = srcScene.FindGameObject(srcScene.Instantiate(StringHash("Parent")));
+        parent->AddComponent<TransformComponent>()->SetLocalPosition({1.0f, 2.0f, 3.0f});
+
+        auto* child = srcScene.FindGameObject(srcScene.Instantiate(StringHash("Child")));
+        child->SetActive(false);
+        child->SetParent(parent);
+
+        // The child was created after the parent, but make it precede the parent in the pool to check the write order.
+        srcScene.Destroy(ObjectPool<GameObject>::GetHandle(parent));
+        assert(child->GetParent() == nullptr);
+        parent = srcScene.FindGameObject(srcScene.Instantiate(StringHash("Parent")));
+        parent->AddComponent<TransformComponent>()->SetLocalPosition({1.0f, 2.0f, 3.0f});
+        child->SetParent(parent);
+        assert(parent->GetChildCount() == 1);
+
+        auto fileData = SceneSerializer::Serialize(srcScene);
+        auto sceneData = SceneSerializer::Deserialize(fileData);
+        assert(sceneData.has_value() && sceneData->objects.size() == 2);
+
+        Scene destScene(frameAllocator);
+        std::vector<GameObjectHandle> handles;
+        for (size_t i = 0; i < sceneData->objects.size(); ++i)
+        {
+            const auto isSucceeded = SceneSerializer::Instantiate(*sceneData, i, destScene, handles);
+            assert(isSucceeded);
+        }
+
+        auto* loadedParent = destScene.FindGameObject(handles[0]);
+        auto* loadedChild = destScene.FindGameObject(handles[1]);
+        assert(loadedParent->GetName() == "Parent" && loadedParent->IsActive());
+        assert(loadedParent->FindComponent<TransformComponent>()->GetLocalPosition() == Vector3(1.0f, 2.0f, 3.0f));
+        assert(loadedChild->GetName() == "Child" && loadedChild->IsActive() == false && loadedChild->GetParent() == loadedParent);
+
+        // The payload which is too short for the component must be reported, not left half read.
+        const std::byte shortPayload[sizeof(float)]{};
+        SceneData brokenSceneData;
+        brokenSceneData.objects.push_back({"Broken", -1, true, 0, 1});
+        brokenSceneData.components.push_back({sceneData->components[0].type, shortPayload});
+        std::vector<GameObjectHandle> brokenHandles;
+        const auto isSucceeded = SceneSerializer::Instantiate(brokenSceneData, 0, destScene, brokenHandles);
+        assert(isSucceeded == false);
+
+        // The object which has two records of the same component type must be reported instead of hitting the assert.
+        SceneData duplicatedSceneData;
+        duplicatedSceneData.objects.push_back({"Duplicated", -1, true, 0, 2});
+        duplicatedSceneData.components.push_back(sceneData->components[0]);
+        duplicatedSceneData.components.push_back(sceneData->components[0]);
+        std::vector<GameObjectHandle> duplicatedHandles;
+        const auto isDuplicatedSucceeded = SceneSerializer::Instantiate(duplicatedSceneData, 0, destScene, duplicatedHandles);
+        assert(isDuplicatedSucceeded == false && destScene.FindGameObject(duplicatedHandles[0])->FindComponent<TransformComponent>() != nullptr);
+
+        // The truncated data must be rejected.
+        fileData.resize(fileData.size() - 1);
+        assert(SceneSerializer::Deserialize(std::move(fileData)).has_value() == false);
+    }
+};
+
+} /* namespace tgon */
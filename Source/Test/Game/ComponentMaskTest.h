@@ -0,0 +1,79 @@
+/**
+ * @file    ComponentMaskTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+
+#include "Game/ComponentMask.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class ComponentMaskTest :
+    public Test
+{
+/**@section Struct */
+private:
+    struct FirstComponent {};
+    struct SecondComponent {};
+    struct ThirdComponent {};
+
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        this->EvaluateTypeIndex();
+        this->EvaluateMask();
+    }
+
+private:
+    void EvaluateTypeIndex()
+    {
+        // The indices are dense, so the next registered types take the next indices.
+        const auto firstIndex = GetComponentTypeIndex<FirstComponent>();
+        const auto secondIndex = GetComponentTypeIndex<SecondComponent>();
+        assert(secondIndex == firstIndex + 1 && secondIndex < ComponentMask::MaxComponentTypeCount);
+        assert(TypeId<Component>::GetCount() == secondIndex + 1);
+
+        // The qualified types share the index of the raw type.
+        assert(GetComponentTypeIndex<const FirstComponent>() == firstIndex && GetComponentTypeIndex<FirstComponent&>() == firstIndex);
+        assert(TypeId<Component>::GetCount() == secondIndex + 1);
+
+        const auto mask = ComponentMask::Create<FirstComponent, ThirdComponent>();
+        assert(mask.Count() == 2 && mask.Test(firstIndex) && mask.Test(secondIndex) == false && mask.Test(GetComponentTypeIndex<ThirdComponent>()));
+    }
+
+    void EvaluateMask()
+    {
+        // The bits cross the word boundary, so the rank has to add the count of the lower word.
+        ComponentMask mask;
+        for (uint32_t typeIndex : {0u, 5u, 63u, 64u, 100u, ComponentMask::MaxComponentTypeCount - 1})
+        {
+            mask.Set(typeIndex);
+        }
+
+        assert(mask.Count() == 6 && mask.Test(63) && mask.Test(64) && mask.Test(65) == false);
+        assert(mask.Rank(0) == 0 && mask.Rank(5) == 1 && mask.Rank(63) == 2 && mask.Rank(64) == 3 && mask.Rank(101) == 5 && mask.Rank(ComponentMask::MaxComponentTypeCount - 1) == 5);
+
+        // The out of range index isn't in any mask.
+        assert(mask.Test(ComponentMask::MaxComponentTypeCount) == false);
+
+        ComponentMask subMask;
+        subMask.Set(5);
+        subMask.Set(100);
+        assert(mask.Contains(subMask) && subMask.Contains(mask) == false && mask.Contains(ComponentMask()));
+
+        mask.Reset(64);
+        assert(mask.Count() == 5 && mask.Test(64) == false && mask.Rank(100) == 3 && mask != ComponentMask());
+
+        mask.Clear();
+        assert(mask.Count() == 0 && mask == ComponentMask());
+    }
+};
+
+} /* namespace tgon */
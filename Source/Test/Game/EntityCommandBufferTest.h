@@ -0,0 +1,186 @@
+/**
+ * @file    EntityCommandBufferTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+
+#include "Engine/SceneModule.h"
+#include "Game/EntityCommandBuffer.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class EntityCommandBufferTest :
+    public Test
+{
+/**@section Struct */
+private:
+    class ValueComponent :
+        public Component
+    {
+    public:
+        TGON_RTTI(ValueComponent)
+
+    public:
+        explicit ValueComponent(int value) : value(value) {}
+
+    public:
+        int value;
+    };
+
+    class SpawnComponent :
+        public Component
+    {
+    public:
+        TGON_RTTI(SpawnComponent)
+
+    public:
+        void Initialize() override
+        {
+            // Recorded during playback, so it must be applied in the same playback.
+            auto* commandBuffer = EntityCommandBuffer::GetCurrent();
+            commandBuffer->AddComponent<ValueComponent>(commandBuffer->Instantiate(StringHash("Spawned")), 7);
+        }
+    };
+
+    class DestroySelfComponent :
+        public Component
+    {
+    public:
+        TGON_RTTI(DestroySelfComponent)
+
+    public:
+        void Update() override
+        {
+            EntityCommandBuffer::GetCurrent()->Destroy(ObjectPool<GameObject>::GetHandle(this->GetGameObject()));
+        }
+    };
+
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        this->EvaluatePlayback();
+        this->EvaluateSceneUpdate();
+    }
+
+private:
+    void EvaluatePlayback()
+    {
+        FrameAllocator frameAllocator;
+        Scene scene(frameAllocator);
+        const auto existingHandle = scene.Instantiate(StringHash("Existing"));
+        scene.FindGameObject(existingHandle)->AddComponent<ValueComponent>(1);
+
+        EntityCommandBuffer commandBuffer(frameAllocator);
+        assert(commandBuffer.IsEmpty());
+
+        // The recording is allowed where the structural changes are locked, as in the chunks of Scene::UpdateParallel.
+        assert(GameObject::SetStructureLocked(true) == false && GameObject::IsStructureLocked());
+
+        // The pending handles can be passed to the later commands of the same buffer.
+        const auto parentHandle = commandBuffer.Instantiate(StringHash("Parent"));
+        const auto childHandle = commandBuffer.Instantiate(StringHash("Child"));
+        commandBuffer.AddComponent<ValueComponent>(childHandle, 2);
+        commandBuffer.SetParent(childHandle, parentHandle);
+        commandBuffer.SetActive(parentHandle, false);
+        commandBuffer.RemoveComponent<ValueComponent>(existingHandle);
+        assert(commandBuffer.IsEmpty() == false && scene.FindGameObject(childHandle) == nullptr);
+        GameObject::SetStructureLocked(false);
+
+        // Nothing is applied until playback, and the commands live in the frame memory.
+        assert(scene.FindGameObject(existingHandle)->FindComponent<ValueComponent>() != nullptr);
+        assert(frameAllocator.GetCurrentShared().GetUsedSize() > 0 && frameAllocator.GetCurrentShared().GetOverflowCount() == 0);
+
+        commandBuffer.Playback(scene);
+        assert(commandBuffer.IsEmpty());
+        assert(scene.FindGameObject(existingHandle)->FindComponent<ValueComponent>() == nullptr);
+
+        GameObject* parent = nullptr;
+        GameObject* child = nullptr;
+        scene.ForEachGameObject([&](GameObject& gameObject)
+        {
+            if (gameObject.GetName() == "Parent")
+            {
+                parent = &gameObject;
+            }
+            else if (gameObject.GetName() == "Child")
+            {
+                child = &gameObject;
+            }
+        });
+        assert(parent != nullptr && parent->IsActive() == false);
+        assert(child != nullptr && child->GetParent() == parent && child->FindComponent<ValueComponent>()->value == 2);
+
+        // The commands are executed in the recorded order, so the object is destroyed before the component is added.
+        commandBuffer.Destroy(ObjectPool<GameObject>::GetHandle(child));
+        commandBuffer.AddComponent<ValueComponent>(ObjectPool<GameObject>::GetHandle(child), 3);
+        commandBuffer.Playback(scene);
+        assert(parent->GetChildCount() == 0);
+
+        int objectCount = 0;
+        scene.ForEachGameObject([&objectCount](GameObject&) { ++objectCount; });
+        assert(objectCount == 2);
+
+        // The discarded commands are never applied.
+        commandBuffer.Instantiate(StringHash("Discarded"));
+        commandBuffer.Clear();
+        commandBuffer.Playback(scene);
+        objectCount = 0;
+        scene.ForEachGameObject([&objectCount](GameObject&) { ++objectCount; });
+        assert(commandBuffer.IsEmpty() && objectCount == 2);
+
+        // The commands which span several pages are still played back in order, and the last activation wins.
+        for (int i = 0; i < 2000; ++i)
+        {
+            commandBuffer.SetActive(existingHandle, i % 2 == 0);
+        }
+        commandBuffer.Playback(scene);
+        assert(scene.FindGameObject(existingHandle)->IsActive() == false);
+
+        // The pages of the played back commands are reclaimed when the frames are swapped.
+        frameAllocator.SwapBuffers();
+        frameAllocator.SwapBuffers();
+        assert(frameAllocator.GetCurrentShared().GetUsedSize() == 0);
+        commandBuffer.SetActive(existingHandle, true);
+        commandBuffer.Playback(scene);
+        assert(scene.FindGameObject(existingHandle)->IsActive());
+    }
+
+    void EvaluateSceneUpdate()
+    {
+        FrameAllocator frameAllocator;
+        Scene scene(frameAllocator);
+        auto* spawner = scene.FindGameObject(scene.Instantiate(StringHash("Spawner")));
+        const auto destroyedHandle = scene.Instantiate(StringHash("Destroyed"));
+        scene.FindGameObject(destroyedHandle)->AddComponent<DestroySelfComponent>();
+
+        // The destruction which is recorded by the tick is applied at the end of the update.
+        scene.Update();
+        assert(scene.IsValid(destroyedHandle) == false && EntityCommandBuffer::GetCurrent() == nullptr);
+
+        // The commands which are recorded by Component::Initialize during playback run in the same sync point.
+        EntityCommandBuffer commandBuffer(frameAllocator);
+        auto* prevCommandBuffer = EntityCommandBuffer::SetCurrent(&commandBuffer);
+        commandBuffer.AddComponent<SpawnComponent>(ObjectPool<GameObject>::GetHandle(spawner));
+        commandBuffer.Playback(scene);
+        EntityCommandBuffer::SetCurrent(prevCommandBuffer);
+
+        int spawnedValue = 0;
+        scene.ForEach<ValueComponent>([&spawnedValue](GameObject& gameObject, ValueComponent& component)
+        {
+            if (gameObject.GetName() == "Spawned")
+            {
+                spawnedValue = component.value;
+            }
+        });
+        assert(commandBuffer.IsEmpty() && spawnedValue == 7);
+    }
+};
+
+} /* namespace tgon */
@@ -0,0 +1,114 @@
+/**
+ * @file    TickSchedulerTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <vector>
+
+#include "Game/GameObject.h"
+#include "Game/TickScheduler.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class TickSchedulerTest :
+    public Test
+{
+/**@section Struct */
+private:
+    class CountComponent :
+        public Component
+    {
+    public:
+        TGON_RTTI(CountComponent)
+
+    public:
+        void Update() override { ++updateCount; }
+
+    public:
+        int updateCount = 0;
+    };
+
+    class SleepComponent :
+        public Component
+    {
+    public:
+        TGON_RTTI(SleepComponent)
+
+    public:
+        void Update() override { ++updateCount; this->Sleep(); }
+
+    public:
+        int updateCount = 0;
+    };
+
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        TickScheduler tickScheduler;
+        {
+            std::vector<std::unique_ptr<GameObject>> gameObjects;
+            for (int i = 0; i < 8; ++i)
+            {
+                auto& gameObject = gameObjects.emplace_back(std::make_unique<GameObject>(StringHash{}, &tickScheduler));
+                gameObject->AddComponent<CountComponent>()->SetTickInterval(4);
+            }
+
+            // The components which tick every 4 frames must be spread evenly, 2 per frame.
+            for (int frame = 0; frame < 4; ++frame)
+            {
+                assert(tickScheduler.BeginTick(TickGroup::Update) == 2);
+                tickScheduler.EndTick();
+                tickScheduler.AdvanceFrame();
+            }
+            for (int frame = 0; frame < 8; ++frame)
+            {
+                tickScheduler.Tick(TickGroup::Update);
+                tickScheduler.AdvanceFrame();
+            }
+            for (auto& gameObject : gameObjects)
+            {
+                assert(gameObject->FindComponent<CountComponent>()->updateCount == 2);
+            }
+
+            // The deactivated objects are removed from the schedule.
+            gameObjects[0]->SetActive(false);
+            gameObjects[1]->FindComponent<CountComponent>()->SetActive(false);
+            size_t dueCount = 0;
+            for (int frame = 0; frame < 4; ++frame)
+            {
+                dueCount += tickScheduler.BeginTick(TickGroup::Update);
+                tickScheduler.EndTick();
+                tickScheduler.AdvanceFrame();
+            }
+            assert(dueCount == 6);
+        }
+        {
+            GameObject gameObject(StringHash{}, &tickScheduler);
+            auto* sleepComponent = gameObject.AddComponent<SleepComponent>();
+            sleepComponent->SetTickGroup(TickGroup::Late);
+
+            tickScheduler.Tick(TickGroup::Update);
+            tickScheduler.Tick(TickGroup::Late);
+            tickScheduler.Tick(TickGroup::Late);
+            assert(sleepComponent->updateCount == 1 && sleepComponent->IsSleeping());
+
+            sleepComponent->WakeUp();
+            tickScheduler.Tick(TickGroup::Late);
+            assert(sleepComponent->updateCount == 2);
+
+            // The component which is removed during ticking must not be touched anymore.
+            gameObject.RemoveComponent<SleepComponent>();
+            assert(tickScheduler.BeginTick(TickGroup::Late) == 0);
+            tickScheduler.EndTick();
+        }
+    }
+};
+
+} /* namespace tgon */
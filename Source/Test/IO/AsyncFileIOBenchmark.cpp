@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fcntl.h>
+#include <filesystem>
+#include <random>
+#include <vector>
+#include <fmt/format.h>
+
+#include "IO/AsyncFileIO.h"
+
+namespace
+{
+
+constexpr size_t FileSize = 64 * 1024 * 1024;
+constexpr int32_t RepeatCount = 5;
+
+struct Workload
+{
+    const char* name;
+    size_t requestSize;
+};
+
+constexpr Workload Workloads[] = {
+    {"4 KiB", 4 * 1024},
+    {"64 KiB", 64 * 1024},
+    {"1 MiB", 1024 * 1024},
+    {"16 MiB", 16 * 1024 * 1024},
+};
+
+/**
+ * @brief   Drops the pages of the file from the page cache, so the reads go to the disk.
+ * @return  true if the platform supports it.
+ */
+bool DropPageCache(const tg::AsyncFile& file)
+{
+#if defined(POSIX_FADV_DONTNEED)
+    return posix_fadvise(file.GetNativeHandle(), 0, 0, POSIX_FADV_DONTNEED) == 0;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief   Gets the best throughput of the repeated reads of the whole file in MiB/s.
+ * @param read  The function which reads the requests and returns after all of them were completed.
+ */
+template <typename _Function>
+double MeasureThroughput(const tg::AsyncFile& file, bool isColdCache, _Function read)
+{
+    auto minTime = std::chrono::nanoseconds::max();
+    for (int32_t i = 0; i < RepeatCount; ++i)
+    {
+        if (isColdCache)
+        {
+            DropPageCache(file);
+        }
+
+        const auto begin = std::chrono::steady_clock::now();
+        read();
+        minTime = std::min(minTime, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin));
+    }
+
+    return (static_cast<double>(FileSize) / (1024.0 * 1024.0)) / (static_cast<double>(minTime.count()) / 1000000000.0);
+}
+
+}
+
+/**
+ * @brief   Reads a file by many small requests and by few large ones in a shuffled order, and compares the blocking reads on
+ *          the calling thread with each backend of AsyncFileIO.
+ */
+int main()
+{
+    const auto path = (std::filesystem::temp_directory_path() / "AsyncFileIOBenchmark.bin").u8string();
+    {
+        std::vector<std::byte> content(FileSize);
+        std::mt19937 random(0);
+        std::generate(content.begin(), content.end(), [&random]() { return static_cast<std::byte>(random()); });
+
+        FILE* fp = fopen(reinterpret_cast<const char*>(path.c_str()), "wb");
+        fwrite(content.data(), 1, content.size(), fp);
+        fclose(fp);
+    }
+
+    auto file = tg::AsyncFile::Open(path.c_str(), tg::FileOptions::RandomAccess);
+    std::vector<std::byte> buffer(FileSize);
+
+    tg::AsyncFileIO threadPoolFileIO(nullptr, tg::AsyncFileIOBackend::ThreadPool);
+    tg::AsyncFileIO nativeFileIO(nullptr, tg::AsyncFileIOBackend::IoUring);
+
+    fmt::print("{} MiB file, the best of {} runs in MiB/s\n", FileSize / (1024 * 1024), RepeatCount);
+    fmt::print("{:<10}{:<8}{:>12}{:>12}{:>12}\n", "Request", "Cache", "Blocking", "ThreadPool", nativeFileIO.GetBackend() == tg::AsyncFileIOBackend::IoUring ? "IoUring" : "(none)");
+
+    for (const auto& workload : Workloads)
+    {
+        std::vector<int64_t> offsets(FileSize / workload.requestSize);
+        for (size_t i = 0; i < offsets.size(); ++i)
+        {
+            offsets[i] = static_cast<int64_t>(i * workload.requestSize);
+        }
+        std::shuffle(offsets.begin(), offsets.end(), std::mt19937(0));
+
+        const auto readBlocking = [&]()
+        {
+            for (auto offset : offsets)
+            {
+                tg::detail::ReadFileAt(file->GetNativeHandle(), offset, buffer.data() + offset, static_cast<int64_t>(workload.requestSize));
+            }
+        };
+        const auto readAsync = [&](tg::AsyncFileIO& asyncFileIO)
+        {
+            std::vector<tg::AsyncReadRequest> requests(offsets.size());
+            for (size_t i = 0; i < offsets.size(); ++i)
+            {
+                requests[i] = {&*file, offsets[i], std::span(buffer).subspan(static_cast<size_t>(offsets[i]), workload.requestSize), tg::AsyncReadCompletionHandler()};
+            }
+
+            for (const auto& handle : asyncFileIO.ReadAsync(requests))
+            {
+                handle.Wait();
+            }
+        };
+
+        for (bool isColdCache : {false, true})
+        {
+            if (isColdCache && DropPageCache(*file) == false)
+            {
+                continue;
+            }
+
+            const auto blockingThroughput = MeasureThroughput(*file, isColdCache, readBlocking);
+            const auto threadPoolThroughput = MeasureThroughput(*file, isColdCache, [&]() { readAsync(threadPoolFileIO); });
+            const auto nativeThroughput = MeasureThroughput(*file, isColdCache, [&]() { readAsync(nativeFileIO); });
+            fmt::print("{:<10}{:<8}{:>12.0f}{:>12.0f}{:>12.0f}\n", workload.name, isColdCache ? "cold" : "warm", blockingThroughput, threadPoolThroughput, nativeThroughput);
+        }
+    }
+
+    file->Close();
+    std::filesystem::remove(path);
+
+    return 0;
+}
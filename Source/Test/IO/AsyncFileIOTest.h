@@ -0,0 +1,131 @@
+/**
+ * @file    AsyncFileIOTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "IO/AsyncFileIO.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class AsyncFileIOTest :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        const auto path = (std::filesystem::temp_directory_path() / "AsyncFileIOTest.bin").u8string();
+
+        std::vector<std::byte> content(1000000);
+        for (size_t i = 0; i < content.size(); ++i)
+        {
+            content[i] = static_cast<std::byte>(i * 31);
+        }
+
+        FILE* fp = fopen(reinterpret_cast<const char*>(path.c_str()), "wb");
+        fwrite(content.data(), 1, content.size(), fp);
+        fclose(fp);
+
+        // Both backends are evaluated, since the thread pool is used wherever io_uring isn't available.
+        for (auto backend : {AsyncFileIOBackend::ThreadPool, AsyncFileIOBackend::IoUring})
+        {
+            this->EvaluateRead(path, content, backend);
+            this->EvaluateBatchRead(path, content, backend);
+        }
+
+        std::filesystem::remove(path);
+    }
+
+private:
+    void EvaluateRead(const std::u8string& path, const std::vector<std::byte>& content, AsyncFileIOBackend backend)
+    {
+        SerialDispatchQueue completionQueue;
+        AsyncFileIO asyncFileIO(&completionQueue, backend);
+
+        auto file = AsyncFile::Open(path.c_str(), FileOptions::SequentialScan);
+        assert(file.has_value() && file->Length() == static_cast<int64_t>(content.size()));
+
+        // The read which crosses the end of the file is short.
+        std::vector<std::byte> buffer(content.size());
+        int64_t handledReadBytes = 0;
+        auto handle = asyncFileIO.ReadAsync(*file, 500000, buffer, [&handledReadBytes](int64_t readBytes)
+        {
+            handledReadBytes = readBytes;
+        });
+        handle.Wait();
+        assert(handle.IsCompleted() && handle.GetReadBytes() == 500000 && std::equal(buffer.begin(), buffer.begin() + 500000, content.begin() + 500000));
+
+        // The handler is posted to the completion queue, so it's called when the queue is dispatched.
+        assert(handledReadBytes == 0);
+        completionQueue.Dispatch();
+        assert(handledReadBytes == 500000);
+
+        auto pathHandle = asyncFileIO.ReadAsync(path.c_str(), 0, buffer);
+        pathHandle.Wait();
+        assert(pathHandle.GetReadBytes() == static_cast<int64_t>(content.size()) && buffer == content);
+
+        handledReadBytes = 0;
+        auto missingFileHandle = asyncFileIO.ReadAsync(u8"AsyncFileIOTest.missing", 0, buffer, [&handledReadBytes](int64_t readBytes)
+        {
+            handledReadBytes = readBytes;
+        });
+        assert(missingFileHandle.IsCompleted() && missingFileHandle.GetReadBytes() == -1);
+        completionQueue.Dispatch();
+        assert(handledReadBytes == -1);
+
+        // The negative offset fails up front even if the file exists.
+        auto negativeOffsetHandle = asyncFileIO.ReadAsync(path.c_str(), -1, buffer);
+        assert(negativeOffsetHandle.IsCompleted() && negativeOffsetHandle.GetReadBytes() == -1);
+    }
+
+    void EvaluateBatchRead(const std::u8string& path, const std::vector<std::byte>& content, AsyncFileIOBackend backend)
+    {
+        auto file = AsyncFile::Open(path.c_str(), FileOptions::RandomAccess);
+
+        // The batch is larger than the queue depth, so the rest of it waits until the slots are freed.
+        constexpr size_t requestCount = 200;
+        constexpr size_t requestSize = 4096;
+        std::vector<std::byte> buffer(requestCount * requestSize);
+        std::atomic<int32_t> completedCount = 0;
+        {
+            AsyncFileIO asyncFileIO(nullptr, backend, 4, 8);
+
+            std::vector<AsyncReadRequest> requests(requestCount);
+            for (size_t i = 0; i < requestCount; ++i)
+            {
+                requests[i] = {&*file, static_cast<int64_t>((requestCount - i) * requestSize), std::span(buffer).subspan(i * requestSize, requestSize), [&completedCount](int64_t readBytes)
+                {
+                    assert(readBytes == requestSize);
+                    ++completedCount;
+                }};
+            }
+
+            const auto handles = asyncFileIO.ReadAsync(requests);
+            assert(handles.size() == requestCount && handles[0].IsValid());
+
+            // The destructor waits for the submitted reads.
+        }
+
+        assert(completedCount == requestCount);
+        for (size_t i = 0; i < requestCount; ++i)
+        {
+            const auto offset = (requestCount - i) * requestSize;
+            assert(std::equal(buffer.begin() + i * requestSize, buffer.begin() + (i + 1) * requestSize, content.begin() + offset));
+        }
+    }
+};
+
+} /* namespace tgon */
@@ -0,0 +1,99 @@
+/**
+ * @file    FileStreamTransferTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "IO/FileStream.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class FileStreamTransferTest :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        const auto path = (std::filesystem::temp_directory_path() / "FileStreamTransferTest.bin").u8string();
+
+        std::vector<std::byte> content(100000);
+        for (size_t i = 0; i < content.size(); ++i)
+        {
+            content[i] = static_cast<std::byte>(i * 31);
+        }
+
+        this->EvaluateLargeTransfer(path, content);
+        this->EvaluateMixedTransfer(path, content);
+        this->EvaluateOpenMode(path);
+
+        std::filesystem::remove(path);
+    }
+
+private:
+    void EvaluateLargeTransfer(const std::u8string& path, const std::vector<std::byte>& content)
+    {
+        {
+            auto fs = FileStream::Create(path.c_str(), FileMode::Create, FileAccess::Write, FileShare::Read, 4096, FileOptions::SequentialScan);
+            assert(fs.has_value() && fs->Write(content.data(), 10) && fs->Write(content.data() + 10, static_cast<int64_t>(content.size()) - 10));
+            assert(fs->Position() == static_cast<int64_t>(content.size()) && fs->Length() == static_cast<int64_t>(content.size()));
+        }
+
+        // The request which is larger than the buffer used to fail, so the whole file is read at once.
+        auto fs = FileStream::Create(path.c_str(), FileMode::Open, FileAccess::Read, FileShare::Read, 4096, FileOptions::SequentialScan);
+        std::vector<std::byte> readContent(content.size() + 100);
+        assert(fs->Read(readContent.data(), 3) == 3 && fs->Position() == 3);
+        assert(fs->Read(readContent.data() + 3, static_cast<int64_t>(readContent.size()) - 3) == static_cast<int64_t>(content.size()) - 3);
+        assert(std::equal(content.begin(), content.end(), readContent.begin()));
+        assert(fs->Read(readContent.data(), 1) == 0 && fs->ReadByte() == -1 && fs->Write(content.data(), 1) == false);
+    }
+
+    void EvaluateMixedTransfer(const std::u8string& path, const std::vector<std::byte>& content)
+    {
+        auto fs = FileStream::Create(path.c_str(), FileMode::Open, FileAccess::ReadWrite, FileShare::None, 4096, FileOptions::RandomAccess);
+
+        std::byte readBytes[16];
+        assert(fs->Read(readBytes, 16) == 16 && readBytes[15] == content[15] && fs->Position() == 16);
+
+        // The write after the buffered read goes to the current position, not to the end of the read buffer.
+        const std::byte writtenBytes[4] = {std::byte(1), std::byte(2), std::byte(3), std::byte(4)};
+        assert(fs->Write(writtenBytes, 4) && fs->Position() == 20);
+        assert(fs->ReadByte() == static_cast<int32_t>(content[20]) && fs->Position() == 21);
+
+        assert(fs->Seek(-5, SeekOrigin::Current) == 16 && fs->Read(readBytes, 5) == 5 && readBytes[0] == std::byte(1) && readBytes[4] == content[20]);
+        assert(fs->Seek(-1, SeekOrigin::End) == static_cast<int64_t>(content.size()) - 1 && fs->ReadByte() == static_cast<int32_t>(content.back()));
+        assert(fs->Seek(-1, SeekOrigin::Begin) == -1);
+
+        assert(fs->SetLength(50) && fs->Length() == 50 && fs->Position() == 50);
+        assert(fs->Seek(0, SeekOrigin::Begin) == 0 && fs->Read(readBytes, 16) == 16 && readBytes[3] == content[3]);
+        fs->Flush(true);
+    }
+
+    void EvaluateOpenMode(const std::u8string& path)
+    {
+        assert(FileStream::Create(path.c_str(), FileMode::CreateNew).has_value() == false);
+        assert(FileStream::Create(path.c_str(), FileMode::Truncate, FileAccess::Read).has_value() == false);
+
+        {
+            auto fs = FileStream::Create(path.c_str(), FileMode::Append, FileAccess::Write, FileShare::Read, 4096, FileOptions::WriteThrough);
+            assert(fs.has_value() && fs->Position() == 50 && fs->WriteByte(std::byte(7)));
+        }
+
+        auto fs = FileStream::Create(path.c_str(), FileMode::Open, FileAccess::Read);
+        assert(fs->Length() == 51 && fs->Seek(50, SeekOrigin::Begin) == 50 && fs->ReadByte() == 7);
+
+        auto movedFs = std::move(*fs);
+        assert(fs->IsClosed() && movedFs.IsClosed() == false && movedFs.Position() == 51);
+    }
+};
+
+} /* namespace tgon */
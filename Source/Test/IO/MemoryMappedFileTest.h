@@ -0,0 +1,96 @@
+/**
+ * @file    MemoryMappedFileTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "IO/File.h"
+#include "IO/MemoryMappedFile.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class MemoryMappedFileTest :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        const auto path = (std::filesystem::temp_directory_path() / "MemoryMappedFileTest.bin").u8string();
+        const auto emptyPath = (std::filesystem::temp_directory_path() / "MemoryMappedFileTest.empty").u8string();
+
+        // The content spans several pages, so the advice is given to the ranges which aren't page aligned.
+        std::vector<std::byte> content(100000);
+        for (size_t i = 0; i < content.size(); ++i)
+        {
+            content[i] = static_cast<std::byte>(i * 31);
+        }
+        WriteFile(path, content);
+        WriteFile(emptyPath, {});
+
+        this->EvaluateMapping(path, content);
+        this->EvaluateEmptyFile(emptyPath);
+
+        std::filesystem::remove(path);
+        std::filesystem::remove(emptyPath);
+        assert(MemoryMappedFile::Open(path.c_str()).has_value() == false);
+    }
+
+private:
+    static void WriteFile(const std::u8string& path, const std::vector<std::byte>& content)
+    {
+        FILE* fp = fopen(reinterpret_cast<const char*>(path.c_str()), "wb");
+        if (content.empty() == false)
+        {
+            fwrite(content.data(), 1, content.size(), fp);
+        }
+        fclose(fp);
+    }
+
+    void EvaluateMapping(const std::u8string& path, const std::vector<std::byte>& content)
+    {
+        auto mappedFile = MemoryMappedFile::Open(path.c_str(), MemoryAdvice::Sequential | MemoryAdvice::WillNeed);
+        assert(mappedFile.has_value() && mappedFile->GetSize() == content.size());
+        assert(std::equal(mappedFile->GetView().begin(), mappedFile->GetView().end(), content.begin()));
+
+        mappedFile->Advise(5000, 20000, MemoryAdvice::Random | MemoryAdvice::WillNeed);
+        mappedFile->Advise(90000, SIZE_MAX, MemoryAdvice::DontNeed);
+        mappedFile->Advise(content.size(), 1, MemoryAdvice::WillNeed);
+
+        // The dropped pages are read again from the file.
+        assert(mappedFile->GetView()[99999] == content[99999]);
+
+        const auto view = mappedFile->GetView(99990, 100);
+        assert(view.size() == 10 && view[0] == content[99990] && mappedFile->GetView(content.size(), 1).empty());
+
+        // The moved file owns the mapping, so the view stays valid after the source is destroyed.
+        auto movedFile = std::move(*mappedFile);
+        mappedFile.reset();
+        assert(movedFile.GetData() == view.data() - 99990 && movedFile.GetView()[1] == content[1]);
+
+        movedFile.Close();
+        assert(movedFile.IsEmpty() && movedFile.GetData() == nullptr);
+
+        const auto fileData = File::ReadAllBytes(path.c_str(), ReturnVectorTag{});
+        assert(fileData.has_value() && *fileData == content);
+    }
+
+    void EvaluateEmptyFile(const std::u8string& path)
+    {
+        const auto mappedFile = MemoryMappedFile::Open(path.c_str(), MemoryAdvice::WillNeed);
+        assert(mappedFile.has_value() && mappedFile->IsEmpty() && mappedFile->GetView().empty());
+        assert(File::ReadAllBytes(path.c_str(), ReturnVectorTag{})->empty());
+    }
+};
+
+} /* namespace tgon */
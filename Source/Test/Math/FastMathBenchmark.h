@@ -0,0 +1,93 @@
+/**
+ * @file    FastMathBenchmark.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <chrono>
+#include <fmt/format.h>
+
+#include "FastMathTest.h"
+
+namespace tg
+{
+
+/**
+ * @brief   Prints the measured error and the time per element of the standard functions, the scalar approximations and
+ *          the vectorized approximations, which is the speed and accuracy trade-off of every function.
+ */
+class FastMathBenchmark :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        constexpr const char* levelNames[] = {"Scalar", "Sse2", "Sse41", "Avx2", "Neon"};
+        const auto tables = FastMathTest::GetSupportedTables();
+        fmt::print("{:<12}{:>12}{:>10}{:>10}", "Function", "MaxError", "Std", "Fast");
+        for (const auto* table : tables)
+        {
+            fmt::print("{:>10}", levelNames[static_cast<int32_t>(table->level)]);
+        }
+        fmt::print("  (ns per element)\n");
+
+        for (const auto& testCase : FastMathTest::GetCases())
+        {
+            // Sample the whole range into a working set which fits in the L1 cache, so the arithmetic is measured instead of
+            // the memory bandwidth.
+            std::vector<float> values(2048);
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                values[i] = testCase.values[i * (testCase.values.size() / values.size())];
+            }
+            std::vector<float> results(values.size());
+
+            const auto standardTime = Measure(values.size(), [&]
+            {
+                for (size_t i = 0; i < values.size(); ++i)
+                {
+                    results[i] = testCase.standardFunction(values[i]);
+                }
+            });
+            const auto scalarTime = Measure(values.size(), [&]
+            {
+                for (size_t i = 0; i < values.size(); ++i)
+                {
+                    results[i] = testCase.function(values[i]);
+                }
+            });
+            fmt::print("{:<12}{:>12.3e}{:>10.2f}{:>10.2f}", testCase.name, FastMathTest::MeasureScalar(testCase), standardTime, scalarTime);
+
+            for (const auto* table : tables)
+            {
+                const auto batchTime = Measure(values.size(), [&]
+                {
+                    (table->*testCase.batchKernel)(values.data(), results.data(), values.size());
+                });
+                fmt::print("{:>10.2f}", batchTime);
+            }
+            fmt::print("\n");
+        }
+    }
+
+    /**
+     * @brief   Gets the best time per element of the repeated runs, which filters out the interruptions.
+     */
+    template <typename _Function>
+    static double Measure(size_t count, const _Function& function)
+    {
+        constexpr int32_t repeatCount = 200;
+        auto minTime = std::chrono::nanoseconds::max();
+        for (int32_t i = 0; i < repeatCount; ++i)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            function();
+            minTime = std::min(minTime, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin));
+        }
+        return static_cast<double>(minTime.count()) / count;
+    }
+};
+
+} /* namespace tgon */
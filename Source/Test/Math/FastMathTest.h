@@ -0,0 +1,222 @@
+/**
+ * @file    FastMathTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+#include "Math/Mathf.h"
+#include "Math/VectorKernels.h"
+#include "Math/VectorKernelTable.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+/**
+ * @brief   Measures the approximations of Mathf against the double precision results and checks the documented bounds.
+ */
+class FastMathTest :
+    public Test
+{
+/**@section Type */
+public:
+    using BatchKernel = void(*)(const float* src, float* dest, size_t count) noexcept;
+
+    /**
+     * @brief   The error of one result, which is scaled the same way as the bound in the documentation.
+     */
+    using ErrorMetric = double(*)(double value, double expected, double actual);
+
+    struct Case
+    {
+        const char* name;
+        float(*function)(float value);
+
+        /**
+         * @brief   The function of Mathf which is forwarded to <cmath>, to compare the speed with.
+         */
+        float(*standardFunction)(float value);
+        double(*reference)(double value);
+        BatchKernel VectorKernelTable::* batchKernel;
+        ErrorMetric errorMetric;
+        double bound;
+        std::vector<float> values;
+    };
+
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        for (const auto& testCase : GetCases())
+        {
+            assert(MeasureScalar(testCase) <= testCase.bound);
+
+            for (const auto* table : GetSupportedTables())
+            {
+                std::vector<float> results(testCase.values.size());
+                (table->*testCase.batchKernel)(testCase.values.data(), results.data(), testCase.values.size());
+                assert(Measure(testCase, results) <= testCase.bound);
+            }
+        }
+
+        this->EvaluateBinaryFunctions();
+        this->EvaluateSpecialValues();
+    }
+
+    static std::vector<Case> GetCases()
+    {
+#if TGON_SIMD_NEON
+        constexpr auto inverseSqrtBound = 3e-5;
+#else
+        constexpr auto inverseSqrtBound = 5e-7;
+#endif
+        return {
+            {"Sin", Mathf::FastSin, Mathf::Sin, [](double value) { return std::sin(value); }, &VectorKernelTable::sinFloats, GetAbsoluteError, 1.5e-7, MakeLinearValues(-8192.0f, 8192.0f)},
+            {"Cos", Mathf::FastCos, Mathf::Cos, [](double value) { return std::cos(value); }, &VectorKernelTable::cosFloats, GetAbsoluteError, 1.5e-7, MakeLinearValues(-8192.0f, 8192.0f)},
+            {"InverseSqrt", Mathf::FastInverseSqrt, [](float value) { return 1.0f / Mathf::Sqrt(value); }, [](double value) { return 1.0 / std::sqrt(value); }, &VectorKernelTable::inverseSqrtFloats, GetRelativeError, inverseSqrtBound, MakeLogarithmicValues(FLT_MIN, FLT_MAX)},
+            {"Sqrt", Mathf::FastSqrt, Mathf::Sqrt, [](double value) { return std::sqrt(value); }, &VectorKernelTable::sqrtFloats, GetRelativeError, inverseSqrtBound, MakeLogarithmicValues(FLT_MIN, FLT_MAX)},
+            {"Exp2", Mathf::FastExp2, [](float value) { return Mathf::Pow(2.0f, value); }, [](double value) { return std::exp2(value); }, &VectorKernelTable::exp2Floats, GetRelativeError, 3e-7, MakeLinearValues(-126.0f, 127.0f)},
+            {"Log2", Mathf::FastLog2, [](float value) { return Mathf::Log(value, 2.0f); }, [](double value) { return std::log2(value); }, &VectorKernelTable::log2Floats, GetLogarithmError, 5e-7, MakeLogarithmicValues(FLT_MIN, FLT_MAX)},
+            {"Exp", Mathf::FastExp, Mathf::Exp, [](double value) { return std::exp(value); }, &VectorKernelTable::expFloats, GetExponentialError, 4e-7, MakeLinearValues(-87.0f, 88.0f)},
+            {"Log", Mathf::FastLog, [](float value) { return Mathf::Log(value); }, [](double value) { return std::log(value); }, &VectorKernelTable::logFloats, GetLogarithmError, 4e-7, MakeLogarithmicValues(FLT_MIN, FLT_MAX)},
+        };
+    }
+
+    static std::vector<const VectorKernelTable*> GetSupportedTables()
+    {
+        std::vector<const VectorKernelTable*> ret;
+        for (auto level : {SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Sse41, SimdLevel::Avx2, SimdLevel::Neon})
+        {
+            const auto* table = GetVectorKernelTable(level);
+            if (table != nullptr && CpuFeature::IsSupported(level))
+            {
+                ret.push_back(table);
+            }
+        }
+        return ret;
+    }
+
+    static double MeasureScalar(const Case& testCase)
+    {
+        std::vector<float> results(testCase.values.size());
+        std::transform(testCase.values.begin(), testCase.values.end(), results.begin(), testCase.function);
+        return Measure(testCase, results);
+    }
+
+    static double Measure(const Case& testCase, const std::vector<float>& results)
+    {
+        double maxError = 0.0;
+        for (size_t i = 0; i < testCase.values.size(); ++i)
+        {
+            const double value = testCase.values[i];
+            maxError = std::max(maxError, testCase.errorMetric(value, testCase.reference(value), results[i]));
+        }
+        return maxError;
+    }
+
+private:
+    void EvaluateBinaryFunctions()
+    {
+        // Walk around the circles, so every octant and both axes are covered.
+        std::vector<float> ys, xs;
+        for (float radius : {1e-3f, 1.0f, 1e4f})
+        {
+            for (int32_t i = 0; i <= 100000; ++i)
+            {
+                const double angle = -Mathf::PI + (Mathf::PI * 2.0) * i / 100000;
+                ys.push_back(static_cast<float>(std::sin(angle) * radius));
+                xs.push_back(static_cast<float>(std::cos(angle) * radius));
+            }
+        }
+
+        std::vector<float> results(ys.size());
+        for (const auto* table : GetSupportedTables())
+        {
+            table->atan2Floats(ys.data(), xs.data(), results.data(), ys.size());
+            for (size_t i = 0; i < ys.size(); ++i)
+            {
+                const auto expected = std::atan2(static_cast<double>(ys[i]), static_cast<double>(xs[i]));
+                assert(std::abs(expected - Mathf::FastAtan2(ys[i], xs[i])) <= 2.5e-6);
+                assert(std::abs(expected - results[i]) <= 2.5e-6);
+            }
+        }
+
+        for (float value : MakeLogarithmicValues(1e-3f, 1e3f))
+        {
+            const double expected = std::pow(static_cast<double>(value), static_cast<double>(2.2f));
+            const double bound = 3e-7 + 2.2 * 3.5e-7 * std::max(1.0, std::abs(std::log2(static_cast<double>(value))));
+            assert(std::abs(Mathf::FastPow(value, 2.2f) - expected) / expected <= bound);
+        }
+    }
+
+    void EvaluateSpecialValues()
+    {
+        assert(Mathf::FastSin(0.0f) == 0.0f && Mathf::FastCos(0.0f) == 1.0f);
+        assert(Mathf::FastAtan2(0.0f, 0.0f) == 0.0f && Mathf::FastAtan2(0.0f, -1.0f) == Mathf::PI);
+        assert(Mathf::FastExp2(0.0f) == 1.0f && Mathf::FastExp2(-200.0f) == 0.0f && std::isfinite(Mathf::FastExp2(200.0f)));
+        assert(Mathf::FastLog2(1.0f) == 0.0f && Mathf::FastLog2(1024.0f) == 10.0f);
+        assert(Mathf::FastSqrt(0.0f) == 0.0f);
+
+        // The odd count leaves a tail for every lane width.
+        const std::vector<float> values = {0.0f, -200.0f, 200.0f, 1.0f, 1024.0f, 0.5f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+        std::vector<float> results(values.size());
+        VectorKernels::FastExp2(values, results);
+        assert(results[0] == 1.0f && results[1] == 0.0f && std::isfinite(results[2]) && results[8] == 16.0f);
+        VectorKernels::FastSqrt(values, results);
+        assert(results[0] == 0.0f && std::abs(results[4] - 32.0f) <= 32.0f * 5e-7f);
+        VectorKernels::FastPow(values, 2.0f, results);
+        assert(std::abs(results[12] - 64.0f) <= 64.0f * 3e-6f);
+    }
+
+    static std::vector<float> MakeLinearValues(float min, float max)
+    {
+        constexpr int32_t count = 1 << 20;
+        std::vector<float> ret(count + 1);
+        for (int32_t i = 0; i <= count; ++i)
+        {
+            ret[i] = static_cast<float>(min + (static_cast<double>(max) - min) * i / count);
+        }
+        return ret;
+    }
+
+    static std::vector<float> MakeLogarithmicValues(float min, float max)
+    {
+        const auto values = MakeLinearValues(std::log2(min), std::log2(max));
+        std::vector<float> ret(values.size());
+        std::transform(values.begin(), values.end(), ret.begin(), [&](float value) { return std::clamp(std::exp2(value), min, max); });
+        return ret;
+    }
+
+    static double GetAbsoluteError(double, double expected, double actual)
+    {
+        return std::abs(actual - expected);
+    }
+
+    static double GetRelativeError(double, double expected, double actual)
+    {
+        return std::abs(actual - expected) / std::abs(expected);
+    }
+
+    static double GetLogarithmError(double, double expected, double actual)
+    {
+        return std::abs(actual - expected) / std::max(1.0, std::abs(expected));
+    }
+
+    /**
+     * @brief   The relative error which is divided by the magnification of the rounding in value * log2(e).
+     */
+    static double GetExponentialError(double value, double expected, double actual)
+    {
+        return GetRelativeError(value, expected, actual) / (1.0 + std::abs(value) * 0.2);
+    }
+};
+
+} /* namespace tgon */
@@ -0,0 +1,159 @@
+/**
+ * @file    IntersectionTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "Math/Frustum.h"
+#include "Math/OBB.h"
+#include "Math/Ray.h"
+#include "Math/VectorKernels.h"
+#include "Math/VectorKernelTable.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class IntersectionTest :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        const AABB box({0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f});
+        assert(box.Contains(Vector3(0.5f, 1.0f, 0.0f)) && box.Contains(Vector3(0.5f, 1.1f, 0.0f)) == false);
+        assert(box.Intersect(AABB({1.0f, 0.5f, 0.5f}, {2.0f, 2.0f, 2.0f})) && box.Intersect(AABB({1.1f, 0.5f, 0.5f}, {2.0f, 2.0f, 2.0f})) == false);
+        assert(box.Contains(AABB({0.2f, 0.2f, 0.2f}, {0.8f, 0.8f, 0.8f})) && box.Contains(AABB({0.2f, 0.2f, 0.2f}, {1.8f, 0.8f, 0.8f})) == false);
+        assert(box.Transformed(Matrix4x4::Translate(1.0f, 2.0f, 3.0f)) == AABB({1.0f, 2.0f, 3.0f}, {2.0f, 3.0f, 4.0f}));
+        assert(Sphere({2.0f, 0.5f, 0.5f}, 1.0f).Intersect(box) && Sphere({2.0f, 2.0f, 0.5f}, 1.0f).Intersect(box) == false);
+
+        assert(Ray({-5.0f, 0.5f, 0.5f}, {1.0f, 0.0f, 0.0f}).Raycast(box) == 5.0f);
+        assert(Ray({-5.0f, 1.5f, 0.5f}, {1.0f, 0.0f, 0.0f}).Raycast(box).has_value() == false);
+        assert(Ray({0.5f, 0.5f, 0.5f}, {0.0f, 0.0f, -1.0f}).Raycast(box) == 0.0f);
+        assert(Ray({2.0f, 0.5f, 0.5f}, {1.0f, 0.0f, 0.0f}).Raycast(box).has_value() == false);
+        assert(Ray({0.0f, 0.0f, -5.0f}, {0.0f, 0.0f, 1.0f}).Raycast(Sphere({0.0f, 0.0f, 0.0f}, 2.0f)) == 3.0f);
+        assert(Ray({0.0f, 3.0f, 0.0f}, {0.0f, -1.0f, 0.0f}).Raycast(Plane::FromPointNormal({0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f})) == 2.0f);
+        assert(Ray({0.2f, 0.2f, 0.0f}, {0.0f, 0.0f, 1.0f}).Raycast({0.0f, 0.0f, 5.0f}, {1.0f, 0.0f, 5.0f}, {0.0f, 1.0f, 5.0f}) == 5.0f);
+        assert(Ray({0.8f, 0.8f, 0.0f}, {0.0f, 0.0f, 1.0f}).Raycast({0.0f, 0.0f, 5.0f}, {1.0f, 0.0f, 5.0f}, {0.0f, 1.0f, 5.0f}).has_value() == false);
+
+        // The rotated box reaches its neighbor only by the corner.
+        const OBB obb({0.0f, 0.0f, 0.0f}, {0.5f, 0.5f, 0.5f}, Quaternion());
+        assert(obb.Intersect(OBB({1.1f, 0.0f, 0.0f}, {0.5f, 0.5f, 0.5f}, Quaternion())) == false);
+        assert(obb.Intersect(OBB({1.1f, 0.0f, 0.0f}, {0.5f, 0.5f, 0.5f}, Quaternion::AxisAngle({0.0f, 0.0f, 1.0f}, Mathf::PI * 0.25f))));
+        assert(OBB({0.0f, 0.0f, 0.0f}, {1.0f, 0.1f, 0.1f}, Quaternion::AxisAngle({0.0f, 0.0f, 1.0f}, Mathf::PI * 0.5f)).Contains({0.0f, 0.9f, 0.0f}));
+
+        const auto frustum = Frustum::FromMatrix(Matrix4x4::PerspectiveLH(Mathf::PI * 0.5f, 1.0f, 0.1f, 100.0f));
+        assert(frustum.Contains({0.0f, 0.0f, 5.0f}) && frustum.Contains({0.0f, 0.0f, -5.0f}) == false && frustum.Contains({0.0f, 0.0f, 200.0f}) == false);
+        assert(frustum.Intersect(Sphere({5.5f, 0.0f, 5.0f}, 1.0f)) && frustum.Intersect(Sphere({100.0f, 0.0f, 5.0f}, 1.0f)) == false);
+        assert(frustum.Intersect(AABB({5.5f, 0.0f, 5.0f}, {6.0f, 1.0f, 6.0f})) && frustum.Intersect(AABB({-20.0f, 0.0f, 5.0f}, {-19.0f, 1.0f, 6.0f})) == false);
+
+        this->EvaluateBatch(frustum);
+    }
+
+private:
+    void EvaluateBatch(const Frustum& frustum)
+    {
+        // The odd count leaves a tail for every lane width.
+        constexpr size_t count = 37;
+        std::mt19937 engine(3);
+        std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+        std::vector<float> values(count * 10);
+        for (auto& value : values)
+        {
+            value = distribution(engine);
+        }
+
+        auto makeVectors = [&](size_t offset)
+        {
+            return ConstVector3SoA(std::span(&values[offset], count), std::span(&values[offset + count], count), std::span(&values[offset + count * 2], count));
+        };
+        std::vector<float> extents(count * 3);
+        for (size_t i = 0; i < extents.size(); ++i)
+        {
+            extents[i] = values[i] + std::abs(values[extents.size() + i]) * 0.3f;
+        }
+        std::vector<float> radii(count);
+        for (size_t i = 0; i < radii.size(); ++i)
+        {
+            radii[i] = 1.0f + std::abs(values[count * 9 + i]) * 0.2f;
+        }
+        const ConstVector3SoA maxs(std::span(&extents[0], count), std::span(&extents[count], count), std::span(&extents[count * 2], count));
+        const AABBSoA boxes{makeVectors(0), maxs};
+        const TriangleSoA triangles{makeVectors(0), makeVectors(count * 3), makeVectors(count * 6)};
+        const SphereSoA spheres{makeVectors(0), radii};
+
+        auto getBox = [&](size_t i) { return AABB({boxes.mins.xs[i], boxes.mins.ys[i], boxes.mins.zs[i]}, {maxs.xs[i], maxs.ys[i], maxs.zs[i]}); };
+        auto getVector = [&](const ConstVector3SoA& vectors, size_t i) { return Vector3(vectors.xs[i], vectors.ys[i], vectors.zs[i]); };
+
+        const Ray ray({-1.0f, -2.0f, -3.0f}, Vector3(0.3f, 0.5f, 0.8f).Normalized());
+        const AABB queryBox({-3.0f, -3.0f, -3.0f}, {3.0f, 3.0f, 3.0f});
+        std::vector<float> distances(count);
+        std::vector<uint32_t> indices(count);
+        for (auto level : {SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Sse41, SimdLevel::Avx2, SimdLevel::Neon})
+        {
+            const auto* table = GetVectorKernelTable(level);
+            if (table == nullptr || CpuFeature::IsSupported(level) == false)
+            {
+                continue;
+            }
+
+            table->raycastAABBs(&ray.origin.x, ToArrays(boxes.mins), ToArrays(boxes.maxs), distances.data(), count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                assert(IsNearlyEqual(ray.Raycast(getBox(i)).value_or(INFINITY), distances[i]));
+            }
+
+            table->raycastTriangles(&ray.origin.x, ToArrays(triangles.v0s), ToArrays(triangles.v1s), ToArrays(triangles.v2s), distances.data(), count);
+            size_t hitCount = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const auto distance = ray.Raycast(getVector(triangles.v0s, i), getVector(triangles.v1s, i), getVector(triangles.v2s, i));
+                hitCount += distance.has_value() ? 1 : 0;
+                assert(IsNearlyEqual(distance.value_or(INFINITY), distances[i]));
+            }
+            assert(hitCount > 0);
+
+            auto expectIndices = [&](size_t actualCount, auto predicate)
+            {
+                size_t expectedCount = 0;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (predicate(i))
+                    {
+                        assert(expectedCount < actualCount && indices[expectedCount] == i);
+                        ++expectedCount;
+                    }
+                }
+                assert(expectedCount == actualCount && expectedCount > 0 && expectedCount < count);
+            };
+            expectIndices(table->overlapAABBs(&queryBox.min.x, ToArrays(boxes.mins), ToArrays(boxes.maxs), indices.data(), count), [&](size_t i) { return queryBox.Intersect(getBox(i)); });
+            expectIndices(table->cullSpheres(&frustum.planes[0].normal.x, ToArrays(spheres.centers), spheres.radii.data(), indices.data(), count), [&](size_t i) { return frustum.Intersect(Sphere(getVector(spheres.centers, i), spheres.radii[i])); });
+            expectIndices(table->cullAABBs(&frustum.planes[0].normal.x, ToArrays(boxes.mins), ToArrays(boxes.maxs), indices.data(), count), [&](size_t i) { return frustum.Intersect(getBox(i)); });
+        }
+
+        const auto visibleCount = GetVectorKernelTable(SimdLevel::Scalar)->cullSpheres(&frustum.planes[0].normal.x, ToArrays(spheres.centers), spheres.radii.data(), indices.data(), count);
+        assert(VectorKernels::Cull(frustum, spheres, indices) == visibleCount);
+        VectorKernels::Raycast(ray, boxes, distances);
+        assert(IsNearlyEqual(ray.Raycast(getBox(0)).value_or(INFINITY), distances[0]));
+    }
+
+    static ConstFloat3Arrays ToArrays(const ConstVector3SoA& vectors)
+    {
+        return {vectors.xs.data(), vectors.ys.data(), vectors.zs.data()};
+    }
+
+    static bool IsNearlyEqual(float expected, float actual)
+    {
+        return expected == actual || std::abs(expected - actual) <= 1e-4f * std::max(1.0f, std::abs(expected));
+    }
+};
+
+} /* namespace tgon */
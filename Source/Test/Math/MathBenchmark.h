@@ -0,0 +1,59 @@
+/**
+ * @file    MathBenchmark.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <fmt/format.h>
+
+#include "FastMathBenchmark.h"
+#include "MathDifferentialTest.h"
+
+namespace tg
+{
+
+/**
+ * @brief   Prints the time per operation and the measured error of every implementation of MathDifferentialTest, next to
+ *          the double precision reference.
+ */
+class MathBenchmark :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        fmt::print("{:<28}{:<8}{:>10}{:>10}  (ns per operation)\n", "Operation", "Path", "MaxUlps", "Time");
+
+        std::vector<double> expected;
+        for (const auto& testCase : MathDifferentialTest::GetCases())
+        {
+            // A small batch stays in the L1 cache, so the arithmetic is measured instead of the memory bandwidth.
+            constexpr size_t count = 256;
+            const auto inputs = MathDifferentialTest::MakeInputs(testCase, count);
+            expected.resize(testCase.outputSize * count);
+
+            const auto referenceTime = FastMathBenchmark::Measure(count, [&]
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    testCase.reference(&inputs[i * testCase.inputSize], &expected[i * testCase.outputSize]);
+                }
+            });
+            fmt::print("{:<28}{:<8}{:>10}{:>10.2f}\n", testCase.name, "Double", "", referenceTime);
+
+            std::vector<float> outputs(testCase.outputSize * count);
+            for (const auto& [name, implementation] : testCase.implementations)
+            {
+                const auto time = FastMathBenchmark::Measure(count, [&]
+                {
+                    implementation(inputs.data(), outputs.data(), count);
+                });
+                fmt::print("{:<28}{:<8}{:>10.2f}{:>10.2f}\n", "", name, MathDifferentialTest::Measure(testCase, inputs, implementation), time);
+            }
+        }
+    }
+};
+
+} /* namespace tgon */
@@ -0,0 +1,597 @@
+/**
+ * @file    MathDifferentialTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Math/Color.h"
+#include "Math/Half.h"
+#include "Math/Matrix3x4.h"
+#include "Math/Matrix4x4.h"
+#include "Math/PackedVector.h"
+#include "Math/Quaternion.h"
+#include "Math/Vector4.h"
+#include "Math/VectorKernelTable.h"
+
+#include "FastMathTest.h"
+
+namespace tg
+{
+
+/**
+ * @brief   Runs the math operations through the SIMD paths of the headers and through every supported kernel table, and
+ *          compares the results with the double precision references on the random inputs.
+ * @remark  The SIMD paths can't diverge from the scalar math silently this way, such as by returning the wrong matrix.
+ */
+class MathDifferentialTest :
+    public Test
+{
+/**@section Type */
+public:
+    /**
+     * @brief   Runs the operation on the packed input elements and writes the packed output elements.
+     */
+    using Implementation = std::function<void(const float* inputs, float* outputs, size_t count)>;
+
+    struct Case
+    {
+        const char* name;
+        size_t inputSize;
+        size_t outputSize;
+
+        /**
+         * @brief   Conditions the random inputs of one element, such as making a matrix invertible. It can be nullptr.
+         */
+        void(*prepare)(float* input);
+        void(*reference)(const float* input, double* output);
+
+        /**
+         * @brief   The magnitude of the terms which make up a result. The results which cancel to about zero are measured in
+         *          the ULPs of this magnitude, otherwise any ULP bound would fail for them.
+         */
+        double scale;
+        double maxUlps;
+        std::vector<std::pair<std::string, Implementation>> implementations;
+    };
+
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        for (const auto& testCase : GetCases())
+        {
+            const auto inputs = MakeInputs(testCase, 1027);
+            for (const auto& [name, implementation] : testCase.implementations)
+            {
+                assert(Measure(testCase, inputs, implementation) <= testCase.maxUlps);
+            }
+        }
+
+        for (const auto* table : FastMathTest::GetSupportedTables())
+        {
+            EvaluatePackedKernels(*table);
+        }
+    }
+
+    /**
+     * @brief   Runs the packed kernels of the table, and requires the same bits as the conversions of the packed types.
+     * @remark  The quantized values are stored in the vertex buffers, so they mustn't depend on the instruction set.
+     */
+    static void EvaluatePackedKernels(const VectorKernelTable& table)
+    {
+        // The count leaves a tail for every lane width.
+        constexpr size_t count = 1027;
+        std::mt19937 engine(23);
+        std::uniform_real_distribution<float> distribution(-1.5f, 1.5f);
+
+        // Mix the ties and the values out of the ranges into the random ones.
+        std::vector<float> values(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            values[i] = i % 4 == 0 ? (static_cast<float>(i % 256) + 0.5f) / 255.0f : distribution(engine);
+        }
+
+        std::vector<uint16_t> halves(count);
+        table.floatsToHalves(values.data(), halves.data(), count);
+        std::vector<float> floats(count);
+        table.halvesToFloats(halves.data(), floats.data(), count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            assert(halves[i] == Half::ConvertFromFloat(values[i]));
+            assert(std::bit_cast<uint32_t>(floats[i]) == std::bit_cast<uint32_t>(Half::ConvertToFloat(halves[i])));
+        }
+
+        std::vector<uint8_t> unorms(count);
+        table.floatsToUnorm8s(values.data(), unorms.data(), count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            assert(unorms[i] == Color(values[i], 0.0f, 0.0f, 0.0f).ToColor32().r);
+        }
+
+        std::vector<Vector3> normals(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            normals[i] = Vector3(distribution(engine), distribution(engine), distribution(engine)).Normalized();
+        }
+        normals[0] = Vector3(0.0f, 0.0f, -1.0f);
+        normals[1] = Vector3(-1.0f, 0.0f, 0.0f);
+
+        std::vector<OctahedralNormal> encodedNormals(count);
+        table.encodeOctahedralNormals(&normals[0].x, &encodedNormals[0].x, count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const OctahedralNormal expected(normals[i]);
+            assert(encodedNormals[i].x == expected.x && encodedNormals[i].y == expected.y);
+        }
+
+        // The positions are scattered beyond the bounds to reach the clamping.
+        const AABB bounds({-1.0f, -0.5f, 0.0f}, {1.0f, 0.5f, 0.25f});
+        std::vector<Vector3> positions(count);
+        for (auto& position : positions)
+        {
+            position = Vector3(distribution(engine), distribution(engine), distribution(engine));
+        }
+
+        const auto center = bounds.GetCenter();
+        const auto scale = QuantizedPosition::GetQuantizationScale(bounds);
+        const float transform[] = {center.x, center.y, center.z, scale.x, scale.y, scale.z};
+        std::vector<QuantizedPosition> quantizedPositions(count);
+        table.quantizePositions(transform, &positions[0].x, &quantizedPositions[0].x, count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const QuantizedPosition expected(positions[i], bounds);
+            assert(quantizedPositions[i].x == expected.x && quantizedPositions[i].y == expected.y && quantizedPositions[i].z == expected.z && quantizedPositions[i].w == 0);
+        }
+    }
+
+    static std::vector<Case> GetCases()
+    {
+        std::vector<Case> ret = {
+            {"Matrix4x4*", 32, 16, nullptr, [](const float* input, double* output) { MultiplyDouble(ToDoubles<16>(input), ToDoubles<16>(input + 16), output); }, 1.0, 4.0, MakeInline(32, 16, [](const float* input, float* output)
+            {
+                Store(Load<Matrix4x4>(input) * Load<Matrix4x4>(input + 16), output);
+            })},
+            {"Matrix4x4*=", 32, 16, nullptr, [](const float* input, double* output) { MultiplyDouble(ToDoubles<16>(input), ToDoubles<16>(input + 16), output); }, 1.0, 4.0, MakeInline(32, 16, [](const float* input, float* output)
+            {
+                auto matrix = Load<Matrix4x4>(input);
+                matrix *= Load<Matrix4x4>(input + 16);
+                Store(matrix, output);
+            })},
+            {"Transposed", 16, 16, nullptr, TransposeDouble, 1.0, 0.0, MakeInline(16, 16, [](const float* input, float* output)
+            {
+                Store(Matrix4x4::Transposed(Load<Matrix4x4>(input)), output);
+            })},
+            {"Inverse", 16, 16, PrepareMatrix4x4, InverseDouble, 0.25, 8.0, MakeInline(16, 16, [](const float* input, float* output)
+            {
+                Store(Matrix4x4::Inverse(Load<Matrix4x4>(input)), output);
+            })},
+            {"AffineInverse", 16, 16, PrepareAffineMatrix4x4, InverseDouble, 0.25, 8.0, MakeInline(16, 16, [](const float* input, float* output)
+            {
+                Store(Matrix4x4::AffineInverse(Load<Matrix4x4>(input)), output);
+            })},
+            {"Vector4*", 20, 4, nullptr, [](const float* input, double* output) { TransformDouble(ToDoubles<4>(input).data(), ToDoubles<16>(input + 4), output); }, 1.0, 4.0, MakeInline(20, 4, [](const float* input, float* output)
+            {
+                Store(Load<Vector4>(input) * Load<Matrix4x4>(input + 4), output);
+            })},
+            {"Matrix3x4*", 24, 12, nullptr, MultiplyMatrix3x4Double, 1.0, 4.0, MakeInline(24, 12, [](const float* input, float* output)
+            {
+                Store(Load<Matrix3x4>(input) * Load<Matrix3x4>(input + 12), output);
+            })},
+            {"Matrix3x4Inverse", 12, 12, PrepareMatrix3x4, InverseMatrix3x4Double, 0.25, 8.0, MakeInline(12, 12, [](const float* input, float* output)
+            {
+                Store(Matrix3x4::Inverse(Load<Matrix3x4>(input)), output);
+            })},
+            {"Matrix3x4*4x4", 28, 16, nullptr, [](const float* input, double* output) { MultiplyDouble(ExpandMatrix3x4(input), ToDoubles<16>(input + 12), output); }, 1.0, 4.0, MakeInline(28, 16, [](const float* input, float* output)
+            {
+                Store(Load<Matrix3x4>(input) * Load<Matrix4x4>(input + 12), output);
+            })},
+            {"Quaternion*", 8, 4, nullptr, MultiplyQuaternionDouble, 1.0, 4.0, MakeInline(8, 4, [](const float* input, float* output)
+            {
+                Store(Load<Quaternion>(input) * Load<Quaternion>(input + 4), output);
+            })},
+            {"Rotate", 7, 3, PrepareQuaternion, [](const float* input, double* output) { TransformDouble(input + 4, RotationDouble(input), output, 3); }, 1.0, 4.0, MakeInline(7, 3, [](const float* input, float* output)
+            {
+                const Vector3 rotated = Load<Quaternion>(input).Rotate(Vector3(input[4], input[5], input[6]));
+                output[0] = rotated.x;
+                output[1] = rotated.y;
+                output[2] = rotated.z;
+            })},
+        };
+
+        // The kernel tables take one matrix or quaternion for the whole batch.
+        ret.push_back({"transformVector4s", 4, 4, nullptr, [](const float* input, double* output) { TransformDouble(input, ToDoubles<16>(GetMatrix4x4()), output); }, 1.0, 4.0, MakeForEachTable([](const VectorKernelTable& table, const float* inputs, float* outputs, size_t count)
+        {
+            table.transformVector4s(GetMatrix4x4(), inputs, outputs, count);
+        })});
+        ret.push_back({"normalizeVector4s", 4, 4, PrepareNonZero, NormalizeDouble, 1.0, 2.0, MakeForEachTable([](const VectorKernelTable& table, const float* inputs, float* outputs, size_t count)
+        {
+            table.normalizeVector4s(inputs, outputs, count);
+        })});
+        ret.push_back({"transformPointVector3s", 3, 3, nullptr, [](const float* input, double* output) { TransformPointDouble(input, output, 1.0); }, 1.0, 4.0, MakeForEachTable([](const VectorKernelTable& table, const float* inputs, float* outputs, size_t count)
+        {
+            table.transformPointVector3s(GetMatrix4x4(), inputs, outputs, count);
+        })});
+        ret.push_back({"transformDirectionVector3s", 3, 3, nullptr, [](const float* input, double* output) { TransformPointDouble(input, output, 0.0); }, 1.0, 4.0, MakeForEachTable([](const VectorKernelTable& table, const float* inputs, float* outputs, size_t count)
+        {
+            table.transformDirectionVector3s(GetMatrix4x4(), inputs, outputs, count);
+        })});
+        ret.push_back({"rotateVector3s", 3, 3, nullptr, [](const float* input, double* output) { TransformDouble(input, RotationDouble(GetQuaternion()), output, 3); }, 1.0, 4.0, MakeForEachTable([](const VectorKernelTable& table, const float* inputs, float* outputs, size_t count)
+        {
+            table.rotateVector3s(GetQuaternion(), inputs, outputs, count);
+        })});
+        ret.push_back({"inverseMatrix4x4s", 16, 16, PrepareMatrix4x4, InverseDouble, 0.25, 8.0, MakeForEachTable([](const VectorKernelTable& table, const float* inputs, float* outputs, size_t count)
+        {
+            table.inverseMatrix4x4s(inputs, outputs, count);
+        })});
+        ret.push_back({"affineInverseMatrix4x4s", 16, 16, PrepareAffineMatrix4x4, InverseDouble, 0.25, 8.0, MakeForEachTable([](const VectorKernelTable& table, const float* inputs, float* outputs, size_t count)
+        {
+            table.affineInverseMatrix4x4s(inputs, outputs, count);
+        })});
+        ret.push_back({"inverseTransposeMatrix4x4s", 16, 16, PrepareAffineMatrix4x4, InverseTransposeDouble, 0.25, 8.0, MakeForEachTable([](const VectorKernelTable& table, const float* inputs, float* outputs, size_t count)
+        {
+            table.inverseTransposeMatrix4x4s(inputs, outputs, count);
+        })});
+        ret.push_back({"multiplyMatrix3x4s", 24, 12, nullptr, MultiplyMatrix3x4Double, 1.0, 4.0, MakeForEachTable([](const VectorKernelTable& table, const float* inputs, float* outputs, size_t count)
+        {
+            // The kernel takes the separate arrays, so the pairs are multiplied one by one.
+            for (size_t i = 0; i < count; ++i)
+            {
+                table.multiplyMatrix3x4s(&inputs[i * 24], &inputs[i * 24 + 12], &outputs[i * 12], 1);
+            }
+        })});
+        ret.push_back({"inverseMatrix3x4s", 12, 12, PrepareMatrix3x4, InverseMatrix3x4Double, 0.25, 8.0, MakeForEachTable([](const VectorKernelTable& table, const float* inputs, float* outputs, size_t count)
+        {
+            table.inverseMatrix3x4s(inputs, outputs, count);
+        })});
+        ret.push_back({"lerpFloats", 2, 1, nullptr, [](const float* input, double* output) { output[0] = input[0] + (static_cast<double>(input[1]) - input[0]) * 0.375; }, 1.0, 2.0, MakeForEachTable([](const VectorKernelTable& table, const float* inputs, float* outputs, size_t count)
+        {
+            // Deinterleave the pairs, because the kernel takes the separate arrays.
+            std::vector<float> from(count), to(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                from[i] = inputs[i * 2];
+                to[i] = inputs[i * 2 + 1];
+            }
+            table.lerpFloats(from.data(), to.data(), 0.375f, outputs, count);
+        })});
+        return ret;
+    }
+
+    /**
+     * @brief   Makes the random inputs of the elements, which are uniform in [-1, 1] before they are prepared.
+     */
+    static std::vector<float> MakeInputs(const Case& testCase, size_t count)
+    {
+        std::mt19937 engine(19);
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        std::vector<float> ret(testCase.inputSize * count);
+        for (auto& value : ret)
+        {
+            value = distribution(engine);
+        }
+
+        if (testCase.prepare != nullptr)
+        {
+            for (size_t i = 0; i < ret.size(); i += testCase.inputSize)
+            {
+                testCase.prepare(&ret[i]);
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief   Gets the largest error of the implementation in ULPs.
+     */
+    static double Measure(const Case& testCase, const std::vector<float>& inputs, const Implementation& implementation)
+    {
+        const auto count = inputs.size() / testCase.inputSize;
+        std::vector<float> outputs(testCase.outputSize * count);
+        implementation(inputs.data(), outputs.data(), count);
+
+        double maxUlps = 0.0;
+        std::vector<double> expected(testCase.outputSize);
+        for (size_t i = 0; i < count; ++i)
+        {
+            testCase.reference(&inputs[i * testCase.inputSize], expected.data());
+            for (size_t j = 0; j < testCase.outputSize; ++j)
+            {
+                maxUlps = std::max(maxUlps, GetUlpError(expected[j], outputs[i * testCase.outputSize + j], testCase.scale));
+            }
+        }
+        return maxUlps;
+    }
+
+    static double GetUlpError(double expected, float actual, double scale)
+    {
+        if (std::isfinite(actual) == false)
+        {
+            return std::numeric_limits<double>::infinity();
+        }
+
+        const auto magnitude = static_cast<float>(std::max(std::abs(expected), scale));
+        const auto ulp = std::ldexp(1.0, std::ilogb(magnitude) - (std::numeric_limits<float>::digits - 1));
+        return std::abs(actual - expected) / ulp;
+    }
+
+    static const char* GetLevelName(SimdLevel level) noexcept
+    {
+        constexpr const char* levelNames[] = {"Scalar", "Sse2", "Sse41", "Avx2", "Neon"};
+        return levelNames[static_cast<int32_t>(level)];
+    }
+
+private:
+    template <typename _Function>
+    static std::vector<std::pair<std::string, Implementation>> MakeInline(size_t inputSize, size_t outputSize, _Function function)
+    {
+        return {{"Inline", [=](const float* inputs, float* outputs, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                function(&inputs[i * inputSize], &outputs[i * outputSize]);
+            }
+        }}};
+    }
+
+    template <typename _Function>
+    static std::vector<std::pair<std::string, Implementation>> MakeForEachTable(_Function function)
+    {
+        std::vector<std::pair<std::string, Implementation>> ret;
+        for (const auto* table : FastMathTest::GetSupportedTables())
+        {
+            ret.push_back({GetLevelName(table->level), [=](const float* inputs, float* outputs, size_t count)
+            {
+                function(*table, inputs, outputs, count);
+            }});
+        }
+        return ret;
+    }
+
+    template <typename _Type>
+    static _Type Load(const float* src)
+    {
+        // The inputs aren't aligned for the types such as Matrix4x4.
+        _Type ret;
+        std::memcpy(static_cast<void*>(&ret), src, sizeof(_Type));
+        return ret;
+    }
+
+    template <typename _Type>
+    static void Store(const _Type& value, float* dest)
+    {
+        std::memcpy(dest, static_cast<const void*>(&value), sizeof(_Type));
+    }
+
+    template <size_t _Count>
+    static std::array<double, _Count> ToDoubles(const float* src)
+    {
+        std::array<double, _Count> ret;
+        std::copy(src, src + _Count, ret.begin());
+        return ret;
+    }
+
+    static const float* GetMatrix4x4() noexcept
+    {
+        static constexpr float matrix[] = {
+            0.9f, -0.3f, 0.2f, 0.1f,
+            0.4f, 1.1f, -0.5f, -0.2f,
+            -0.1f, 0.6f, 0.8f, 0.3f,
+            2.0f, -1.5f, 0.5f, 1.0f
+        };
+        return matrix;
+    }
+
+    static const float* GetQuaternion() noexcept
+    {
+        static const auto quaternion = Quaternion(0.3f, -0.5f, 0.2f, 0.7f).Normalized();
+        return &quaternion.x;
+    }
+
+    static void PrepareNonZero(float* input)
+    {
+        // Keep the vectors away from zero, whose normalization is undefined.
+        input[0] += std::copysign(0.5f, input[0]);
+    }
+
+    static void PrepareMatrix4x4(float* input)
+    {
+        // The dominant diagonal keeps the matrices well-conditioned.
+        for (size_t i = 0; i < 16; i += 5)
+        {
+            input[i] += 4.0f;
+        }
+    }
+
+    static void PrepareAffineMatrix4x4(float* input)
+    {
+        PrepareMatrix4x4(input);
+        input[3] = input[7] = input[11] = 0.0f;
+        input[15] = 1.0f;
+    }
+
+    static void PrepareMatrix3x4(float* input)
+    {
+        input[0] += 4.0f;
+        input[5] += 4.0f;
+        input[10] += 4.0f;
+    }
+
+    static void PrepareQuaternion(float* input)
+    {
+        const auto rotation = Quaternion(input[0], input[1], input[2], input[3] + 2.0f).Normalized();
+        Store(rotation, input);
+    }
+
+    static void MultiplyDouble(const std::array<double, 16>& lhs, const std::array<double, 16>& rhs, double* output)
+    {
+        for (size_t row = 0; row < 4; ++row)
+        {
+            TransformDouble(&lhs[row * 4], rhs, &output[row * 4]);
+        }
+    }
+
+    template <typename _Value>
+    static void TransformDouble(const _Value* vector, const std::array<double, 16>& matrix, double* output, size_t size = 4)
+    {
+        for (size_t column = 0; column < size; ++column)
+        {
+            output[column] = 0.0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                output[column] += static_cast<double>(vector[i]) * matrix[i * 4 + column];
+            }
+        }
+    }
+
+    static void TransformPointDouble(const float* input, double* output, double w)
+    {
+        const auto matrix = ToDoubles<16>(GetMatrix4x4());
+        const double vector[] = {input[0], input[1], input[2], w};
+        double transformed[4];
+        TransformDouble(vector, matrix, transformed);
+        std::copy(transformed, transformed + 3, output);
+    }
+
+    static void TransposeDouble(const float* input, double* output)
+    {
+        for (size_t i = 0; i < 16; ++i)
+        {
+            output[i] = input[(i % 4) * 4 + i / 4];
+        }
+    }
+
+    static void NormalizeDouble(const float* input, double* output)
+    {
+        const auto length = std::sqrt(static_cast<double>(input[0]) * input[0] + static_cast<double>(input[1]) * input[1] + static_cast<double>(input[2]) * input[2] + static_cast<double>(input[3]) * input[3]);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            output[i] = input[i] / length;
+        }
+    }
+
+    static void InverseDouble(const float* input, double* output)
+    {
+        std::array<std::array<double, 8>, 4> augmented{};
+        for (size_t row = 0; row < 4; ++row)
+        {
+            std::copy(&input[row * 4], &input[row * 4 + 4], augmented[row].begin());
+            augmented[row][4 + row] = 1.0;
+        }
+
+        // Gauss-Jordan elimination, which doesn't need pivoting for the dominant diagonals.
+        for (size_t column = 0; column < 4; ++column)
+        {
+            const auto divisor = augmented[column][column];
+            for (auto& value : augmented[column])
+            {
+                value /= divisor;
+            }
+
+            for (size_t row = 0; row < 4; ++row)
+            {
+                const auto factor = augmented[row][column];
+                for (size_t i = 0; row != column && i < 8; ++i)
+                {
+                    augmented[row][i] -= factor * augmented[column][i];
+                }
+            }
+        }
+
+        for (size_t row = 0; row < 4; ++row)
+        {
+            std::copy(&augmented[row][4], &augmented[row][8], &output[row * 4]);
+        }
+    }
+
+    static void InverseTransposeDouble(const float* input, double* output)
+    {
+        // The kernel drops the translation, so only the 3x3 part of the inverse is transposed.
+        double inverse[16];
+        InverseDouble(input, inverse);
+        for (size_t i = 0; i < 16; ++i)
+        {
+            const auto row = i / 4, column = i % 4;
+            output[i] = row < 3 && column < 3 ? inverse[column * 4 + row] : (row == column ? 1.0 : 0.0);
+        }
+    }
+
+    static std::array<double, 16> ExpandMatrix3x4(const float* input)
+    {
+        // The rows of Matrix3x4 are the columns of the equivalent Matrix4x4.
+        std::array<double, 16> ret{};
+        for (size_t row = 0; row < 4; ++row)
+        {
+            for (size_t column = 0; column < 3; ++column)
+            {
+                ret[row * 4 + column] = input[column * 4 + row];
+            }
+        }
+        ret[15] = 1.0;
+        return ret;
+    }
+
+    static void CompactMatrix4x4(const double* matrix, double* output)
+    {
+        for (size_t row = 0; row < 3; ++row)
+        {
+            for (size_t column = 0; column < 4; ++column)
+            {
+                output[row * 4 + column] = matrix[column * 4 + row];
+            }
+        }
+    }
+
+    static void MultiplyMatrix3x4Double(const float* input, double* output)
+    {
+        double product[16];
+        MultiplyDouble(ExpandMatrix3x4(input), ExpandMatrix3x4(input + 12), product);
+        CompactMatrix4x4(product, output);
+    }
+
+    static void InverseMatrix3x4Double(const float* input, double* output)
+    {
+        const auto expanded = ExpandMatrix3x4(input);
+        float matrix[16];
+        std::copy(expanded.begin(), expanded.end(), matrix);
+
+        double inverse[16];
+        InverseDouble(matrix, inverse);
+        CompactMatrix4x4(inverse, output);
+    }
+
+    static void MultiplyQuaternionDouble(const float* input, double* output)
+    {
+        const auto [x1, y1, z1, w1] = ToDoubles<4>(input);
+        const auto [x2, y2, z2, w2] = ToDoubles<4>(input + 4);
+        output[0] = w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2;
+        output[1] = w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2;
+        output[2] = w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2;
+        output[3] = w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2;
+    }
+
+    static std::array<double, 16> RotationDouble(const float* quaternion)
+    {
+        const auto [x, y, z, w] = ToDoubles<4>(quaternion);
+        return {
+            1.0 - 2.0 * (y * y + z * z), 2.0 * (x * y + w * z), 2.0 * (x * z - w * y), 0.0,
+            2.0 * (x * y - w * z), 1.0 - 2.0 * (x * x + z * z), 2.0 * (y * z + w * x), 0.0,
+            2.0 * (x * z + w * y), 2.0 * (y * z - w * x), 1.0 - 2.0 * (x * x + y * y), 0.0,
+            0.0, 0.0, 0.0, 1.0
+        };
+    }
+};
+
+} /* namespace tgon */
@@ -0,0 +1,38 @@
+// The tests are built on assert, so they must run in the release configuration as well.
+#undef NDEBUG
+
+#include <string_view>
+
+#include "FastMathBenchmark.h"
+#include "FastMathTest.h"
+#include "IntersectionTest.h"
+#include "MathBenchmark.h"
+#include "MathDifferentialTest.h"
+#include "Matrix3x4Test.h"
+#include "Matrix4x4Test.h"
+#include "PackedVectorTest.h"
+#include "QuaternionTest.h"
+#include "VectorKernelsTest.h"
+
+/**
+ * @brief   Runs the math tests, and the benchmarks as well if --benchmark is given.
+ */
+int main(int argc, char* argv[])
+{
+    tg::Matrix4x4Test().Evaluate();
+    tg::Matrix3x4Test().Evaluate();
+    tg::QuaternionTest().Evaluate();
+    tg::VectorKernelsTest().Evaluate();
+    tg::IntersectionTest().Evaluate();
+    tg::FastMathTest().Evaluate();
+    tg::PackedVectorTest().Evaluate();
+    tg::MathDifferentialTest().Evaluate();
+
+    if (argc > 1 && std::string_view(argv[1]) == "--benchmark")
+    {
+        tg::MathBenchmark().Evaluate();
+        tg::FastMathBenchmark().Evaluate();
+    }
+
+    return 0;
+}
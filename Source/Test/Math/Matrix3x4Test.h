@@ -0,0 +1,97 @@
+/**
+ * @file    Matrix3x4Test.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <random>
+#include <vector>
+
+#include "Math/Matrix3x4.h"
+#include "Math/VectorKernels.h"
+#include "Math/VectorKernelTable.h"
+
+#include "FastMathTest.h"
+#include "Matrix4x4Test.h"
+
+namespace tg
+{
+
+class Matrix3x4Test :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        std::mt19937 engine(17);
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+        std::vector<Matrix4x4> expandedMatrices;
+        std::vector<Matrix3x4> matrices;
+        for (int32_t i = 0; i < 64; ++i)
+        {
+            Matrix4x4 matrix;
+            for (int32_t j = 0; j < 16; ++j)
+            {
+                // The dominant diagonal keeps the matrices well-conditioned.
+                matrix[j] = distribution(engine) + ((j % 5 == 0) ? 4.0f : 0.0f);
+            }
+            matrix.m03 = matrix.m13 = matrix.m23 = 0.0f;
+            matrix.m30 *= 100.0f;
+            matrix.m31 *= 100.0f;
+            matrix.m32 *= 100.0f;
+            matrix.m33 = 1.0f;
+
+            expandedMatrices.push_back(matrix);
+            matrices.push_back(Matrix3x4(matrix));
+            assert(matrices.back().ToMatrix4x4() == matrix);
+        }
+
+        const Matrix4x4 viewProjection = Matrix4x4Test::MultiplyDouble(Matrix4x4::LookAtRH({1.0f, 2.0f, 3.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}), Matrix4x4::PerspectiveRH(1.0f, 1.5f, 0.1f, 100.0f));
+        for (size_t i = 0; i + 1 < matrices.size(); ++i)
+        {
+            const auto expectedProduct = Matrix4x4Test::MultiplyDouble(expandedMatrices[i], expandedMatrices[i + 1]);
+            assert(Matrix4x4Test::IsNearlyEqual(expectedProduct, (matrices[i] * matrices[i + 1]).ToMatrix4x4(), 1e-5));
+            assert(Matrix4x4Test::IsNearlyEqual(Matrix4x4Test::InverseDouble(expandedMatrices[i]), Matrix3x4::Inverse(matrices[i]).ToMatrix4x4(), 1e-5));
+            assert(Matrix4x4Test::IsNearlyEqual(Matrix4x4Test::MultiplyDouble(expandedMatrices[i], viewProjection), matrices[i] * viewProjection, 1e-5));
+
+            const Vector3 point(distribution(engine), distribution(engine), distribution(engine));
+            const Vector3 transformed = matrices[i].TransformPoint(point);
+            const auto expected = Vector4(point.x, point.y, point.z, 1.0f) * expandedMatrices[i];
+            assert(std::abs(transformed.x - expected.x) < 1e-3f && std::abs(transformed.y - expected.y) < 1e-3f && std::abs(transformed.z - expected.z) < 1e-3f);
+        }
+
+        auto translation = Matrix3x4::Translate(1.0f, 2.0f, 3.0f);
+        translation *= Matrix3x4::Scale(2.0f, 2.0f, 2.0f);
+        assert(translation.GetTranslation() == Vector3(2.0f, 4.0f, 6.0f) && translation.TransformDirection({1.0f, 0.0f, 0.0f}) == Vector3(2.0f, 0.0f, 0.0f));
+
+        // Every batch kernel must match the double precision reference as well, including in place.
+        std::vector<Matrix3x4> destMatrices(matrices.size());
+        for (const auto* table : FastMathTest::GetSupportedTables())
+        {
+            table->multiplyMatrix3x4s(&matrices[0].m00, &matrices[1].m00, &destMatrices[0].m00, matrices.size() - 1);
+            for (size_t i = 0; i + 1 < matrices.size(); ++i)
+            {
+                const auto expected = Matrix4x4Test::MultiplyDouble(expandedMatrices[i], expandedMatrices[i + 1]);
+                assert(Matrix4x4Test::IsNearlyEqual(expected, destMatrices[i].ToMatrix4x4(), 1e-5));
+            }
+
+            destMatrices = matrices;
+            table->inverseMatrix3x4s(&destMatrices[0].m00, &destMatrices[0].m00, destMatrices.size());
+            for (size_t i = 0; i < matrices.size(); ++i)
+            {
+                assert(Matrix4x4Test::IsNearlyEqual(Matrix4x4Test::InverseDouble(expandedMatrices[i]), destMatrices[i].ToMatrix4x4(), 1e-5));
+            }
+        }
+
+        VectorKernels::Multiply(matrices, matrices, destMatrices);
+        assert(Matrix4x4Test::IsNearlyEqual((matrices[3] * matrices[3]).ToMatrix4x4(), destMatrices[3].ToMatrix4x4(), 1e-5));
+        VectorKernels::Inverse(matrices, destMatrices);
+        assert(Matrix4x4Test::IsNearlyEqual(Matrix3x4::Inverse(matrices[5]).ToMatrix4x4(), destMatrices[5].ToMatrix4x4(), 1e-5));
+    }
+};
+
+} /* namespace tgon */
@@ -0,0 +1,201 @@
+/**
+ * @file    Matrix4x4Test.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Math/Matrix4x4.h"
+#include "Math/VectorKernels.h"
+#include "Math/VectorKernelTable.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class Matrix4x4Test :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        std::mt19937 engine(11);
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+        std::vector<Matrix4x4> generalMatrices;
+        std::vector<Matrix4x4> affineMatrices;
+        for (int32_t i = 0; i < 64; ++i)
+        {
+            Matrix4x4 matrix;
+            for (int32_t j = 0; j < 16; ++j)
+            {
+                // The dominant diagonal keeps the matrices well-conditioned.
+                matrix[j] = distribution(engine) + ((j % 5 == 0) ? 4.0f : 0.0f);
+            }
+            generalMatrices.push_back(matrix);
+
+            matrix.m03 = matrix.m13 = matrix.m23 = 0.0f;
+            matrix.m30 *= 100.0f;
+            matrix.m31 *= 100.0f;
+            matrix.m32 *= 100.0f;
+            matrix.m33 = 1.0f;
+            affineMatrices.push_back(matrix);
+        }
+
+        for (size_t i = 0; i < generalMatrices.size(); ++i)
+        {
+            const auto expected = InverseDouble(generalMatrices[i]);
+            assert(IsNearlyEqual(expected, Matrix4x4::Inverse(generalMatrices[i]), 1e-5));
+
+            const auto expectedAffine = InverseDouble(affineMatrices[i]);
+            assert(IsNearlyEqual(expectedAffine, Matrix4x4::AffineInverse(affineMatrices[i]), 1e-5));
+            assert(IsNearlyEqual(expectedAffine, Matrix4x4::Inverse(affineMatrices[i]), 1e-5));
+
+            auto expectedInverseTranspose = Matrix4x4::Transposed(expectedAffine);
+            expectedInverseTranspose.m03 = expectedInverseTranspose.m13 = expectedInverseTranspose.m23 = 0.0f;
+            assert(IsNearlyEqual(expectedInverseTranspose, Matrix4x4::InverseTranspose(affineMatrices[i]), 1e-5));
+        }
+
+        // Every batch kernel must match the double precision reference as well.
+        std::vector<Matrix4x4> destMatrices(generalMatrices.size());
+        for (auto level : {SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Sse41, SimdLevel::Avx2, SimdLevel::Neon})
+        {
+            const auto* table = GetVectorKernelTable(level);
+            if (table == nullptr || CpuFeature::IsSupported(level) == false)
+            {
+                continue;
+            }
+
+            table->inverseMatrix4x4s(&generalMatrices[0].m00, &destMatrices[0].m00, generalMatrices.size());
+            for (size_t i = 0; i < generalMatrices.size(); ++i)
+            {
+                assert(IsNearlyEqual(InverseDouble(generalMatrices[i]), destMatrices[i], 1e-5));
+            }
+
+            table->affineInverseMatrix4x4s(&affineMatrices[0].m00, &destMatrices[0].m00, affineMatrices.size());
+            for (size_t i = 0; i < affineMatrices.size(); ++i)
+            {
+                assert(IsNearlyEqual(InverseDouble(affineMatrices[i]), destMatrices[i], 1e-5));
+            }
+
+            table->inverseTransposeMatrix4x4s(&affineMatrices[0].m00, &destMatrices[0].m00, affineMatrices.size());
+            for (size_t i = 0; i < affineMatrices.size(); ++i)
+            {
+                assert(IsNearlyEqual(Matrix4x4::InverseTranspose(affineMatrices[i]), destMatrices[i], 1e-5));
+            }
+        }
+
+        VectorKernels::Inverse(generalMatrices, destMatrices);
+        assert(IsNearlyEqual(InverseDouble(generalMatrices.back()), destMatrices.back(), 1e-5));
+
+        const auto rotation = Matrix4x4::RotateY(0.7f);
+        const auto transform = MultiplyDouble(MultiplyDouble(Matrix4x4::Scale(-2.0f, 3.0f, 0.5f), rotation), Matrix4x4::Translate(1.0f, 2.0f, 3.0f));
+
+        Vector3 translation, scale;
+        Matrix4x4 decomposedRotation;
+        assert(Matrix4x4::Decompose(transform, translation, decomposedRotation, scale));
+        assert(translation == Vector3(1.0f, 2.0f, 3.0f));
+        assert(std::abs(scale.x + 2.0f) < 1e-5f && std::abs(scale.y - 3.0f) < 1e-5f && std::abs(scale.z - 0.5f) < 1e-5f);
+        assert(IsNearlyEqual(rotation, decomposedRotation, 1e-5));
+        assert(Matrix4x4::Decompose(Matrix4x4::Scale(1.0f, 0.0f, 1.0f), translation, decomposedRotation, scale) == false);
+    }
+
+public:
+    static Matrix4x4 InverseDouble(const Matrix4x4& matrix)
+    {
+        std::array<std::array<double, 8>, 4> augmented{};
+        for (int32_t row = 0; row < 4; ++row)
+        {
+            for (int32_t column = 0; column < 4; ++column)
+            {
+                augmented[row][column] = matrix[row * 4 + column];
+            }
+            augmented[row][4 + row] = 1.0;
+        }
+
+        // Gauss-Jordan elimination with partial pivoting.
+        for (int32_t column = 0; column < 4; ++column)
+        {
+            auto pivot = column;
+            for (int32_t row = column + 1; row < 4; ++row)
+            {
+                if (std::abs(augmented[row][column]) > std::abs(augmented[pivot][column]))
+                {
+                    pivot = row;
+                }
+            }
+            std::swap(augmented[column], augmented[pivot]);
+
+            const auto divisor = augmented[column][column];
+            for (auto& value : augmented[column])
+            {
+                value /= divisor;
+            }
+
+            for (int32_t row = 0; row < 4; ++row)
+            {
+                if (row == column)
+                {
+                    continue;
+                }
+
+                const auto factor = augmented[row][column];
+                for (int32_t i = 0; i < 8; ++i)
+                {
+                    augmented[row][i] -= factor * augmented[column][i];
+                }
+            }
+        }
+
+        Matrix4x4 ret;
+        for (int32_t row = 0; row < 4; ++row)
+        {
+            for (int32_t column = 0; column < 4; ++column)
+            {
+                ret[row * 4 + column] = static_cast<float>(augmented[row][4 + column]);
+            }
+        }
+        return ret;
+    }
+
+    static Matrix4x4 MultiplyDouble(const Matrix4x4& lhs, const Matrix4x4& rhs)
+    {
+        Matrix4x4 ret;
+        for (int32_t row = 0; row < 4; ++row)
+        {
+            for (int32_t column = 0; column < 4; ++column)
+            {
+                double sum = 0.0;
+                for (int32_t i = 0; i < 4; ++i)
+                {
+                    sum += static_cast<double>(lhs[row * 4 + i]) * rhs[i * 4 + column];
+                }
+                ret[row * 4 + column] = static_cast<float>(sum);
+            }
+        }
+        return ret;
+    }
+
+    static bool IsNearlyEqual(const Matrix4x4& expected, const Matrix4x4& actual, double tolerance)
+    {
+        for (int32_t i = 0; i < 16; ++i)
+        {
+            if (std::abs(expected[i] - actual[i]) > tolerance * std::max(1.0, std::abs(static_cast<double>(expected[i]))))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} /* namespace tgon */
@@ -0,0 +1,176 @@
+/**
+ * @file    PackedVectorTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "Math/Half.h"
+#include "Math/PackedVector.h"
+#include "Math/VectorKernels.h"
+#include "Math/VectorKernelTable.h"
+
+#include "FastMathTest.h"
+
+namespace tg
+{
+
+class PackedVectorTest :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        assert(Half(1.0f).bits == 0x3C00 && Half(-2.0f).bits == 0xC000 && Half(65504.0f).bits == 0x7BFF);
+        assert(Half(65520.0f).bits == 0x7C00 && Half(1e-8f).bits == 0 && Half(5.96046448e-8f).bits == 1);
+        assert(std::isnan(static_cast<float>(Half(NAN))) && Half(0.1f) == Half::FromBits(0x2E66));
+
+        // The float of every half converts back to the same bits, and the ties round to the nearest even.
+        for (uint32_t bits = 0; bits <= 0xFFFF; ++bits)
+        {
+            const auto half = Half::FromBits(static_cast<uint16_t>(bits));
+            const float value = half;
+            assert(std::isnan(value) || Half(value).bits == bits);
+        }
+        assert(Half(1.0f + 1.0f / 2048.0f).bits == 0x3C00 && Half(1.0f + 3.0f / 2048.0f).bits == 0x3C02);
+
+        const auto tables = FastMathTest::GetSupportedTables();
+        this->EvaluateHalves(tables);
+        this->EvaluateNormals(tables);
+        this->EvaluatePositions(tables);
+        this->EvaluateColors(tables);
+    }
+
+private:
+    void EvaluateHalves(const std::vector<const VectorKernelTable*>& tables)
+    {
+        std::vector<uint16_t> halves(0x10000 + 3);
+        for (size_t i = 0; i < halves.size(); ++i)
+        {
+            halves[i] = static_cast<uint16_t>(i);
+        }
+
+        // Mix the floats which lie on the halves, the ties and the others, and leave a tail for every lane width.
+        std::mt19937 random(7);
+        std::vector<float> values(halves.size() * 2);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            const auto bits = static_cast<uint32_t>(random());
+            values[i] = i % 2 == 0 ? std::bit_cast<float>(bits) : Half::ConvertToFloat(static_cast<uint16_t>(bits)) * (1.0f + 1.0f / 2048.0f);
+        }
+
+        std::vector<float> floats(halves.size());
+        std::vector<uint16_t> results(values.size());
+        for (const auto* table : tables)
+        {
+            table->halvesToFloats(halves.data(), floats.data(), halves.size());
+            for (size_t i = 0; i < halves.size(); ++i)
+            {
+                const auto expected = Half::ConvertToFloat(halves[i]);
+                assert(std::bit_cast<uint32_t>(floats[i]) == std::bit_cast<uint32_t>(expected) || (std::isnan(floats[i]) && std::isnan(expected)));
+            }
+
+            table->floatsToHalves(values.data(), results.data(), values.size());
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                assert(results[i] == Half::ConvertFromFloat(values[i]) || (std::isnan(values[i]) && std::isnan(Half::ConvertToFloat(results[i]))));
+            }
+        }
+    }
+
+    void EvaluateNormals(const std::vector<const VectorKernelTable*>& tables)
+    {
+        std::mt19937 random(11);
+        std::normal_distribution<float> distribution;
+        std::vector<Vector3> normals(1027);
+        for (auto& normal : normals)
+        {
+            normal = Vector3(distribution(random), distribution(random), distribution(random)).Normalized();
+        }
+        normals[0] = Vector3(0.0f, 0.0f, -1.0f);
+        normals[1] = Vector3(-1.0f, 0.0f, 0.0f);
+
+        std::vector<OctahedralNormal> results(normals.size());
+        for (const auto* table : tables)
+        {
+            table->encodeOctahedralNormals(&normals[0].x, &results[0].x, normals.size());
+            for (size_t i = 0; i < normals.size(); ++i)
+            {
+                const OctahedralNormal expected(normals[i]);
+                assert(results[i].x == expected.x && results[i].y == expected.y);
+
+                // The chord of 0.005 degrees, because the cosine of the angle is too close to 1 for the floats.
+                const Vector3 error = expected.Decode() - normals[i];
+                assert(error.Length() <= 2.0f * std::sin(0.0025f * Mathf::Deg2Rad));
+            }
+        }
+    }
+
+    void EvaluatePositions(const std::vector<const VectorKernelTable*>& tables)
+    {
+        const AABB bounds({-3.0f, 0.0f, 2.0f}, {5.0f, 0.0f, 10.0f});
+        std::mt19937 random(13);
+        std::uniform_real_distribution<float> distribution(-4.0f, 11.0f);
+        std::vector<Vector3> positions(1027);
+        for (auto& position : positions)
+        {
+            position = Vector3(distribution(random), distribution(random), distribution(random));
+        }
+
+        std::vector<QuantizedPosition> results(positions.size());
+        const auto dequantization = QuantizedPosition::GetDequantizationMatrix(bounds);
+        for (const auto* table : tables)
+        {
+            const auto center = bounds.GetCenter();
+            const auto scale = QuantizedPosition::GetQuantizationScale(bounds);
+            const float transform[] = {center.x, center.y, center.z, scale.x, scale.y, scale.z};
+            table->quantizePositions(transform, &positions[0].x, &results[0].x, positions.size());
+            for (size_t i = 0; i < positions.size(); ++i)
+            {
+                const QuantizedPosition expected(positions[i], bounds);
+                assert(results[i].x == expected.x && results[i].y == expected.y && results[i].z == expected.z);
+                assert(results[i].y == 0 && results[i].w == 0);
+
+                // The positions in the bounds are restored within a step, either by the CPU or by the matrix.
+                const Vector3 clamped(std::clamp(positions[i].x, -3.0f, 5.0f), 0.0f, std::clamp(positions[i].z, 2.0f, 10.0f));
+                const Vector3 dequantized = expected.Dequantize(bounds);
+                const auto transformed = Vector4(expected.x / 32767.0f, expected.y / 32767.0f, expected.z / 32767.0f, 1.0f) * dequantization;
+                assert(std::abs(dequantized.x - clamped.x) <= 4.0f / 32767.0f && std::abs(dequantized.z - clamped.z) <= 4.0f / 32767.0f);
+                assert(std::abs(transformed.x - dequantized.x) <= 1e-5f && std::abs(transformed.z - dequantized.z) <= 1e-5f && transformed.y == 0.0f);
+            }
+        }
+    }
+
+    void EvaluateColors(const std::vector<const VectorKernelTable*>& tables)
+    {
+        std::vector<Color> colors;
+        for (int32_t i = 0; i < 300; ++i)
+        {
+            colors.push_back(Color(i / 255.0f, 1.0f - i / 255.0f, i * 0.01f - 1.0f, 0.5f));
+        }
+
+        std::vector<Color32> results(colors.size());
+        for (const auto* table : tables)
+        {
+            table->floatsToUnorm8s(&colors[0].r, &results[0].r, colors.size() * 4);
+            for (size_t i = 0; i < colors.size(); ++i)
+            {
+                assert(results[i] == colors[i].ToColor32());
+            }
+        }
+
+        assert(Color(1.0f, 0.0f, 2.0f, -1.0f).ToColor32() == Color32(255, 0, 255, 0) && Color(0.5f, 0.5f, 0.5f, 0.5f).ToColor32().r == 128);
+
+        VectorKernels::Convert(colors, results);
+        assert(results[100] == colors[100].ToColor32());
+    }
+};
+
+} /* namespace tgon */
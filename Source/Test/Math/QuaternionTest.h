@@ -0,0 +1,105 @@
+/**
+ * @file    QuaternionTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
+#include "Math/Vector4.h"
+#include "Math/VectorKernels.h"
+#include "Math/VectorKernelTable.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class QuaternionTest :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        const auto q1 = Quaternion::Euler(0.3f, -1.1f, 2.0f);
+        const auto q2 = Quaternion::AxisAngle(Vector3(0.0f, 0.6f, 0.8f), 0.9f);
+
+        // Euler must rotate the same way as Matrix4x4::Rotate, and the matrix conversion must round trip.
+        assert(IsNearlyEqual(Matrix4x4::Rotate(0.3f, -1.1f, 2.0f), q1.ToMatrix(), 1e-5f));
+        assert(IsNearlyEqual(q1.ToMatrix(), Quaternion::FromMatrix(q1.ToMatrix()).ToMatrix(), 1e-5f));
+        assert(IsNearlyEqual(Matrix4x4::RotateZ(3.0f), Quaternion::FromMatrix(Matrix4x4::RotateZ(3.0f)).ToMatrix(), 1e-5f));
+
+        const auto eulerAngles = q1.ToEulerAngles();
+        assert(IsNearlyEqual(q1.ToMatrix(), Quaternion::Euler(eulerAngles.x, eulerAngles.y, eulerAngles.z).ToMatrix(), 1e-5f));
+
+        // q1 * q2 applies q2 first, which is q2's matrix followed by q1's matrix in the row vector convention.
+        const Vector3 v(1.0f, -2.0f, 0.5f);
+        const auto rotated = (q1 * q2).Rotate(v);
+        const auto expected = Vector4(v.x, v.y, v.z, 0.0f) * q2.ToMatrix() * q1.ToMatrix();
+        assert(IsNearlyEqual(rotated, Vector3(expected.x, expected.y, expected.z), 1e-5f));
+        assert(IsNearlyEqual(q1 * v, q1.Rotate(v), 1e-6f));
+        assert(IsNearlyEqual((q1 * q1.Inverse()).Rotate(v), v, 1e-5f));
+
+        // The interpolations must hit both ends and agree at the midpoint, where the angular velocity doesn't matter.
+        assert(std::abs(Quaternion::Dot(Quaternion::SLerp(q1, q2, 0.0f), q1)) > 0.99999f);
+        assert(std::abs(Quaternion::Dot(Quaternion::SLerp(q1, q2, 1.0f), q2)) > 0.99999f);
+        assert(std::abs(Quaternion::Dot(Quaternion::NLerp(q1, -q2, 1.0f), q2)) > 0.99999f);
+        assert(std::abs(Quaternion::Dot(Quaternion::SLerp(q1, q2, 0.5f), Quaternion::NLerp(q1, q2, 0.5f))) > 0.99999f);
+        assert(std::abs(Quaternion::SLerp(q1, q2, 0.3f).Length() - 1.0f) < 1e-5f);
+
+        std::mt19937 engine(5);
+        std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+        std::vector<Vector3> srcVectors(37);
+        for (auto& srcVector : srcVectors)
+        {
+            srcVector = Vector3(distribution(engine), distribution(engine), distribution(engine));
+        }
+
+        // The count isn't a multiple of the SIMD width, so the tail is covered as well.
+        std::vector<Vector3> destVectors(srcVectors.size());
+        for (auto level : {SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Sse41, SimdLevel::Avx2, SimdLevel::Neon})
+        {
+            const auto* table = GetVectorKernelTable(level);
+            if (table == nullptr || CpuFeature::IsSupported(level) == false)
+            {
+                continue;
+            }
+
+            table->rotateVector3s(&q1.x, &srcVectors[0].x, &destVectors[0].x, srcVectors.size());
+            for (size_t i = 0; i < srcVectors.size(); ++i)
+            {
+                assert(IsNearlyEqual(q1.Rotate(srcVectors[i]), destVectors[i], 1e-4f));
+            }
+        }
+
+        VectorKernels::Rotate(q2, srcVectors, destVectors);
+        assert(IsNearlyEqual(q2.Rotate(srcVectors.back()), destVectors.back(), 1e-4f));
+    }
+
+private:
+    static bool IsNearlyEqual(const Matrix4x4& expected, const Matrix4x4& actual, float tolerance)
+    {
+        for (int32_t i = 0; i < 16; ++i)
+        {
+            if (std::abs(expected[i] - actual[i]) > tolerance)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool IsNearlyEqual(const Vector3& expected, const Vector3& actual, float tolerance)
+    {
+        return std::abs(expected.x - actual.x) <= tolerance && std::abs(expected.y - actual.y) <= tolerance && std::abs(expected.z - actual.z) <= tolerance;
+    }
+};
+
+} /* namespace tgon */
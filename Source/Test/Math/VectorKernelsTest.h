@@ -0,0 +1,213 @@
+/**
+ * @file    VectorKernelsTest.h
+ * @author  ggomdyu
+ * @since   10/19/2026
+ */
+
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "Core/Simd.h"
+#include "Math/VectorKernels.h"
+#include "Math/VectorKernelTable.h"
+
+#include "../Test.h"
+
+namespace tg
+{
+
+class VectorKernelsTest :
+    public Test
+{
+/**@section Method */
+public:
+    void Evaluate() override
+    {
+        this->EvaluateSimd();
+
+        // The odd count leaves a tail for the 8-wide kernels.
+        constexpr size_t count = 37;
+        std::mt19937 engine(7);
+        std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+        auto makeVectors = [&]()
+        {
+            std::vector<float> vectors(count * 4);
+            for (auto& value : vectors)
+            {
+                value = distribution(engine);
+            }
+            return vectors;
+        };
+        const auto matrix = makeVectors();
+        const auto from = makeVectors();
+        const auto to = makeVectors();
+
+        const auto* scalarTable = GetVectorKernelTable(SimdLevel::Scalar);
+        std::vector<float> expected(count * 4);
+        std::vector<float> actual(count * 4);
+        for (auto level : {SimdLevel::Sse2, SimdLevel::Sse41, SimdLevel::Avx2, SimdLevel::Neon})
+        {
+            const auto* table = GetVectorKernelTable(level);
+            if (table == nullptr || CpuFeature::IsSupported(level) == false)
+            {
+                continue;
+            }
+            assert(table->level == level);
+
+            scalarTable->transformVector4s(matrix.data(), from.data(), expected.data(), count);
+            table->transformVector4s(matrix.data(), from.data(), actual.data(), count);
+            assert(IsNearlyEqual(expected, actual, 1e-3f));
+
+            scalarTable->normalizeVector4s(from.data(), expected.data(), count);
+            table->normalizeVector4s(from.data(), actual.data(), count);
+            assert(IsNearlyEqual(expected, actual, 1e-5f));
+
+            scalarTable->lerpVector4s(from.data(), to.data(), 0.3f, expected.data(), count);
+            table->lerpVector4s(from.data(), to.data(), 0.3f, actual.data(), count);
+            assert(IsNearlyEqual(expected, actual, 1e-5f));
+
+            this->EvaluateVector3s(*scalarTable, *table, matrix, from, to);
+        }
+
+        assert(CpuFeature::IsSupported(VectorKernels::GetSimdLevel()));
+
+        std::vector<Vector4> vectors(count, Vector4(1.0f, 2.0f, 3.0f, 1.0f));
+        VectorKernels::Transform(Matrix4x4::Translate(1.0f, 2.0f, 3.0f), vectors, vectors);
+        assert(vectors.back() == Vector4(2.0f, 4.0f, 6.0f, 1.0f));
+        assert(vectors.back() * Matrix4x4::Scale(2.0f, 2.0f, 2.0f) == Vector4(4.0f, 8.0f, 12.0f, 1.0f));
+        static_assert(Vector4(1.0f, 2.0f, 3.0f, 1.0f) * Matrix4x4() == Vector4(1.0f, 2.0f, 3.0f, 1.0f));
+
+        std::vector<Vector3> points = {{1.0f, -2.0f, 3.0f}, {-4.0f, 5.0f, 0.5f}, {2.0f, 7.0f, -6.0f}};
+        VectorKernels::TransformPoints(Matrix4x4::Translate(1.0f, 2.0f, 3.0f), points, points);
+        assert(points[0] == Vector3(2.0f, 0.0f, 6.0f));
+        VectorKernels::TransformDirections(Matrix4x4::Translate(1.0f, 2.0f, 3.0f), points, points);
+        assert(points[0] == Vector3(2.0f, 0.0f, 6.0f));
+
+        Vector3 min, max;
+        VectorKernels::MinMax(points, min, max);
+        assert(min == Vector3(-3.0f, 0.0f, -3.0f) && max == Vector3(3.0f, 9.0f, 6.0f));
+
+        std::vector<float> xs(points.size()), ys(points.size()), zs(points.size());
+        VectorKernels::Split(points, Vector3SoA(xs, ys, zs));
+        VectorKernels::MinMax(Vector3SoA(xs, ys, zs), min, max);
+        assert(min == Vector3(-3.0f, 0.0f, -3.0f) && max == Vector3(3.0f, 9.0f, 6.0f));
+
+        std::vector<Color> colors(count);
+        VectorKernels::Lerp(std::vector<Color>(count, Color::Black()), std::vector<Color>(count, Color::White()), 2.0f, colors);
+        assert(colors.front() == Color::White() && colors.back() == Color::White());
+    }
+
+private:
+    void EvaluateSimd()
+    {
+        const float lhs[4] = {1.0f, -2.0f, 3.0f, -4.0f};
+        const float rhs[4] = {0.5f, 4.0f, -1.0f, 2.0f};
+        const auto a = Float4::Load(lhs);
+        const auto b = Float4::Load(rhs);
+
+        float ret[4];
+        Float4::MultiplyAdd(a, b, a).Store(ret);
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            assert(ret[i] == lhs[i] * rhs[i] + lhs[i]);
+        }
+
+        Float4::Select(Float4::CompareLess(a, b), a, b).Store(ret);
+        assert(ret[0] == 0.5f && ret[1] == -2.0f && ret[2] == -1.0f && ret[3] == -4.0f);
+        assert(Float4::CompareLess(a, b).GetSignMask() == 0b1010);
+        assert((a.Shuffle<3, 2, 1, 0>().GetX() == -4.0f));
+        assert(Float4::Dot(a, b) == -18.5f && Float4::Abs(a).HorizontalSum() == 10.0f);
+
+        int32_t lanes[4];
+        (Int4::Set(3, -5, 65537, 7) * Int4::Set(4, 6, 65537, -1)).Store(lanes);
+        assert(lanes[0] == 12 && lanes[1] == -30 && lanes[2] == static_cast<int32_t>(65537u * 65537u) && lanes[3] == -7);
+        assert(Int4::Max(Int4::Splat(-1), Int4::Zero()).GetX() == 0 && Int4::Splat(-8).ShiftRightArithmetic<1>().GetX() == -4);
+        assert(Int4::Splat(-8).ShiftRightLogical<28>().GetX() == 15 && Float4::Splat(2.9f).ToInt4().ToFloat4().GetX() == 2.0f);
+
+        float wide[8];
+        Float8::Max(Float8::Splat(1.0f), Float8::Load(std::vector<float>{0, 1, 2, 3, 4, 5, 6, 7}.data())).Store(wide);
+        assert(wide[0] == 1.0f && wide[7] == 7.0f);
+        assert(Float8::CompareLess(Float8::Zero(), Float8::Splat(-1.0f)).GetSignMask() == 0);
+    }
+
+    void EvaluateVector3s(const VectorKernelTable& scalarTable, const VectorKernelTable& table, const std::vector<float>& matrix, const std::vector<float>& from, const std::vector<float>& to)
+    {
+        // The arrays hold 148 floats, which cover 49 packed Vector3 and 49 SoA vectors with a tail for every lane width.
+        constexpr size_t count = 49;
+        const ConstFloat3Arrays lhs{&from[0], &from[count], &from[count * 2]};
+        const ConstFloat3Arrays rhs{&to[0], &to[count], &to[count * 2]};
+
+        std::vector<float> expected(count * 3);
+        std::vector<float> actual(count * 3);
+        const Float3Arrays expectedArrays{&expected[0], &expected[count], &expected[count * 2]};
+        const Float3Arrays actualArrays{&actual[0], &actual[count], &actual[count * 2]};
+
+        scalarTable.transformPointVector3s(matrix.data(), from.data(), expected.data(), count);
+        table.transformPointVector3s(matrix.data(), from.data(), actual.data(), count);
+        assert(IsNearlyEqual(expected, actual, 1e-4f));
+
+        scalarTable.transformDirectionVector3s(matrix.data(), from.data(), expected.data(), count);
+        table.transformDirectionVector3s(matrix.data(), from.data(), actual.data(), count);
+        assert(IsNearlyEqual(expected, actual, 1e-4f));
+
+        scalarTable.transformPoints(matrix.data(), lhs, expectedArrays, count);
+        table.transformPoints(matrix.data(), lhs, actualArrays, count);
+        assert(IsNearlyEqual(expected, actual, 1e-4f));
+
+        scalarTable.transformDirections(matrix.data(), lhs, expectedArrays, count);
+        table.transformDirections(matrix.data(), lhs, actualArrays, count);
+        assert(IsNearlyEqual(expected, actual, 1e-4f));
+
+        scalarTable.crossVector3s(lhs, rhs, expectedArrays, count);
+        table.crossVector3s(lhs, rhs, actualArrays, count);
+        assert(IsNearlyEqual(expected, actual, 1e-4f));
+
+        scalarTable.normalizeVector3s(lhs, expectedArrays, count);
+        table.normalizeVector3s(lhs, actualArrays, count);
+        assert(IsNearlyEqual(expected, actual, 1e-5f));
+
+        table.splitVector3s(from.data(), actualArrays, count);
+        scalarTable.mergeVector3s({actualArrays.xs, actualArrays.ys, actualArrays.zs}, expected.data(), count);
+        assert(std::equal(expected.begin(), expected.end(), from.begin()));
+        scalarTable.splitVector3s(from.data(), expectedArrays, count);
+        table.mergeVector3s({expectedArrays.xs, expectedArrays.ys, expectedArrays.zs}, actual.data(), count);
+        assert(std::equal(actual.begin(), actual.end(), from.begin()));
+
+        expected.resize(count);
+        actual.resize(count);
+        scalarTable.dotVector3s(lhs, rhs, expected.data(), count);
+        table.dotVector3s(lhs, rhs, actual.data(), count);
+        assert(IsNearlyEqual(expected, actual, 1e-4f));
+
+        scalarTable.lerpFloats(from.data(), to.data(), 0.7f, expected.data(), count);
+        table.lerpFloats(from.data(), to.data(), 0.7f, actual.data(), count);
+        assert(IsNearlyEqual(expected, actual, 1e-5f));
+
+        float expectedMinMax[6], actualMinMax[6];
+        scalarTable.minMaxVector3s(from.data(), count, &expectedMinMax[0], &expectedMinMax[3]);
+        table.minMaxVector3s(from.data(), count, &actualMinMax[0], &actualMinMax[3]);
+        assert(std::equal(std::begin(expectedMinMax), std::end(expectedMinMax), actualMinMax));
+
+        scalarTable.minMaxFloats(from.data(), from.size() - 1, &expectedMinMax[0], &expectedMinMax[1]);
+        table.minMaxFloats(from.data(), from.size() - 1, &actualMinMax[0], &actualMinMax[1]);
+        assert(expectedMinMax[0] == actualMinMax[0] && expectedMinMax[1] == actualMinMax[1]);
+    }
+
+    static bool IsNearlyEqual(const std::vector<float>& expected, const std::vector<float>& actual, float tolerance)
+    {
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            if (std::abs(expected[i] - actual[i]) > tolerance * std::max(1.0f, std::abs(expected[i])))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} /* namespace tgon */
@@ -5,6 +5,8 @@
 #include <unicode/unistr.h>
 #include <unicode/utypes.h>
 
+#include "Core/MemoryResource.h"
+
 #include "Encoding.h"
 
 extern const UConverterSharedData* getAlgorithmicTypeFromName(const char* realName);
@@ -13,7 +15,7 @@ extern const UConverterSharedData* getAlgorithmicTypeFromCodePage(int32_t codePa
 namespace tg
 {
 
-std::unordered_map<int32_t, Encoding> Encoding::m_encodingTable;
+std::pmr::unordered_map<int32_t, Encoding> Encoding::m_encodingTable(TrackingMemoryResource::GetInstance(MemoryTag::Text));
 
 Encoding::Encoding(const char8_t* codePageName) :
     Encoding(CreateUConverter(codePageName))
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory_resource>
 #include <span>
 #include <string>
 #include <unordered_map>
@@ -67,7 +68,7 @@ private:
 private:
     UConverter* m_converter = nullptr;
     std::u8string_view m_encodingName;
-    static std::unordered_map<int32_t, Encoding> m_encodingTable;
+    static std::pmr::unordered_map<int32_t, Encoding> m_encodingTable;
 };
 
 }
@@ -1,26 +1,31 @@
 #include "PrecompiledHeader.h"
 
+#include "Core/FrameAllocator.h"
+
 #include "DispatchQueue.h"
 #include "Thread.h"
 
 namespace tg
 {
-    
-void SerialDispatchQueue::AddAsyncTask(const Delegate<void()>& task)
+
+void DispatchQueue::PushTask(Task&& task)
 {
-    std::lock_guard lock(m_mutex);
+    if (m_taskPool.IsFull())
+    {
+        m_taskPool.Reserve(std::max(m_taskPool.GetCapacity() * 2, InitialTaskPoolCapacity));
+    }
 
-    m_taskPool.push_back(task);
+    m_taskPool.PushBack(std::move(task));
 }
 
-void SerialDispatchQueue::AddAsyncTask(Delegate<void()>&& task)
+void SerialDispatchQueue::AddAsyncTask(Task task)
 {
     std::lock_guard lock(m_mutex);
 
-    m_taskPool.push_back(std::move(task));
+    this->PushTask(std::move(task));
 }
 
-void SerialDispatchQueue::AddSyncTask(const Delegate<void()>& task)
+void SerialDispatchQueue::AddSyncTask(Task task)
 {
     if (Thread::IsMainThread(std::this_thread::get_id()))
     {
@@ -28,43 +33,31 @@ void SerialDispatchQueue::AddSyncTask(const Delegate<void()>& task)
     }
     else
     {
+        // The caller waits until the task is executed, so the wrapper only has to refer to the task.
         bool isTaskExecuted = false;
-        this->AddAsyncTask([&, task]()
+        this->AddAsyncTask([&isTaskExecuted, &task]()
         {
             task();
             isTaskExecuted = true;
         });
+
         while (isTaskExecuted == false);
     }
 }
 
-void SerialDispatchQueue::AddSyncTask(Delegate<void()>&& task)
+void SerialDispatchQueue::Dispatch()
 {
-    if (Thread::IsMainThread(std::this_thread::get_id()))
-    {
-        task();
-    }
-    else
     {
-        bool isTaskExecuted = false;
-        this->AddAsyncTask([&isTaskExecuted, task = std::move(task)]()
-        {
-            task();
-            isTaskExecuted = true;
-        });
-
-        while (isTaskExecuted == false);
+        std::lock_guard lock(m_mutex);
+        std::swap(m_taskPool, m_dispatchingTaskPool);
     }
-}
 
-void SerialDispatchQueue::Dispatch()
-{
-    for (auto& task : m_taskPool)
+    // The tasks which are added while dispatching are executed on the next dispatch.
+    while (m_dispatchingTaskPool.IsEmpty() == false)
     {
-        task();
+        m_dispatchingTaskPool.Front()();
+        m_dispatchingTaskPool.PopFront();
     }
-    
-    m_taskPool.clear();
 }
 
 ConcurrentDispatchQueue::ConcurrentDispatchQueue(int32_t threadPoolCount) :
@@ -91,38 +84,18 @@ ConcurrentDispatchQueue::~ConcurrentDispatchQueue()
     }
 }
     
-void ConcurrentDispatchQueue::AddAsyncTask(const Delegate<void()>& task)
-{
-    std::lock_guard lock(m_mutex);
-
-    m_taskPool.push_back(task);
-    m_cv.notify_one();
-}
-
-void ConcurrentDispatchQueue::AddAsyncTask(Delegate<void()>&& task)
+void ConcurrentDispatchQueue::AddAsyncTask(Task task)
 {
     std::lock_guard lock(m_mutex);
     
-    m_taskPool.push_back(std::move(task));
+    this->PushTask(std::move(task));
     m_cv.notify_one();
 }
-    
-void ConcurrentDispatchQueue::AddSyncTask(const Delegate<void()>& task)
-{
-    bool isTaskExecuted = false;
-    this->AddAsyncTask([&isTaskExecuted, &task]()
-    {
-        task();
-        isTaskExecuted = true;
-    });
-    
-    while (isTaskExecuted == false);
-}
 
-void ConcurrentDispatchQueue::AddSyncTask(Delegate<void()>&& task)
+void ConcurrentDispatchQueue::AddSyncTask(Task task)
 {
     bool isTaskExecuted = false;
-    this->AddAsyncTask([&isTaskExecuted, task = std::move(task)]()
+    this->AddAsyncTask([&isTaskExecuted, &task]()
     {
         task();
         isTaskExecuted = true;
@@ -138,19 +111,21 @@ void ConcurrentDispatchQueue::DispatchQueueHandler()
     while (m_needToDestroy == false)
     {
         m_cv.wait(lock, [this]() {
-            return (m_taskPool.size() > 0) || m_needToDestroy;
+            return (m_taskPool.IsEmpty() == false) || m_needToDestroy;
         });
 
-        if ((m_taskPool.size() <= 0) || m_needToDestroy)
+        if (m_taskPool.IsEmpty() || m_needToDestroy)
         {
             continue;
         }
         
-        auto task = std::move(m_taskPool.front());
-        m_taskPool.pop_front();
+        auto task = std::move(m_taskPool.Front());
+        m_taskPool.PopFront();
         
         lock.unlock();
         {
+            // The scratch memory which the task leaves behind is given back before the next task.
+            ScratchScope scratchScope;
             task();
         }
         lock.lock();
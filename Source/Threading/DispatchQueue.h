@@ -1,11 +1,11 @@
 #pragma once
 
-#include <deque>
 #include <vector>
 #include <mutex>
 
-#include "Core/Delegate.h"
+#include "Core/InplaceDelegate.h"
 #include "Core/NonCopyable.h"
+#include "Core/RingBuffer.h"
 
 #include "Thread.h"
 
@@ -15,22 +15,36 @@ namespace tg
 class DispatchQueue :
     private NonCopyable
 {
+/**@section Type */
+public:
+    /**
+     * @brief   The task which is stored in the queue without allocation. The capacity holds a std::string and a
+     *          std::shared_ptr in the debug builds of every standard library.
+     */
+    using Task = InplaceDelegate<void(), 64>;
+
 /**@section Destructor */
 public:
     virtual ~DispatchQueue() = default;
     
 /**@section Method */
 public:
-    virtual void AddAsyncTask(const Delegate<void()>& task) = 0;
-    virtual void AddAsyncTask(Delegate<void()>&& task) = 0;
-    virtual void AddSyncTask(const Delegate<void()>& task) = 0;
-    virtual void AddSyncTask(Delegate<void()>&& task) = 0;
+    virtual void AddAsyncTask(Task task) = 0;
+    virtual void AddSyncTask(Task task) = 0;
     void Dispatch();
-    
+
+protected:
+    /**
+     * @brief   Adds the task to the pool. The mutex must be locked by the caller.
+     */
+    void PushTask(Task&& task);
+
 /**@section Variable */
 protected:
+    static constexpr size_t InitialTaskPoolCapacity = 64;
+
     std::mutex m_mutex;
-    std::deque<Delegate<void()>> m_taskPool;
+    RingBuffer<Task> m_taskPool;
 };
     
 class SerialDispatchQueue final :
@@ -38,11 +52,14 @@ class SerialDispatchQueue final :
 {
 /**@section Method */
 public:
-    void AddAsyncTask(const Delegate<void()>& task) override;
-    void AddAsyncTask(Delegate<void()>&& task) override;
-    void AddSyncTask(const Delegate<void()>& task) override;
-    void AddSyncTask(Delegate<void()>&& task) override;
+    void AddAsyncTask(Task task) override;
+    void AddSyncTask(Task task) override;
     void Dispatch();
+
+/**@section Variable */
+private:
+    // The tasks are swapped into here to run them without holding the lock. Both pools keep their capacity.
+    RingBuffer<Task> m_dispatchingTaskPool;
 };
 
 class ConcurrentDispatchQueue final :
@@ -58,10 +75,8 @@ public:
 
 /**@section Method */
 public:
-    void AddAsyncTask(const Delegate<void()>& task) override;
-    void AddAsyncTask(Delegate<void()>&& task) override;
-    void AddSyncTask(const Delegate<void()>& task) override;
-    void AddSyncTask(Delegate<void()>&& task) override;
+    void AddAsyncTask(Task task) override;
+    void AddSyncTask(Task task) override;
     
 private:
     void DispatchQueueHandler();
@@ -66,10 +66,7 @@ void Timer::Update()
     const auto currentTime = Environment::GetTickCount();
     if ((currentTime - m_prevTime) > m_interval)
     {
-        if (OnTimeElapsed != nullptr)
-        {
-            OnTimeElapsed();
-        }
+        OnTimeElapsed.Publish({});
 
         if (m_isAutoReset)
         {
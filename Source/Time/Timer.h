@@ -2,11 +2,13 @@
 
 #include <cstdint>
 
-#include "Core/DelegateChain.h"
+#include "Core/EventBus.h"
 
 namespace tg
 {
-    
+
+struct TimerElapsedEvent final {};
+
 class Timer final
 {
 /**@section Constructor */
@@ -58,7 +60,7 @@ public:
     /**
      * @brief   Occurs when the interval elapses.
      */
-    DelegateChain<void()> OnTimeElapsed;
+    EventChannel<TimerElapsedEvent> OnTimeElapsed;
     
 /**@section Variable */
 private: